@@ -153,7 +153,7 @@ private:
         const avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status status,
         const avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::ChangedReason reason) override;
 
-    void receive(const std::string& contextId, const std::string& message) override;
+    void receive(const std::string& contextId, std::shared_ptr<const std::string> message) override;
 
     /// Mutex to serialize access to @c m_isEnabled
     std::mutex m_isEnabledMutex;
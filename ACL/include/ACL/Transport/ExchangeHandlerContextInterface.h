@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 
+#include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
 
@@ -47,8 +48,16 @@ public:
 
     /**
      * Notification that an @c MessageRequest has been sent.
+     *
+     * @param priority The priority of the @c MessageRequest.
      */
-    virtual void onMessageRequestSent() = 0;
+    virtual void onMessageRequestSent(avsCommon::avs::MessageRequest::Priority priority) = 0;
+
+    /**
+     * Notification that a @c MessageRequest which has been sent is no longer waiting for a stream, because its stream
+     * has been opened or it has failed.  Until then, the connection has no stream free for another request.
+     */
+    virtual void onMessageRequestStreamOpened() = 0;
 
     /**
      * Notification that sending a message request timed out.
@@ -57,9 +66,11 @@ public:
 
     /**
      * Notification that sending a @c MessageRequest has failed or been acknowledged by AVS
-     * (this is used to indicate it is okay to send the next message).
+     * (this is used to indicate it is okay to send the next message of the same priority).
+     *
+     * @param priority The priority of the @c MessageRequest.
      */
-    virtual void onMessageRequestAcknowledged() = 0;
+    virtual void onMessageRequestAcknowledged(avsCommon::avs::MessageRequest::Priority priority) = 0;
 
     /**
      * Notification tht a message request has finished it's exchange with AVS.
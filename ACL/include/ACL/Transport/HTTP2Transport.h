@@ -67,6 +67,10 @@ public:
 
         /// The elapsed time without any activity before sending out a ping.
         std::chrono::seconds inactivityTimeout;
+
+        /// The maximum number of streams to have open at once, including the downchannel and ping streams.  Fewer
+        /// are opened if the server's SETTINGS_MAX_CONCURRENT_STREAMS is lower.
+        unsigned int maxConcurrentStreams;
     };
 
     /**
@@ -156,9 +160,10 @@ public:
     /// @{
     void onDownchannelConnected() override;
     void onDownchannelFinished() override;
-    void onMessageRequestSent() override;
+    void onMessageRequestSent(avsCommon::avs::MessageRequest::Priority priority) override;
+    void onMessageRequestStreamOpened() override;
     void onMessageRequestTimeout() override;
-    void onMessageRequestAcknowledged() override;
+    void onMessageRequestAcknowledged(avsCommon::avs::MessageRequest::Priority priority) override;
     void onMessageRequestFinished() override;
     void onPingRequestAcknowledged(bool success) override;
     void onPingTimeout() override;
@@ -426,6 +431,9 @@ private:
     /// The number of message handlers that are not finished with their request.
     int m_countOfUnfinishedMessageHandlers;
 
+    /// The number of message handlers whose request is waiting for a stream.
+    int m_countOfMessageHandlersAwaitingStream;
+
     /// The current ping handler (if any).
     std::shared_ptr<PingHandler> m_pingHandler;
 
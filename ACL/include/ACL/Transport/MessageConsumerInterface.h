@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGECONSUMERINTERFACE_H_
 
 #include <memory>
+#include <string>
 
 namespace alexaClientSDK {
 namespace acl {
@@ -35,9 +36,10 @@ public:
      * Called when a message has been received from AVS.
      *
      * @param contextId The context id for the current message.
-     * @param message The AVS message in string representation.
+     * @param message The AVS message in string representation.  The buffer is immutable and is shared, rather than
+     *     copied, by everything the message is passed on to.
      */
-    virtual void consumeMessage(const std::string& contextId, const std::string& message) = 0;
+    virtual void consumeMessage(const std::string& contextId, std::shared_ptr<const std::string> message) = 0;
 };
 
 }  // namespace acl
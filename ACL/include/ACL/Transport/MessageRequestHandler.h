@@ -67,6 +67,12 @@ public:
         std::shared_ptr<avsCommon::sdkInterfaces::EventTracerInterface> eventTracer = nullptr);
 
 private:
+    /**
+     * Resumes the request once the attachment being sent has data again, after @c onSendMimePartData() paused it
+     * because the attachment was empty.
+     */
+    class DataWaiter;
+
     /**
      * Constructor.
      *
@@ -81,6 +87,11 @@ private:
         std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest,
         std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
 
+    /**
+     * Notify the associated HTTP2Transport instance that the message request is no longer waiting for a stream.
+     */
+    void reportMessageRequestStreamOpened();
+
     /**
      * Notify the associated HTTP2Transport instance that the message request failed or was acknowledged by AVS.
      */
@@ -127,6 +138,9 @@ private:
     /// The metric recorder.
     std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
+    /// Whether the opening of the stream of the @c MessageRequest was reported.
+    bool m_wasMessageRequestStreamOpenedReported;
+
     /// Whether acknowledge of the @c MessageRequest was reported.
     bool m_wasMessageRequestAcknowledgeReported;
 
@@ -135,6 +149,9 @@ private:
 
     /// Response code received through @c onReceiveResponseCode (or zero).
     long m_responseCode;
+
+    /// Resumes the request when the attachment being sent has data again.
+    std::shared_ptr<DataWaiter> m_dataWaiter;
 };
 
 }  // namespace acl
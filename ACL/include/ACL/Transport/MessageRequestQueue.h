@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
 
 #include <deque>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -30,7 +31,7 @@ namespace alexaClientSDK {
 namespace acl {
 
 /**
- * Class to manage @c MessageRequest send queues in HTTP2Transport.
+ * Class to manage @c MessageRequest send queues in HTTP2Transport, with a lane per @c MessageRequest::Priority.
  *
  * Note: This class is not thread safe. The user should ensure thread safety.
  */
@@ -63,22 +64,55 @@ public:
 
     /// Override MessageRequestQueueInterface methods
     /// @{
-    void enqueueRequest(std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> enqueueRequest(
+        std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) override;
     avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> peekRequestTime() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest() override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority) override;
     bool isMessageRequestAvailable() const override;
-    void setWaitingFlagForQueue() override;
+    bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const override;
+    avsCommon::utils::Optional<avsCommon::avs::MessageRequest::Deadline> peekEarliestDeadline() const override;
+    std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> removeExpiredRequests(
+        avsCommon::avs::MessageRequest::Deadline now) override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueOldestRequest() override;
+    void setWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) override;
+    void clearWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) override;
     void clearWaitingFlagForQueue() override;
     bool empty() const override;
+    size_t size() const override;
     void clear() override;
     /// @}
 
 private:
+    /**
+     * Dequeue the first @c MessageRequest of a lane.
+     *
+     * @param lane The lane, which must not be empty.
+     * @return The first @c MessageRequest of the lane.
+     */
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueFrom(MessageRequestQueueStruct& lane);
+
+    /**
+     * Update the counts of the @c MessageRequests present for one which has been removed.
+     *
+     * @param messageRequest The @c MessageRequest which has been removed.
+     */
+    void onRequestRemoved(const std::shared_ptr<avsCommon::avs::MessageRequest>& messageRequest);
+
     /// Member to keep track of the current @c MessageRequests present.
-    int m_size;
+    size_t m_size;
+
+    /// The number of @c MessageRequests present which have a deadline, so that the queue is only searched for
+    /// deadlines when there are some.
+    size_t m_countOfRequestsWithDeadline;
+
+    /// The number of @c MessageRequests present which have a coalescing key, so that the queue is only searched for a
+    /// request to supersede when there may be one.
+    size_t m_countOfRequestsWithCoalescingKey;
 
-    /// The struct that contains the message queue
-    MessageRequestQueueStruct m_sendQueue;
+    /// The lanes of the queue.  The map is ordered so that the lane of the highest priority comes first.
+    std::map<avsCommon::avs::MessageRequest::Priority, MessageRequestQueueStruct> m_sendQueues;
 };
 
 }  // namespace acl
@@ -20,6 +20,7 @@
 #include <deque>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/Optional.h>
@@ -30,6 +31,15 @@ namespace acl {
 /**
  * An interface that abstracts the operations of a @c MessageRequestQueuesMap between the standard version
  * and the synchronized implementation.
+ *
+ * Requests are kept in a lane per @c MessageRequest::Priority.  Each lane is sent in the order it was enqueued, and
+ * waits for a response to the request it sent last; a lane of higher priority is sent first, and does not wait for
+ * lanes of lower priority.  The longer the first request of a lane has been queued, the higher the priority it is sent
+ * at, so that it is not held back forever by lanes of higher priority; it is never sent ahead of a
+ * @c MessageRequest::Priority::HIGH request, though.
+ *
+ * A request with a coalescing key replaces any queued request with the same key, and is queued after the requests
+ * enqueued before it, so that the state it reports is not overwritten by an older report.
  */
 class MessageRequestQueueInterface {
 public:
@@ -39,28 +49,49 @@ public:
     virtual ~MessageRequestQueueInterface() = default;
 
     /**
-     * Enqueues the @c MessageRequest to the corresponding send queue based on the send queue type.
-     * If send queue type is not present, a new queue is created before enqueuing the request.
+     * Enqueues the @c MessageRequest to the lane of its priority.  If it has a coalescing key, any queued request with
+     * the same key is removed, as the new request supersedes it.
+     *
+     * @param messageRequest The @c MessageRequest to enqueue.
+     * @return The queued @c MessageRequest which @c messageRequest superseded, which the caller must complete, or
+     * nullptr if there was none.
      */
-    virtual void enqueueRequest(std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) = 0;
+    virtual std::shared_ptr<avsCommon::avs::MessageRequest> enqueueRequest(
+        std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) = 0;
 
     /**
-     * Peek at the next item in the queue and retrieve the time that the request was queued.
+     * Peek at the oldest request in the queue and retrieve the time that the request was queued.
      *
-     * @return The time that the next request (if any) was queued.
+     * @return The time that the oldest request (if any) was queued.
      */
     virtual avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> peekRequestTime() = 0;
 
     /**
-     * Dequeues the next available @c MessageRequest by taking into account if the queue is waiting for
-     * a response. This method keeps track of the queue being processed and once a request from the queue
-     * is dequeued moves it to the next queue. It also loops back to the starting queue at the end and exits
-     * the loop if a valid MessageRequest is found or if it reaches the place it started.
+     * Dequeues the next @c MessageRequest to send of any priority, as @c dequeueRequest(lowestPriority) does.  If
+     * every lane is waiting for a response, the first request of the highest priority lane is dequeued.
      *
      * @return @c MessageRequest if an available, else return nullptr.
      */
     virtual std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest() = 0;
 
+    /**
+     * Dequeues the next @c MessageRequest to send from the lanes which are not waiting for a response and whose
+     * priority is at least @c lowestPriority.  Of those, the lane whose first request has the highest priority after
+     * aging is chosen.
+     *
+     * @param lowestPriority The lowest priority which may be sent.
+     * @return The next @c MessageRequest to send, or nullptr if there is none.
+     */
+    virtual std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority) = 0;
+
+    /**
+     * Dequeues the oldest @c MessageRequest in any lane, which is the one whose time @c peekRequestTime() returns.
+     *
+     * @return The oldest @c MessageRequest, or nullptr if the queue is empty.
+     */
+    virtual std::shared_ptr<avsCommon::avs::MessageRequest> dequeueOldestRequest() = 0;
+
     /**
      * This method checks if there is a @c MessageRequest available to be sent.
      *
@@ -69,16 +100,45 @@ public:
     virtual bool isMessageRequestAvailable() const = 0;
 
     /**
-     * Sets the waiting flag for the queue specified by the given send queue type.
+     * This method checks if there is a @c MessageRequest available to be sent, of at least the given priority.
+     *
+     * @param lowestPriority The lowest priority which may be sent.
+     * @return true if @c MessageRequest is available to be sent, else false.
+     */
+    virtual bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const = 0;
+
+    /**
+     * Get the earliest deadline of the queued @c MessageRequests.
      *
-     * @param sendQueueType the send queue type of the queue to set the waiting flag on.
+     * @return The earliest deadline, if any queued @c MessageRequest has one.
      */
-    virtual void setWaitingFlagForQueue() = 0;
+    virtual avsCommon::utils::Optional<avsCommon::avs::MessageRequest::Deadline> peekEarliestDeadline() const = 0;
 
     /**
-     * Clear the waiting flag for the queue specified by the given send queue type.
+     * Remove the @c MessageRequests whose deadline has passed.
      *
-     * @param sendQueueType the send queue type of the queue to clear the waiting flag on.
+     * @param now The current time.
+     * @return The @c MessageRequests removed, which the caller must complete.
+     */
+    virtual std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> removeExpiredRequests(
+        avsCommon::avs::MessageRequest::Deadline now) = 0;
+
+    /**
+     * Sets the waiting flag for the lane of the given priority.
+     *
+     * @param priority The priority of the lane to set the waiting flag on.
+     */
+    virtual void setWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) = 0;
+
+    /**
+     * Clear the waiting flag for the lane of the given priority.
+     *
+     * @param priority The priority of the lane to clear the waiting flag on.
+     */
+    virtual void clearWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) = 0;
+
+    /**
+     * Clear the waiting flags of all the lanes.
      */
     virtual void clearWaitingFlagForQueue() = 0;
 
@@ -89,6 +149,13 @@ public:
      */
     virtual bool empty() const = 0;
 
+    /**
+     * Get the number of @c MessageRequests in all the lanes.
+     *
+     * @return The number of @c MessageRequests queued.
+     */
+    virtual size_t size() const = 0;
+
     /**
      * Clears all the @c MessageRequests along with the corresponding queues.
      */
@@ -25,6 +25,7 @@
 
 #include <AVSCommon/AVS/Attachment/AttachmentManager.h>
 #include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 
 #include "AVSCommon/SDKInterfaces/AuthDelegateInterface.h"
 #include "ACL/Transport/MessageConsumerInterface.h"
@@ -58,12 +59,14 @@ public:
      * @param avsGateway The gateway to connect to AVS. The value will be set by the @c AVSGatewayManager based on
      * either the previously verified gateway or a value from the config file. If both are not present, a default value
      * is used.
+     * @param metricRecorder The metric recorder, which records how many messages are superseded while queued.
      */
     MessageRouter(
         std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager,
         std::shared_ptr<TransportFactoryInterface> transportFactory,
-        const std::string& avsGateway = "");
+        const std::string& avsGateway = "",
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
 
     /// @name MessageRouterInterface methods.
     /// @{
@@ -86,7 +89,7 @@ public:
 
     void onServerSideDisconnect(std::shared_ptr<TransportInterface> transport) override;
 
-    void consumeMessage(const std::string& contextId, const std::string& message) override;
+    void consumeMessage(const std::string& contextId, std::shared_ptr<const std::string> message) override;
 
     void doShutdown() override;
 
@@ -126,7 +129,7 @@ private:
      * @param contextId The context id for the current message.
      * @param message The AVS message in string representation.
      */
-    void notifyObserverOnReceive(const std::string& contextId, const std::string& message);
+    void notifyObserverOnReceive(const std::string& contextId, std::shared_ptr<const std::string> message);
 
     /**
      * Creates a new transport, and begins the connection process. The new transport immediately becomes the active
@@ -205,6 +208,9 @@ private:
     /// The synchonized queue of messages to send that is shared between transports.
     std::shared_ptr<SynchronizedMessageRequestQueue> m_requestQueue;
 
+    /// The metric recorder.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
 protected:
     /**
      * Executor to perform asynchronous operations:
@@ -50,9 +50,9 @@ private:
      * This function will be called when a Message arrives from AVS.
      *
      * @param contextId The contextId of the AVS message, which is used when acquiring attachments.
-     * @param message The AVS message that has been received.
+     * @param message The AVS message that has been received, in an immutable buffer shared with other recipients.
      */
-    virtual void receive(const std::string& contextId, const std::string& message) = 0;
+    virtual void receive(const std::string& contextId, std::shared_ptr<const std::string> message) = 0;
 
     /// The friend declaration.
     friend class MessageRouter;
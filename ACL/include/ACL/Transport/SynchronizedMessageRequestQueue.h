@@ -45,13 +45,23 @@ public:
 
     /// Override MessageRequestQueueInterface methods
     /// @{
-    void enqueueRequest(std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> enqueueRequest(
+        std::shared_ptr<avsCommon::avs::MessageRequest> messageRequest) override;
     avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> peekRequestTime() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest() override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority) override;
     bool isMessageRequestAvailable() const override;
-    void setWaitingFlagForQueue() override;
+    bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const override;
+    avsCommon::utils::Optional<avsCommon::avs::MessageRequest::Deadline> peekEarliestDeadline() const override;
+    std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> removeExpiredRequests(
+        avsCommon::avs::MessageRequest::Deadline now) override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueOldestRequest() override;
+    void setWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) override;
+    void clearWaitingFlagForQueue(avsCommon::avs::MessageRequest::Priority priority) override;
     void clearWaitingFlagForQueue() override;
     bool empty() const override;
+    size_t size() const override;
     void clear() override;
     /// @}
 
@@ -197,7 +197,7 @@ void AVSConnectionManager::onConnectionStatusChanged(
     updateConnectionStatus(status, reason);
 }
 
-void AVSConnectionManager::receive(const std::string& contextId, const std::string& message) {
+void AVSConnectionManager::receive(const std::string& contextId, std::shared_ptr<const std::string> message) {
     std::unique_lock<std::mutex> lock{m_messageObserverMutex};
     std::unordered_set<std::shared_ptr<avsCommon::sdkInterfaces::MessageObserverInterface>> observers{
         m_messageObservers};
@@ -17,11 +17,16 @@
 #include <chrono>
 #include <functional>
 #include <random>
+#include <sstream>
+#include <vector>
 
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/Timing/TimeUtils.h>
 #include <ACL/Transport/PostConnectInterface.h>
 
@@ -39,6 +44,7 @@ using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::avs;
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::metrics;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("HTTP2Transport");
@@ -50,12 +56,28 @@ static const std::string TAG("HTTP2Transport");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// The maximum number of streams we can have active at once.  Please see here for more information:
-/// https://developer.amazon.com/public/solutions/alexa/alexa-voice-service/docs/managing-an-http-2-connection
-static const int MAX_STREAMS = 10;
+/// The default maximum number of streams we can have active at once.  The connection also holds back streams beyond
+/// the SETTINGS_MAX_CONCURRENT_STREAMS of the server, so this only needs to bound the resources used by a flood of
+/// events.  It is the smallest limit a server should advertise, as recommended by RFC 7540.
+static const unsigned int DEFAULT_MAX_CONCURRENT_STREAMS = 100;
 
-/// Max number of message requests MAX_STREAMS - 2 (for the downchannel stream and the ping stream)
-static const int MAX_MESSAGE_HANDLERS = MAX_STREAMS - 2;
+/// The number of streams which are not used for message requests: the downchannel stream and the ping stream.
+static const unsigned int COUNT_OF_NON_MESSAGE_STREAMS = 2;
+
+/// Prefix used to identify metrics published by this module.
+static const std::string ACL_METRIC_SOURCE_PREFIX = "ACL-";
+
+/// Metric activity name of sending a message request.
+static const std::string SEND_MESSAGE_REQUEST = "SEND_MESSAGE_REQUEST";
+
+/// Metric data point of the number of message requests left in the queue when one is sent.
+static const std::string QUEUE_DEPTH = "QUEUE_DEPTH";
+
+/// Metric data point of the number of message request streams in flight when one is sent.
+static const std::string IN_FLIGHT_STREAMS = "IN_FLIGHT_STREAMS";
+
+/// Metric data point of the priority of a message request sent.
+static const std::string PRIORITY = "PRIORITY";
 
 /// Timeout to send a ping to AVS if there has not been any other acitivity on the connection.
 static std::chrono::minutes INACTIVITY_TIMEOUT{5};
@@ -94,7 +116,66 @@ std::ostream& operator<<(std::ostream& stream, HTTP2Transport::State state) {
     return stream << "";
 }
 
-HTTP2Transport::Configuration::Configuration() : inactivityTimeout{INACTIVITY_TIMEOUT} {
+HTTP2Transport::Configuration::Configuration() :
+        inactivityTimeout{INACTIVITY_TIMEOUT},
+        maxConcurrentStreams{DEFAULT_MAX_CONCURRENT_STREAMS} {
+}
+
+/**
+ * Record the metric of sending a message request.
+ *
+ * @param metricRecorder The metric recorder.
+ * @param priority The priority of the message request.
+ * @param queueDepth The number of message requests left in the queue.
+ * @param inFlightStreams The number of message request streams in flight before this one.
+ */
+static void collectSendMessageRequestMetric(
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
+    MessageRequest::Priority priority,
+    size_t queueDepth,
+    int inFlightStreams) {
+    std::stringstream priorityString;
+    priorityString << priority;
+    recordMetric(
+        metricRecorder,
+        MetricEventBuilder{}
+            .setActivityName(ACL_METRIC_SOURCE_PREFIX + SEND_MESSAGE_REQUEST)
+            .addDataPoint(DataPointCounterBuilder{}.setName(QUEUE_DEPTH).increment(queueDepth).build())
+            .addDataPoint(DataPointCounterBuilder{}.setName(IN_FLIGHT_STREAMS).increment(inFlightStreams).build())
+            .addDataPoint(DataPointStringBuilder{}.setName(PRIORITY).setValue(priorityString.str()).build())
+            .build());
+}
+
+/**
+ * Get the lowest priority of @c MessageRequest which may be sent, so that streams are kept for requests of higher
+ * priority: the last stream is kept for @c HIGH, and half of them for @c NORMAL and @c HIGH.
+ *
+ * @param countOfUnfinishedMessageHandlers The number of @c MessageRequests being sent.
+ * @param maxMessageHandlers The number of @c MessageRequests which may be sent at once.
+ * @return The lowest priority of @c MessageRequest which may be sent.
+ */
+static MessageRequest::Priority getLowestAdmittedPriority(
+    int countOfUnfinishedMessageHandlers,
+    int maxMessageHandlers) {
+    if (countOfUnfinishedMessageHandlers < std::max(1, maxMessageHandlers / 2)) {
+        return MessageRequest::Priority::BACKGROUND;
+    }
+    if (countOfUnfinishedMessageHandlers < std::max(1, maxMessageHandlers - 1)) {
+        return MessageRequest::Priority::NORMAL;
+    }
+    return MessageRequest::Priority::HIGH;
+}
+
+/**
+ * Tell the senders of @c MessageRequests whose deadline passed while they were queued that they were not sent.
+ *
+ * @param expiredRequests The @c MessageRequests whose deadline passed.
+ */
+static void completeExpiredRequests(const std::vector<std::shared_ptr<MessageRequest>>& expiredRequests) {
+    for (auto& request : expiredRequests) {
+        ACSDK_DEBUG5(LX("messageRequestExpired").d("priority", request->getPriority()));
+        request->sendCompleted(MessageRequestObserverInterface::Status::EXPIRED);
+    }
 }
 
 std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
@@ -154,6 +235,13 @@ std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
         return nullptr;
     }
 
+    if (configuration.maxConcurrentStreams <= COUNT_OF_NON_MESSAGE_STREAMS) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "maxConcurrentStreamsTooSmall")
+                        .d("maxConcurrentStreams", configuration.maxConcurrentStreams));
+        return nullptr;
+    }
+
     auto transport = std::shared_ptr<HTTP2Transport>(new HTTP2Transport(
         std::move(authDelegate),
         avsGateway,
@@ -194,6 +282,7 @@ HTTP2Transport::HTTP2Transport(
         m_eventTracer{std::move(eventTracer)},
         m_connectRetryCount{0},
         m_countOfUnfinishedMessageHandlers{0},
+        m_countOfMessageHandlersAwaitingStream{0},
         m_postConnected{false},
         m_configuration{configuration},
         m_disconnectReason{ConnectionStatusObserverInterface::ChangedReason::NONE} {
@@ -315,8 +404,12 @@ void HTTP2Transport::sendPostConnectMessage(std::shared_ptr<MessageRequest> requ
     }
 
     if (allowed) {
-        m_requestQueue.enqueueRequest(request);
+        auto supersededRequest = m_requestQueue.enqueueRequest(request);
         m_wakeEvent.notify_all();
+        if (supersededRequest) {
+            lock.unlock();
+            supersededRequest->sendCompleted(MessageRequestObserverInterface::Status::SUPERSEDED);
+        }
     } else {
         ACSDK_ERROR(LX("enqueueRequestFailed").d("reason", "notInAllowedState").d("m_state", m_state));
         lock.unlock();
@@ -460,11 +553,20 @@ void HTTP2Transport::onDownchannelFinished() {
     }
 }
 
-void HTTP2Transport::onMessageRequestSent() {
+void HTTP2Transport::onMessageRequestSent(MessageRequest::Priority priority) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_sharedRequestQueue->setWaitingFlagForQueue();
+    m_sharedRequestQueue->setWaitingFlagForQueue(priority);
     m_countOfUnfinishedMessageHandlers++;
-    ACSDK_DEBUG7(LX(__func__).d("countOfUnfinishedMessageHandlers", m_countOfUnfinishedMessageHandlers));
+    m_countOfMessageHandlersAwaitingStream++;
+    ACSDK_DEBUG7(LX(__func__)
+                     .d("priority", priority)
+                     .d("countOfUnfinishedMessageHandlers", m_countOfUnfinishedMessageHandlers));
+}
+
+void HTTP2Transport::onMessageRequestStreamOpened() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_countOfMessageHandlersAwaitingStream;
+    m_wakeEvent.notify_all();
 }
 
 void HTTP2Transport::onMessageRequestTimeout() {
@@ -472,10 +574,10 @@ void HTTP2Transport::onMessageRequestTimeout() {
     onWakeVerifyConnectivity();
 }
 
-void HTTP2Transport::onMessageRequestAcknowledged() {
-    ACSDK_DEBUG7(LX(__func__));
+void HTTP2Transport::onMessageRequestAcknowledged(MessageRequest::Priority priority) {
+    ACSDK_DEBUG7(LX(__func__).d("priority", priority));
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_sharedRequestQueue->clearWaitingFlagForQueue();
+    m_sharedRequestQueue->clearWaitingFlagForQueue(priority);
     m_wakeEvent.notify_all();
 }
 
@@ -703,6 +805,12 @@ HTTP2Transport::State HTTP2Transport::monitorSharedQueueWhileWaiting(
     while (true) {
         auto wakeTime = maxWakeTime;
 
+        completeExpiredRequests(m_sharedRequestQueue->removeExpiredRequests(std::chrono::steady_clock::now()));
+        auto earliestDeadline = m_sharedRequestQueue->peekEarliestDeadline();
+        if (earliestDeadline.hasValue()) {
+            wakeTime = std::min(earliestDeadline.value(), wakeTime);
+        }
+
         while (true) {
             auto messageRequestTime = m_sharedRequestQueue->peekRequestTime();
             if (!messageRequestTime.hasValue()) {
@@ -717,15 +825,16 @@ HTTP2Transport::State HTTP2Transport::monitorSharedQueueWhileWaiting(
                 break;
             }
 
-            auto request = m_sharedRequestQueue->dequeueRequest();
+            auto request = m_sharedRequestQueue->dequeueOldestRequest();
             request->sendCompleted(MessageRequestObserverInterface::Status::TIMEDOUT);
         }
 
         auto messageRequestTime = m_sharedRequestQueue->peekRequestTime();
 
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_wakeEvent.wait_until(lock, wakeTime, [this, whileState, messageRequestTime] {
-            return m_state != whileState || m_sharedRequestQueue->peekRequestTime() != messageRequestTime;
+        m_wakeEvent.wait_until(lock, wakeTime, [this, whileState, messageRequestTime, earliestDeadline] {
+            return m_state != whileState || m_sharedRequestQueue->peekRequestTime() != messageRequestTime ||
+                   m_sharedRequestQueue->peekEarliestDeadline() != earliestDeadline;
         });
 
         if (whileState != m_state || std::chrono::steady_clock::now() >= maxWakeTime) {
@@ -741,33 +850,70 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(
 
     std::unique_lock<std::mutex> lock(m_mutex);
 
-    auto canSendMessage = [this, &requestQueue] {
-        return (
-            requestQueue.isMessageRequestAvailable() && (m_countOfUnfinishedMessageHandlers < MAX_MESSAGE_HANDLERS));
+    // A request is not handed to the connection while the last one is still waiting for a stream, which happens when
+    // the server's SETTINGS_MAX_CONCURRENT_STREAMS is reached.  The queue then keeps the requests in priority order,
+    // rather than the connection holding them in the order they were sent.
+    const auto maxMessageHandlers =
+        static_cast<int>(m_configuration.maxConcurrentStreams - COUNT_OF_NON_MESSAGE_STREAMS);
+    auto lowestAdmittedPriority = [this, maxMessageHandlers] {
+        return getLowestAdmittedPriority(m_countOfUnfinishedMessageHandlers, maxMessageHandlers);
+    };
+    auto canSendMessage = [this, &requestQueue, maxMessageHandlers, lowestAdmittedPriority] {
+        return m_countOfUnfinishedMessageHandlers < maxMessageHandlers && 0 == m_countOfMessageHandlersAwaitingStream &&
+               requestQueue.isMessageRequestAvailable(lowestAdmittedPriority());
+    };
+
+    avsCommon::utils::Optional<MessageRequest::Deadline> earliestDeadline;
+    auto hasDeadlineChanged = [&requestQueue, &earliestDeadline] {
+        auto deadline = requestQueue.peekEarliestDeadline();
+        return deadline != earliestDeadline ||
+               (deadline.hasValue() && deadline.value() <= std::chrono::steady_clock::now());
     };
 
-    auto wakePredicate = [this, whileState, canSendMessage] {
-        return whileState != m_state || canSendMessage() ||
+    auto wakePredicate = [this, whileState, canSendMessage, hasDeadlineChanged] {
+        return whileState != m_state || canSendMessage() || hasDeadlineChanged() ||
                (std::chrono::steady_clock::now() > m_timeOfLastActivity + m_configuration.inactivityTimeout);
     };
 
-    auto pingWakePredicate = [this, whileState, canSendMessage] {
-        return whileState != m_state || !m_pingHandler || canSendMessage();
+    auto pingWakePredicate = [this, whileState, canSendMessage, hasDeadlineChanged] {
+        return whileState != m_state || !m_pingHandler || canSendMessage() || hasDeadlineChanged();
     };
 
     while (true) {
+        earliestDeadline = requestQueue.peekEarliestDeadline();
         if (m_pingHandler) {
-            m_wakeEvent.wait(lock, pingWakePredicate);
+            if (earliestDeadline.hasValue()) {
+                m_wakeEvent.wait_until(lock, earliestDeadline.value(), pingWakePredicate);
+            } else {
+                m_wakeEvent.wait(lock, pingWakePredicate);
+            }
         } else {
-            m_wakeEvent.wait_until(lock, m_timeOfLastActivity + m_configuration.inactivityTimeout, wakePredicate);
+            auto wakeTime = m_timeOfLastActivity + m_configuration.inactivityTimeout;
+            if (earliestDeadline.hasValue()) {
+                wakeTime = std::min(wakeTime, earliestDeadline.value());
+            }
+            m_wakeEvent.wait_until(lock, wakeTime, wakePredicate);
         }
 
         if (m_state != whileState) {
             break;
         }
 
+        auto expiredRequests = requestQueue.removeExpiredRequests(std::chrono::steady_clock::now());
+        if (!expiredRequests.empty()) {
+            lock.unlock();
+            completeExpiredRequests(expiredRequests);
+            lock.lock();
+            continue;
+        }
+
         if (canSendMessage()) {
-            auto messageRequest = requestQueue.dequeueRequest();
+            auto messageRequest = requestQueue.dequeueRequest(lowestAdmittedPriority());
+            collectSendMessageRequestMetric(
+                m_metricRecorder,
+                messageRequest->getPriority(),
+                requestQueue.size(),
+                m_countOfUnfinishedMessageHandlers);
 
             lock.unlock();
 
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
@@ -24,6 +25,7 @@
 #include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
 #include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
 #include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+#include <AVSCommon/Utils/Threading/WorkStealingScheduler.h>
 
 #include "ACL/Transport/HTTP2Transport.h"
 #include "ACL/Transport/MimeResponseSink.h"
@@ -64,6 +66,10 @@ static const std::string ATTACHMENT_CONTENT_TYPE = "Content-Type: application/oc
 /// Prefix for the ID of message requests.
 static const std::string MESSAGEREQUEST_ID_PREFIX = "AVSEvent-";
 
+/// HTTP/2 stream weight of @c MessageRequest::Priority::HIGH requests (the default is 16), so that they get most of
+/// the bandwidth of a busy connection.
+static const uint8_t HIGH_PRIORITY_STREAM_WEIGHT = 128;
+
 /// String to identify log entries originating from this file.
 static const std::string TAG("MessageRequestHandler");
 
@@ -85,6 +91,10 @@ static const std::string ERROR_INTERNAL = "INTERNAL_ERROR";
 /// Send completed
 static const std::string SEND_COMPLETED = "SEND_COMPLETED";
 
+/// How long to wait for data from an empty attachment before leaving the request to the connection's retry of paused
+/// streams.  The wait is armed again when the retry finds the attachment still empty.
+static const std::chrono::milliseconds ATTACHMENT_DATA_WAIT_TIMEOUT(100);
+
 /**
  * Create a LogEntry using this file's TAG and the specified event string.
  *
@@ -112,7 +122,118 @@ static void collectSendDataResultMetric(
             .build());
 }
 
+/**
+ * Attachment readers cannot notify that data has arrived, so each time the request is paused on an empty attachment a
+ * job on the shared @c WorkStealingScheduler blocks in @c AttachmentReader::waitForData() and resumes the request when
+ * it returns with data.  That wait cannot be interrupted, so the job owns a reference to this object rather than to the
+ * handler: it outlives the handler by at most @c ATTACHMENT_DATA_WAIT_TIMEOUT, and the handler may be destroyed by the
+ * job when it releases the last reference to the request.
+ */
+class MessageRequestHandler::DataWaiter : public std::enable_shared_from_this<MessageRequestHandler::DataWaiter> {
+public:
+    /**
+     * Constructor.
+     */
+    DataWaiter();
+
+    /**
+     * Set the request to resume.
+     *
+     * @param request The request sending the attachments.
+     */
+    void setRequest(std::shared_ptr<HTTP2RequestInterface> request);
+
+    /**
+     * Resume the request once an attachment has data to read, or is closed.  Does nothing if a wait is already in
+     * progress, as the request is resumed when it ends with data.
+     *
+     * @param reader The reader of the attachment, which was found empty.
+     */
+    void arm(std::shared_ptr<AttachmentReader> reader);
+
+    /**
+     * Stop resuming the request.  A wait in progress ends by its timeout.
+     */
+    void stop();
+
+private:
+    /**
+     * Wait for data from an armed reader, and resume the request if it arrives.  Runs on the scheduler.
+     *
+     * @param reader The reader to wait for.
+     */
+    void waitForData(std::shared_ptr<AttachmentReader> reader);
+
+    /// The scheduler the waits run on.
+    const std::shared_ptr<avsCommon::utils::threading::WorkStealingScheduler> m_scheduler;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The request to resume.
+    std::weak_ptr<HTTP2RequestInterface> m_request;
+
+    /// Whether a wait is scheduled or in progress.
+    bool m_isWaiting;
+
+    /// Whether the request should no longer be resumed.
+    bool m_isStopping;
+};
+
+MessageRequestHandler::DataWaiter::DataWaiter() :
+        m_scheduler{avsCommon::utils::threading::WorkStealingScheduler::getDefaultScheduler()},
+        m_isWaiting{false},
+        m_isStopping{false} {
+}
+
+void MessageRequestHandler::DataWaiter::setRequest(std::shared_ptr<HTTP2RequestInterface> request) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_request = request;
+}
+
+void MessageRequestHandler::DataWaiter::arm(std::shared_ptr<AttachmentReader> reader) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isStopping || m_isWaiting) {
+            return;
+        }
+        m_isWaiting = true;
+    }
+    auto self = shared_from_this();
+    if (!m_scheduler->schedule([self, reader] { self->waitForData(reader); })) {
+        // The connection's retry of paused streams still resumes the request.
+        ACSDK_WARN(LX("armFailed").d("reason", "scheduleFailed"));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isWaiting = false;
+    }
+}
+
+void MessageRequestHandler::DataWaiter::stop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopping = true;
+}
+
+void MessageRequestHandler::DataWaiter::waitForData(std::shared_ptr<AttachmentReader> reader) {
+    auto hasData = reader->waitForData(ATTACHMENT_DATA_WAIT_TIMEOUT);
+    reader.reset();
+
+    std::shared_ptr<HTTP2RequestInterface> request;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isWaiting = false;
+        if (hasData && !m_isStopping) {
+            request = m_request.lock();
+        }
+    }
+
+    if (request) {
+        ACSDK_DEBUG9(LX("resumeOnAttachmentData"));
+        request->resume();
+    }
+}
+
 MessageRequestHandler::~MessageRequestHandler() {
+    m_dataWaiter->stop();
     reportMessageRequestAcknowledged();
     reportMessageRequestFinished();
 }
@@ -154,8 +275,11 @@ std::shared_ptr<MessageRequestHandler> MessageRequestHandler::create(
     cfg.setResponseSink(std::make_shared<HTTP2MimeResponseDecoder>(
         std::make_shared<MimeResponseSink>(handler, messageConsumer, attachmentManager, cfg.getId())));
     cfg.setActivityTimeout(STREAM_PROGRESS_TIMEOUT);
+    if (avsCommon::avs::MessageRequest::Priority::HIGH == messageRequest->getPriority()) {
+        cfg.setPriority(HIGH_PRIORITY_STREAM_WEIGHT);
+    }
 
-    context->onMessageRequestSent();
+    context->onMessageRequestSent(messageRequest->getPriority());
     auto request = context->createAndSendRequest(cfg);
 
     if (!request) {
@@ -165,6 +289,8 @@ std::shared_ptr<MessageRequestHandler> MessageRequestHandler::create(
         return nullptr;
     }
 
+    handler->m_dataWaiter->setRequest(request);
+
     if (eventTracer) {
         eventTracer->traceEvent(messageRequest->getJsonContent());
     }
@@ -184,17 +310,29 @@ MessageRequestHandler::MessageRequestHandler(
         m_countOfJsonBytesLeft{m_json.size()},
         m_countOfPartsSent{0},
         m_metricRecorder{metricRecorder},
+        m_wasMessageRequestStreamOpenedReported{false},
         m_wasMessageRequestAcknowledgeReported{false},
         m_wasMessageRequestFinishedReported{false},
-        m_responseCode{0} {
+        m_responseCode{0},
+        m_dataWaiter{std::make_shared<DataWaiter>()} {
     ACSDK_DEBUG7(LX(__func__).d("context", context.get()).d("messageRequest", messageRequest.get()));
 }
 
+void MessageRequestHandler::reportMessageRequestStreamOpened() {
+    if (!m_wasMessageRequestStreamOpenedReported) {
+        ACSDK_DEBUG7(LX(__func__));
+        m_wasMessageRequestStreamOpenedReported = true;
+        m_context->onMessageRequestStreamOpened();
+    }
+}
+
 void MessageRequestHandler::reportMessageRequestAcknowledged() {
     ACSDK_DEBUG7(LX(__func__));
+    // A request which failed or has been answered is no longer waiting for its stream either.
+    reportMessageRequestStreamOpened();
     if (!m_wasMessageRequestAcknowledgeReported) {
         m_wasMessageRequestAcknowledgeReported = true;
-        m_context->onMessageRequestAcknowledged();
+        m_context->onMessageRequestAcknowledged(m_messageRequest->getPriority());
     }
 }
 
@@ -219,6 +357,9 @@ HTTP2GetMimeHeadersResult MessageRequestHandler::getMimePartHeaderLines() {
 
     m_context->onActivity();
 
+    // The body is only asked for once the request has a stream.
+    reportMessageRequestStreamOpened();
+
     if (0 == m_countOfPartsSent) {
         return HTTP2GetMimeHeadersResult(JSON_MIME_PART_HEADER_LINES);
     } else if (static_cast<int>(m_countOfPartsSent) <= m_messageRequest->attachmentReadersCount()) {
@@ -261,7 +402,14 @@ HTTP2SendDataResult MessageRequestHandler::onSendMimePartData(char* bytes, size_
             case AttachmentReader::ReadStatus::OK:
             case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
             case AttachmentReader::ReadStatus::OK_TIMEDOUT:
-                return bytesRead != 0 ? HTTP2SendDataResult(bytesRead) : HTTP2SendDataResult::PAUSE;
+                if (0 == bytesRead) {
+                    if (AttachmentReader::ReadStatus::OK_WOULDBLOCK == readStatus) {
+                        // Resume as soon as data arrives, rather than when the connection next retries paused streams.
+                        m_dataWaiter->arm(m_namedReader->reader);
+                    }
+                    return HTTP2SendDataResult::PAUSE;
+                }
+                return HTTP2SendDataResult(bytesRead);
 
             case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
                 return HTTP2SendDataResult::ABORT;
@@ -315,6 +463,8 @@ bool MessageRequestHandler::onReceiveResponseCode(long responseCode) {
 void MessageRequestHandler::onResponseFinished(HTTP2ResponseFinishedStatus status, const std::string& nonMimeBody) {
     ACSDK_DEBUG7(LX(__func__).d("status", status).d("responseCode", m_responseCode));
 
+    m_dataWaiter->stop();
+
     if (HTTP2ResponseFinishedStatus::TIMEOUT == status) {
         m_context->onMessageRequestTimeout();
     }
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
@@ -35,7 +37,29 @@ static const std::string EMPTY_QUEUE_NAME = "";
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-MessageRequestQueue::MessageRequestQueue() : m_size{0} {
+/// How long the first request of a lane must be queued to be sent as though its priority were one higher.
+static const std::chrono::seconds AGING_INTERVAL{2};
+
+/**
+ * Get the priority a request is sent at after aging, as the time it would take a request of the highest priority to
+ * age to it.  Lower values are sent first.
+ *
+ * @param priority The priority of the request.
+ * @param age How long the request has been queued.
+ * @return The priority after aging.
+ */
+static std::chrono::steady_clock::duration agedPriority(
+    MessageRequest::Priority priority,
+    std::chrono::steady_clock::duration age) {
+    auto rank = static_cast<int>(priority) * std::chrono::steady_clock::duration(AGING_INTERVAL) - age;
+    // A request never ages past the highest priority, so it is never sent ahead of a request of that priority.
+    return std::max(rank, std::chrono::steady_clock::duration::zero());
+}
+
+MessageRequestQueue::MessageRequestQueue() :
+        m_size{0},
+        m_countOfRequestsWithDeadline{0},
+        m_countOfRequestsWithCoalescingKey{0} {
 }
 
 MessageRequestQueue::~MessageRequestQueue() {
@@ -43,53 +67,194 @@ MessageRequestQueue::~MessageRequestQueue() {
     clear();
 }
 
-void MessageRequestQueue::enqueueRequest(std::shared_ptr<MessageRequest> messageRequest) {
-    if (messageRequest != nullptr) {
-        m_sendQueue.queue.push_back({std::chrono::steady_clock::now(), messageRequest});
-        m_size++;
-    } else {
+std::shared_ptr<MessageRequest> MessageRequestQueue::enqueueRequest(std::shared_ptr<MessageRequest> messageRequest) {
+    if (!messageRequest) {
         ACSDK_ERROR(LX("enqueueRequest").d("reason", "nullMessageRequest"));
+        return nullptr;
+    }
+
+    std::shared_ptr<MessageRequest> supersededRequest;
+    auto coalescingKey = messageRequest->getCoalescingKey();
+    if (!coalescingKey.empty() && m_countOfRequestsWithCoalescingKey > 0) {
+        // There is at most one queued request with the key, as each one queued supersedes the one before it.
+        for (auto lane = m_sendQueues.begin(); lane != m_sendQueues.end() && !supersededRequest; ++lane) {
+            auto& queue = lane->second.queue;
+            for (auto it = queue.begin(); it != queue.end(); ++it) {
+                if (it->second->getCoalescingKey() == coalescingKey) {
+                    supersededRequest = it->second;
+                    queue.erase(it);
+                    onRequestRemoved(supersededRequest);
+                    break;
+                }
+            }
+        }
+    }
+
+    m_sendQueues[messageRequest->getPriority()].queue.push_back({std::chrono::steady_clock::now(), messageRequest});
+    m_size++;
+    if (messageRequest->getDeadline().hasValue()) {
+        m_countOfRequestsWithDeadline++;
     }
+    if (!coalescingKey.empty()) {
+        m_countOfRequestsWithCoalescingKey++;
+    }
+    return supersededRequest;
 }
 
 avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> MessageRequestQueue::peekRequestTime() {
-    if (m_size > 0) {
-        return m_sendQueue.queue.front().first;
+    avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> oldest;
+    for (const auto& lane : m_sendQueues) {
+        if (!lane.second.queue.empty() &&
+            (!oldest.hasValue() || lane.second.queue.front().first < oldest.value())) {
+            oldest = lane.second.queue.front().first;
+        }
     }
-
-    return avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>>();
+    return oldest;
 }
 
 std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueRequest() {
-    std::shared_ptr<MessageRequest> messageRequest;
+    if (isMessageRequestAvailable()) {
+        return dequeueRequest(MessageRequest::Priority::BACKGROUND);
+    }
+    for (auto& lane : m_sendQueues) {
+        if (!lane.second.queue.empty()) {
+            return dequeueFrom(lane.second);
+        }
+    }
+    return nullptr;
+}
 
-    if (m_size > 0) {
-        messageRequest = m_sendQueue.queue.front().second;
-        m_sendQueue.queue.pop_front();
-        m_size--;
+std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueRequest(MessageRequest::Priority lowestPriority) {
+    auto now = std::chrono::steady_clock::now();
+    MessageRequestQueueStruct* nextLane = nullptr;
+    std::chrono::steady_clock::duration nextLanePriority;
+    // The lanes are in order of priority, so of lanes with the same priority after aging, the first is chosen.
+    for (auto& lane : m_sendQueues) {
+        if (lane.first > lowestPriority) {
+            break;
+        }
+        if (lane.second.queue.empty() || lane.second.isQueueWaitingForResponse) {
+            continue;
+        }
+        auto lanePriority = agedPriority(lane.first, now - lane.second.queue.front().first);
+        if (!nextLane || lanePriority < nextLanePriority) {
+            nextLane = &lane.second;
+            nextLanePriority = lanePriority;
+        }
     }
-    return messageRequest;
+    return nextLane ? dequeueFrom(*nextLane) : nullptr;
+}
+
+std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueOldestRequest() {
+    MessageRequestQueueStruct* oldestLane = nullptr;
+    for (auto& lane : m_sendQueues) {
+        if (!lane.second.queue.empty() &&
+            (!oldestLane || lane.second.queue.front().first < oldestLane->queue.front().first)) {
+            oldestLane = &lane.second;
+        }
+    }
+    return oldestLane ? dequeueFrom(*oldestLane) : nullptr;
 }
 
 bool MessageRequestQueue::isMessageRequestAvailable() const {
-    return !m_sendQueue.queue.empty() && !m_sendQueue.isQueueWaitingForResponse;
+    return isMessageRequestAvailable(MessageRequest::Priority::BACKGROUND);
+}
+
+bool MessageRequestQueue::isMessageRequestAvailable(MessageRequest::Priority lowestPriority) const {
+    for (const auto& lane : m_sendQueues) {
+        if (lane.first > lowestPriority) {
+            break;
+        }
+        if (!lane.second.queue.empty() && !lane.second.isQueueWaitingForResponse) {
+            return true;
+        }
+    }
+    return false;
+}
+
+avsCommon::utils::Optional<MessageRequest::Deadline> MessageRequestQueue::peekEarliestDeadline() const {
+    avsCommon::utils::Optional<MessageRequest::Deadline> earliest;
+    if (0 == m_countOfRequestsWithDeadline) {
+        return earliest;
+    }
+    for (const auto& lane : m_sendQueues) {
+        for (const auto& entry : lane.second.queue) {
+            auto deadline = entry.second->getDeadline();
+            if (deadline.hasValue() && (!earliest.hasValue() || deadline.value() < earliest.value())) {
+                earliest = deadline;
+            }
+        }
+    }
+    return earliest;
+}
+
+std::vector<std::shared_ptr<MessageRequest>> MessageRequestQueue::removeExpiredRequests(MessageRequest::Deadline now) {
+    std::vector<std::shared_ptr<MessageRequest>> expired;
+    if (0 == m_countOfRequestsWithDeadline) {
+        return expired;
+    }
+    for (auto& lane : m_sendQueues) {
+        auto& queue = lane.second.queue;
+        for (auto it = queue.begin(); it != queue.end();) {
+            auto deadline = it->second->getDeadline();
+            if (deadline.hasValue() && deadline.value() <= now) {
+                expired.push_back(it->second);
+                it = queue.erase(it);
+                onRequestRemoved(expired.back());
+            } else {
+                ++it;
+            }
+        }
+    }
+    return expired;
+}
+
+void MessageRequestQueue::setWaitingFlagForQueue(MessageRequest::Priority priority) {
+    m_sendQueues[priority].isQueueWaitingForResponse = true;
 }
 
-void MessageRequestQueue::setWaitingFlagForQueue() {
-    m_sendQueue.isQueueWaitingForResponse = true;
+void MessageRequestQueue::clearWaitingFlagForQueue(MessageRequest::Priority priority) {
+    m_sendQueues[priority].isQueueWaitingForResponse = false;
 }
 
 void MessageRequestQueue::clearWaitingFlagForQueue() {
-    m_sendQueue.isQueueWaitingForResponse = false;
+    for (auto& lane : m_sendQueues) {
+        lane.second.isQueueWaitingForResponse = false;
+    }
 }
 
 bool MessageRequestQueue::empty() const {
     return (0 == m_size);
 }
 
+size_t MessageRequestQueue::size() const {
+    return m_size;
+}
+
 void MessageRequestQueue::clear() {
-    m_sendQueue.queue.clear();
+    for (auto& lane : m_sendQueues) {
+        lane.second.queue.clear();
+    }
     m_size = 0;
+    m_countOfRequestsWithDeadline = 0;
+    m_countOfRequestsWithCoalescingKey = 0;
+}
+
+std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueFrom(MessageRequestQueueStruct& lane) {
+    auto messageRequest = lane.queue.front().second;
+    lane.queue.pop_front();
+    onRequestRemoved(messageRequest);
+    return messageRequest;
+}
+
+void MessageRequestQueue::onRequestRemoved(const std::shared_ptr<MessageRequest>& messageRequest) {
+    m_size--;
+    if (messageRequest->getDeadline().hasValue()) {
+        m_countOfRequestsWithDeadline--;
+    }
+    if (!messageRequest->getCoalescingKey().empty()) {
+        m_countOfRequestsWithCoalescingKey--;
+    }
 }
 
 }  // namespace acl
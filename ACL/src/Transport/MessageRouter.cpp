@@ -18,6 +18,9 @@
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointStringBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 
 #include "ACL/Transport/MessageRouter.h"
@@ -29,6 +32,7 @@ using namespace alexaClientSDK::avsCommon::sdkInterfaces;
 using namespace alexaClientSDK::avsCommon::utils;
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::avs;
+using namespace avsCommon::utils::metrics;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("MessageRouter");
@@ -40,11 +44,47 @@ static const std::string TAG("MessageRouter");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Prefix used to identify metrics published by this module.
+static const std::string ACL_METRIC_SOURCE_PREFIX = "ACL-";
+
+/// Metric identifier for a message superseded while it was queued.
+static const std::string MESSAGE_REQUEST_SUPERSEDED = "MESSAGE_REQUEST_SUPERSEDED";
+
+/// Counter of the messages superseded.
+static const std::string SUPERSEDED_COUNT = "SUPERSEDED_COUNT";
+
+/// Coalescing key tag
+static const std::string COALESCING_KEY_TAG = "COALESCING_KEY";
+
+/**
+ * Complete a message which was superseded while it was queued, and record that it was.
+ *
+ * @param metricRecorder The metric recorder object.
+ * @param supersededRequest The message which was superseded.
+ */
+static void completeSupersededRequest(
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
+    const std::shared_ptr<MessageRequest>& supersededRequest) {
+    ACSDK_DEBUG5(LX("messageRequestSuperseded").d("coalescingKey", supersededRequest->getCoalescingKey()));
+    recordMetric(
+        metricRecorder,
+        MetricEventBuilder{}
+            .setActivityName(ACL_METRIC_SOURCE_PREFIX + MESSAGE_REQUEST_SUPERSEDED)
+            .addDataPoint(DataPointCounterBuilder{}.setName(SUPERSEDED_COUNT).increment(1).build())
+            .addDataPoint(DataPointStringBuilder{}
+                              .setName(COALESCING_KEY_TAG)
+                              .setValue(supersededRequest->getCoalescingKey())
+                              .build())
+            .build());
+    supersededRequest->sendCompleted(MessageRequestObserverInterface::Status::SUPERSEDED);
+}
+
 MessageRouter::MessageRouter(
     std::shared_ptr<AuthDelegateInterface> authDelegate,
     std::shared_ptr<AttachmentManager> attachmentManager,
     std::shared_ptr<TransportFactoryInterface> transportFactory,
-    const std::string& avsGateway) :
+    const std::string& avsGateway,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder) :
         MessageRouterInterface{"MessageRouter"},
         m_avsGateway{avsGateway},
         m_authDelegate{authDelegate},
@@ -53,7 +93,8 @@ MessageRouter::MessageRouter(
         m_isEnabled{false},
         m_attachmentManager{attachmentManager},
         m_transportFactory{transportFactory},
-        m_requestQueue{std::make_shared<SynchronizedMessageRequestQueue>()} {
+        m_requestQueue{std::make_shared<SynchronizedMessageRequestQueue>()},
+        m_metricRecorder{std::move(metricRecorder)} {
 }
 
 MessageRouterInterface::ConnectionStatus MessageRouter::getConnectionStatus() {
@@ -113,8 +154,12 @@ void MessageRouter::sendMessage(std::shared_ptr<MessageRequest> request) {
     }
     std::unique_lock<std::mutex> lock{m_connectionMutex};
     if (m_activeTransport) {
-        m_requestQueue->enqueueRequest(request);
+        auto supersededRequest = m_requestQueue->enqueueRequest(request);
         m_activeTransport->onRequestEnqueued();
+        lock.unlock();
+        if (supersededRequest) {
+            completeSupersededRequest(m_metricRecorder, supersededRequest);
+        }
     } else {
         ACSDK_ERROR(LX("sendFailed").d("reason", "noActiveTransport"));
         request->sendCompleted(MessageRequestObserverInterface::Status::NOT_CONNECTED);
@@ -230,8 +275,8 @@ void MessageRouter::onServerSideDisconnect(std::shared_ptr<TransportInterface> t
     }
 }
 
-void MessageRouter::consumeMessage(const std::string& contextId, const std::string& message) {
-    notifyObserverOnReceive(contextId, message);
+void MessageRouter::consumeMessage(const std::string& contextId, std::shared_ptr<const std::string> message) {
+    notifyObserverOnReceive(contextId, std::move(message));
 }
 
 void MessageRouter::setObserver(std::shared_ptr<MessageRouterObserverInterface> observer) {
@@ -262,7 +307,8 @@ void MessageRouter::notifyObserverOnConnectionStatusChanged(
     m_executor.submit(task);
 }
 
-void MessageRouter::notifyObserverOnReceive(const std::string& contextId, const std::string& message) {
+void MessageRouter::notifyObserverOnReceive(const std::string& contextId, std::shared_ptr<const std::string> message) {
+    // The task shares the message buffer rather than copying it onto the executor.
     auto task = [this, contextId, message]() {
         auto temp = getObserver();
         if (temp) {
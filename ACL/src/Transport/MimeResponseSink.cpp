@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/String/StringUtils.h>
 
 #include "ACL/Transport/MimeResponseSink.h"
 
@@ -34,6 +37,9 @@ static const std::string X_AMZN_REQUESTID_PREFIX = "x-amzn-requestid:";
 /// MIME field name for a part's MIME type
 static const std::string MIME_CONTENT_TYPE_FIELD_NAME = "Content-Type";
 
+/// MIME field name for a part's length
+static const std::string MIME_CONTENT_LENGTH_FIELD_NAME = "Content-Length";
+
 /// MIME field name for a part's reference id
 static const std::string MIME_CONTENT_ID_FIELD_NAME = "Content-ID";
 
@@ -43,6 +49,9 @@ static const std::string MIME_JSON_CONTENT_TYPE = "application/json";
 /// MIME type for binary streams
 static const std::string MIME_OCTET_STREAM_CONTENT_TYPE = "application/octet-stream";
 
+/// Maximum size to preallocate for a directive from the Content-Length of its part, bigger directives grow as received.
+static const int MAX_DIRECTIVE_PREALLOCATION = 256 * 1024;
+
 /// Maximum size of non-mime body to accumulate.
 static const size_t NON_MIME_BODY_MAX_SIZE = 4096;
 
@@ -134,6 +143,13 @@ bool MimeResponseSink::onBeginMimePart(const std::multimap<std::string, std::str
     if (contentType.find(MIME_JSON_CONTENT_TYPE) != std::string::npos) {
         m_contentType = ContentType::JSON;
         ACSDK_DEBUG9(LX("JsonContentDetected"));
+        // Size the buffer up front when the length of the part is known, so that it is not reallocated as it grows.
+        auto lengthIt = headers.find(MIME_CONTENT_LENGTH_FIELD_NAME);
+        int length = 0;
+        if (headers.end() != lengthIt && avsCommon::utils::string::stringToInt(lengthIt->second, &length) &&
+            length > 0) {
+            m_directiveBeingReceived.reserve(std::min(length, MAX_DIRECTIVE_PREALLOCATION));
+        }
     } else if (
         m_attachmentManager && contentType.find(MIME_OCTET_STREAM_CONTENT_TYPE) != std::string::npos &&
         1 == headers.count(MIME_CONTENT_ID_FIELD_NAME)) {
@@ -191,7 +207,9 @@ bool MimeResponseSink::onEndMimePart() {
             }
             // Check there's data to send out, because in a re-drive we may skip a directive that's been seen before.
             if (!m_directiveBeingReceived.empty()) {
-                m_messageConsumer->consumeMessage(m_attachmentContextId, m_directiveBeingReceived);
+                // The buffer is moved into the message rather than copied, and is shared by everything it reaches.
+                m_messageConsumer->consumeMessage(
+                    m_attachmentContextId, std::make_shared<const std::string>(std::move(m_directiveBeingReceived)));
                 m_directiveBeingReceived.clear();
             }
             break;
@@ -38,9 +38,10 @@ SynchronizedMessageRequestQueue::~SynchronizedMessageRequestQueue() {
     clear();
 }
 
-void SynchronizedMessageRequestQueue::enqueueRequest(std::shared_ptr<MessageRequest> messageRequest) {
+std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::enqueueRequest(
+    std::shared_ptr<MessageRequest> messageRequest) {
     std::lock_guard<std::mutex> lock{m_mutex};
-    m_requestQueue.enqueueRequest(std::move(messageRequest));
+    return m_requestQueue.enqueueRequest(std::move(messageRequest));
 }
 
 avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> SynchronizedMessageRequestQueue::
@@ -54,14 +55,46 @@ std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::dequeueRequest(
     return m_requestQueue.dequeueRequest();
 }
 
+std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::dequeueRequest(
+    MessageRequest::Priority lowestPriority) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.dequeueRequest(lowestPriority);
+}
+
+std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::dequeueOldestRequest() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.dequeueOldestRequest();
+}
+
 bool SynchronizedMessageRequestQueue::isMessageRequestAvailable() const {
     std::lock_guard<std::mutex> lock{m_mutex};
     return m_requestQueue.isMessageRequestAvailable();
 }
 
-void SynchronizedMessageRequestQueue::setWaitingFlagForQueue() {
+bool SynchronizedMessageRequestQueue::isMessageRequestAvailable(MessageRequest::Priority lowestPriority) const {
     std::lock_guard<std::mutex> lock{m_mutex};
-    m_requestQueue.setWaitingFlagForQueue();
+    return m_requestQueue.isMessageRequestAvailable(lowestPriority);
+}
+
+avsCommon::utils::Optional<MessageRequest::Deadline> SynchronizedMessageRequestQueue::peekEarliestDeadline() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.peekEarliestDeadline();
+}
+
+std::vector<std::shared_ptr<MessageRequest>> SynchronizedMessageRequestQueue::removeExpiredRequests(
+    MessageRequest::Deadline now) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.removeExpiredRequests(now);
+}
+
+void SynchronizedMessageRequestQueue::setWaitingFlagForQueue(MessageRequest::Priority priority) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_requestQueue.setWaitingFlagForQueue(priority);
+}
+
+void SynchronizedMessageRequestQueue::clearWaitingFlagForQueue(MessageRequest::Priority priority) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_requestQueue.clearWaitingFlagForQueue(priority);
 }
 
 void SynchronizedMessageRequestQueue::clearWaitingFlagForQueue() {
@@ -74,6 +107,11 @@ bool SynchronizedMessageRequestQueue::empty() const {
     return m_requestQueue.empty();
 }
 
+size_t SynchronizedMessageRequestQueue::size() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.size();
+}
+
 void SynchronizedMessageRequestQueue::clear() {
     std::lock_guard<std::mutex> lock{m_mutex};
     m_requestQueue.clear();
@@ -26,6 +26,7 @@
 #include <ACL/Transport/HTTP2Transport.h>
 #include <AVSCommon/AVS/Attachment/AttachmentManager.h>
 #include <AVSCommon/AVS/Attachment/AttachmentUtils.h>
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
 #include <AVSCommon/Utils/PromiseFuturePair.h>
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
@@ -957,9 +958,9 @@ TEST_F(HTTP2TransportTest, test_messageConsumerReceiveDirective) {
 
     EXPECT_CALL(*m_mockMessageConsumer, consumeMessage(_, _))
         .WillRepeatedly(Invoke([&messagesAreConsumed, &consumedMessageCount, &messages](
-                                   const std::string& contextId, const std::string& message) {
+                                   const std::string& contextId, std::shared_ptr<const std::string> message) {
             consumedMessageCount++;
-            messages.push_back(message);
+            messages.push_back(*message);
             if (consumedMessageCount == 2u) {
                 messagesAreConsumed.setValue();
             }
@@ -1206,6 +1207,22 @@ TEST_F(HTTP2TransportTest, testSlow_avsStreamsLimit) {
     // to be sent at one time, forcing HTTP2Transport to queue the requests until some requests complete.
     const unsigned messagesCount = MAX_POST_STREAMS * 2;
 
+    // Setup HTTP2Transport with a limit of MAX_AVS_STREAMS.
+    HTTP2Transport::Configuration cfg;
+    cfg.maxConcurrentStreams = MAX_AVS_STREAMS;
+    m_http2Transport = HTTP2Transport::create(
+        m_mockAuthDelegate,
+        TEST_AVS_GATEWAY_STRING,
+        m_mockHttp2Connection,
+        m_mockMessageConsumer,
+        m_attachmentManager,
+        m_mockTransportObserver,
+        m_mockPostConnectFactory,
+        m_synchronizedMessageRequestQueue,
+        cfg,
+        m_mockMetricRecorder,
+        m_mockEventTracer);
+
     authorizeAndConnect();
 
     m_mockHttp2Connection->setResponseToPOSTRequests(HTTPResponseCode::SUCCESS_OK);
@@ -1226,8 +1243,8 @@ TEST_F(HTTP2TransportTest, testSlow_avsStreamsLimit) {
     // Check that there was a downchannel request sent out.
     ASSERT_NE(m_mockHttp2Connection->getDownchannelRequest(RESPONSE_TIMEOUT), nullptr);
 
-    // Check the messages we sent were limited.
-    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), MAX_POST_STREAMS);
+    // Check the messages we sent were limited.  The last stream is kept for HIGH priority messages.
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), MAX_POST_STREAMS - 1);
 
     unsigned int completed = 0;
     std::shared_ptr<MockHTTP2Request> request;
@@ -1243,7 +1260,196 @@ TEST_F(HTTP2TransportTest, testSlow_avsStreamsLimit) {
     ASSERT_EQ(completed, messagesCount);
 
     // Check that the maximum number of enqueued messages at any time has been limited.
-    ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), MAX_POST_STREAMS);
+    ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), MAX_POST_STREAMS - 1);
+}
+
+/**
+ * Test that a high priority MessageRequest does not wait for responses to normal priority ones, but does wait for the
+ * request sent last to be given a stream.
+ */
+TEST_F(HTTP2TransportTest, test_highPriorityMessageRequestSentAheadOfNormalPriority) {
+    const std::string highPriorityMessage = "high priority message";
+    const unsigned normalPriorityMessagesCount = 3;
+
+    authorizeAndConnect();
+
+    for (unsigned messageNum = 0; messageNum < normalPriorityMessagesCount; messageNum++) {
+        m_synchronizedMessageRequestQueue->enqueueRequest(std::make_shared<MessageRequest>(TEST_MESSAGE, ""));
+        m_http2Transport->onRequestEnqueued();
+    }
+    for (int attempt = 0; attempt < 100 && m_mockHttp2Connection->getPostRequestsNum() < 1; attempt++) {
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    }
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 1u);
+
+    m_synchronizedMessageRequestQueue->enqueueRequest(
+        std::make_shared<MessageRequest>(highPriorityMessage, "", MessageRequest::Priority::HIGH));
+    m_http2Transport->onRequestEnqueued();
+
+    // Give m_http2Transport a chance to misbehave and send a request before the first one has a stream.
+    std::this_thread::sleep_for(SHORT_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 1u);
+
+    // Open the stream of the first request by reading its body, but do not respond to it.
+    ASSERT_NE(m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT), nullptr);
+
+    // The high priority request is sent, while the normal priority ones still wait for the response.
+    for (int attempt = 0; attempt < 100 && m_mockHttp2Connection->getPostRequestsNum() < 2; attempt++) {
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    }
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 2u);
+    auto request = m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(request, nullptr);
+    auto mimeMessage = request->getMimeResponseSink()->getMimePart(0);
+    ASSERT_EQ(highPriorityMessage, std::string(mimeMessage.begin(), mimeMessage.end()));
+
+    std::this_thread::sleep_for(SHORT_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 2u);
+
+    // On disconnect, send CANCELED response for each POST REQUEST.
+    EXPECT_CALL(*m_mockHttp2Connection, disconnect()).WillOnce(Invoke([this]() {
+        while (auto postRequest = m_mockHttp2Connection->dequePostRequest()) {
+            postRequest->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::CANCELLED);
+        }
+    }));
+}
+
+/**
+ * Test that a MessageRequest whose deadline passes while it is queued is completed with EXPIRED rather than sent.
+ */
+TEST_F(HTTP2TransportTest, test_messageRequestExpiresWhileQueued) {
+    authorizeAndConnect();
+
+    // The first request is not given a stream, which holds back the requests after it.
+    m_synchronizedMessageRequestQueue->enqueueRequest(std::make_shared<MessageRequest>(TEST_MESSAGE, ""));
+    m_http2Transport->onRequestEnqueued();
+    for (int attempt = 0; attempt < 100 && m_mockHttp2Connection->getPostRequestsNum() < 1; attempt++) {
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    }
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 1u);
+
+    auto messageReq = std::make_shared<MessageRequest>(
+        TEST_MESSAGE,
+        "",
+        MessageRequest::Priority::BACKGROUND,
+        Optional<MessageRequest::Deadline>(std::chrono::steady_clock::now() + ONE_HUNDRED_MILLISECOND_DELAY));
+    auto messageObserver = std::make_shared<TestMessageRequestObserver>();
+    messageReq->addObserver(messageObserver);
+    m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+    m_http2Transport->onRequestEnqueued();
+
+    ASSERT_TRUE(messageObserver->m_status.waitFor(RESPONSE_TIMEOUT));
+    ASSERT_EQ(messageObserver->m_status.getValue(), MessageRequestObserverInterface::Status::EXPIRED);
+    ASSERT_TRUE(m_synchronizedMessageRequestQueue->empty());
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 1u);
+
+    // On disconnect, send CANCELED response for each POST REQUEST.
+    EXPECT_CALL(*m_mockHttp2Connection, disconnect()).WillOnce(Invoke([this]() {
+        while (auto postRequest = m_mockHttp2Connection->dequePostRequest()) {
+            postRequest->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::CANCELLED);
+        }
+    }));
+}
+
+/**
+ * Load test: while a thousand background events are sent, a Recognize event is sent as @c HIGH priority, and the same
+ * event as @c BACKGROUND priority, which is sent in order with the flood as it would be by a single FIFO queue.  The
+ * time from enqueueing each to its stream opening is printed and recorded; only the order in which they are sent is
+ * asserted, so that the test is stable on loaded build machines.
+ */
+TEST_F(HTTP2TransportTest, testSlow_highPriorityRecognizeDuringBackgroundFlood) {
+    // The number of background events in the flood.
+    const unsigned floodCount = 1000;
+    // The number of background events answered before the Recognize events are sent.
+    const unsigned floodAnsweredBeforeRecognize = 100;
+    // The round trip time simulated for each response.
+    const auto roundTripTime = std::chrono::milliseconds(1);
+    const std::string recognizeHigh = "Recognize HIGH";
+    const std::string recognizeBackground = "Recognize BACKGROUND";
+
+    HTTP2Transport::Configuration cfg;
+    cfg.maxConcurrentStreams = MAX_AVS_STREAMS;
+    m_http2Transport = HTTP2Transport::create(
+        m_mockAuthDelegate,
+        TEST_AVS_GATEWAY_STRING,
+        m_mockHttp2Connection,
+        m_mockMessageConsumer,
+        m_attachmentManager,
+        m_mockTransportObserver,
+        m_mockPostConnectFactory,
+        m_synchronizedMessageRequestQueue,
+        cfg,
+        m_mockMetricRecorder,
+        m_mockEventTracer);
+
+    authorizeAndConnect();
+    ASSERT_NE(m_mockHttp2Connection->getDownchannelRequest(RESPONSE_TIMEOUT), nullptr);
+
+    for (unsigned messageNum = 0; messageNum < floodCount; messageNum++) {
+        m_synchronizedMessageRequestQueue->enqueueRequest(std::make_shared<MessageRequest>(
+            TEST_MESSAGE + std::to_string(messageNum), "", MessageRequest::Priority::BACKGROUND));
+        m_http2Transport->onRequestEnqueued();
+    }
+
+    std::chrono::steady_clock::time_point recognizeEnqueueTime;
+    std::chrono::steady_clock::duration highTimeToStream{0};
+    std::chrono::steady_clock::duration backgroundTimeToStream{0};
+    unsigned highIndex = 0;
+    unsigned backgroundIndex = 0;
+    unsigned answered = 0;
+    auto lastProgress = std::chrono::steady_clock::now();
+    while (answered < floodCount + 2 && std::chrono::steady_clock::now() - lastProgress < RESPONSE_TIMEOUT) {
+        if (floodAnsweredBeforeRecognize == answered && recognizeEnqueueTime.time_since_epoch().count() == 0) {
+            recognizeEnqueueTime = std::chrono::steady_clock::now();
+            m_synchronizedMessageRequestQueue->enqueueRequest(
+                std::make_shared<MessageRequest>(recognizeBackground, "", MessageRequest::Priority::BACKGROUND));
+            m_synchronizedMessageRequestQueue->enqueueRequest(
+                std::make_shared<MessageRequest>(recognizeHigh, "", MessageRequest::Priority::HIGH));
+            m_http2Transport->onRequestEnqueued();
+        }
+
+        auto request = m_mockHttp2Connection->dequePostRequest();
+        if (!request) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        // Reading the body opens the request's stream.
+        std::string body;
+        char buffer[1024];
+        for (bool isBodyRead = false; !isBodyRead;) {
+            auto result = request->getSource()->onSendData(buffer, sizeof(buffer));
+            body.append(buffer, HTTP2SendStatus::CONTINUE == result.status ? result.size : 0);
+            isBodyRead = result.status != HTTP2SendStatus::CONTINUE;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (body.find(recognizeHigh) != std::string::npos) {
+            highTimeToStream = now - recognizeEnqueueTime;
+            highIndex = answered;
+        } else if (body.find(recognizeBackground) != std::string::npos) {
+            backgroundTimeToStream = now - recognizeEnqueueTime;
+            backgroundIndex = answered;
+        }
+
+        std::this_thread::sleep_for(roundTripTime);
+        request->getSink()->onReceiveResponseCode(static_cast<long>(HTTPResponseCode::SUCCESS_NO_CONTENT));
+        request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+        answered++;
+        lastProgress = std::chrono::steady_clock::now();
+    }
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    reportBenchmarkResult("HIGH", "recognizeTimeToStreamMilliseconds", Milliseconds(highTimeToStream).count());
+    reportBenchmarkResult("HIGH", "backgroundEventsSentAheadOfRecognize", highIndex - floodAnsweredBeforeRecognize);
+    reportBenchmarkResult("FIFO", "recognizeTimeToStreamMilliseconds", Milliseconds(backgroundTimeToStream).count());
+    reportBenchmarkResult(
+        "FIFO", "backgroundEventsSentAheadOfRecognize", backgroundIndex - floodAnsweredBeforeRecognize);
+
+    ASSERT_EQ(answered, floodCount + 2);
+    // Only the background events already holding a stream may be sent ahead of the HIGH priority Recognize.
+    ASSERT_LE(highIndex, floodAnsweredBeforeRecognize + MAX_POST_STREAMS);
+    // The background Recognize waits for the rest of the flood.
+    ASSERT_EQ(backgroundIndex, floodCount + 1);
 }
 
 /**
@@ -0,0 +1,286 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file MessageRequestHandlerTest.cpp
+///
+/// Tests how quickly a @c MessageRequestHandler streaming an attachment sends data written to the attachment while its
+/// request is paused, as a Recognize event streams audio.  The request is sent through a @c LibcurlHTTP2Connection in
+/// clear text to a server on the loopback interface, which answers with HTTP/1.1.
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ACL/Transport/ExchangeHandlerContextInterface.h>
+#include <ACL/Transport/MessageRequestHandler.h>
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/SDKInterfaces/MessageRequestObserverInterface.h>
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+#include <AVSCommon/Utils/Common/LoopbackHTTPServer.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2Connection.h>
+
+#include "MockMessageConsumer.h"
+
+namespace alexaClientSDK {
+namespace acl {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::libcurlUtils;
+using namespace std::chrono;
+
+/// How long to wait for something which should happen before giving up.
+static const milliseconds TIMEOUT{5000};
+
+/// The number of chunks sent by the latency test.
+static const size_t LATENCY_CHUNKS = 50;
+
+/// The size of a chunk: 10 ms of 16 kHz 16-bit audio.
+static const size_t CHUNK_SIZE = 320;
+
+/// How long to wait after a chunk arrives before writing the next one, so that the request is paused in between.
+static const milliseconds CHUNK_INTERVAL{3};
+
+/// The median latency from writing a chunk to the chunk arriving which the test requires.  The connection retries
+/// streams which are paused but not resumed after 10 ms, so this is only met when the handler resumes its request as
+/// soon as the attachment has data.
+static const milliseconds MAX_MEDIAN_LATENCY{2};
+
+/// The token the request is authorized with.
+static const std::string AUTH_TOKEN = "authToken";
+
+/// The JSON content of the message.
+static const std::string JSON_CONTENT = "{\"event\":{}}";
+
+/// The name of the attachment of the message.
+static const std::string ATTACHMENT_NAME = "audio";
+
+/// The end of the body of a message request: its closing MIME boundary.
+static const std::string CLOSING_BOUNDARY = "--WhooHooZeerOoonie!--";
+
+/// An @c ExchangeHandlerContextInterface which sends requests through a connection to a fixed gateway.
+class TestExchangeHandlerContext : public ExchangeHandlerContextInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param connection The connection to send requests through.
+     * @param gateway The URL requests are sent to.
+     */
+    TestExchangeHandlerContext(std::shared_ptr<LibcurlHTTP2Connection> connection, const std::string& gateway) :
+            m_connection{connection},
+            m_gateway{gateway} {
+    }
+
+    /// @name ExchangeHandlerContextInterface methods.
+    /// @{
+    void onDownchannelConnected() override {
+    }
+
+    void onDownchannelFinished() override {
+    }
+
+    void onMessageRequestSent(MessageRequest::Priority priority) override {
+    }
+
+    void onMessageRequestStreamOpened() override {
+    }
+
+    void onMessageRequestTimeout() override {
+    }
+
+    void onMessageRequestAcknowledged(MessageRequest::Priority priority) override {
+    }
+
+    void onMessageRequestFinished() override {
+    }
+
+    void onPingRequestAcknowledged(bool success) override {
+    }
+
+    void onPingTimeout() override {
+    }
+
+    void onActivity() override {
+    }
+
+    void onForbidden(const std::string& authToken) override {
+    }
+
+    std::shared_ptr<HTTP2RequestInterface> createAndSendRequest(const HTTP2RequestConfig& cfg) override {
+        return m_connection->createAndSendRequest(cfg);
+    }
+
+    std::string getAVSGateway() override {
+        return m_gateway;
+    }
+    /// @}
+
+private:
+    /// The connection requests are sent through.
+    std::shared_ptr<LibcurlHTTP2Connection> m_connection;
+
+    /// The URL requests are sent to.
+    std::string m_gateway;
+};
+
+/// A @c MessageRequestObserverInterface which reports the status the message was sent with.
+class SendCompletedObserver : public MessageRequestObserverInterface {
+public:
+    /**
+     * Get the status the message was sent with.
+     *
+     * @return A future which is set when the message has been sent.
+     */
+    std::shared_future<Status> getStatus() {
+        return m_status.get_future().share();
+    }
+
+    /// @name MessageRequestObserverInterface methods.
+    /// @{
+    void onSendCompleted(Status status) override {
+        m_status.set_value(status);
+    }
+
+    void onExceptionReceived(const std::string& exceptionMessage) override {
+    }
+    /// @}
+
+private:
+    /// Set when the message has been sent.
+    std::promise<Status> m_status;
+};
+
+class MessageRequestHandlerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+        m_connection = LibcurlHTTP2Connection::create();
+        ASSERT_NE(m_connection, nullptr);
+        m_context = std::make_shared<TestExchangeHandlerContext>(m_connection, m_server.getUrl());
+        m_attachment = std::make_shared<InProcessAttachment>(ATTACHMENT_NAME);
+        m_writer = m_attachment->createWriter(InProcessAttachmentWriter::SDSTypeWriter::Policy::NONBLOCKABLE);
+        ASSERT_NE(m_writer, nullptr);
+        m_messageRequest = std::make_shared<MessageRequest>(JSON_CONTENT);
+        std::shared_ptr<AttachmentReader> reader =
+            m_attachment->createReader(InProcessAttachmentReader::SDSTypeReader::Policy::NONBLOCKING);
+        ASSERT_NE(reader, nullptr);
+        m_messageRequest->addAttachmentReader(ATTACHMENT_NAME, reader);
+        m_observer = std::make_shared<SendCompletedObserver>();
+        m_messageRequest->addObserver(m_observer);
+    }
+
+    void TearDown() override {
+        if (m_connection) {
+            m_connection->disconnect();
+        }
+    }
+
+    /**
+     * Write a chunk to the attachment.
+     *
+     * @param chunk The chunk to write.
+     */
+    void write(const std::string& chunk) {
+        auto status = AttachmentWriter::WriteStatus::OK;
+        ASSERT_EQ(chunk.size(), m_writer->write(chunk.data(), chunk.size(), &status));
+    }
+
+    /// The server receiving the request.
+    LoopbackHTTPServer m_server;
+
+    /// The connection the request is sent through.
+    std::shared_ptr<LibcurlHTTP2Connection> m_connection;
+
+    /// The context of the handler.
+    std::shared_ptr<TestExchangeHandlerContext> m_context;
+
+    /// The attachment streamed with the message, as a Recognize event streams audio.
+    std::shared_ptr<InProcessAttachment> m_attachment;
+
+    /// The writer of the attachment.
+    std::unique_ptr<AttachmentWriter> m_writer;
+
+    /// The message sent.
+    std::shared_ptr<MessageRequest> m_messageRequest;
+
+    /// Observes when the message has been sent.
+    std::shared_ptr<SendCompletedObserver> m_observer;
+};
+
+/// Verify that data written to the attachment of a paused request is sent as soon as it is written, rather than when
+/// paused streams are retried.
+TEST_F(MessageRequestHandlerTest, test_attachmentDataResumesPausedRequest) {
+    auto status = m_observer->getStatus();
+    auto handler = MessageRequestHandler::create(
+        m_context,
+        AUTH_TOKEN,
+        m_messageRequest,
+        std::make_shared<::testing::NiceMock<MockMessageConsumer>>(),
+        std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS),
+        nullptr);
+    ASSERT_NE(handler, nullptr);
+    handler.reset();
+
+    // Wait for the request to reach the attachment, and find it empty.
+    std::string firstChunk(CHUNK_SIZE, '#');
+    write(firstChunk);
+    auto received = m_server.waitForBodyContaining(firstChunk, TIMEOUT);
+    ASSERT_GT(received, 0u);
+
+    steady_clock::time_point arrival;
+    std::vector<microseconds> latencies;
+    for (size_t i = 0; i < LATENCY_CHUNKS; ++i) {
+        std::this_thread::sleep_for(CHUNK_INTERVAL);
+        auto written = steady_clock::now();
+        write(std::string(CHUNK_SIZE, 'a' + i % 26));
+        auto next = m_server.waitForBody(received, TIMEOUT, &arrival);
+        ASSERT_GT(next, received) << "chunk " << i << " did not arrive";
+        received = next;
+        latencies.push_back(duration_cast<microseconds>(arrival - written));
+    }
+    m_writer->close();
+
+    // The loopback server's "100 Continue" is reported as the response code, so only completion is checked.
+    EXPECT_GT(m_server.waitForBodyContaining(CLOSING_BOUNDARY, TIMEOUT), 0u);
+    EXPECT_EQ(std::future_status::ready, status.wait_for(TIMEOUT));
+
+    std::sort(latencies.begin(), latencies.end());
+    auto median = latencies[latencies.size() / 2];
+    reportBenchmarkResult("medianChunkLatencyUs", median.count());
+    reportBenchmarkResult("maxChunkLatencyUs", latencies.back().count());
+    EXPECT_LT(median, MAX_MEDIAN_LATENCY);
+}
+
+}  // namespace test
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
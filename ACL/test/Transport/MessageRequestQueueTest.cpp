@@ -0,0 +1,258 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ACL/Transport/MessageRequestQueue.h>
+
+namespace alexaClientSDK {
+namespace acl {
+namespace transport {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace ::testing;
+
+/**
+ * Create a @c MessageRequest.
+ *
+ * @param priority The priority of the request.
+ * @return The new @c MessageRequest.
+ */
+static std::shared_ptr<MessageRequest> createRequest(MessageRequest::Priority priority) {
+    return std::make_shared<MessageRequest>("{}", "", priority);
+}
+
+/**
+ * Create a @c MessageRequest which must be sent by a deadline.
+ *
+ * @param priority The priority of the request.
+ * @param deadline When the request must be sent by.
+ * @return The new @c MessageRequest.
+ */
+static std::shared_ptr<MessageRequest> createRequest(
+    MessageRequest::Priority priority,
+    MessageRequest::Deadline deadline) {
+    return std::make_shared<MessageRequest>(
+        "{}", "", priority, avsCommon::utils::Optional<MessageRequest::Deadline>(deadline));
+}
+
+/// Test harness for @c MessageRequestQueue class.
+class MessageRequestQueueTest : public Test {
+protected:
+    /// The queue under test.
+    MessageRequestQueue m_queue;
+};
+
+/**
+ * Test that requests are dequeued in order within a priority, and that the highest priority is dequeued first.
+ */
+TEST_F(MessageRequestQueueTest, test_dequeueHighestPriorityFirst) {
+    auto normal1 = createRequest(MessageRequest::Priority::NORMAL);
+    auto normal2 = createRequest(MessageRequest::Priority::NORMAL);
+    auto high = createRequest(MessageRequest::Priority::HIGH);
+    m_queue.enqueueRequest(normal1);
+    m_queue.enqueueRequest(normal2);
+    m_queue.enqueueRequest(high);
+    ASSERT_EQ(m_queue.size(), 3u);
+
+    EXPECT_EQ(m_queue.dequeueRequest(), high);
+    EXPECT_EQ(m_queue.dequeueRequest(), normal1);
+    EXPECT_EQ(m_queue.dequeueRequest(), normal2);
+    EXPECT_EQ(m_queue.dequeueRequest(), nullptr);
+    EXPECT_TRUE(m_queue.empty());
+}
+
+/**
+ * Test that a priority waiting for a response does not hold back the other priorities.
+ */
+TEST_F(MessageRequestQueueTest, test_waitingFlagIsPerPriority) {
+    auto normal = createRequest(MessageRequest::Priority::NORMAL);
+    auto high = createRequest(MessageRequest::Priority::HIGH);
+    m_queue.enqueueRequest(normal);
+    m_queue.enqueueRequest(high);
+
+    m_queue.setWaitingFlagForQueue(MessageRequest::Priority::NORMAL);
+    ASSERT_TRUE(m_queue.isMessageRequestAvailable());
+    EXPECT_EQ(m_queue.dequeueRequest(), high);
+    EXPECT_FALSE(m_queue.isMessageRequestAvailable());
+
+    m_queue.enqueueRequest(high);
+    m_queue.setWaitingFlagForQueue(MessageRequest::Priority::HIGH);
+    m_queue.clearWaitingFlagForQueue(MessageRequest::Priority::NORMAL);
+    ASSERT_TRUE(m_queue.isMessageRequestAvailable());
+    EXPECT_EQ(m_queue.dequeueRequest(), normal);
+
+    // With every priority waiting, the highest priority is still dequeued on request.
+    m_queue.enqueueRequest(normal);
+    m_queue.setWaitingFlagForQueue(MessageRequest::Priority::NORMAL);
+    EXPECT_FALSE(m_queue.isMessageRequestAvailable());
+    EXPECT_EQ(m_queue.dequeueRequest(), high);
+
+    m_queue.clearWaitingFlagForQueue();
+    EXPECT_TRUE(m_queue.isMessageRequestAvailable());
+}
+
+/**
+ * Test that the oldest request is peeked at and dequeued regardless of priority.
+ */
+TEST_F(MessageRequestQueueTest, test_dequeueOldestRequest) {
+    EXPECT_FALSE(m_queue.peekRequestTime().hasValue());
+    EXPECT_EQ(m_queue.dequeueOldestRequest(), nullptr);
+
+    auto normal = createRequest(MessageRequest::Priority::NORMAL);
+    auto high = createRequest(MessageRequest::Priority::HIGH);
+    auto beforeNormal = std::chrono::steady_clock::now();
+    m_queue.enqueueRequest(normal);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto afterNormal = std::chrono::steady_clock::now();
+    m_queue.enqueueRequest(high);
+
+    ASSERT_TRUE(m_queue.peekRequestTime().hasValue());
+    EXPECT_GE(m_queue.peekRequestTime().value(), beforeNormal);
+    EXPECT_LE(m_queue.peekRequestTime().value(), afterNormal);
+    EXPECT_EQ(m_queue.dequeueOldestRequest(), normal);
+    EXPECT_EQ(m_queue.dequeueOldestRequest(), high);
+    EXPECT_TRUE(m_queue.empty());
+}
+
+/**
+ * Test that clear() empties every priority.
+ */
+TEST_F(MessageRequestQueueTest, test_clear) {
+    m_queue.enqueueRequest(createRequest(MessageRequest::Priority::NORMAL));
+    m_queue.enqueueRequest(createRequest(MessageRequest::Priority::HIGH));
+    m_queue.enqueueRequest(nullptr);
+    ASSERT_EQ(m_queue.size(), 2u);
+
+    m_queue.clear();
+    EXPECT_TRUE(m_queue.empty());
+    EXPECT_EQ(m_queue.size(), 0u);
+    EXPECT_FALSE(m_queue.isMessageRequestAvailable());
+    EXPECT_EQ(m_queue.dequeueRequest(), nullptr);
+}
+
+/**
+ * Test that only requests of the priorities admitted are dequeued.
+ */
+TEST_F(MessageRequestQueueTest, test_dequeueAdmittedPrioritiesOnly) {
+    auto background = createRequest(MessageRequest::Priority::BACKGROUND);
+    auto normal = createRequest(MessageRequest::Priority::NORMAL);
+    m_queue.enqueueRequest(background);
+    m_queue.enqueueRequest(normal);
+
+    EXPECT_FALSE(m_queue.isMessageRequestAvailable(MessageRequest::Priority::HIGH));
+    EXPECT_EQ(m_queue.dequeueRequest(MessageRequest::Priority::HIGH), nullptr);
+    ASSERT_TRUE(m_queue.isMessageRequestAvailable(MessageRequest::Priority::NORMAL));
+    EXPECT_EQ(m_queue.dequeueRequest(MessageRequest::Priority::NORMAL), normal);
+    EXPECT_FALSE(m_queue.isMessageRequestAvailable(MessageRequest::Priority::NORMAL));
+    ASSERT_TRUE(m_queue.isMessageRequestAvailable(MessageRequest::Priority::BACKGROUND));
+    EXPECT_EQ(m_queue.dequeueRequest(MessageRequest::Priority::BACKGROUND), background);
+    EXPECT_TRUE(m_queue.empty());
+}
+
+/**
+ * Test that a request which has been queued for long enough is sent ahead of newer requests of a higher priority, but
+ * never ahead of a request of the highest priority.
+ */
+TEST_F(MessageRequestQueueTest, testTimer_agedRequestSentAheadOfHigherPriority) {
+    auto background = createRequest(MessageRequest::Priority::BACKGROUND);
+    m_queue.enqueueRequest(background);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2100));
+    auto normal = createRequest(MessageRequest::Priority::NORMAL);
+    auto high = createRequest(MessageRequest::Priority::HIGH);
+    m_queue.enqueueRequest(normal);
+    m_queue.enqueueRequest(high);
+
+    EXPECT_EQ(m_queue.dequeueRequest(), high);
+    EXPECT_EQ(m_queue.dequeueRequest(), background);
+    EXPECT_EQ(m_queue.dequeueRequest(), normal);
+}
+
+/**
+ * Test that requests whose deadline has passed are removed, and that the earliest deadline is tracked.
+ */
+TEST_F(MessageRequestQueueTest, test_removeExpiredRequests) {
+    auto now = std::chrono::steady_clock::now();
+    EXPECT_FALSE(m_queue.peekEarliestDeadline().hasValue());
+    EXPECT_TRUE(m_queue.removeExpiredRequests(now).empty());
+
+    auto expiring = createRequest(MessageRequest::Priority::BACKGROUND, now + std::chrono::seconds(1));
+    auto later = createRequest(MessageRequest::Priority::NORMAL, now + std::chrono::seconds(2));
+    auto undated = createRequest(MessageRequest::Priority::BACKGROUND);
+    m_queue.enqueueRequest(later);
+    m_queue.enqueueRequest(expiring);
+    m_queue.enqueueRequest(undated);
+
+    ASSERT_TRUE(m_queue.peekEarliestDeadline().hasValue());
+    EXPECT_EQ(m_queue.peekEarliestDeadline().value(), now + std::chrono::seconds(1));
+    EXPECT_TRUE(m_queue.removeExpiredRequests(now).empty());
+
+    auto expired = m_queue.removeExpiredRequests(now + std::chrono::seconds(1));
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0], expiring);
+    EXPECT_EQ(m_queue.size(), 2u);
+    ASSERT_TRUE(m_queue.peekEarliestDeadline().hasValue());
+    EXPECT_EQ(m_queue.peekEarliestDeadline().value(), now + std::chrono::seconds(2));
+
+    EXPECT_EQ(m_queue.dequeueRequest(), later);
+    EXPECT_FALSE(m_queue.peekEarliestDeadline().hasValue());
+    EXPECT_TRUE(m_queue.removeExpiredRequests(now + std::chrono::seconds(3)).empty());
+    EXPECT_EQ(m_queue.dequeueRequest(), undated);
+}
+
+/**
+ * Test that a request with a coalescing key replaces the queued request with the same key, and is queued after the
+ * requests enqueued before it.
+ */
+TEST_F(MessageRequestQueueTest, test_coalescingKeyReplacesQueuedRequest) {
+    auto volume1 = createRequest(MessageRequest::Priority::NORMAL);
+    volume1->setCoalescingKey("Speaker.VolumeChanged");
+    auto mute = createRequest(MessageRequest::Priority::NORMAL);
+    mute->setCoalescingKey("Speaker.MuteChanged");
+    auto other = createRequest(MessageRequest::Priority::NORMAL);
+    auto volume2 = createRequest(MessageRequest::Priority::NORMAL);
+    volume2->setCoalescingKey("Speaker.VolumeChanged");
+
+    EXPECT_EQ(m_queue.enqueueRequest(volume1), nullptr);
+    EXPECT_EQ(m_queue.enqueueRequest(mute), nullptr);
+    EXPECT_EQ(m_queue.enqueueRequest(other), nullptr);
+    EXPECT_EQ(m_queue.enqueueRequest(volume2), volume1);
+    EXPECT_EQ(m_queue.size(), 3u);
+
+    EXPECT_EQ(m_queue.dequeueRequest(), mute);
+    EXPECT_EQ(m_queue.dequeueRequest(), other);
+    EXPECT_EQ(m_queue.dequeueRequest(), volume2);
+
+    // A request which has been dequeued is not superseded.
+    auto volume3 = createRequest(MessageRequest::Priority::BACKGROUND);
+    volume3->setCoalescingKey("Speaker.VolumeChanged");
+    EXPECT_EQ(m_queue.enqueueRequest(volume3), nullptr);
+
+    // A request is superseded by one of another priority.
+    auto volume4 = createRequest(MessageRequest::Priority::HIGH);
+    volume4->setCoalescingKey("Speaker.VolumeChanged");
+    EXPECT_EQ(m_queue.enqueueRequest(volume4), volume3);
+    EXPECT_EQ(m_queue.dequeueRequest(), volume4);
+    EXPECT_TRUE(m_queue.empty());
+}
+
+}  // namespace test
+}  // namespace transport
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -14,6 +14,7 @@
  */
 
 #include "MessageRouterTest.h"
+#include "MockMessageRequest.h"
 
 #include <gtest/gtest.h>
 
@@ -113,6 +114,42 @@ TEST_F(MessageRouterTest, test_sendIsSuccessfulWhenConnected) {
     EXPECT_CALL(*m_mockTransport, disconnect()).Times(AnyNumber());
 }
 
+/**
+ * Test that a message with a coalescing key supersedes a queued message with the same key, which is completed with
+ * SUPERSEDED, and that (when metrics recording is enabled) the superseded message is recorded in a metric.
+ */
+TEST_F(MessageRouterTest, test_sendSupersedesQueuedMessageWithSameCoalescingKey) {
+    setupStateToConnected();
+
+    auto supersededRequest = std::make_shared<MockMessageRequest>();
+    supersededRequest->setCoalescingKey("Speaker.VolumeChanged");
+    auto otherRequest = createMessageRequest();
+    auto latestRequest = createMessageRequest();
+    latestRequest->setCoalescingKey("Speaker.VolumeChanged");
+
+    EXPECT_CALL(*m_mockTransport, onRequestEnqueued()).Times(3);
+    EXPECT_CALL(*supersededRequest, sendCompleted(MessageRequestObserverInterface::Status::SUPERSEDED)).Times(1);
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(*m_mockMetricRecorder, recordMetric(_))
+        .WillOnce(Invoke([](std::shared_ptr<avsCommon::utils::metrics::MetricEvent> metricEvent) {
+            EXPECT_EQ(metricEvent->getActivityName(), "ACL-MESSAGE_REQUEST_SUPERSEDED");
+            auto coalescingKey =
+                metricEvent->getDataPoint("COALESCING_KEY", avsCommon::utils::metrics::DataType::STRING);
+            ASSERT_TRUE(coalescingKey.hasValue());
+            EXPECT_EQ(coalescingKey.value().getValue(), "Speaker.VolumeChanged");
+        }));
+#else
+    EXPECT_CALL(*m_mockMetricRecorder, recordMetric(_)).Times(0);
+#endif
+
+    m_router->sendMessage(supersededRequest);
+    m_router->sendMessage(otherRequest);
+    m_router->sendMessage(latestRequest);
+
+    // Since we connected we will be disconnected when the router is destroyed
+    EXPECT_CALL(*m_mockTransport, disconnect()).Times(AnyNumber());
+}
+
 TEST_F(MessageRouterTest, test_sendFailsWhenDisconnected) {
     auto messageRequest = createMessageRequest();
 
@@ -216,7 +253,7 @@ TEST_F(MessageRouterTest, test_serverSideDisconnectCreatesANewTransport) {
  */
 TEST_F(MessageRouterTest, test_onReceive) {
     m_mockMessageRouterObserver->reset();
-    m_router->consumeMessage(CONTEXT_ID, MESSAGE);
+    m_router->consumeMessage(CONTEXT_ID, std::make_shared<const std::string>(MESSAGE));
     waitOnMessageRouter(SHORT_TIMEOUT_MS);
     ASSERT_TRUE(m_mockMessageRouterObserver->wasNotifiedOfReceive());
     ASSERT_EQ(CONTEXT_ID, m_mockMessageRouterObserver->getAttachmentContextId());
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_ACL_TEST_TRANSPORT_MESSAGEROUTERTEST_H_
 #define ALEXA_CLIENT_SDK_ACL_TEST_TRANSPORT_MESSAGEROUTERTEST_H_
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
@@ -23,6 +24,7 @@
 
 #include "AVSCommon/Utils/Threading/Executor.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 
 #include "MockMessageRouterObserver.h"
 #include "MockAuthDelegate.h"
@@ -48,8 +50,9 @@ public:
         std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<AttachmentManager> attachmentManager,
         std::shared_ptr<TransportFactoryInterface> factory,
-        const std::string& avsGateway) :
-            MessageRouter(authDelegate, attachmentManager, factory, avsGateway) {
+        const std::string& avsGateway,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr) :
+            MessageRouter(authDelegate, attachmentManager, factory, avsGateway, metricRecorder) {
     }
 
     /**
@@ -98,11 +101,13 @@ public:
             m_attachmentManager{std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS)},
             m_mockTransport{std::make_shared<NiceMock<MockTransport>>()},
             m_transportFactory{std::make_shared<MockTransportFactory>(m_mockTransport)},
+            m_mockMetricRecorder{std::make_shared<NiceMock<avsCommon::utils::metrics::test::MockMetricRecorder>>()},
             m_router{std::make_shared<TestableMessageRouter>(
                 m_mockAuthDelegate,
                 m_attachmentManager,
                 m_transportFactory,
-                AVS_ENDPOINT)} {
+                AVS_ENDPOINT,
+                m_mockMetricRecorder)} {
         m_router->setObserver(m_mockMessageRouterObserver);
     }
 
@@ -141,6 +146,7 @@ public:
     std::shared_ptr<AttachmentManager> m_attachmentManager;
     std::shared_ptr<NiceMock<MockTransport>> m_mockTransport;
     std::shared_ptr<MockTransportFactory> m_transportFactory;
+    std::shared_ptr<NiceMock<avsCommon::utils::metrics::test::MockMetricRecorder>> m_mockMetricRecorder;
     std::shared_ptr<TestableMessageRouter> m_router;
     // TestableMessageRouter m_router;
 };
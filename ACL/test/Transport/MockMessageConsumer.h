@@ -30,7 +30,7 @@ namespace test {
  */
 class MockMessageConsumer : public MessageConsumerInterface {
 public:
-    MOCK_METHOD2(consumeMessage, void(const std::string& contextId, const std::string& message));
+    MOCK_METHOD2(consumeMessage, void(const std::string& contextId, std::shared_ptr<const std::string> message));
 };
 
 }  // namespace test
@@ -67,10 +67,10 @@ private:
         m_status = status;
         m_reason = reason;
     }
-    virtual void receive(const std::string& contextId, const std::string& message) override {
+    virtual void receive(const std::string& contextId, std::shared_ptr<const std::string> message) override {
         notifiedOfReceive = true;
         m_attachmentContextId = contextId;
-        m_message = message;
+        m_message = *message;
     }
 
     avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status m_status;
@@ -39,7 +39,7 @@ public:
         m_messageObserver = observer;
     }
 
-    void consumeMessage(const std::string& contextId, const std::string& message) override {
+    void consumeMessage(const std::string& contextId, std::shared_ptr<const std::string> message) override {
         if (m_messageObserver) {
             m_messageObserver->receive(contextId, message);
         }
@@ -50,6 +50,14 @@ public:
 
     void receive(const std::string& contextId, const std::string& message) override;
 
+    /**
+     * Parse a message into an @c AVSDirective which holds on to the message buffer rather than a copy of it.
+     *
+     * @param contextId The context for the message, which is used to acquire attachments.
+     * @param message The AVS message that has been received.
+     */
+    void receive(const std::string& contextId, std::shared_ptr<const std::string> message) override;
+
 private:
     /// Object that manages sending exceptions encountered messages to AVS.
     std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> m_exceptionEncounteredSender;
@@ -60,6 +60,15 @@ MessageInterpreter::MessageInterpreter(
 }
 
 void MessageInterpreter::receive(const std::string& contextId, const std::string& message) {
+    receive(contextId, std::make_shared<const std::string>(message));
+}
+
+void MessageInterpreter::receive(const std::string& contextId, std::shared_ptr<const std::string> message) {
+    if (!message) {
+        ACSDK_ERROR(LX("receiveFailed").d("reason", "nullMessage"));
+        return;
+    }
+
     auto createResult = AVSDirective::create(message, m_attachmentManager, contextId);
     std::shared_ptr<AVSDirective> avsDirective{std::move(createResult.first)};
     if (!avsDirective) {
@@ -68,7 +77,7 @@ void MessageInterpreter::receive(const std::string& contextId, const std::string
                 "Unable to parse Directive - JSON error:" + avsDirectiveParseStatusToString(createResult.second);
             ACSDK_ERROR(LX("receiveFailed").m(errorDescription));
             m_exceptionEncounteredSender->sendExceptionEncountered(
-                message, ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED, errorDescription);
+                *message, ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED, errorDescription);
         } else {
             ACSDK_ERROR(LX("receiveFailed").m("unable to send AVS Exception due to nullptr sender."));
         }
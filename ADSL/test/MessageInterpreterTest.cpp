@@ -320,6 +320,25 @@ TEST_F(MessageIntepreterTest, test_messageIsValidDirective) {
     m_messageInterpreter->receive(TEST_ATTACHMENT_CONTEXT_ID, SPEAK_DIRECTIVE);
 }
 
+/**
+ * Test that a message received in a shared buffer is parsed into an AVSDirective which is passed to the directive
+ * sequencer.
+ */
+TEST_F(MessageIntepreterTest, test_sharedMessageIsValidDirective) {
+    EXPECT_CALL(*m_mockExceptionEncounteredSender, sendExceptionEncountered(_, _, _)).Times(0);
+    EXPECT_CALL(*m_mockDirectiveSequencer, onDirective(_))
+        .Times(1)
+        .WillOnce(Invoke([](std::shared_ptr<AVSDirective> avsDirective) -> bool {
+            EXPECT_EQ(avsDirective->getNamespace(), NAMESPACE_TEST);
+            EXPECT_EQ(avsDirective->getName(), NAME_TEST);
+            EXPECT_EQ(avsDirective->getPayload(), PAYLOAD_TEST);
+            EXPECT_EQ(avsDirective->getAttachmentContextId(), TEST_ATTACHMENT_CONTEXT_ID);
+            EXPECT_EQ(avsDirective->getUnparsedDirective(), SPEAK_DIRECTIVE);
+            return true;
+        }));
+    m_messageInterpreter->receive(TEST_ATTACHMENT_CONTEXT_ID, std::make_shared<const std::string>(SPEAK_DIRECTIVE));
+}
+
 }  // namespace test
 }  // namespace adsl
 }  // namespace alexaClientSDK
@@ -75,8 +75,11 @@ bool FocusManager::acquireChannel(
         return false;
     }
 
-    m_executor.submit(
-        [this, channelToAcquire, channelActivity]() { acquireChannelHelper(channelToAcquire, channelActivity); });
+    auto task = [this, channelToAcquire, channelActivity]() {
+        acquireChannelHelper(channelToAcquire, channelActivity);
+    };
+    static_assert(threading::InlineTask::fitsInline<decltype(task)>(), "acquireChannel task should not allocate");
+    m_executor.execute(std::move(task));
     return true;
 }
 
@@ -95,8 +98,11 @@ bool FocusManager::acquireChannel(
         return false;
     }
 
-    m_executor.submit(
-        [this, channelToAcquire, channelActivity]() { acquireChannelHelper(channelToAcquire, channelActivity); });
+    auto task = [this, channelToAcquire, channelActivity]() {
+        acquireChannelHelper(channelToAcquire, channelActivity);
+    };
+    static_assert(threading::InlineTask::fitsInline<decltype(task)>(), "acquireChannel task should not allocate");
+    m_executor.execute(std::move(task));
     return true;
 }
 
@@ -115,9 +121,13 @@ std::future<bool> FocusManager::releaseChannel(
         return returnValue;
     }
 
-    m_executor.submit([this, channelToRelease, channelObserver, releaseChannelSuccess, channelName]() {
-        releaseChannelHelper(channelToRelease, channelObserver, releaseChannelSuccess, channelName);
-    });
+    // Capture a non-const copy so that the task is nothrow movable and is queued without allocating.
+    std::string releasedChannelName = channelName;
+    auto task = [this, channelToRelease, channelObserver, releaseChannelSuccess, releasedChannelName]() {
+        releaseChannelHelper(channelToRelease, channelObserver, releaseChannelSuccess, releasedChannelName);
+    };
+    static_assert(threading::InlineTask::fitsInline<decltype(task)>(), "releaseChannel task should not allocate");
+    m_executor.execute(std::move(task));
 
     return returnValue;
 }
@@ -134,7 +144,7 @@ void FocusManager::stopForegroundActivity() {
     std::string foregroundChannelInterface = foregroundChannel->getInterface();
     lock.unlock();
 
-    m_executor.submitToFront([this, foregroundChannel, foregroundChannelInterface]() {
+    m_executor.executeToFront([this, foregroundChannel, foregroundChannelInterface]() {
         stopForegroundActivityHelper(foregroundChannel, foregroundChannelInterface);
     });
 }
@@ -158,7 +168,7 @@ void FocusManager::stopAllActivities() {
 
     lock.unlock();
 
-    m_executor.submitToFront([this, channelOwnersCapture]() { stopAllActivitiesHelper(channelOwnersCapture); });
+    m_executor.executeToFront([this, channelOwnersCapture]() { stopAllActivitiesHelper(channelOwnersCapture); });
 }
 
 void FocusManager::addObserver(const std::shared_ptr<FocusManagerObserverInterface>& observer) {
@@ -50,6 +50,13 @@ public:
      */
     std::string toJson() const;
 
+    /**
+     * Serialize the context now, so that later calls to @c toJson() return the result instead of serializing the
+     * states again.  This is useful for a context which is shared by several requesters.  The result is discarded when
+     * a state is added or removed.
+     */
+    void cacheJson();
+
     /**
      * Get all states available in this context.
      *
@@ -86,6 +93,9 @@ public:
 private:
     /// A map of capabilities and their state.
     States m_states;
+
+    /// The json of @c m_states saved by @c cacheJson(), if any.
+    utils::Optional<std::string> m_json;
 };
 
 }  // namespace avs
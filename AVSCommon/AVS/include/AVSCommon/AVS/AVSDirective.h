@@ -18,9 +18,12 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
+#include <rapidjson/document.h>
+
 #include "Attachment/AttachmentManagerInterface.h"
 #include "AVSMessage.h"
 
@@ -76,6 +79,21 @@ public:
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId);
 
+    /**
+     * Creates an AVSDirective which holds on to the buffer of the unparsed directive rather than a copy of it.  An
+     * object payload is sliced from the buffer rather than built as a JSON document and serialized again.
+     *
+     * @param unparsedDirective The unparsed AVS Directive JSON string, in an immutable buffer.
+     * @param attachmentManager The attachment manager.
+     * @param attachmentContextId The contextId required to get attachments from the AttachmentManager.
+     * @return A pair of an AVSDirective pointer and a parse status.  If the AVSDirective is nullptr, the status will
+     * express the parse error.
+     */
+    static std::pair<std::unique_ptr<AVSDirective>, ParseStatus> create(
+        std::shared_ptr<const std::string> unparsedDirective,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
+        const std::string& attachmentContextId);
+
     /**
      * Creates an AVSDirective.
      *
@@ -111,6 +129,15 @@ public:
      */
     std::string getUnparsedDirective() const;
 
+    /**
+     * Returns the payload parsed as JSON.  The payload is parsed the first time this is called, and the document is
+     * shared by every later caller, so capability agents should use this rather than parse @c getPayload() again.
+     *
+     * @return The payload document, which is never @c nullptr.  If the payload is not valid JSON, the document
+     * reports the parse error.
+     */
+    std::shared_ptr<const rapidjson::Document> getPayloadDocument() const;
+
     /**
      * Returns the attachmentContextId.
      */
@@ -128,19 +155,23 @@ private:
      * @param endpoint Optional parameter used to identify the target endpoint for the given directive.
      */
     AVSDirective(
-        const std::string& unparsedDirective,
+        std::shared_ptr<const std::string> unparsedDirective,
         std::shared_ptr<AVSMessageHeader> avsMessageHeader,
-        const std::string& payload,
+        std::string payload,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId,
         const utils::Optional<AVSMessageEndpoint>& endpoint);
 
-    /// The unparsed directive JSON string from AVS.
-    const std::string m_unparsedDirective;
+    /// The unparsed directive JSON string from AVS, which may be shared with other recipients of the message.
+    const std::shared_ptr<const std::string> m_unparsedDirective;
     /// The attachmentManager.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> m_attachmentManager;
     /// The contextId needed to acquire the right attachment from the attachmentManager.
     std::string m_attachmentContextId;
+    /// Serializes access to @c m_payloadDocument.
+    mutable std::mutex m_payloadDocumentMutex;
+    /// The payload parsed as JSON, or @c nullptr until @c getPayloadDocument() is first called.
+    mutable std::shared_ptr<const rapidjson::Document> m_payloadDocument;
 };
 
 /**
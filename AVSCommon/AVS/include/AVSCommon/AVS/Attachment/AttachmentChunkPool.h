@@ -0,0 +1,132 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKPOOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A pool of fixed-size chunks of memory, which @c ChunkedAttachment buffers their data in.
+ *
+ * Chunks released by an attachment are kept idle, up to a limit, so that the next attachment reuses them rather than
+ * allocating.  Chunks are not initialized, as an attachment only reads back the bytes it has written.
+ *
+ * This class is thread-safe.
+ */
+class AttachmentChunkPool {
+public:
+    /// A chunk of memory.
+    using Chunk = std::unique_ptr<uint8_t[]>;
+
+    /**
+     * Create a pool.
+     *
+     * @param chunkSize The size of each chunk, in bytes.  Must not be zero.
+     * @param maxIdleChunks The most idle chunks kept in the pool.
+     * @return The new pool, or nullptr if the parameters are invalid.
+     */
+    static std::shared_ptr<AttachmentChunkPool> create(
+        size_t chunkSize = DEFAULT_CHUNK_SIZE,
+        size_t maxIdleChunks = DEFAULT_MAX_IDLE_CHUNKS);
+
+    /**
+     * Get the pool shared by the attachments of the process which are not given one.
+     *
+     * @return The default pool.
+     */
+    static std::shared_ptr<AttachmentChunkPool> getDefault();
+
+    /**
+     * Acquire a chunk.
+     *
+     * @return The chunk most recently released, or a new chunk if the pool has none.
+     */
+    Chunk acquire();
+
+    /**
+     * Return a chunk to the pool.  The chunk is freed if the pool is full.
+     *
+     * @param chunk A chunk acquired from this pool.
+     */
+    void release(Chunk chunk);
+
+    /**
+     * Get the size of each chunk.
+     *
+     * @return The size of each chunk, in bytes.
+     */
+    size_t getChunkSize() const;
+
+    /**
+     * Get the number of idle chunks in the pool.
+     *
+     * @return The number of idle chunks in the pool.
+     */
+    size_t getIdleCount();
+
+    /**
+     * Get the number of chunks acquired and not yet released.
+     *
+     * @return The number of chunks in use.
+     */
+    size_t getInUseCount();
+
+    /// The default size of each chunk.
+    static const size_t DEFAULT_CHUNK_SIZE;
+
+    /// The default for the most idle chunks kept in the pool.
+    static const size_t DEFAULT_MAX_IDLE_CHUNKS;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param chunkSize The size of each chunk, in bytes.
+     * @param maxIdleChunks The most idle chunks kept in the pool.
+     */
+    AttachmentChunkPool(size_t chunkSize, size_t maxIdleChunks);
+
+    /// The size of each chunk.
+    const size_t m_chunkSize;
+
+    /// The most idle chunks kept in the pool.
+    const size_t m_maxIdleChunks;
+
+    /// Serializes access to @c m_idleChunks and @c m_inUseCount.
+    std::mutex m_mutex;
+
+    /// The idle chunks, most recently released last.
+    std::vector<Chunk> m_idleChunks;
+
+    /// The number of chunks acquired and not yet released.
+    size_t m_inUseCount;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTCHUNKPOOL_H_
@@ -68,7 +68,11 @@ public:
      */
     enum class AttachmentType {
         /// This value corresponds to the @c InProcessAttachment class.
-        IN_PROCESS
+        IN_PROCESS,
+        /// This value corresponds to the @c ChunkedAttachment class, using the default @c AttachmentChunkPool.  Its
+        /// readers keep @c ChunkedAttachment::SEEKABLE_READER_REACH_BACK_BYTES behind them, as the attachments of
+        /// directives are played by the media player.
+        CHUNKED
     };
 
     /**
@@ -100,6 +100,19 @@ public:
      */
     virtual uint64_t getNumUnreadBytes() = 0;
 
+    /**
+     * Wait until data is available to read, or the attachment is closed, without reading anything.  This lets a
+     * consumer which reads without blocking on one thread be woken up on another thread when data arrives.  Readers
+     * which cannot wait return @c false straight away.
+     *
+     * @param timeout The maximum time to wait.  This must not be zero.
+     * @return @c true if a @c read() would no longer find the attachment empty, or @c false if the wait timed out or
+     *     is not supported.
+     */
+    virtual bool waitForData(std::chrono::milliseconds timeout) {
+        return false;
+    }
+
     /**
      * The close function.  An implementation will take care of any resource management when a reader no longer
      * needs to use an attachment.
@@ -0,0 +1,80 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
+
+#include <memory>
+#include <string>
+
+#include "AVSCommon/AVS/Attachment/Attachment.h"
+#include "AVSCommon/AVS/Attachment/AttachmentChunkPool.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that represents an AVS attachment whose data is held in chunks from an @c AttachmentChunkPool, so that it
+ * only holds memory for the data written to it rather than for a whole ring buffer.  See @c ChunkedAttachmentBuffer.
+ */
+class ChunkedAttachment : public Attachment {
+public:
+    /**
+     * Constructor.
+     *
+     * @param id The attachment id.
+     * @param pool The pool the chunks are acquired from.  If not specified, the default pool is used.
+     * @param maxBufferedBytes The most bytes the reader has not consumed which are held, as the size of the buffer of
+     *     an @c InProcessAttachment bounds them.
+     * @param minReachBackBytes The fewest bytes behind the reader which are held, so that it may seek back to them,
+     *     unless the writer needs their room.  By default the data the reader has passed is released.
+     */
+    ChunkedAttachment(
+        const std::string& id,
+        std::shared_ptr<AttachmentChunkPool> pool = nullptr,
+        size_t maxBufferedBytes = InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES,
+        size_t minReachBackBytes = 0);
+
+    std::unique_ptr<AttachmentWriter> createWriter(
+        utils::sds::WriterPolicy policy = utils::sds::WriterPolicy::ALL_OR_NOTHING) override;
+
+    std::unique_ptr<AttachmentReader> createReader(utils::sds::ReaderPolicy policy) override;
+
+    /**
+     * Get the number of bytes of the chunks the attachment holds.
+     *
+     * @return The number of bytes of the chunks held.
+     */
+    size_t getAllocatedBytes();
+
+    /// A reach-back window for a reader which finds the type of the stream and then seeks back to its start, as the
+    /// seekable source of the media player does.
+    static const size_t SEEKABLE_READER_REACH_BACK_BYTES;
+
+private:
+    /// The data of the attachment, shared with the reader and the writer.
+    std::shared_ptr<ChunkedAttachmentBuffer> m_buffer;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENT_H_
@@ -0,0 +1,229 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkPool.h"
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/AttachmentWriter.h"
+#include "AVSCommon/Utils/SDS/ReaderPolicy.h"
+#include "AVSCommon/Utils/SDS/WriterPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * The data of a @c ChunkedAttachment, shared by its writer and its reader.
+ *
+ * The data is held in chunks from an @c AttachmentChunkPool, acquired as the writer reaches them, so an attachment
+ * only holds memory for the data written to it.  As the reader passes data, the chunks holding only data more than
+ * @c minReachBackBytes behind it are returned to the pool, so an attachment read as it is written holds little more
+ * than the data in flight.  The reader may seek back to any data still held, as it can in the ring buffer of an
+ * @c InProcessAttachment, so a reader which seeks back is given a reach-back window to keep the data it seeks to.
+ * When the writer needs room beyond @c maxBufferedBytes, the writer policies behave as they do for an
+ * @c InProcessAttachment of @c maxBufferedBytes: @c ALL_OR_NOTHING and @c BLOCKING writers wait for the reader to
+ * consume data, and a @c NONBLOCKABLE writer discards the oldest data.
+ *
+ * This class is thread-safe.
+ */
+class ChunkedAttachmentBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param pool The pool the chunks are acquired from.
+     * @param maxBufferedBytes The most bytes the reader has not consumed which are held.
+     * @param minReachBackBytes The fewest bytes behind the reader which are held, so that it may seek back to them,
+     *     unless the writer needs their room.
+     */
+    ChunkedAttachmentBuffer(
+        std::shared_ptr<AttachmentChunkPool> pool,
+        size_t maxBufferedBytes,
+        size_t minReachBackBytes);
+
+    /**
+     * Destructor.  Returns the chunks held to the pool.
+     */
+    ~ChunkedAttachmentBuffer();
+
+    /**
+     * Write data, as @c AttachmentWriter::write() does.
+     *
+     * @param buf The buffer where data should be copied from.
+     * @param numBytes The size of the buffer in bytes.
+     * @param policy The policy of the writer.
+     * @param[out] writeStatus The resulting state of the write.
+     * @param timeout The most time a @c BLOCKING writer waits for room, or zero to wait forever.
+     * @return The number of bytes written.
+     */
+    size_t write(
+        const void* buf,
+        size_t numBytes,
+        utils::sds::WriterPolicy policy,
+        AttachmentWriter::WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * Close the writer.  The reader reads the data written so far, then @c CLOSED.
+     */
+    void closeWriter();
+
+    /**
+     * Read data, as @c AttachmentReader::read() does.
+     *
+     * @param buf The buffer where data should be copied to.
+     * @param numBytes The size of the buffer in bytes.
+     * @param policy The policy of the reader.
+     * @param[out] readStatus The resulting state of the read.
+     * @param timeout The most time a @c BLOCKING reader waits for data, or zero to wait forever.
+     * @return The number of bytes read.
+     */
+    size_t read(
+        void* buf,
+        size_t numBytes,
+        utils::sds::ReaderPolicy policy,
+        AttachmentReader::ReadStatus* readStatus,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * Move the reader, as @c AttachmentReader::seek() does.
+     *
+     * @param offset The offset from the start of the attachment.
+     * @return @c true if the offset is at data still held or not yet written, else @c false.
+     */
+    bool seek(uint64_t offset);
+
+    /**
+     * Wait for data, as @c AttachmentReader::waitForData() does.
+     *
+     * @param timeout The maximum time to wait.
+     * @return @c true if a read would no longer find the buffer empty, else @c false.
+     */
+    bool waitForData(std::chrono::milliseconds timeout);
+
+    /**
+     * Get the number of bytes written which the reader has not read.
+     *
+     * @return The number of unread bytes.
+     */
+    uint64_t getNumUnreadBytes();
+
+    /**
+     * Close the reader.  Once the reader stops reading, the chunks are returned to the pool and later writes are
+     * discarded.
+     *
+     * @param closePoint When the reader stops reading.
+     */
+    void closeReader(AttachmentReader::ClosePoint closePoint);
+
+    /**
+     * Get the number of bytes of the chunks held.
+     *
+     * @return The number of bytes of the chunks held.
+     */
+    size_t getAllocatedBytes();
+
+private:
+    /**
+     * Get whether a read would no longer find the buffer empty.  @c m_mutex must be held.
+     *
+     * @return @c true if the reader or the writer is closed, or there is data to read, else @c false.
+     */
+    bool canReadLocked() const;
+
+    /**
+     * Discard the data before an offset, returning the chunks holding only discarded data to the pool.  @c m_mutex
+     * must be held.
+     *
+     * @param offset The offset of the oldest data to keep.
+     */
+    void discardBeforeLocked(uint64_t offset);
+
+    /**
+     * Return every chunk to the pool, once the reader is closed.  @c m_mutex must be held.
+     */
+    void releaseAllLocked();
+
+    /**
+     * Get the number of bytes the writer may write before it overwrites data the reader has not consumed.  @c m_mutex
+     * must be held.
+     *
+     * @return The number of bytes.
+     */
+    uint64_t getFreeSpaceLocked() const;
+
+    /// The pool the chunks are acquired from.
+    const std::shared_ptr<AttachmentChunkPool> m_pool;
+
+    /// The size of each chunk.
+    const size_t m_chunkSize;
+
+    /// The most bytes the reader has not consumed which are held.
+    const uint64_t m_maxBufferedBytes;
+
+    /// The fewest bytes behind the reader which are held.
+    const uint64_t m_minReachBackBytes;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when data is written, or when the writer or the reader is closed.
+    std::condition_variable m_dataAvailable;
+
+    /// Notified when the reader consumes data or moves, or when the reader is closed.
+    std::condition_variable m_spaceAvailable;
+
+    /// The chunks held, in the order of the data.
+    std::deque<AttachmentChunkPool::Chunk> m_chunks;
+
+    /// The index in the attachment of the first chunk of @c m_chunks, in chunks.
+    uint64_t m_firstChunkIndex;
+
+    /// The offset of the oldest data the reader may read.
+    uint64_t m_oldestOffset;
+
+    /// The offset the next byte will be written at.
+    uint64_t m_writeOffset;
+
+    /// The offset the next byte will be read from.
+    uint64_t m_readOffset;
+
+    /// The offset the reader stops reading at, once it has been closed after draining.
+    uint64_t m_readerCloseOffset;
+
+    /// Whether the writer has been closed.
+    bool m_isWriterClosed;
+
+    /// Whether the reader has been closed, and its chunks released.
+    bool m_isReaderClosed;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
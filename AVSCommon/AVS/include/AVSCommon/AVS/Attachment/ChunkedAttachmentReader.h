@@ -0,0 +1,78 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+
+#include <memory>
+
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/Utils/SDS/ReaderPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that provides functionality to read data from a @c ChunkedAttachment.
+ */
+class ChunkedAttachmentReader : public AttachmentReader {
+public:
+    /**
+     * Constructor.
+     *
+     * @param buffer The data of the attachment.
+     * @param policy The policy of the reader.
+     */
+    ChunkedAttachmentReader(std::shared_ptr<ChunkedAttachmentBuffer> buffer, utils::sds::ReaderPolicy policy);
+
+    /**
+     * Destructor.  Closes the reader, so that the data of the attachment is released.
+     */
+    ~ChunkedAttachmentReader();
+
+    /// @name AttachmentReader methods.
+    /// @{
+    std::size_t read(
+        void* buf,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override;
+
+    void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override;
+
+    bool seek(uint64_t offset) override;
+
+    uint64_t getNumUnreadBytes() override;
+
+    bool waitForData(std::chrono::milliseconds timeout) override;
+    /// @}
+
+private:
+    /// The data of the attachment.
+    const std::shared_ptr<ChunkedAttachmentBuffer> m_buffer;
+
+    /// The policy of the reader.
+    const utils::sds::ReaderPolicy m_policy;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
@@ -0,0 +1,69 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
+
+#include <memory>
+
+#include "AVSCommon/AVS/Attachment/AttachmentWriter.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/Utils/SDS/WriterPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that provides functionality to write data to a @c ChunkedAttachment.
+ */
+class ChunkedAttachmentWriter : public AttachmentWriter {
+public:
+    /**
+     * Constructor.
+     *
+     * @param buffer The data of the attachment.
+     * @param policy The policy of the writer.
+     */
+    ChunkedAttachmentWriter(std::shared_ptr<ChunkedAttachmentBuffer> buffer, utils::sds::WriterPolicy policy);
+
+    /**
+     * Destructor.  Closes the writer.
+     */
+    ~ChunkedAttachmentWriter();
+
+    std::size_t write(
+        const void* buf,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) override;
+
+    void close() override;
+
+private:
+    /// The data of the attachment.
+    const std::shared_ptr<ChunkedAttachmentBuffer> m_buffer;
+
+    /// The policy of the writer.
+    const utils::sds::WriterPolicy m_policy;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTWRITER_H_
@@ -72,6 +72,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    bool waitForData(std::chrono::milliseconds timeout) override;
+
     /// @}
 private:
     /**
@@ -258,6 +260,18 @@ uint64_t DefaultAttachmentReader<SDSType>::getNumUnreadBytes() {
     return 0;
 }
 
+template <typename SDSType>
+bool DefaultAttachmentReader<SDSType>::waitForData(std::chrono::milliseconds timeout) {
+    if (!m_reader) {
+        ACSDK_ERROR(utils::logger::LogEntry(TAG, "waitForDataFailed").d("reason", "noReader"));
+        return false;
+    }
+
+    // A closed stream or an overrun is reported by the next read, so they end the wait as data does.
+    auto result = m_reader->wait(1, timeout);
+    return result >= 0 || SDSType::Reader::Error::OVERRUN == result;
+}
+
 template <typename SDSType>
 DefaultAttachmentReader<SDSType>::DefaultAttachmentReader(
     typename SDSType::Reader::Policy policy,
@@ -76,6 +76,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    bool waitForData(std::chrono::milliseconds timeout) override;
+
 private:
     /**
      * Constructor
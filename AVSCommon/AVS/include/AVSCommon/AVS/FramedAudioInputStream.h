@@ -0,0 +1,186 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_FRAMEDAUDIOINPUTSTREAM_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_FRAMEDAUDIOINPUTSTREAM_H_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AVSCommon/AVS/AudioInputStream.h"
+#include "AVSCommon/Utils/AudioFormat.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+/**
+ * A layer on top of an @c AudioInputStream which carries interleaved multi-channel audio.  Each word of the stream is
+ * one frame: a sample of every channel.  This class keeps the @c AudioFormat of the stream, and a ring of the
+ * @c std::chrono::steady_clock times at which frames were written, so that:
+ *
+ * @li A @c Reader can be moved to the audio captured at a point in time, such as the start of a wake word.
+ * @li A @c Reader can read a single channel, such as a beam chosen by the DSP, without copying the other channels.
+ *
+ * The @c Writer and @c Readers are created on the underlying stream as usual.  Writes must go through @c write(), or
+ * be followed by a call to @c markWritten(), so that their time is recorded.
+ *
+ * @note The times are held by this object, so seeking by time is only possible in the process which writes the stream.
+ */
+class FramedAudioInputStream {
+public:
+    /// The type of a time at which audio was written.
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    /// The default number of writes whose times are kept: ten seconds of 10 ms writes.
+    static constexpr size_t DEFAULT_MAX_WRITE_TIMES = 1000;
+
+    /**
+     * Creates a @c FramedAudioInputStream.
+     *
+     * @param stream The underlying stream.  Its word size must be the size of one frame of @c format.
+     * @param format The format of the audio.  It must be interleaved LPCM with whole-byte samples.
+     * @param maxWriteTimes The number of writes whose times are kept.  Older audio cannot be found by time.
+     * @return The new @c FramedAudioInputStream, or @c nullptr if the parameters are invalid.
+     */
+    static std::shared_ptr<FramedAudioInputStream> create(
+        std::shared_ptr<AudioInputStream> stream,
+        const utils::AudioFormat& format,
+        size_t maxWriteTimes = DEFAULT_MAX_WRITE_TIMES);
+
+    /**
+     * Gets the underlying stream.
+     *
+     * @return The underlying stream.
+     */
+    std::shared_ptr<AudioInputStream> getStream() const;
+
+    /**
+     * Gets the format of the audio.
+     *
+     * @return The format of the audio.
+     */
+    const utils::AudioFormat& getFormat() const;
+
+    /**
+     * Writes frames to the stream and records the time they were written.
+     *
+     * @param writer A @c Writer of the underlying stream.
+     * @param buf The interleaved frames to write.
+     * @param nFrames The number of frames to write.
+     * @param timeout The maximum time to wait, as for @c AudioInputStream::Writer::write().
+     * @return The result of @c AudioInputStream::Writer::write().
+     */
+    ssize_t write(
+        AudioInputStream::Writer* writer,
+        const void* buf,
+        size_t nFrames,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * Records that the frames before the @c Writer's position were written at a time.  This is for writers which use
+     * @c AudioInputStream::Writer::reserve() and @c commit() instead of @c write().
+     *
+     * @param writer A @c Writer of the underlying stream.
+     * @param time The time at which the frames were written.
+     */
+    void markWritten(const AudioInputStream::Writer& writer, TimePoint time = std::chrono::steady_clock::now());
+
+    /**
+     * Finds the frame captured at a time.  The time of a frame is interpolated from the time of the write which
+     * completed before it, using the sample rate.
+     *
+     * @param time The time to find.
+     * @param[out] index The index of the first frame captured at or after @c time.
+     * @return @c true if @c index was found, or @c false if @c time is before the oldest write whose time is kept.
+     */
+    bool getIndex(TimePoint time, AudioInputStream::Index* index) const;
+
+    /**
+     * Moves a @c Reader to the frame captured at a time.
+     *
+     * @param reader A @c Reader of the underlying stream.
+     * @param time The time to move to.
+     * @return @c true if the @c Reader moved, or @c false if the audio at @c time is no longer in the stream.
+     */
+    bool seek(AudioInputStream::Reader* reader, TimePoint time) const;
+
+    /**
+     * Reads the samples of one channel from the stream, copying only that channel.
+     *
+     * @param reader A @c Reader of the underlying stream.
+     * @param channel The channel to read, in the range `[0, numChannels)`.
+     * @param buf A buffer to copy the samples to.  It must be large enough to hold @c nFrames samples.
+     * @param nFrames The maximum number of frames to read.
+     * @param timeout The maximum time to wait, as for @c AudioInputStream::Reader::read().
+     * @return The number of frames read, or an @c AudioInputStream::Reader::Error as for
+     *     @c AudioInputStream::Reader::read().
+     */
+    ssize_t readChannel(
+        AudioInputStream::Reader* reader,
+        size_t channel,
+        void* buf,
+        size_t nFrames,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) const;
+
+private:
+    /// The time at which a write completed.
+    struct WriteTime {
+        /// The index of the frame after the last frame of the write.
+        AudioInputStream::Index endIndex;
+
+        /// The time at which the write completed.
+        TimePoint time;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param stream The underlying stream.
+     * @param format The format of the audio.
+     * @param maxWriteTimes The number of writes whose times are kept.
+     */
+    FramedAudioInputStream(
+        std::shared_ptr<AudioInputStream> stream,
+        const utils::AudioFormat& format,
+        size_t maxWriteTimes);
+
+    /// The underlying stream.
+    const std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The format of the audio.
+    const utils::AudioFormat m_format;
+
+    /// The size of a sample of one channel in bytes.
+    const size_t m_bytesPerSample;
+
+    /// Serializes access to @c m_writeTimes and @c m_nextWriteTime.
+    mutable std::mutex m_writeTimesMutex;
+
+    /// A ring of the times of the latest writes, oldest first starting at @c m_nextWriteTime once it has wrapped.
+    std::vector<WriteTime> m_writeTimes;
+
+    /// The position in @c m_writeTimes of the next write time to record.
+    size_t m_nextWriteTime;
+};
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_FRAMEDAUDIOINPUTSTREAM_H_
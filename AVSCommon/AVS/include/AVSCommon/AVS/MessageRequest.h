@@ -16,15 +16,18 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_MESSAGEREQUEST_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_MESSAGEREQUEST_H_
 
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
 #include "AVSCommon/AVS/Attachment/AttachmentReader.h"
 #include <AVSCommon/SDKInterfaces/MessageRequestObserverInterface.h>
+#include <AVSCommon/Utils/Optional.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -56,14 +59,38 @@ public:
         std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader;
     };
 
+    /**
+     * How urgently a message should be sent.  Messages of a higher priority are sent before any queued messages of a
+     * lower priority, and do not wait for responses to them.  A message which has been queued for long enough is sent
+     * as though it had a higher priority, so that a steady stream of messages cannot hold it back forever.
+     */
+    enum class Priority {
+        /// A message the user is waiting for, such as a @c Recognize event.
+        HIGH,
+        /// A message which reports a change as it happens.
+        NORMAL,
+        /// A periodic or informational report which nothing waits for, such as @c SoftwareInfo.
+        BACKGROUND
+    };
+
+    /// The type of the time by which a message must have been sent.
+    using Deadline = std::chrono::steady_clock::time_point;
+
     /**
      * Constructor.
      *
      * @param jsonContent The message to be sent to AVS.
      * @param uriPathExtension An optional uri path extension which will be appended to the base url of the AVS.
      * endpoint.  If not specified, the default AVS path extension should be used by the sender implementation.
+     * @param priority How urgently the message should be sent.
+     * @param deadline An optional time by which the message must have been sent.  If it is still queued then, it is
+     * not sent, and completes with @c MessageRequestObserverInterface::Status::EXPIRED.
      */
-    MessageRequest(const std::string& jsonContent, const std::string& uriPathExtension = "");
+    MessageRequest(
+        const std::string& jsonContent,
+        const std::string& uriPathExtension = "",
+        Priority priority = Priority::NORMAL,
+        const utils::Optional<Deadline>& deadline = utils::Optional<Deadline>());
 
     /**
      * Destructor.
@@ -95,6 +122,37 @@ public:
      */
     std::string getUriPathExtension();
 
+    /**
+     * Retrieves how urgently the message should be sent.
+     *
+     * @return How urgently the message should be sent.
+     */
+    Priority getPriority() const;
+
+    /**
+     * Retrieves the time by which the message must have been sent.
+     *
+     * @return The time by which the message must have been sent, if it has a deadline.
+     */
+    utils::Optional<Deadline> getDeadline() const;
+
+    /**
+     * Set the key of the state this message reports, for a message which supersedes any earlier report of that state.
+     * If a message with the same key is still queued when this one is sent, only this one is sent, and the earlier
+     * one completes with @c MessageRequestObserverInterface::Status::SUPERSEDED.  This must be called before the
+     * message is sent.
+     *
+     * @param coalescingKey The key of the state this message reports, such as the namespace and name of the event.
+     */
+    void setCoalescingKey(const std::string& coalescingKey);
+
+    /**
+     * Retrieves the key of the state this message reports.
+     *
+     * @return The key of the state this message reports, or an empty string if the message supersedes no other.
+     */
+    std::string getCoalescingKey() const;
+
     /**
      * Gets the number of @c AttachmentReaders in this message.
      *
@@ -153,8 +211,36 @@ protected:
 
     /// The AttachmentReaders of the Attachments data to be sent to AVS.
     std::vector<std::shared_ptr<NamedReader>> m_readers;
+
+    /// How urgently the message should be sent.
+    const Priority m_priority;
+
+    /// The time by which the message must have been sent, if it has a deadline.
+    const utils::Optional<Deadline> m_deadline;
+
+    /// The key of the state this message reports, or an empty string if the message supersedes no other.
+    std::string m_coalescingKey;
 };
 
+/**
+ * Write a @c MessageRequest::Priority value to an @c ostream as a string.
+ *
+ * @param stream The stream to write the value to.
+ * @param priority The priority to write to the @c ostream as a string.
+ * @return The @c ostream that was passed in and written to.
+ */
+inline std::ostream& operator<<(std::ostream& stream, MessageRequest::Priority priority) {
+    switch (priority) {
+        case MessageRequest::Priority::HIGH:
+            return stream << "HIGH";
+        case MessageRequest::Priority::NORMAL:
+            return stream << "NORMAL";
+        case MessageRequest::Priority::BACKGROUND:
+            return stream << "BACKGROUND";
+    }
+    return stream << "UNKNOWN";
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
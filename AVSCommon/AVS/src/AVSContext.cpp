@@ -59,13 +59,23 @@ std::map<CapabilityTag, CapabilityState> AVSContext::getStates() const {
 
 void AVSContext::addState(const CapabilityTag& identifier, const CapabilityState& state) {
     m_states.insert(std::make_pair(identifier, state));
+    m_json.reset();
 }
 
 void AVSContext::removeState(const CapabilityTag& identifier) {
     m_states.erase(identifier);
+    m_json.reset();
+}
+
+void AVSContext::cacheJson() {
+    m_json.reset();
+    m_json.set(toJson());
 }
 
 std::string AVSContext::toJson() const {
+    if (m_json.hasValue()) {
+        return m_json.value();
+    }
     utils::json::JsonGenerator jsonGenerator;
     jsonGenerator.startArray(PROPERTIES_KEY_STRING);
     for (const auto& element : m_states) {
@@ -18,6 +18,8 @@
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 #include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -69,25 +71,221 @@ static const std::string TAG("AvsDirective");
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
 /**
- * Utility function to attempt a JSON parse of the passed in string, and inform the caller if this succeeded or failed.
- *
- * @param unparsedDirective The unparsed JSON string which should represent an AVS Directive.
- * @param[out] document The rapidjson Document which will be set to the parsed structure if the parse succeeds.
- * @return Whether the parse was successful.
+ * A rapidjson input stream over a C string.  Unlike @c rapidjson::StringStream, the reader does not parse from a local
+ * copy of it, so its position can be read by the handler while parsing.
  */
-static bool parseDocument(const std::string& unparsedDirective, Document* document) {
-    if (!document) {
-        ACSDK_ERROR(LX("parseDocumentFailed").m("nullptr document"));
-        return false;
+class PositionTrackingStringStream {
+public:
+    /// The type of character in the stream.
+    typedef char Ch;
+
+    /**
+     * Constructor.
+     *
+     * @param source The null-terminated string to read.
+     */
+    explicit PositionTrackingStringStream(const Ch* source) : m_stream{source} {
     }
 
-    if (!parseJSON(unparsedDirective, document)) {
-        ACSDK_ERROR(LX("parseDocumentFailed").d("uparsedDirective", unparsedDirective));
-        return false;
+    /// @return The next character, without consuming it.
+    Ch Peek() const {
+        return m_stream.Peek();
     }
 
-    return true;
-}
+    /// @return The next character, which is consumed.
+    Ch Take() {
+        return m_stream.Take();
+    }
+
+    /// @return The number of characters consumed.
+    size_t Tell() const {
+        return m_stream.Tell();
+    }
+
+    /// @name Writing, which is only used by in-situ parsing, is not supported.
+    /// @{
+    Ch* PutBegin() {
+        RAPIDJSON_ASSERT(false);
+        return nullptr;
+    }
+    void Put(Ch) {
+        RAPIDJSON_ASSERT(false);
+    }
+    void Flush() {
+        RAPIDJSON_ASSERT(false);
+    }
+    size_t PutEnd(Ch*) {
+        RAPIDJSON_ASSERT(false);
+        return 0;
+    }
+    /// @}
+
+private:
+    /// The stream read.
+    StringStream m_stream;
+};
+
+/**
+ * A SAX handler which builds the @c Document of a directive, except for the members of an object payload.  The extent
+ * of the payload in the unparsed directive is recorded instead, so that the payload can be sliced from the unparsed
+ * directive rather than built and serialized again.  An empty object is left in the @c Document in its place.
+ */
+class DirectiveHandler {
+public:
+    /**
+     * Constructor.
+     *
+     * @param document The document to build.
+     * @param stream The stream being parsed.
+     */
+    DirectiveHandler(Document* document, const PositionTrackingStringStream& stream) :
+            m_document{document},
+            m_stream(stream),
+            m_depth{0},
+            m_isDirectiveKey{false},
+            m_isPayloadKey{false},
+            m_payloadDepth{0},
+            m_payloadBegin{0},
+            m_payloadEnd{0},
+            m_hasObjectPayload{false} {
+    }
+
+    /**
+     * Get the extent of an object payload in the unparsed directive.
+     *
+     * @param[out] begin The offset of the opening brace of the payload.
+     * @param[out] length The length of the payload, including its braces.
+     * @return Whether the payload was an object.
+     */
+    bool getObjectPayload(size_t* begin, size_t* length) const {
+        if (!m_hasObjectPayload) {
+            return false;
+        }
+        *begin = m_payloadBegin;
+        *length = m_payloadEnd - m_payloadBegin;
+        return true;
+    }
+
+    /// @name Handler events
+    /// @{
+    bool Null() {
+        return isInPayload() || m_document->Null();
+    }
+    bool Bool(bool value) {
+        return isInPayload() || m_document->Bool(value);
+    }
+    bool Int(int value) {
+        return isInPayload() || m_document->Int(value);
+    }
+    bool Uint(unsigned value) {
+        return isInPayload() || m_document->Uint(value);
+    }
+    bool Int64(int64_t value) {
+        return isInPayload() || m_document->Int64(value);
+    }
+    bool Uint64(uint64_t value) {
+        return isInPayload() || m_document->Uint64(value);
+    }
+    bool Double(double value) {
+        return isInPayload() || m_document->Double(value);
+    }
+    bool RawNumber(const char* value, SizeType length, bool copy) {
+        return isInPayload() || m_document->RawNumber(value, length, copy);
+    }
+    bool String(const char* value, SizeType length, bool copy) {
+        return isInPayload() || m_document->String(value, length, copy);
+    }
+    bool Key(const char* value, SizeType length, bool copy) {
+        if (isInPayload()) {
+            return true;
+        }
+        if (1 == m_depth) {
+            m_isDirectiveKey = JSON_MESSAGE_DIRECTIVE_KEY.compare(0, std::string::npos, value, length) == 0;
+        } else if (2 == m_depth) {
+            m_isPayloadKey =
+                m_isDirectiveKey && JSON_MESSAGE_PAYLOAD_KEY.compare(0, std::string::npos, value, length) == 0;
+        }
+        return m_document->Key(value, length, copy);
+    }
+    bool StartObject() {
+        ++m_depth;
+        if (isInPayload()) {
+            return true;
+        }
+        if (2 == m_depth) {
+            m_isPayloadKey = false;
+        }
+        // Only the first payload member is recorded, as FindMember() would find.
+        if (3 == m_depth && m_isPayloadKey && !m_hasObjectPayload) {
+            m_payloadDepth = m_depth;
+            // The reader has consumed the opening brace.
+            m_payloadBegin = m_stream.Tell() - 1;
+        }
+        return m_document->StartObject();
+    }
+    bool EndObject(SizeType memberCount) {
+        if (isInPayload()) {
+            if (m_depth-- != m_payloadDepth) {
+                return true;
+            }
+            // The reader has consumed the closing brace.
+            m_payloadEnd = m_stream.Tell();
+            m_payloadDepth = 0;
+            m_hasObjectPayload = true;
+            return m_document->EndObject(0);
+        }
+        --m_depth;
+        return m_document->EndObject(memberCount);
+    }
+    bool StartArray() {
+        ++m_depth;
+        if (isInPayload()) {
+            return true;
+        }
+        if (2 == m_depth) {
+            m_isPayloadKey = false;
+        }
+        return m_document->StartArray();
+    }
+    bool EndArray(SizeType elementCount) {
+        --m_depth;
+        return isInPayload() || m_document->EndArray(elementCount);
+    }
+    /// @}
+
+private:
+    /// @return Whether the members of an object payload are being parsed.
+    bool isInPayload() const {
+        return m_payloadDepth != 0;
+    }
+
+    /// The document built.
+    Document* m_document;
+
+    /// The stream being parsed.
+    const PositionTrackingStringStream& m_stream;
+
+    /// The number of objects and arrays open.
+    int m_depth;
+
+    /// Whether the last key of the root object was the directive key.
+    bool m_isDirectiveKey;
+
+    /// Whether the last key of the directive object was the payload key.
+    bool m_isPayloadKey;
+
+    /// The depth of the payload object while its members are being parsed, or 0.
+    int m_payloadDepth;
+
+    /// The offset of the opening brace of the payload.
+    size_t m_payloadBegin;
+
+    /// The offset just after the closing brace of the payload.
+    size_t m_payloadEnd;
+
+    /// Whether a payload object has been parsed.
+    bool m_hasObjectPayload;
+};
 
 /**
  * Utility function to parse the header from a rapidjson document structure.
@@ -236,16 +434,59 @@ static utils::Optional<AVSMessageEndpoint> parseEndpoint(const Document& documen
     return utils::Optional<AVSMessageEndpoint>(messageEndpoint);
 }
 
+/// A document parsed in place in a buffer, which must live as long as the document.
+struct PayloadDocument {
+    /**
+     * Constructor.
+     *
+     * @param payload The JSON to parse.
+     */
+    explicit PayloadDocument(std::string payload) : buffer{std::move(payload)} {
+    }
+
+    /// The JSON, which is modified by parsing it in place.
+    std::string buffer;
+
+    /// The document, whose strings point into @c buffer.
+    Document document;
+};
+
 std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective::create(
     const std::string& unparsedDirective,
     std::shared_ptr<AttachmentManagerInterface> attachmentManager,
     const std::string& attachmentContextId) {
+    return create(std::make_shared<const std::string>(unparsedDirective), attachmentManager, attachmentContextId);
+}
+
+std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective::create(
+    std::shared_ptr<const std::string> unparsedDirective,
+    std::shared_ptr<AttachmentManagerInterface> attachmentManager,
+    const std::string& attachmentContextId) {
     std::pair<std::unique_ptr<AVSDirective>, ParseStatus> result;
     result.second = ParseStatus::SUCCESS;
 
+    if (!unparsedDirective) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullUnparsedDirective"));
+        result.second = ParseStatus::ERROR_INVALID_JSON;
+        return result;
+    }
+
     Document document;
-    if (!parseDocument(unparsedDirective, &document)) {
-        ACSDK_ERROR(LX("createFailed").m("failed to parse JSON"));
+    PositionTrackingStringStream stream(unparsedDirective->c_str());
+    DirectiveHandler handler(&document, stream);
+    ParseResult parseResult;
+    auto generator = [&stream, &handler, &parseResult](Document&) {
+        Reader reader;
+        parseResult = reader.Parse(stream, handler);
+        return !parseResult.IsError();
+    };
+    document.Populate(generator);
+    if (parseResult.IsError()) {
+        ACSDK_ERROR(LX("createFailed")
+                        .m("failed to parse JSON")
+                        .d("offset", parseResult.Offset())
+                        .d("error", GetParseError_En(parseResult.Code()))
+                        .d("unparsedDirective", *unparsedDirective));
         result.second = ParseStatus::ERROR_INVALID_JSON;
         return result;
     }
@@ -256,16 +497,23 @@ std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective
         return result;
     }
 
-    auto payload = parsePayload(document, &(result.second));
-    if (ParseStatus::SUCCESS != result.second) {
-        ACSDK_ERROR(LX("createFailed").m("failed to parse payload"));
-        return result;
+    std::string payload;
+    size_t payloadBegin = 0;
+    size_t payloadLength = 0;
+    if (handler.getObjectPayload(&payloadBegin, &payloadLength)) {
+        payload = unparsedDirective->substr(payloadBegin, payloadLength);
+    } else {
+        payload = parsePayload(document, &(result.second));
+        if (ParseStatus::SUCCESS != result.second) {
+            ACSDK_ERROR(LX("createFailed").m("failed to parse payload"));
+            return result;
+        }
     }
 
     auto endpoint = parseEndpoint(document);
 
-    result.first = std::unique_ptr<AVSDirective>(
-        new AVSDirective(unparsedDirective, header, payload, attachmentManager, attachmentContextId, endpoint));
+    result.first = std::unique_ptr<AVSDirective>(new AVSDirective(
+        std::move(unparsedDirective), header, std::move(payload), attachmentManager, attachmentContextId, endpoint));
 
     return result;
 }
@@ -286,7 +534,12 @@ std::unique_ptr<AVSDirective> AVSDirective::create(
         return nullptr;
     }
     return std::unique_ptr<AVSDirective>(new AVSDirective(
-        unparsedDirective, avsMessageHeader, payload, attachmentManager, attachmentContextId, endpoint));
+        std::make_shared<const std::string>(unparsedDirective),
+        avsMessageHeader,
+        payload,
+        attachmentManager,
+        attachmentContextId,
+        endpoint));
 }
 
 std::unique_ptr<AttachmentReader> AVSDirective::getAttachmentReader(
@@ -297,20 +550,38 @@ std::unique_ptr<AttachmentReader> AVSDirective::getAttachmentReader(
 }
 
 AVSDirective::AVSDirective(
-    const std::string& unparsedDirective,
+    std::shared_ptr<const std::string> unparsedDirective,
     std::shared_ptr<AVSMessageHeader> avsMessageHeader,
-    const std::string& payload,
+    std::string payload,
     std::shared_ptr<AttachmentManagerInterface> attachmentManager,
     const std::string& attachmentContextId,
     const utils::Optional<AVSMessageEndpoint>& endpoint) :
-        AVSMessage{avsMessageHeader, payload, endpoint},
-        m_unparsedDirective{unparsedDirective},
+        AVSMessage{avsMessageHeader, std::move(payload), endpoint},
+        m_unparsedDirective{std::move(unparsedDirective)},
         m_attachmentManager{attachmentManager},
         m_attachmentContextId{attachmentContextId} {
 }
 
 std::string AVSDirective::getUnparsedDirective() const {
-    return m_unparsedDirective;
+    return *m_unparsedDirective;
+}
+
+std::shared_ptr<const Document> AVSDirective::getPayloadDocument() const {
+    std::lock_guard<std::mutex> lock(m_payloadDocumentMutex);
+    if (!m_payloadDocument) {
+        // The strings of the document are parsed in place in its own copy of the payload, and its values come from
+        // the document's pool allocator, so parsing allocates little beyond the copy.
+        auto payloadDocument = std::make_shared<PayloadDocument>(getPayload());
+        payloadDocument->document.ParseInsitu(&payloadDocument->buffer[0]);
+        if (payloadDocument->document.HasParseError()) {
+            ACSDK_ERROR(LX("getPayloadDocumentFailed")
+                            .d("offset", payloadDocument->document.GetErrorOffset())
+                            .d("error", GetParseError_En(payloadDocument->document.GetParseError()))
+                            .d("messageId", getMessageId()));
+        }
+        m_payloadDocument = std::shared_ptr<const Document>(payloadDocument, &payloadDocument->document);
+    }
+    return m_payloadDocument;
 }
 
 std::string AVSDirective::getAttachmentContextId() const {
@@ -17,7 +17,13 @@
 
 #include "AVSCommon/AVS/Initialization/AlexaClientSDKInit.h"
 #include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Logger/BinaryFileLogger.h"
+#include "AVSCommon/Utils/Logger/ConsoleLogger.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
+#include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -34,9 +40,176 @@ static const std::string TAG("AlexaClientSdkInit");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Name of the @c ConfigurationNode for threading settings.
+static const std::string THREADING_CONFIG_KEY("threading");
+
+/// Key for the executor mode within the threading settings.
+static const std::string EXECUTOR_MODE_KEY("executorMode");
+
+/// Key for the number of shared scheduler workers within the threading settings.
+static const std::string SCHEDULER_WORKER_COUNT_KEY("schedulerWorkerCount");
+
+/// Key for the timer coalescing slack in milliseconds within the threading settings.
+static const std::string TIMER_SLACK_MS_KEY("timerSlackMs");
+
+/// Value of @c EXECUTOR_MODE_KEY selecting @c ExecutorMode::SHARED_SCHEDULER.
+static const std::string SHARED_SCHEDULER_MODE("SHARED_SCHEDULER");
+
+/// Value of @c EXECUTOR_MODE_KEY selecting @c ExecutorMode::DEDICATED_THREAD.
+static const std::string DEDICATED_THREAD_MODE("DEDICATED_THREAD");
+
+/// Name of the @c ConfigurationNode for console logger settings.
+static const std::string CONSOLE_LOGGER_CONFIG_KEY("consoleLogger");
+
+/// Key for the number of entries queued for the background log writer within the console logger settings.
+static const std::string ASYNC_QUEUE_SIZE_KEY("asyncQueueSize");
+
+/// Key for the @c AsyncLogWriter::OverflowPolicy name within the console logger settings.
+static const std::string ASYNC_OVERFLOW_POLICY_KEY("asyncOverflowPolicy");
+
+/// Name of the @c ConfigurationNode for binary file logger settings.
+static const std::string BINARY_FILE_LOGGER_CONFIG_KEY("binaryFileLogger");
+
+/// Key for the path of the current file within the binary file logger settings.
+static const std::string BINARY_FILE_PATH_KEY("path");
+
+/// Key for the size of each file in KiB within the binary file logger settings.
+static const std::string BINARY_FILE_SIZE_KB_KEY("fileSizeKb");
+
+/// Key for the number of files kept within the binary file logger settings.
+static const std::string BINARY_FILE_COUNT_KEY("fileCount");
+
+/// Name of the @c ConfigurationNode for the settings of the pool of stream buffers.
+static const std::string SDS_BUFFER_POOL_CONFIG_KEY("sdsBufferPool");
+
+/// Key for the capacity of the smallest size class in KiB within the stream buffer pool settings.
+static const std::string MIN_CLASS_SIZE_KB_KEY("minClassSizeKb");
+
+/// Key for the capacity of the largest size class in KiB within the stream buffer pool settings.
+static const std::string MAX_CLASS_SIZE_KB_KEY("maxClassSizeKb");
+
+/// Key for the most capacity kept in idle buffers in KiB within the stream buffer pool settings.
+static const std::string MAX_RETAINED_KB_KEY("maxRetainedKb");
+
+/// Key for whether pooled buffers are advised to use transparent huge pages within the stream buffer pool settings.
+static const std::string USE_HUGE_PAGES_KEY("useHugePages");
+
+/// Key for whether pooled buffers are locked in RAM within the stream buffer pool settings.
+static const std::string LOCK_MEMORY_KEY("lockMemory");
+
+/// The size of each binary log file in KiB if not configured.
+static const int DEFAULT_BINARY_FILE_SIZE_KB = 1024;
+
+/// The number of binary log files kept if not configured.
+static const int DEFAULT_BINARY_FILE_COUNT = 4;
+
 /// Tracks whether we've initialized the Alexa Client SDK or not
 std::atomic_int AlexaClientSDKInit::g_isInitialized{0};
 
+/**
+ * Apply the threading settings from the configuration. This must run before the first @c Executor or timer is used for
+ * the settings to apply to every executor and timer.
+ */
+static void configureThreading() {
+    auto config = utils::configuration::ConfigurationNode::getRoot()[THREADING_CONFIG_KEY];
+
+    int workerCount = 0;
+    if (config.getInt(SCHEDULER_WORKER_COUNT_KEY, &workerCount) && workerCount >= 0) {
+        utils::threading::WorkStealingScheduler::setDefaultWorkerCount(static_cast<size_t>(workerCount));
+    }
+
+    int timerSlackMs = 0;
+    if (config.getInt(TIMER_SLACK_MS_KEY, &timerSlackMs) && timerSlackMs > 0) {
+        utils::timing::TimerWheel::setDefaultSlack(std::chrono::milliseconds(timerSlackMs));
+    }
+
+    std::string mode;
+    if (!config.getString(EXECUTOR_MODE_KEY, &mode)) {
+        return;
+    }
+    if (SHARED_SCHEDULER_MODE == mode) {
+        utils::threading::Executor::setDefaultMode(utils::threading::ExecutorMode::SHARED_SCHEDULER);
+    } else if (DEDICATED_THREAD_MODE == mode) {
+        utils::threading::Executor::setDefaultMode(utils::threading::ExecutorMode::DEDICATED_THREAD);
+    } else {
+        ACSDK_WARN(LX("configureThreadingFailed").d("reason", "unknownExecutorMode").d("mode", mode));
+    }
+}
+
+/**
+ * Apply the console logger settings that can only be read once the configuration is available. The logger itself is
+ * created, and reads its level, before that.
+ */
+static void configureConsoleLogger() {
+    auto config = utils::configuration::ConfigurationNode::getRoot()[CONSOLE_LOGGER_CONFIG_KEY];
+
+    int queueSize = 0;
+    if (!config.getInt(ASYNC_QUEUE_SIZE_KEY, &queueSize) || queueSize <= 0) {
+        return;
+    }
+    auto policy = utils::logger::AsyncLogWriter::OverflowPolicy::DROP;
+    std::string policyName;
+    if (config.getString(ASYNC_OVERFLOW_POLICY_KEY, &policyName) &&
+        !utils::logger::AsyncLogWriter::convertNameToOverflowPolicy(policyName, &policy)) {
+        ACSDK_WARN(LX("configureLoggingFailed").d("reason", "unknownOverflowPolicy").d("policy", policyName));
+    }
+    auto consoleLogger =
+        std::dynamic_pointer_cast<utils::logger::ConsoleLogger>(utils::logger::ConsoleLogger::instance());
+    if (consoleLogger && !consoleLogger->enableAsync(static_cast<size_t>(queueSize), policy)) {
+        ACSDK_WARN(LX("configureLoggingFailed").d("reason", "enableAsyncFailed").d("queueSize", queueSize));
+    }
+}
+
+/**
+ * Open the files of the binary file logger, if they are configured. The logger is only the sink when the SDK is built
+ * with ACSDK_LOG_SINK=BinaryFile.
+ */
+static void configureBinaryFileLogger() {
+    auto config = utils::configuration::ConfigurationNode::getRoot()[BINARY_FILE_LOGGER_CONFIG_KEY];
+
+    std::string path;
+    if (!config.getString(BINARY_FILE_PATH_KEY, &path) || path.empty()) {
+        return;
+    }
+    int fileSizeKb = 0;
+    config.getInt(BINARY_FILE_SIZE_KB_KEY, &fileSizeKb, DEFAULT_BINARY_FILE_SIZE_KB);
+    int fileCount = 0;
+    config.getInt(BINARY_FILE_COUNT_KEY, &fileCount, DEFAULT_BINARY_FILE_COUNT);
+    auto binaryFileLogger =
+        std::dynamic_pointer_cast<utils::logger::BinaryFileLogger>(utils::logger::BinaryFileLogger::instance());
+    if (fileSizeKb <= 0 || fileCount <= 0 || !binaryFileLogger ||
+        !binaryFileLogger->open(path, static_cast<size_t>(fileSizeKb) * 1024, static_cast<size_t>(fileCount))) {
+        ACSDK_WARN(LX("configureLoggingFailed")
+                       .d("reason", "openBinaryFileFailed")
+                       .d("path", path)
+                       .d("fileSizeKb", fileSizeKb)
+                       .d("fileCount", fileCount));
+    }
+}
+
+/**
+ * Apply the settings of the pool the buffers of in-process streams are drawn from. This must run before the first
+ * stream buffer is acquired for the settings to apply.
+ */
+static void configureSDSBufferPool() {
+    auto config = utils::configuration::ConfigurationNode::getRoot()[SDS_BUFFER_POOL_CONFIG_KEY];
+
+    utils::sds::SDSBufferPool::Configuration poolConfiguration;
+    int kilobytes = 0;
+    if (config.getInt(MIN_CLASS_SIZE_KB_KEY, &kilobytes) && kilobytes > 0) {
+        poolConfiguration.minClassSize = static_cast<size_t>(kilobytes) * 1024;
+    }
+    if (config.getInt(MAX_CLASS_SIZE_KB_KEY, &kilobytes) && kilobytes > 0) {
+        poolConfiguration.maxClassSize = static_cast<size_t>(kilobytes) * 1024;
+    }
+    if (config.getInt(MAX_RETAINED_KB_KEY, &kilobytes) && kilobytes >= 0) {
+        poolConfiguration.maxRetainedBytes = static_cast<size_t>(kilobytes) * 1024;
+    }
+    config.getBool(USE_HUGE_PAGES_KEY, &poolConfiguration.useHugePages, poolConfiguration.useHugePages);
+    config.getBool(LOCK_MEMORY_KEY, &poolConfiguration.lockMemory, poolConfiguration.lockMemory);
+    utils::sds::SDSBufferPool::setDefaultConfiguration(poolConfiguration);
+}
+
 bool AlexaClientSDKInit::isInitialized() {
     return g_isInitialized > 0;
 }
@@ -52,6 +225,11 @@ bool AlexaClientSDKInit::initialize(const std::vector<std::shared_ptr<std::istre
         return false;
     }
 
+    configureThreading();
+    configureConsoleLogger();
+    configureBinaryFileLogger();
+    configureSDSBufferPool();
+
     if (CURLE_OK != curl_global_init(CURL_GLOBAL_ALL)) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "curl_global_initFailed"));
         utils::configuration::ConfigurationNode::uninitialize();
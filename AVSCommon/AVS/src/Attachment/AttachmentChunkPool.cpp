@@ -0,0 +1,98 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkPool.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AttachmentChunkPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+const size_t AttachmentChunkPool::DEFAULT_CHUNK_SIZE = 16 * 1024;
+const size_t AttachmentChunkPool::DEFAULT_MAX_IDLE_CHUNKS = 64;
+
+std::shared_ptr<AttachmentChunkPool> AttachmentChunkPool::create(size_t chunkSize, size_t maxIdleChunks) {
+    if (0 == chunkSize) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroChunkSize"));
+        return nullptr;
+    }
+    return std::shared_ptr<AttachmentChunkPool>(new AttachmentChunkPool(chunkSize, maxIdleChunks));
+}
+
+std::shared_ptr<AttachmentChunkPool> AttachmentChunkPool::getDefault() {
+    static auto pool = create();
+    return pool;
+}
+
+AttachmentChunkPool::AttachmentChunkPool(size_t chunkSize, size_t maxIdleChunks) :
+        m_chunkSize{chunkSize},
+        m_maxIdleChunks{maxIdleChunks},
+        m_inUseCount{0} {
+}
+
+AttachmentChunkPool::Chunk AttachmentChunkPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_inUseCount;
+        if (!m_idleChunks.empty()) {
+            auto chunk = std::move(m_idleChunks.back());
+            m_idleChunks.pop_back();
+            return chunk;
+        }
+    }
+    // Allocated without the lock held, and not value-initialized as the attachment only reads what it wrote.
+    return Chunk(new uint8_t[m_chunkSize]);
+}
+
+void AttachmentChunkPool::release(Chunk chunk) {
+    if (!chunk) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_inUseCount;
+    if (m_idleChunks.size() < m_maxIdleChunks) {
+        m_idleChunks.push_back(std::move(chunk));
+    }
+}
+
+size_t AttachmentChunkPool::getChunkSize() const {
+    return m_chunkSize;
+}
+
+size_t AttachmentChunkPool::getIdleCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idleChunks.size();
+}
+
+size_t AttachmentChunkPool::getInUseCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inUseCount;
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
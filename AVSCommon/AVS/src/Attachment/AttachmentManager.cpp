@@ -15,6 +15,7 @@
 
 #include <vector>
 
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
@@ -102,6 +103,16 @@ AttachmentManager::AttachmentManagementDetails& AttachmentManager::getDetailsLoc
                 details.attachment =
                     alexaClientSDK::avsCommon::utils::memory::make_unique<InProcessAttachment>(attachmentId);
                 break;
+            // The chunked attachment type.
+            case AttachmentType::CHUNKED:
+                // Constructed directly, as make_unique() would bind SDS_BUFFER_DEFAULT_SIZE_IN_BYTES, which is only
+                // declared, to a reference.
+                details.attachment = std::unique_ptr<Attachment>(new ChunkedAttachment(
+                    attachmentId,
+                    nullptr,
+                    InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES,
+                    ChunkedAttachment::SEEKABLE_READER_REACH_BACK_BYTES));
+                break;
         }
 
         // In code compiled with no warnings, the following test should never pass.
@@ -18,6 +18,7 @@
 #include <AVSCommon/AVS/Attachment/InProcessAttachmentReader.h>
 #include "AVSCommon/AVS/Attachment/AttachmentUtils.h"
 #include <AVSCommon/Utils/SDS/InProcessSDS.h>
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 using namespace alexaClientSDK::avsCommon::utils::sds;
@@ -42,7 +43,7 @@ static const std::size_t MAX_READER_SIZE = 4 * 1024;
 
 std::unique_ptr<AttachmentReader> AttachmentUtils::createAttachmentReader(const std::vector<char>& srcBuffer) {
     auto bufferSize = InProcessSDS::calculateBufferSize(srcBuffer.size());
-    auto buffer = std::make_shared<InProcessSDS::Buffer>(bufferSize);
+    auto buffer = SDSBufferPool::getDefault()->acquire(bufferSize);
     auto stream = InProcessSDS::create(buffer);
 
     if (!stream) {
@@ -0,0 +1,68 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+const size_t ChunkedAttachment::SEEKABLE_READER_REACH_BACK_BYTES = 256 * 1024;
+
+ChunkedAttachment::ChunkedAttachment(
+    const std::string& id,
+    std::shared_ptr<AttachmentChunkPool> pool,
+    size_t maxBufferedBytes,
+    size_t minReachBackBytes) :
+        Attachment(id),
+        m_buffer{std::make_shared<ChunkedAttachmentBuffer>(
+            pool ? std::move(pool) : AttachmentChunkPool::getDefault(),
+            maxBufferedBytes,
+            minReachBackBytes)} {
+}
+
+std::unique_ptr<AttachmentWriter> ChunkedAttachment::createWriter(utils::sds::WriterPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_hasCreatedWriter) {
+        return nullptr;
+    }
+    m_hasCreatedWriter = true;
+
+    return std::unique_ptr<AttachmentWriter>(new ChunkedAttachmentWriter(m_buffer, policy));
+}
+
+std::unique_ptr<AttachmentReader> ChunkedAttachment::createReader(utils::sds::ReaderPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_hasCreatedReader) {
+        return nullptr;
+    }
+    m_hasCreatedReader = true;
+
+    return std::unique_ptr<AttachmentReader>(new ChunkedAttachmentReader(m_buffer, policy));
+}
+
+size_t ChunkedAttachment::getAllocatedBytes() {
+    return m_buffer->getAllocatedBytes();
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
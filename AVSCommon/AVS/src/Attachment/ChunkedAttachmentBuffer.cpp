@@ -0,0 +1,311 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace utils::sds;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ChunkedAttachmentBuffer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+ChunkedAttachmentBuffer::ChunkedAttachmentBuffer(
+    std::shared_ptr<AttachmentChunkPool> pool,
+    size_t maxBufferedBytes,
+    size_t minReachBackBytes) :
+        m_pool{std::move(pool)},
+        m_chunkSize{m_pool->getChunkSize()},
+        m_maxBufferedBytes{maxBufferedBytes},
+        m_minReachBackBytes{minReachBackBytes},
+        m_firstChunkIndex{0},
+        m_oldestOffset{0},
+        m_writeOffset{0},
+        m_readOffset{0},
+        m_readerCloseOffset{UINT64_MAX},
+        m_isWriterClosed{false},
+        m_isReaderClosed{false} {
+}
+
+ChunkedAttachmentBuffer::~ChunkedAttachmentBuffer() {
+    for (auto& chunk : m_chunks) {
+        m_pool->release(std::move(chunk));
+    }
+}
+
+size_t ChunkedAttachmentBuffer::write(
+    const void* buf,
+    size_t numBytes,
+    WriterPolicy policy,
+    AttachmentWriter::WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    if (!writeStatus) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "writeStatus is nullptr"));
+        return 0;
+    }
+    if (!buf) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "buf is nullptr"));
+        *writeStatus = AttachmentWriter::WriteStatus::ERROR_INTERNAL;
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_isWriterClosed) {
+        *writeStatus = AttachmentWriter::WriteStatus::CLOSED;
+        return 0;
+    }
+    *writeStatus = AttachmentWriter::WriteStatus::OK;
+    if (0 == numBytes || m_isReaderClosed) {
+        // Nothing will read the data any more, so it is discarded.
+        return numBytes;
+    }
+
+    size_t count = numBytes;
+    switch (policy) {
+        case WriterPolicy::NONBLOCKABLE:
+            break;
+        case WriterPolicy::ALL_OR_NOTHING:
+            if (numBytes > getFreeSpaceLocked()) {
+                *writeStatus = AttachmentWriter::WriteStatus::OK_BUFFER_FULL;
+                return 0;
+            }
+            break;
+        case WriterPolicy::BLOCKING: {
+            auto canWrite = [this] { return m_isWriterClosed || m_isReaderClosed || getFreeSpaceLocked() > 0; };
+            if (std::chrono::milliseconds::zero() == timeout) {
+                m_spaceAvailable.wait(lock, canWrite);
+            } else if (!m_spaceAvailable.wait_for(lock, timeout, canWrite)) {
+                *writeStatus = AttachmentWriter::WriteStatus::TIMEDOUT;
+                return 0;
+            }
+            if (m_isWriterClosed) {
+                *writeStatus = AttachmentWriter::WriteStatus::CLOSED;
+                return 0;
+            }
+            if (m_isReaderClosed) {
+                return numBytes;
+            }
+            count = static_cast<size_t>(std::min<uint64_t>(numBytes, getFreeSpaceLocked()));
+            break;
+        }
+    }
+
+    auto source = static_cast<const uint8_t*>(buf);
+    for (size_t written = 0; written < count;) {
+        auto offsetInChunk = static_cast<size_t>(m_writeOffset % m_chunkSize);
+        auto piece = std::min(count - written, m_chunkSize - offsetInChunk);
+        auto end = m_writeOffset + piece;
+        if (end > m_maxBufferedBytes) {
+            // Only reached by a NONBLOCKABLE writer, or once the reader has consumed the data discarded.
+            discardBeforeLocked(end - m_maxBufferedBytes);
+        }
+        auto chunkIndex = m_writeOffset / m_chunkSize;
+        if (m_chunks.empty()) {
+            m_firstChunkIndex = chunkIndex;
+        }
+        if (chunkIndex - m_firstChunkIndex == m_chunks.size()) {
+            m_chunks.push_back(m_pool->acquire());
+        }
+        memcpy(m_chunks[chunkIndex - m_firstChunkIndex].get() + offsetInChunk, source + written, piece);
+        m_writeOffset = end;
+        written += piece;
+    }
+    m_dataAvailable.notify_all();
+    return count;
+}
+
+void ChunkedAttachmentBuffer::closeWriter() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isWriterClosed = true;
+    m_dataAvailable.notify_all();
+    m_spaceAvailable.notify_all();
+}
+
+size_t ChunkedAttachmentBuffer::read(
+    void* buf,
+    size_t numBytes,
+    ReaderPolicy policy,
+    AttachmentReader::ReadStatus* readStatus,
+    std::chrono::milliseconds timeout) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "read status is nullptr"));
+        return 0;
+    }
+    if (!buf) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "buf is nullptr"));
+        *readStatus = AttachmentReader::ReadStatus::ERROR_INTERNAL;
+        return 0;
+    }
+    if (timeout.count() < 0) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "negative timeout"));
+        *readStatus = AttachmentReader::ReadStatus::ERROR_INTERNAL;
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    *readStatus = AttachmentReader::ReadStatus::OK;
+    while (true) {
+        if (m_isReaderClosed) {
+            *readStatus = AttachmentReader::ReadStatus::CLOSED;
+            return 0;
+        }
+        if (0 == numBytes) {
+            return 0;
+        }
+        if (m_readOffset < m_oldestOffset) {
+            // An attachment cannot recover from this.
+            ACSDK_ERROR(LX("readFailed").d("reason", "memory overrun by writer"));
+            *readStatus = AttachmentReader::ReadStatus::ERROR_OVERRUN;
+            releaseAllLocked();
+            return 0;
+        }
+        if (m_readOffset >= m_readerCloseOffset) {
+            *readStatus = AttachmentReader::ReadStatus::CLOSED;
+            releaseAllLocked();
+            return 0;
+        }
+        if (m_readOffset < m_writeOffset) {
+            break;
+        }
+        if (m_isWriterClosed) {
+            *readStatus = AttachmentReader::ReadStatus::CLOSED;
+            return 0;
+        }
+        if (ReaderPolicy::NONBLOCKING == policy) {
+            *readStatus = AttachmentReader::ReadStatus::OK_WOULDBLOCK;
+            return 0;
+        }
+        auto canRead = [this] { return canReadLocked(); };
+        if (std::chrono::milliseconds::zero() == timeout) {
+            m_dataAvailable.wait(lock, canRead);
+        } else if (!m_dataAvailable.wait_for(lock, timeout, canRead)) {
+            *readStatus = AttachmentReader::ReadStatus::OK_TIMEDOUT;
+            return 0;
+        }
+    }
+
+    auto readable = std::min(m_writeOffset, m_readerCloseOffset) - m_readOffset;
+    auto count = static_cast<size_t>(std::min<uint64_t>(numBytes, readable));
+    auto destination = static_cast<uint8_t*>(buf);
+    for (size_t read = 0; read < count;) {
+        auto offsetInChunk = static_cast<size_t>(m_readOffset % m_chunkSize);
+        auto piece = std::min(count - read, m_chunkSize - offsetInChunk);
+        auto& chunk = m_chunks[m_readOffset / m_chunkSize - m_firstChunkIndex];
+        memcpy(destination + read, chunk.get() + offsetInChunk, piece);
+        m_readOffset += piece;
+        read += piece;
+    }
+    if (m_readOffset > m_minReachBackBytes) {
+        // The reader can no longer seek back to data beyond its reach-back window.
+        discardBeforeLocked(m_readOffset - m_minReachBackBytes);
+    }
+    m_spaceAvailable.notify_all();
+    return count;
+}
+
+bool ChunkedAttachmentBuffer::seek(uint64_t offset) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isReaderClosed || offset < m_oldestOffset) {
+        return false;
+    }
+    m_readOffset = offset;
+    m_spaceAvailable.notify_all();
+    return true;
+}
+
+bool ChunkedAttachmentBuffer::waitForData(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_dataAvailable.wait_for(lock, timeout, [this] { return canReadLocked(); });
+}
+
+uint64_t ChunkedAttachmentBuffer::getNumUnreadBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isReaderClosed || m_readOffset >= m_writeOffset) {
+        return 0;
+    }
+    return m_writeOffset - m_readOffset;
+}
+
+void ChunkedAttachmentBuffer::closeReader(AttachmentReader::ClosePoint closePoint) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isReaderClosed) {
+        return;
+    }
+    switch (closePoint) {
+        case AttachmentReader::ClosePoint::IMMEDIATELY:
+            releaseAllLocked();
+            return;
+        case AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER:
+            m_readerCloseOffset = std::min(m_readerCloseOffset, m_writeOffset);
+            m_dataAvailable.notify_all();
+            return;
+    }
+}
+
+size_t ChunkedAttachmentBuffer::getAllocatedBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_chunks.size() * m_chunkSize;
+}
+
+bool ChunkedAttachmentBuffer::canReadLocked() const {
+    return m_isReaderClosed || m_isWriterClosed || m_readOffset < m_writeOffset || m_readOffset >= m_readerCloseOffset;
+}
+
+void ChunkedAttachmentBuffer::discardBeforeLocked(uint64_t offset) {
+    if (offset <= m_oldestOffset) {
+        return;
+    }
+    m_oldestOffset = offset;
+    while (!m_chunks.empty() && (m_firstChunkIndex + 1) * m_chunkSize <= m_oldestOffset) {
+        m_pool->release(std::move(m_chunks.front()));
+        m_chunks.pop_front();
+        ++m_firstChunkIndex;
+    }
+}
+
+void ChunkedAttachmentBuffer::releaseAllLocked() {
+    m_isReaderClosed = true;
+    for (auto& chunk : m_chunks) {
+        m_pool->release(std::move(chunk));
+    }
+    m_chunks.clear();
+    m_dataAvailable.notify_all();
+    m_spaceAvailable.notify_all();
+}
+
+uint64_t ChunkedAttachmentBuffer::getFreeSpaceLocked() const {
+    auto consumed = std::max(m_readOffset, m_oldestOffset);
+    auto unconsumed = consumed < m_writeOffset ? m_writeOffset - consumed : 0;
+    return unconsumed < m_maxBufferedBytes ? m_maxBufferedBytes - unconsumed : 0;
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,61 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+ChunkedAttachmentReader::ChunkedAttachmentReader(
+    std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+    utils::sds::ReaderPolicy policy) :
+        m_buffer{std::move(buffer)},
+        m_policy{policy} {
+}
+
+ChunkedAttachmentReader::~ChunkedAttachmentReader() {
+    close(ClosePoint::IMMEDIATELY);
+}
+
+std::size_t ChunkedAttachmentReader::read(
+    void* buf,
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    return m_buffer->read(buf, numBytes, m_policy, readStatus, timeoutMs);
+}
+
+void ChunkedAttachmentReader::close(ClosePoint closePoint) {
+    m_buffer->closeReader(closePoint);
+}
+
+bool ChunkedAttachmentReader::seek(uint64_t offset) {
+    return m_buffer->seek(offset);
+}
+
+uint64_t ChunkedAttachmentReader::getNumUnreadBytes() {
+    return m_buffer->getNumUnreadBytes();
+}
+
+bool ChunkedAttachmentReader::waitForData(std::chrono::milliseconds timeout) {
+    return m_buffer->waitForData(timeout);
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
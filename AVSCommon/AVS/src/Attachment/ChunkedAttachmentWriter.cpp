@@ -0,0 +1,49 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+ChunkedAttachmentWriter::ChunkedAttachmentWriter(
+    std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+    utils::sds::WriterPolicy policy) :
+        m_buffer{std::move(buffer)},
+        m_policy{policy} {
+}
+
+ChunkedAttachmentWriter::~ChunkedAttachmentWriter() {
+    close();
+}
+
+std::size_t ChunkedAttachmentWriter::write(
+    const void* buf,
+    std::size_t numBytes,
+    WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    return m_buffer->write(buf, numBytes, m_policy, writeStatus, timeout);
+}
+
+void ChunkedAttachmentWriter::close() {
+    m_buffer->closeWriter();
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
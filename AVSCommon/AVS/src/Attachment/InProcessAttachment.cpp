@@ -15,6 +15,7 @@
 
 #include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -28,7 +29,7 @@ InProcessAttachment::InProcessAttachment(const std::string& id, std::unique_ptr<
         m_sds{std::move(sds)} {
     if (!m_sds) {
         auto buffSize = SDSType::calculateBufferSize(SDS_BUFFER_DEFAULT_SIZE_IN_BYTES);
-        auto buff = std::make_shared<SDSBufferType>(buffSize);
+        auto buff = utils::sds::SDSBufferPool::getDefault()->acquire(buffSize);
         m_sds = SDSType::create(buff);
     }
 }
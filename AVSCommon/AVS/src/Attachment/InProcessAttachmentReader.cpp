@@ -59,6 +59,10 @@ uint64_t InProcessAttachmentReader::getNumUnreadBytes() {
     return m_delegate->getNumUnreadBytes();
 }
 
+bool InProcessAttachmentReader::waitForData(std::chrono::milliseconds timeout) {
+    return m_delegate->waitForData(timeout);
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,242 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "AVSCommon/AVS/FramedAudioInputStream.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+using namespace utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("FramedAudioInputStream");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of bits in a byte.
+static const unsigned int BITS_PER_BYTE = 8;
+
+constexpr size_t FramedAudioInputStream::DEFAULT_MAX_WRITE_TIMES;
+
+std::shared_ptr<FramedAudioInputStream> FramedAudioInputStream::create(
+    std::shared_ptr<AudioInputStream> stream,
+    const AudioFormat& format,
+    size_t maxWriteTimes) {
+    if (!stream) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullStream"));
+        return nullptr;
+    }
+    if (format.encoding != AudioFormat::Encoding::LPCM) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedEncoding").d("encoding", format.encoding));
+        return nullptr;
+    }
+    if (0 == format.numChannels || 0 == format.sampleRateHz || 0 == format.sampleSizeInBits ||
+        format.sampleSizeInBits % BITS_PER_BYTE != 0) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidFormat")
+                        .d("numChannels", format.numChannels)
+                        .d("sampleRateHz", format.sampleRateHz)
+                        .d("sampleSizeInBits", format.sampleSizeInBits));
+        return nullptr;
+    }
+    if (format.numChannels > 1 && format.layout != AudioFormat::Layout::INTERLEAVED) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "notInterleaved"));
+        return nullptr;
+    }
+    auto frameSize = format.sampleSizeInBits / BITS_PER_BYTE * format.numChannels;
+    if (stream->getWordSize() != frameSize) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "wordSizeIsNotFrameSize")
+                        .d("wordSize", stream->getWordSize())
+                        .d("frameSize", frameSize));
+        return nullptr;
+    }
+    if (0 == maxWriteTimes) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "maxWriteTimesZero"));
+        return nullptr;
+    }
+    return std::shared_ptr<FramedAudioInputStream>(new FramedAudioInputStream(stream, format, maxWriteTimes));
+}
+
+FramedAudioInputStream::FramedAudioInputStream(
+    std::shared_ptr<AudioInputStream> stream,
+    const AudioFormat& format,
+    size_t maxWriteTimes) :
+        m_stream{stream},
+        m_format(format),
+        m_bytesPerSample{format.sampleSizeInBits / BITS_PER_BYTE},
+        m_nextWriteTime{0} {
+    m_writeTimes.reserve(maxWriteTimes);
+}
+
+std::shared_ptr<AudioInputStream> FramedAudioInputStream::getStream() const {
+    return m_stream;
+}
+
+const AudioFormat& FramedAudioInputStream::getFormat() const {
+    return m_format;
+}
+
+ssize_t FramedAudioInputStream::write(
+    AudioInputStream::Writer* writer,
+    const void* buf,
+    size_t nFrames,
+    std::chrono::milliseconds timeout) {
+    if (!writer) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "nullWriter"));
+        return AudioInputStream::Writer::Error::INVALID;
+    }
+    auto result = writer->write(buf, nFrames, timeout);
+    if (result > 0) {
+        markWritten(*writer);
+    }
+    return result;
+}
+
+void FramedAudioInputStream::markWritten(const AudioInputStream::Writer& writer, TimePoint time) {
+    WriteTime writeTime{writer.tell(), time};
+    std::lock_guard<std::mutex> lock(m_writeTimesMutex);
+    if (!m_writeTimes.empty()) {
+        auto& latest = m_writeTimes[(m_nextWriteTime + m_writeTimes.size() - 1) % m_writeTimes.size()];
+        if (writeTime.endIndex <= latest.endIndex) {
+            // Nothing was written since the last time was recorded.
+            return;
+        }
+    }
+    if (m_writeTimes.size() < m_writeTimes.capacity()) {
+        m_writeTimes.push_back(writeTime);
+    } else {
+        m_writeTimes[m_nextWriteTime] = writeTime;
+    }
+    m_nextWriteTime = (m_nextWriteTime + 1) % m_writeTimes.capacity();
+}
+
+bool FramedAudioInputStream::getIndex(TimePoint time, AudioInputStream::Index* index) const {
+    if (!index) {
+        ACSDK_ERROR(LX("getIndexFailed").d("reason", "nullIndex"));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_writeTimesMutex);
+    auto count = m_writeTimes.size();
+    // The ring is oldest first from m_nextWriteTime, which is zero until the ring is full.
+    auto at = [this, count](size_t i) -> const WriteTime& { return m_writeTimes[(m_nextWriteTime + i) % count]; };
+
+    // Binary search for the first write which completed after time; the write before it is the base to interpolate
+    // from.  Times are recorded in order, so the ring is sorted.
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (at(middle).time <= time) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (0 == low) {
+        ACSDK_WARN(LX("getIndexFailed").d("reason", "timeNotKept").d("writeTimes", count));
+        return false;
+    }
+
+    auto& base = at(low - 1);
+    // Whole seconds and the remainder are scaled separately so that the arithmetic is exact and cannot overflow.
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - base.time);
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(elapsed);
+    auto remainder = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed - seconds);
+    *index = base.endIndex + seconds.count() * m_format.sampleRateHz +
+             remainder.count() * m_format.sampleRateHz / std::chrono::nanoseconds(std::chrono::seconds(1)).count();
+    // Frames after the next write were captured after it completed, which is after time.
+    if (low < count && *index > at(low).endIndex) {
+        *index = at(low).endIndex;
+    }
+    return true;
+}
+
+bool FramedAudioInputStream::seek(AudioInputStream::Reader* reader, TimePoint time) const {
+    if (!reader) {
+        ACSDK_ERROR(LX("seekFailed").d("reason", "nullReader"));
+        return false;
+    }
+    AudioInputStream::Index index;
+    if (!getIndex(time, &index)) {
+        return false;
+    }
+    return reader->seek(index, AudioInputStream::Reader::Reference::ABSOLUTE);
+}
+
+ssize_t FramedAudioInputStream::readChannel(
+    AudioInputStream::Reader* reader,
+    size_t channel,
+    void* buf,
+    size_t nFrames,
+    std::chrono::milliseconds timeout) const {
+    if (!reader || !buf || 0 == nFrames) {
+        ACSDK_ERROR(LX("readChannelFailed")
+                        .d("reason", "invalidParameter")
+                        .d("nullReader", !reader)
+                        .d("nullBuffer", !buf)
+                        .d("numFrames", nFrames));
+        return AudioInputStream::Reader::Error::INVALID;
+    }
+    if (channel >= m_format.numChannels) {
+        ACSDK_ERROR(LX("readChannelFailed").d("reason", "invalidChannel").d("channel", channel));
+        return AudioInputStream::Reader::Error::INVALID;
+    }
+
+    // Peek at the frames in place, so that only the selected channel is copied.
+    AudioInputStream::Reader::Regions regions;
+    auto available = reader->peek(&regions, 1, timeout);
+    if (available <= 0) {
+        return available;
+    }
+    if (nFrames > static_cast<size_t>(available)) {
+        nFrames = available;
+    }
+
+    auto frameSize = reader->getWordSize();
+    auto out = static_cast<uint8_t*>(buf);
+    size_t remaining = nFrames;
+    for (size_t region = 0; region < 2 && remaining > 0; ++region) {
+        auto in = static_cast<const uint8_t*>(regions.data[region]) + channel * m_bytesPerSample;
+        auto frames = std::min(remaining, regions.nWords[region]);
+        for (size_t frame = 0; frame < frames; ++frame) {
+            memcpy(out, in, m_bytesPerSample);
+            out += m_bytesPerSample;
+            in += frameSize;
+        }
+        remaining -= frames;
+    }
+
+    auto result = reader->consume(nFrames);
+    if (result < 0) {
+        return result;
+    }
+    return nFrames;
+}
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -32,9 +32,15 @@ static const std::string TAG("MessageRequest");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-MessageRequest::MessageRequest(const std::string& jsonContent, const std::string& uriPathExtension) :
+MessageRequest::MessageRequest(
+    const std::string& jsonContent,
+    const std::string& uriPathExtension,
+    Priority priority,
+    const utils::Optional<Deadline>& deadline) :
         m_jsonContent{jsonContent},
-        m_uriPathExtension{uriPathExtension} {
+        m_uriPathExtension{uriPathExtension},
+        m_priority{priority},
+        m_deadline{deadline} {
 }
 
 MessageRequest::~MessageRequest() {
@@ -60,6 +66,22 @@ std::string MessageRequest::getUriPathExtension() {
     return m_uriPathExtension;
 }
 
+MessageRequest::Priority MessageRequest::getPriority() const {
+    return m_priority;
+}
+
+utils::Optional<MessageRequest::Deadline> MessageRequest::getDeadline() const {
+    return m_deadline;
+}
+
+void MessageRequest::setCoalescingKey(const std::string& coalescingKey) {
+    m_coalescingKey = coalescingKey;
+}
+
+std::string MessageRequest::getCoalescingKey() const {
+    return m_coalescingKey;
+}
+
 int MessageRequest::attachmentReadersCount() {
     return m_readers.size();
 }
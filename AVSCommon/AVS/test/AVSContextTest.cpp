@@ -85,6 +85,27 @@ TEST(AVSContextTest, test_toJsonWithoutPropertyInstance) {
     EXPECT_EQ(json.find(R"("instance":)"), std::string::npos);
 }
 
+/// Test that a cached json is served by toJson until a state is added or removed.
+TEST(AVSContextTest, test_cacheJsonIsDiscardedWhenStatesChange) {
+    AVSContext context;
+    context.addState(CAPABILITY_TAG, CAPABILITY_STATE);
+    context.cacheJson();
+    auto json = context.toJson();
+    EXPECT_NE(json.find(R"("value":)" + CAPABILITY_STATE.valuePayload), std::string::npos);
+
+    // A copy keeps the cached json.
+    AVSContext copy = context;
+    EXPECT_EQ(copy.toJson(), json);
+
+    CapabilityTag otherTag{"OtherNamespace", "OtherName", "EndpointId"};
+    context.addState(otherTag, CAPABILITY_STATE);
+    EXPECT_NE(context.toJson().find(R"("namespace":")" + otherTag.nameSpace), std::string::npos);
+
+    context.cacheJson();
+    context.removeState(otherTag);
+    EXPECT_EQ(context.toJson(), json);
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
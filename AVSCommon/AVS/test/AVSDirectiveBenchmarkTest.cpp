@@ -0,0 +1,217 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AVSDirectiveBenchmarkTest.cpp
+///
+/// Measures the CPU time to dispatch a directive: parsing it with @c AVSDirective::create() as @c MessageInterpreter
+/// does, then reading its payload in each of the capability agents and observers it reaches.  The payload is either
+/// parsed again from @c getPayload() by each reader, as capability agents used to, or shared with
+/// @c getPayloadDocument().  The directives are a 20 KB RenderTemplate and a Play of a playlist of 50 items.  Results
+/// are printed to stdout and recorded as test properties; only correctness is asserted so that the test is stable on
+/// loaded build machines.
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/Utils/JSON/JSONUtils.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace std::chrono;
+using namespace utils::json;
+using utils::reportBenchmarkResult;
+
+/// The number of times each directive is dispatched by each variant.
+static const int DISPATCHES = 500;
+
+/// The size the RenderTemplate directive is grown to.
+static const size_t RENDER_TEMPLATE_SIZE = 20 * 1024;
+
+/// The number of items in the playlist.
+static const int PLAYLIST_ITEMS = 50;
+
+/// The token of the last item of the RenderTemplate and of the playlist.
+static const std::string LAST_TOKEN = "last-token";
+
+/**
+ * Get the CPU time used by this process so far.
+ *
+ * @return The user and system CPU time.
+ */
+static microseconds cpuTime() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/**
+ * Build a directive.
+ *
+ * @param avsNamespace The namespace of the directive.
+ * @param name The name of the directive.
+ * @param payload The payload of the directive.
+ * @return The JSON of the directive.
+ */
+static std::string buildDirective(
+    const std::string& avsNamespace,
+    const std::string& name,
+    const std::string& payload) {
+    return R"({"directive":{"header":{"namespace":")" + avsNamespace + R"(","name":")" + name +
+           R"(","messageId":"6a0c1a5e-9b1f-4c1e-8d2a-3f4b5c6d7e8f",)" +
+           R"("dialogRequestId":"0b1e7a4c-3f6d-4e2b-8a9c-5d7f1e3b2a6c"},"payload":)" + payload + "}}";
+}
+
+/**
+ * Build a RenderTemplate directive for a list, with items added until it is @c RENDER_TEMPLATE_SIZE long.
+ *
+ * @return The JSON of the directive.
+ */
+static std::string buildRenderTemplate() {
+    std::string items;
+    int count = 0;
+    while (items.size() < RENDER_TEMPLATE_SIZE) {
+        ++count;
+        items += R"({"leftTextField":")" + std::to_string(count) + R"(.","rightTextField":"Item )" +
+                 std::to_string(count) + R"( of the list, with a description long enough to wrap on a screen",)" +
+                 R"("image":{"sources":[{"url":"https://images.example.com/item/)" + std::to_string(count) +
+                 R"(.png","size":"SMALL","widthPixels":120,"heightPixels":120}]},"token":"token-)" +
+                 std::to_string(count) + R"("},)";
+    }
+    items += R"({"leftTextField":"","rightTextField":"","token":")" + LAST_TOKEN + R"("})";
+    return buildDirective(
+        "TemplateRuntime",
+        "RenderTemplate",
+        R"({"token":"template-token","type":"ListTemplate1","title":{"mainTitle":"List","subTitle":"Items"},)"
+        R"("listItems":[)" +
+            items + "]}");
+}
+
+/**
+ * Build a Play directive for a playlist of @c PLAYLIST_ITEMS items.
+ *
+ * @return The JSON of the directive.
+ */
+static std::string buildPlaylist() {
+    std::string items;
+    for (int i = 1; i <= PLAYLIST_ITEMS; ++i) {
+        auto token = PLAYLIST_ITEMS == i ? LAST_TOKEN : "token-" + std::to_string(i);
+        items += R"({"audioItemId":"item-)" + std::to_string(i) + R"(","stream":{"url":"https://audio.example.com/)" +
+                 std::to_string(i) + R"(.mp3","streamFormat":"AUDIO_MPEG","offsetInMilliseconds":0,)" +
+                 R"("expiryTime":"2030-01-01T00:00:00+0000",)" +
+                 R"("progressReport":{"progressReportIntervalInMilliseconds":10000},"token":")" + token +
+                 R"(","expectedPreviousToken":""},"metadata":{"title":"Track )" +
+                 std::to_string(i) + R"(","artist":"Artist","album":"Album"}})" + (PLAYLIST_ITEMS == i ? "" : ",");
+    }
+    return buildDirective("AudioPlayer", "Play", R"({"playBehavior":"REPLACE_ALL","audioItems":[)" + items + "]}");
+}
+
+/**
+ * Read the token of the last item of an array in a payload, as a capability agent handling it would.
+ *
+ * @param payload The payload.
+ * @param arrayKey The key of the array.
+ * @return The token of the last item, or an empty string if it is missing.
+ */
+static std::string readLastToken(const rapidjson::Value& payload, const std::string& arrayKey) {
+    auto it = payload.FindMember(arrayKey);
+    if (payload.MemberEnd() == it || !it->value.IsArray() || it->value.Empty()) {
+        return "";
+    }
+    const auto& last = it->value[it->value.Size() - 1];
+    rapidjson::Value::ConstMemberIterator streamIt;
+    const auto& holder = jsonUtils::findNode(last, "stream", &streamIt) ? streamIt->value : last;
+    std::string token;
+    jsonUtils::retrieveValue(holder, "token", &token);
+    return token;
+}
+
+/// Fixture which dispatches directives and reports the CPU time per dispatch.
+class AVSDirectiveBenchmarkTest : public ::testing::Test {
+protected:
+    /**
+     * Dispatch a directive repeatedly, and report the CPU time per dispatch.
+     *
+     * @param variant The name of the variant.
+     * @param json The JSON of the directive.
+     * @param arrayKey The key of the array of items in the payload.
+     * @param readers The number of capability agents and observers which read the payload.
+     * @param isShared Whether the readers share the payload document rather than parse the payload again.
+     */
+    void run(
+        const std::string& variant,
+        const std::string& json,
+        const std::string& arrayKey,
+        int readers,
+        bool isShared) {
+        auto start = cpuTime();
+        for (int i = 0; i < DISPATCHES; ++i) {
+            auto result = AVSDirective::create(std::make_shared<const std::string>(json), nullptr, "");
+            ASSERT_EQ(result.second, AVSDirective::ParseStatus::SUCCESS);
+            std::shared_ptr<AVSDirective> directive = std::move(result.first);
+            for (int reader = 0; reader < readers; ++reader) {
+                if (isShared) {
+                    auto payload = directive->getPayloadDocument();
+                    ASSERT_FALSE(payload->HasParseError());
+                    ASSERT_EQ(readLastToken(*payload, arrayKey), LAST_TOKEN);
+                } else {
+                    rapidjson::Document payload;
+                    ASSERT_FALSE(payload.Parse(directive->getPayload()).HasParseError());
+                    ASSERT_EQ(readLastToken(payload, arrayKey), LAST_TOKEN);
+                }
+            }
+        }
+        auto cpu = cpuTime() - start;
+        reportBenchmarkResult(variant, "directiveBytes", static_cast<double>(json.size()));
+        reportBenchmarkResult(variant, "cpuMicrosecondsPerDispatch", static_cast<double>(cpu.count()) / DISPATCHES);
+    }
+};
+
+/// A RenderTemplate read by TemplateRuntime and by one observer of the card, each parsing the payload.
+TEST_F(AVSDirectiveBenchmarkTest, testSlow_renderTemplateReparsed) {
+    run("RENDER_TEMPLATE_REPARSED", buildRenderTemplate(), "listItems", 2, false);
+}
+
+/// A RenderTemplate read by TemplateRuntime and by one observer of the card, sharing the payload document.
+TEST_F(AVSDirectiveBenchmarkTest, testSlow_renderTemplateShared) {
+    run("RENDER_TEMPLATE_SHARED", buildRenderTemplate(), "listItems", 2, true);
+}
+
+/// A playlist read once by AudioPlayer, parsing the payload.
+TEST_F(AVSDirectiveBenchmarkTest, testSlow_playlistReparsed) {
+    run("PLAYLIST_REPARSED", buildPlaylist(), "audioItems", 1, false);
+}
+
+/// A playlist read once by AudioPlayer, parsing the payload in place.
+TEST_F(AVSDirectiveBenchmarkTest, testSlow_playlistShared) {
+    run("PLAYLIST_SHARED", buildPlaylist(), "audioItems", 1, true);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -167,6 +167,82 @@ TEST(AVSDirectiveTest, test_parseWithEndpointCookie) {
     EXPECT_EQ(endpoint.cookies["key"], "value");
 }
 
+TEST(AVSDirectiveTest, test_parseSharedBufferSlicesObjectPayload) {
+    // clang-format off
+    auto directiveJson = std::make_shared<const std::string>(R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "payload": {
+            "payload": {"directive": "}{"},
+            "list": [{"key": "value"}, 1, true, null]
+        },
+        "other": [{"payload": "ignored"}]
+    }})");
+    // clang-format on
+    std::string payloadJson = R"({
+            "payload": {"directive": "}{"},
+            "list": [{"key": "value"}, 1, true, null]
+        })";
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::SUCCESS);
+    ASSERT_THAT(parseResult.first, NotNull());
+
+    auto& directive = *parseResult.first;
+    EXPECT_EQ(directive.getNamespace(), "Namespace");
+    EXPECT_EQ(directive.getName(), "Name");
+    EXPECT_EQ(directive.getMessageId(), "Id");
+    EXPECT_EQ(directive.getPayload(), payloadJson);
+    EXPECT_EQ(directive.getUnparsedDirective(), *directiveJson);
+}
+
+TEST(AVSDirectiveTest, test_parseSharedBufferWithStringPayload) {
+    // clang-format off
+    auto directiveJson = std::make_shared<const std::string>(R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "payload": "value"
+    }})");
+    // clang-format on
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::SUCCESS);
+    ASSERT_THAT(parseResult.first, NotNull());
+    EXPECT_EQ(parseResult.first->getPayload(), "value");
+}
+
+TEST(AVSDirectiveTest, test_parseSharedBufferWithoutPayload) {
+    // clang-format off
+    auto directiveJson = std::make_shared<const std::string>(R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "notPayload": {
+            "payload": {}
+        }
+    }})");
+    // clang-format on
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::ERROR_MISSING_PAYLOAD_KEY);
+    EXPECT_THAT(parseResult.first, IsNull());
+}
+
+TEST(AVSDirectiveTest, test_parseSharedBufferWithInvalidJson) {
+    auto parseResult =
+        AVSDirective::create(std::make_shared<const std::string>(R"({"directive": {"payload": {})"), nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::ERROR_INVALID_JSON);
+    EXPECT_THAT(parseResult.first, IsNull());
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -331,6 +331,26 @@ TEST_F(AttachmentReaderTest, test_overrunResultsInReaderReset) {
     EXPECT_EQ(testPattern, result);
 }
 
+/**
+ * Test that a non-blocking read ignores its timeout, while @c waitForData() waits for data.
+ */
+TEST_F(AttachmentReaderTest, test_nonblockingReadIgnoresTimeout) {
+    static const std::chrono::milliseconds TIMEOUT{500};
+    init();
+
+    std::vector<uint8_t> result(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(0u, m_reader->read(result.data(), result.size(), &readStatus, TIMEOUT));
+    EXPECT_EQ(InProcessAttachmentReader::ReadStatus::OK_WOULDBLOCK, readStatus);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, TIMEOUT);
+
+    EXPECT_FALSE(m_reader->waitForData(std::chrono::milliseconds(10)));
+    ASSERT_EQ(static_cast<ssize_t>(result.size()), m_writer->write(m_testPattern.data(), result.size()));
+    EXPECT_TRUE(m_reader->waitForData(TIMEOUT));
+    readAndVerifyResult(std::move(m_reader), result.size());
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,180 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file ChunkedAttachmentBenchmarkTest.cpp
+///
+/// Measures the memory held while a burst of 10 Speak directives is buffered, as when the audio of a multi-turn or
+/// long answer arrives before SpeechSynthesizer plays it.  The audio of each directive, 2 KB to 56 KB, is written to
+/// an attachment from @c AttachmentManager as the MIME parser does, then read back as it is played.  The attachments
+/// are either @c IN_PROCESS, each with its own 1 MB ring buffer, or @c CHUNKED, holding chunks from the default
+/// @c AttachmentChunkPool.  The resident set size and the minor page faults of the process, and the bytes the
+/// attachments hold, are printed to stdout and recorded as test properties; only correctness is asserted so that the
+/// test is stable on loaded build machines.
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/AVS/Attachment/AttachmentChunkPool.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+#include "Common/Common.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace attachment;
+using namespace utils::sds;
+using utils::reportBenchmarkResult;
+
+/// The number of Speak directives in the burst.
+static const int DIRECTIVES = 10;
+
+/// The size of the audio of the first directive.
+static const size_t FIRST_AUDIO_SIZE = 2 * 1024;
+
+/// How much larger the audio of each directive is than the audio of the one before.
+static const size_t AUDIO_SIZE_STEP = 6 * 1024;
+
+/// The size of the parts the MIME parser writes.
+static const size_t WRITE_SIZE = 4 * 1024;
+
+/// The context id of the attachments.
+static const std::string CONTEXT_ID = "messageId";
+
+/**
+ * Get the resident set size of this process.
+ *
+ * @return The resident set size, in bytes.
+ */
+static size_t residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t sizePages = 0;
+    size_t residentPages = 0;
+    statm >> sizePages >> residentPages;
+    return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/**
+ * Get the minor page faults of this process so far.
+ *
+ * @return The number of minor page faults.
+ */
+static long minorFaults() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+/// Fixture which buffers bursts of audio and reports the memory held.
+class ChunkedAttachmentBenchmarkTest : public ::testing::Test {
+protected:
+    /**
+     * Buffer the audio of the burst, then play it, and report the memory held while it is buffered.
+     *
+     * @param variant The name of the variant.
+     * @param type The type of the attachments.
+     * @param[out] heldBytes The bytes the attachments hold while the burst is buffered.
+     */
+    void run(const std::string& variant, AttachmentManager::AttachmentType type, size_t* heldBytes) {
+        AttachmentManager manager(type);
+        std::vector<std::vector<uint8_t>> audio;
+        std::vector<std::string> ids;
+        size_t audioBytes = 0;
+        for (int i = 0; i < DIRECTIVES; ++i) {
+            audio.push_back(createTestPattern(static_cast<int>(FIRST_AUDIO_SIZE + i * AUDIO_SIZE_STEP)));
+            ids.push_back(manager.generateAttachmentId(CONTEXT_ID, "audio" + std::to_string(i)));
+            audioBytes += audio.back().size();
+        }
+        auto chunksInUse = AttachmentChunkPool::getDefault()->getInUseCount();
+
+        auto startResident = residentBytes();
+        auto startFaults = minorFaults();
+        for (int i = 0; i < DIRECTIVES; ++i) {
+            auto writer = manager.createWriter(ids[i]);
+            ASSERT_NE(writer, nullptr);
+            for (size_t offset = 0; offset < audio[i].size(); offset += WRITE_SIZE) {
+                auto size = std::min(WRITE_SIZE, audio[i].size() - offset);
+                auto writeStatus = AttachmentWriter::WriteStatus::OK;
+                ASSERT_EQ(writer->write(audio[i].data() + offset, size, &writeStatus), size);
+                ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+            }
+        }
+        auto resident = residentBytes() - startResident;
+        auto faults = minorFaults() - startFaults;
+        if (AttachmentManager::AttachmentType::CHUNKED == type) {
+            *heldBytes = (AttachmentChunkPool::getDefault()->getInUseCount() - chunksInUse) *
+                         AttachmentChunkPool::getDefault()->getChunkSize();
+        } else {
+            *heldBytes = DIRECTIVES * InProcessAttachment::SDSType::calculateBufferSize(
+                                          InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES);
+        }
+
+        for (int i = 0; i < DIRECTIVES; ++i) {
+            auto reader = manager.createReader(ids[i], ReaderPolicy::NONBLOCKING);
+            ASSERT_NE(reader, nullptr);
+            std::vector<uint8_t> played(audio[i].size() + 1);
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            ASSERT_EQ(reader->read(played.data(), played.size(), &readStatus), audio[i].size());
+            played.pop_back();
+            ASSERT_EQ(played, audio[i]);
+        }
+
+        reportBenchmarkResult(variant, "audioKilobytes", audioBytes / 1024.0);
+        reportBenchmarkResult(variant, "heldKilobytes", *heldBytes / 1024.0);
+        reportBenchmarkResult(variant, "residentKilobytesDelta", static_cast<double>(resident) / 1024.0);
+        reportBenchmarkResult(variant, "minorFaults", static_cast<double>(faults));
+    }
+};
+
+/// Each directive's audio is buffered in a 1 MB ring buffer.
+TEST_F(ChunkedAttachmentBenchmarkTest, testSlow_inProcessSpeakBurst) {
+    size_t heldBytes = 0;
+    run("IN_PROCESS", AttachmentManager::AttachmentType::IN_PROCESS, &heldBytes);
+}
+
+/// Each directive's audio is buffered in as many chunks as it needs.
+TEST_F(ChunkedAttachmentBenchmarkTest, testSlow_chunkedSpeakBurst) {
+    size_t heldBytes = 0;
+    run("CHUNKED", AttachmentManager::AttachmentType::CHUNKED, &heldBytes);
+    auto chunkSize = AttachmentChunkPool::getDefault()->getChunkSize();
+    size_t audioBytes = 0;
+    for (int i = 0; i < DIRECTIVES; ++i) {
+        audioBytes += FIRST_AUDIO_SIZE + i * AUDIO_SIZE_STEP;
+    }
+    // Each attachment holds less than a chunk more than its audio.
+    EXPECT_LT(heldBytes, audioBytes + DIRECTIVES * chunkSize);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
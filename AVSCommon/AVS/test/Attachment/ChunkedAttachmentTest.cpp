@@ -0,0 +1,393 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
+
+#include "Common/Common.h"
+
+using namespace ::testing;
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::sds;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// The size of the chunks of the pool used by the tests.
+static const size_t TEST_CHUNK_SIZE = 100;
+
+/// The most idle chunks kept by the pool used by the tests.
+static const size_t TEST_MAX_IDLE_CHUNKS = 4;
+
+/// The most bytes held by the attachments of the tests.
+static const size_t TEST_MAX_BUFFERED_BYTES = 400;
+
+/// A timeout long enough for another thread to make progress.
+static const std::chrono::milliseconds LONG_TIMEOUT{2000};
+
+/// A timeout short enough to expire in the tests.
+static const std::chrono::milliseconds SHORT_TIMEOUT{10};
+
+/**
+ * A class which helps drive this unit test suite.
+ */
+class ChunkedAttachmentTest : public ::testing::Test {
+public:
+    /**
+     * Constructor.
+     */
+    ChunkedAttachmentTest() :
+            m_pool{AttachmentChunkPool::create(TEST_CHUNK_SIZE, TEST_MAX_IDLE_CHUNKS)},
+            m_attachment{
+                std::make_shared<ChunkedAttachment>(TEST_ATTACHMENT_ID_STRING_ONE, m_pool, TEST_MAX_BUFFERED_BYTES)},
+            m_pattern{createTestPattern(TEST_MAX_BUFFERED_BYTES * 2)} {
+    }
+
+    /**
+     * Write part of the test pattern.
+     *
+     * @param writer The writer.
+     * @param offset The offset in the pattern of the first byte.
+     * @param numBytes The number of bytes to write.
+     * @param[out] writeStatus The resulting state of the write.
+     * @param timeout The timeout of the write.
+     * @return The number of bytes written.
+     */
+    size_t writePattern(
+        AttachmentWriter* writer,
+        size_t offset,
+        size_t numBytes,
+        AttachmentWriter::WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) {
+        return writer->write(m_pattern.data() + offset, numBytes, writeStatus, timeout);
+    }
+
+    /**
+     * Read from a reader, and verify the data read matches the test pattern.
+     *
+     * @param reader The reader.
+     * @param offset The offset in the pattern of the first byte expected.
+     * @param numBytes The number of bytes expected.
+     */
+    void readAndVerify(AttachmentReader* reader, size_t offset, size_t numBytes) {
+        std::vector<uint8_t> result(numBytes);
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        ASSERT_EQ(reader->read(result.data(), numBytes, &readStatus), numBytes);
+        ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+        ASSERT_TRUE(std::equal(result.begin(), result.end(), m_pattern.begin() + offset));
+    }
+
+    /// The pool the chunks of the attachment are acquired from.
+    std::shared_ptr<AttachmentChunkPool> m_pool;
+
+    /// The attachment under test.
+    std::shared_ptr<ChunkedAttachment> m_attachment;
+
+    /// The data written to the attachment.
+    std::vector<uint8_t> m_pattern;
+};
+
+/**
+ * Verify a pool cannot be created with chunks of zero bytes.
+ */
+TEST_F(ChunkedAttachmentTest, test_createPoolWithZeroChunkSize) {
+    ASSERT_EQ(AttachmentChunkPool::create(0), nullptr);
+}
+
+/**
+ * Verify only one writer and one reader may be created.
+ */
+TEST_F(ChunkedAttachmentTest, test_createWriterAndReaderOnce) {
+    ASSERT_NE(m_attachment->createWriter(), nullptr);
+    ASSERT_EQ(m_attachment->createWriter(), nullptr);
+    ASSERT_NE(m_attachment->createReader(ReaderPolicy::NONBLOCKING), nullptr);
+    ASSERT_EQ(m_attachment->createReader(ReaderPolicy::NONBLOCKING), nullptr);
+}
+
+/**
+ * Verify chunks are only acquired as data is written.
+ */
+TEST_F(ChunkedAttachmentTest, test_chunksAcquiredOnWrite) {
+    auto writer = m_attachment->createWriter();
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 0u);
+    EXPECT_EQ(m_pool->getInUseCount(), 0u);
+
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 150, &writeStatus), 150u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 2 * TEST_CHUNK_SIZE);
+    EXPECT_EQ(m_pool->getInUseCount(), 2u);
+}
+
+/**
+ * Verify data written across chunks is read back, then @c CLOSED once the writer is closed.
+ */
+TEST_F(ChunkedAttachmentTest, test_readBackAcrossChunks) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 350, &writeStatus), 350u);
+    EXPECT_EQ(reader->getNumUnreadBytes(), 350u);
+
+    readAndVerify(reader.get(), 0, 30);
+    readAndVerify(reader.get(), 30, 170);
+    readAndVerify(reader.get(), 200, 150);
+    EXPECT_EQ(reader->getNumUnreadBytes(), 0u);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::OK_WOULDBLOCK);
+
+    writer->close();
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+    EXPECT_EQ(writePattern(writer.get(), 0, 1, &writeStatus), 0u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::CLOSED);
+}
+
+/**
+ * Verify an @c ALL_OR_NOTHING writer may not hold more than the cap of unread data, and that chunks the reader has
+ * passed are reused for new data.
+ */
+TEST_F(ChunkedAttachmentTest, test_allOrNothingWriterCapped) {
+    auto writer = m_attachment->createWriter(WriterPolicy::ALL_OR_NOTHING);
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, TEST_MAX_BUFFERED_BYTES, &writeStatus), TEST_MAX_BUFFERED_BYTES);
+    ASSERT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 1, &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+
+    readAndVerify(reader.get(), 0, 150);
+    ASSERT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 151, &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+    ASSERT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 150, &writeStatus), 150u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+
+    // The first chunk only held data the reader had passed, so it was released and reused for the new data.
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 5 * TEST_CHUNK_SIZE);
+    EXPECT_EQ(m_pool->getInUseCount(), 5u);
+    EXPECT_EQ(m_pool->getIdleCount(), 0u);
+    readAndVerify(reader.get(), 150, TEST_MAX_BUFFERED_BYTES);
+}
+
+/**
+ * Verify a @c BLOCKING writer times out when the cap is reached, and writes once the reader consumes data.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingWriterWaitsForReader) {
+    auto writer = m_attachment->createWriter(WriterPolicy::BLOCKING);
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, TEST_MAX_BUFFERED_BYTES, &writeStatus), TEST_MAX_BUFFERED_BYTES);
+    ASSERT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 100, &writeStatus, SHORT_TIMEOUT), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::TIMEDOUT);
+
+    std::thread readerThread([this, &reader] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT);
+        readAndVerify(reader.get(), 0, 60);
+    });
+    // Writes as much as fits once the reader has consumed data.
+    EXPECT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 100, &writeStatus, LONG_TIMEOUT), 60u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+    readerThread.join();
+}
+
+/**
+ * Verify a @c NONBLOCKABLE writer discards the oldest data, so that a reader behind it fails with @c ERROR_OVERRUN.
+ */
+TEST_F(ChunkedAttachmentTest, test_nonblockableWriterOverrunsReader) {
+    auto writer = m_attachment->createWriter(WriterPolicy::NONBLOCKABLE);
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, TEST_MAX_BUFFERED_BYTES, &writeStatus), TEST_MAX_BUFFERED_BYTES);
+    ASSERT_EQ(writePattern(writer.get(), TEST_MAX_BUFFERED_BYTES, 250, &writeStatus), 250u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+    EXPECT_LE(m_attachment->getAllocatedBytes(), TEST_MAX_BUFFERED_BYTES + TEST_CHUNK_SIZE);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::ERROR_OVERRUN);
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+    EXPECT_EQ(m_pool->getInUseCount(), 0u);
+}
+
+/**
+ * Verify a @c BLOCKING reader times out without data, and wakes once data is written.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingReaderWaitsForWriter) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::BLOCKING);
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus, SHORT_TIMEOUT), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::OK_TIMEDOUT);
+
+    std::thread writerThread([this, &writer] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT);
+        auto writeStatus = AttachmentWriter::WriteStatus::OK;
+        writePattern(writer.get(), 0, 50, &writeStatus);
+    });
+    std::vector<uint8_t> result(100);
+    EXPECT_EQ(reader->read(result.data(), result.size(), &readStatus, LONG_TIMEOUT), 50u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+    EXPECT_TRUE(std::equal(result.begin(), result.begin() + 50, m_pattern.begin()));
+    writerThread.join();
+}
+
+/**
+ * Verify the chunks holding only data the reader has passed are returned to the pool, and that the reader may no
+ * longer seek back to that data.
+ */
+TEST_F(ChunkedAttachmentTest, test_chunksReleasedBehindReader) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 350, &writeStatus), 350u);
+    readAndVerify(reader.get(), 0, 250);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 2 * TEST_CHUNK_SIZE);
+    EXPECT_EQ(m_pool->getInUseCount(), 2u);
+    EXPECT_EQ(m_pool->getIdleCount(), 2u);
+
+    EXPECT_FALSE(reader->seek(249));
+    ASSERT_TRUE(reader->seek(250));
+    readAndVerify(reader.get(), 250, 100);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), TEST_CHUNK_SIZE);
+}
+
+/**
+ * Verify a reader with a reach-back window keeps the chunks holding data within the window behind it.
+ */
+TEST_F(ChunkedAttachmentTest, test_reachBackWindowKeepsPassedData) {
+    static const size_t REACH_BACK_BYTES = 150;
+    ChunkedAttachment attachment(TEST_ATTACHMENT_ID_STRING_TWO, m_pool, TEST_MAX_BUFFERED_BYTES, REACH_BACK_BYTES);
+    auto writer = attachment.createWriter();
+    auto reader = attachment.createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 350, &writeStatus), 350u);
+    readAndVerify(reader.get(), 0, 250);
+    EXPECT_EQ(attachment.getAllocatedBytes(), 3 * TEST_CHUNK_SIZE);
+
+    EXPECT_FALSE(reader->seek(99));
+    ASSERT_TRUE(reader->seek(100));
+    readAndVerify(reader.get(), 100, 250);
+}
+
+/**
+ * Verify the reader may seek back to data within its reach-back window, but not to data discarded to make room.
+ */
+TEST_F(ChunkedAttachmentTest, test_seekBackWithinHeldData) {
+    ChunkedAttachment attachment(
+        TEST_ATTACHMENT_ID_STRING_TWO, m_pool, TEST_MAX_BUFFERED_BYTES, TEST_MAX_BUFFERED_BYTES);
+    auto writer = attachment.createWriter();
+    auto reader = attachment.createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 300, &writeStatus), 300u);
+    readAndVerify(reader.get(), 0, 300);
+    ASSERT_TRUE(reader->seek(0));
+    readAndVerify(reader.get(), 0, 300);
+
+    ASSERT_EQ(writePattern(writer.get(), 300, 400, &writeStatus), 400u);
+    EXPECT_FALSE(reader->seek(0));
+    ASSERT_TRUE(reader->seek(300));
+    readAndVerify(reader.get(), 300, 400);
+
+    // Seeking ahead of the writer is allowed.
+    ASSERT_TRUE(reader->seek(750));
+    EXPECT_EQ(reader->getNumUnreadBytes(), 0u);
+}
+
+/**
+ * Verify closing the reader immediately returns its chunks to the pool, and that later writes are discarded.
+ */
+TEST_F(ChunkedAttachmentTest, test_closeReaderImmediately) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 300, &writeStatus), 300u);
+    reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 0u);
+    EXPECT_EQ(m_pool->getInUseCount(), 0u);
+    EXPECT_EQ(m_pool->getIdleCount(), 3u);
+
+    EXPECT_EQ(writePattern(writer.get(), 300, 300, &writeStatus), 300u);
+    EXPECT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 0u);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    EXPECT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+}
+
+/**
+ * Verify a reader closed after draining reads the data written before it was closed, then releases the chunks.
+ */
+TEST_F(ChunkedAttachmentTest, test_closeReaderAfterDraining) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 200, &writeStatus), 200u);
+    readAndVerify(reader.get(), 0, 50);
+    reader->close(AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER);
+    ASSERT_EQ(writePattern(writer.get(), 200, 100, &writeStatus), 100u);
+
+    std::vector<uint8_t> result(300);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    EXPECT_EQ(reader->read(result.data(), result.size(), &readStatus), 150u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(reader->read(result.data(), result.size(), &readStatus), 0u);
+    EXPECT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+    EXPECT_EQ(m_attachment->getAllocatedBytes(), 0u);
+}
+
+/**
+ * Verify the chunks of a destroyed attachment are reused by the next one, and that the pool keeps a bounded number
+ * of idle chunks.
+ */
+TEST_F(ChunkedAttachmentTest, test_chunksReusedAcrossAttachments) {
+    {
+        auto writer = m_attachment->createWriter();
+        auto writeStatus = AttachmentWriter::WriteStatus::OK;
+        ASSERT_EQ(writePattern(writer.get(), 0, TEST_MAX_BUFFERED_BYTES, &writeStatus), TEST_MAX_BUFFERED_BYTES);
+        ASSERT_EQ(m_pool->getInUseCount(), 4u);
+        m_attachment.reset();
+    }
+    EXPECT_EQ(m_pool->getInUseCount(), 0u);
+    EXPECT_EQ(m_pool->getIdleCount(), TEST_MAX_IDLE_CHUNKS);
+
+    ChunkedAttachment second(TEST_ATTACHMENT_ID_STRING_TWO, m_pool, TEST_MAX_BUFFERED_BYTES * 2);
+    auto writer = second.createWriter();
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writePattern(writer.get(), 0, 550, &writeStatus), 550u);
+    EXPECT_EQ(m_pool->getIdleCount(), 0u);
+    EXPECT_EQ(m_pool->getInUseCount(), 6u);
+
+    auto reader = second.createReader(ReaderPolicy::NONBLOCKING);
+    readAndVerify(reader.get(), 0, 550);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,203 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/FramedAudioInputStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+using namespace std::chrono;
+
+/// The number of channels of the test audio.
+static const unsigned int CHANNELS = 4;
+
+/// The sample rate of the test audio.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The number of frames in a write: 10 ms of audio.
+static const size_t FRAMES_PER_WRITE = SAMPLE_RATE_HZ / 100;
+
+/// The number of frames the stream holds: 100 writes.
+static const size_t STREAM_FRAMES = FRAMES_PER_WRITE * 100;
+
+/// The format of the test audio.
+static const AudioFormat FORMAT{AudioFormat::Encoding::LPCM,
+                                AudioFormat::Endianness::LITTLE,
+                                SAMPLE_RATE_HZ,
+                                16,
+                                CHANNELS,
+                                true,
+                                AudioFormat::Layout::INTERLEAVED};
+
+/**
+ * The sample of a channel in a frame.
+ *
+ * @param frame The index of the frame.
+ * @param channel The channel.
+ * @return The sample.
+ */
+static int16_t sampleOf(size_t frame, size_t channel) {
+    return static_cast<int16_t>(frame * CHANNELS + channel);
+}
+
+class FramedAudioInputStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto wordSize = sizeof(int16_t) * CHANNELS;
+        auto buffer = std::make_shared<AudioInputStream::Buffer>(
+            AudioInputStream::calculateBufferSize(STREAM_FRAMES, wordSize, 2));
+        m_stream = AudioInputStream::create(buffer, wordSize, 2);
+        ASSERT_NE(m_stream, nullptr);
+        m_framed = FramedAudioInputStream::create(m_stream, FORMAT);
+        ASSERT_NE(m_framed, nullptr);
+        m_writer = m_stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+        ASSERT_NE(m_writer, nullptr);
+    }
+
+    /**
+     * Write frames which continue from the previous write, recording the write at a time.
+     *
+     * @param nFrames The number of frames to write.
+     * @param time The time at which the frames were written.
+     */
+    void writeFrames(size_t nFrames, FramedAudioInputStream::TimePoint time) {
+        auto first = m_writer->tell();
+        std::vector<int16_t> frames(nFrames * CHANNELS);
+        for (size_t frame = 0; frame < nFrames; ++frame) {
+            for (size_t channel = 0; channel < CHANNELS; ++channel) {
+                frames[frame * CHANNELS + channel] = sampleOf(first + frame, channel);
+            }
+        }
+        ASSERT_EQ(m_writer->write(frames.data(), nFrames), static_cast<ssize_t>(nFrames));
+        m_framed->markWritten(*m_writer, time);
+    }
+
+    /// The underlying stream.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The stream under test.
+    std::shared_ptr<FramedAudioInputStream> m_framed;
+
+    /// The writer of the stream.
+    std::unique_ptr<AudioInputStream::Writer> m_writer;
+};
+
+/// Verify that streams whose words are not frames of the format are rejected.
+TEST_F(FramedAudioInputStreamTest, test_createWithInvalidParameters) {
+    EXPECT_EQ(FramedAudioInputStream::create(nullptr, FORMAT), nullptr);
+    EXPECT_EQ(FramedAudioInputStream::create(m_stream, FORMAT, 0), nullptr);
+
+    auto format = FORMAT;
+    format.numChannels = CHANNELS * 2;
+    EXPECT_EQ(FramedAudioInputStream::create(m_stream, format), nullptr);
+
+    format = FORMAT;
+    format.layout = AudioFormat::Layout::NON_INTERLEAVED;
+    EXPECT_EQ(FramedAudioInputStream::create(m_stream, format), nullptr);
+
+    format = FORMAT;
+    format.encoding = AudioFormat::Encoding::OPUS;
+    EXPECT_EQ(FramedAudioInputStream::create(m_stream, format), nullptr);
+
+    EXPECT_EQ(m_framed->getFormat().numChannels, CHANNELS);
+    EXPECT_EQ(m_framed->getStream(), m_stream);
+}
+
+/// Verify that a single channel is read from interleaved frames, including frames which wrap around the buffer.
+TEST_F(FramedAudioInputStreamTest, test_readChannel) {
+    auto reader = m_stream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    std::vector<int16_t> samples(STREAM_FRAMES);
+    auto now = steady_clock::now();
+
+    EXPECT_EQ(
+        m_framed->readChannel(reader.get(), CHANNELS, samples.data(), 1), AudioInputStream::Reader::Error::INVALID);
+    EXPECT_EQ(m_framed->readChannel(reader.get(), 0, samples.data(), 1), AudioInputStream::Reader::Error::WOULDBLOCK);
+
+    // Leave the reader short of the end of the buffer so that the second of the reads below wraps.
+    const size_t framesBeforeWrap = FRAMES_PER_WRITE * 3 / 8;
+    writeFrames(STREAM_FRAMES - framesBeforeWrap, now);
+    ASSERT_EQ(
+        m_framed->readChannel(reader.get(), 1, samples.data(), STREAM_FRAMES),
+        static_cast<ssize_t>(STREAM_FRAMES - framesBeforeWrap));
+    writeFrames(FRAMES_PER_WRITE, now);
+
+    for (size_t channel = 0; channel < CHANNELS; ++channel) {
+        auto first = reader->tell();
+        ASSERT_EQ(
+            m_framed->readChannel(reader.get(), channel, samples.data(), FRAMES_PER_WRITE / CHANNELS),
+            static_cast<ssize_t>(FRAMES_PER_WRITE / CHANNELS));
+        for (size_t frame = 0; frame < FRAMES_PER_WRITE / CHANNELS; ++frame) {
+            ASSERT_EQ(samples[frame], sampleOf(first + frame, channel));
+        }
+    }
+}
+
+/// Verify that a reader can be moved to the audio captured at a time.
+TEST_F(FramedAudioInputStreamTest, test_seekByTime) {
+    auto reader = m_stream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto start = steady_clock::now();
+    const milliseconds writeDuration{1000 * FRAMES_PER_WRITE / SAMPLE_RATE_HZ};
+    for (size_t write = 1; write <= 10; ++write) {
+        writeFrames(FRAMES_PER_WRITE, start + writeDuration * write);
+    }
+
+    // Audio from before the first write completed is not known.
+    AudioInputStream::Index index;
+    EXPECT_FALSE(m_framed->getIndex(start, &index));
+
+    // The time a write completed maps to the end of the write, and times in between are interpolated.
+    ASSERT_TRUE(m_framed->getIndex(start + writeDuration * 3, &index));
+    EXPECT_EQ(index, FRAMES_PER_WRITE * 3);
+    ASSERT_TRUE(m_framed->getIndex(start + writeDuration * 3 + milliseconds(5), &index));
+    EXPECT_EQ(index, FRAMES_PER_WRITE * 3 + SAMPLE_RATE_HZ * 5 / 1000);
+
+    // Seek to the middle of the fifth write, and read the audio from there.
+    ASSERT_TRUE(m_framed->seek(reader.get(), start + writeDuration * 4 + milliseconds(5)));
+    EXPECT_EQ(reader->tell(), FRAMES_PER_WRITE * 4 + SAMPLE_RATE_HZ * 5 / 1000);
+    int16_t sample;
+    ASSERT_EQ(m_framed->readChannel(reader.get(), 2, &sample, 1), 1);
+    EXPECT_EQ(sample, sampleOf(FRAMES_PER_WRITE * 4 + SAMPLE_RATE_HZ * 5 / 1000, 2));
+}
+
+/// Verify that only the configured number of write times is kept.
+TEST_F(FramedAudioInputStreamTest, test_writeTimesAreBounded) {
+    auto framed = FramedAudioInputStream::create(m_stream, FORMAT, 2);
+    ASSERT_NE(framed, nullptr);
+    auto start = steady_clock::now();
+    std::vector<int16_t> frames(FRAMES_PER_WRITE * CHANNELS);
+    for (size_t write = 1; write <= 3; ++write) {
+        ASSERT_EQ(
+            framed->write(m_writer.get(), frames.data(), FRAMES_PER_WRITE), static_cast<ssize_t>(FRAMES_PER_WRITE));
+    }
+    AudioInputStream::Index index;
+    EXPECT_FALSE(framed->getIndex(start, &index));
+    ASSERT_TRUE(framed->getIndex(steady_clock::now(), &index));
+    EXPECT_GE(index, FRAMES_PER_WRITE * 3);
+}
+
+}  // namespace test
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_SDKINTERFACES_INCLUDE_AVSCOMMON_SDKINTERFACES_MESSAGEOBSERVERINTERFACE_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_SDKINTERFACES_INCLUDE_AVSCOMMON_SDKINTERFACES_MESSAGEOBSERVERINTERFACE_H_
 
+#include <memory>
 #include <string>
 
 namespace alexaClientSDK {
@@ -40,8 +41,28 @@ public:
      * @param message The AVS message that has been received.
      */
     virtual void receive(const std::string& contextId, const std::string& message) = 0;
+
+    /**
+     * Receive a Message from AVS in an immutable buffer which is shared with the other observers.  Observers which
+     * keep the message beyond this call, such as those which parse it into an @c AVSDirective, can override this to
+     * hold on to the buffer rather than copy it.  The default implementation passes the message on to
+     * @c receive(const std::string&, const std::string&).
+     *
+     * @param contextId The context for the message, which in this case reflects the logical HTTP/2 stream the
+     * message arrived on.
+     * @param message The AVS message that has been received.
+     */
+    virtual void receive(const std::string& contextId, std::shared_ptr<const std::string> message);
 };
 
+inline void MessageObserverInterface::receive(
+    const std::string& contextId,
+    std::shared_ptr<const std::string> message) {
+    if (message) {
+        receive(contextId, *message);
+    }
+}
+
 }  // namespace sdkInterfaces
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
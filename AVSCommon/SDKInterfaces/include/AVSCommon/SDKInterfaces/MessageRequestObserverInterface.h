@@ -77,7 +77,13 @@ public:
         BAD_REQUEST,
 
         /// The send failed due to unknown server error.
-        SERVER_OTHER_ERROR
+        SERVER_OTHER_ERROR,
+
+        /// The message was not sent because its deadline passed while it was queued.
+        EXPIRED,
+
+        /// The message was not sent because a later message reporting the same state was sent instead.
+        SUPERSEDED
     };
 
     /*
@@ -137,6 +143,10 @@ inline std::ostream& operator<<(std::ostream& stream, MessageRequestObserverInte
             return stream << "CLIENT_ERROR_BAD_REQUEST";
         case MessageRequestObserverInterface::Status::SERVER_OTHER_ERROR:
             return stream << "SERVER_OTHER_ERROR";
+        case MessageRequestObserverInterface::Status::EXPIRED:
+            return stream << "EXPIRED";
+        case MessageRequestObserverInterface::Status::SUPERSEDED:
+            return stream << "SUPERSEDED";
     }
     return stream << "Unknown MessageRequestObserverInterface::Status";
 }
@@ -78,6 +78,15 @@ public:
      * @note In future versions, this method will be made pure virtual.
      */
     virtual bool canStateBeRetrieved();
+
+    /**
+     * Returns whether the provider reports every change of its state with @c reportStateChange.  Once such a provider
+     * has reported its state, the @c ContextManager includes the last state reported in the context instead of
+     * querying the provider for it.
+     *
+     * @return Whether the last state reported by this provider is always its current state.
+     */
+    virtual bool isStateProactivelyReported();
 };
 
 inline void StateProviderInterface::provideState(
@@ -97,6 +106,10 @@ inline bool StateProviderInterface::canStateBeRetrieved() {
     return true;
 }
 
+inline bool StateProviderInterface::isStateProactivelyReported() {
+    return false;
+}
+
 }  // namespace sdkInterfaces
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -60,22 +60,14 @@ private:
     enum class State {
         /// Just created
         NEW,
-        /// Requesting the source for the headers for the first mime part.
-        GETTING_1ST_PART_HEADERS,
-        /// Sending the boundary before the first part.
-        SENDING_1ST_BOUNDARY,
-        /// Sending the headers for the current part.
-        SENDING_PART_HEADERS,
+        /// Requesting the source for the headers for the next mime part.
+        GETTING_PART_HEADERS,
+        /// Sending the boundary and headers before the current part.
+        SENDING_PART_ENVELOPE,
         /// Sending data for the current part.
         SENDING_PART_DATA,
-        /// Sending the boundary terminating the current part.
-        SENDING_END_BOUNDARY,
-        /// Requesting the source for the headers for the next part.
-        GETTING_NTH_PART_HEADERS,
-        /// Sending the CRLF between the latest boundary and the next part.
-        SENDING_CRLF_AFTER_BOUNDARY,
-        /// Sending the two dashes after the final boundary.
-        SENDING_TERMINATING_DASHES,
+        /// Sending the final boundary.
+        SENDING_TRAILER,
         /// Done sending.
         DONE,
         /// Bad state.
@@ -93,30 +85,24 @@ private:
     void setState(State newState);
 
     /**
-     * Copy a string in to the provided buffer, starting at the offset @m_stringIndex into the buffer,
-     * truncating the copy if necessary to not exceed the size of the buffer.  @c m_stringIndex will
-     * be updated to the next byte after the copied string, and @c m_bytesCopied will have the count
-     * of copied bytes added to it.
+     * Build the boundary and header lines which precede a part in to @c m_envelope, so that they can be sent with
+     * a single copy however they are split across calls to @c onSendData().
      *
-     * @param bytes The buffer to copy the string to.
-     * @param size The size of the buffer to copy the string to.
-     * @param text The string to send.
-     * @return Whether the end of the string was sent.
+     * @param headerLines The header lines of the part.
      */
-    bool sendString(char* bytes, size_t size, const std::string& text);
+    void buildPartEnvelope(const std::vector<std::string>& headerLines);
 
     /**
-     * Copy a string and a CRLF in to the provided buffer, starting at the offset @m_stringIndex into the buffer,
-     * truncating the copy if necessary to not exceed the size of the buffer.  @c m_stringIndex will
-     * be updated to the next byte after the copied string and CRLF, and @c m_bytesCopied will have the count
-     * of copied bytes added to it.
+     * Copy the unsent remainder of an envelope in to the provided buffer, after the @c m_bytesCopied bytes already
+     * copied, truncating the copy if necessary to not exceed the size of the buffer.  @c m_envelopeIndex and
+     * @c m_bytesCopied are advanced by the count of copied bytes.
      *
-     * @param bytes The buffer to copy the string to.
-     * @param size The size of the buffer to copy the string to.
-     * @param text The string to send.
-     * @return Whether the end of the string was sent.
+     * @param bytes The buffer to copy the envelope to.
+     * @param size The size of the buffer to copy the envelope to.
+     * @param envelope The envelope to send.
+     * @return Whether the end of the envelope was sent.
      */
-    bool sendStringAndCRLF(char* bytes, size_t size, const std::string& text);
+    bool sendEnvelope(char* bytes, size_t size, const std::string& envelope);
 
     /**
      * Create a HTTP2SendDataResult with HTTP2SendStatus::CONTINUE and a size of @c m_bytesCopied.
@@ -131,8 +117,11 @@ private:
     /// The boundry string without a CRLF or two-dash prefix.
     std::string m_rawBoundary;
 
-    /// The boundary string with CRLF nd two-dash prefix to simplify emitting it in the encoded stream.
-    std::string m_prefixedBoundary;
+    /// The CRLF, two dashes, boundary and CRLF which start the envelope of every part.
+    const std::string m_partBoundary;
+
+    /// The final boundary, with the CRLF and dashes around it.
+    const std::string m_trailer;
 
     /// Shared pointer to the MimeRequestSource implementation.
     std::shared_ptr<HTTP2MimeRequestSourceInterface> m_source;
@@ -140,14 +129,14 @@ private:
     /// Number of bytes accumulated in @c bytes during call to @c onSendData().
     size_t m_bytesCopied;
 
-    /// Last result from calling getMimeHeaderLines.
-    HTTP2GetMimeHeadersResult m_getMimeHeaderLinesResult;
+    /// Whether any part has been started.
+    bool m_hasSentPart;
 
-    /// Iterator to header line currently being sent.
-    std::vector<std::string>::const_iterator m_headerLine;
+    /// The envelope of the current part.  Its capacity is kept from part to part.
+    std::string m_envelope;
 
-    /// Current index in to @c m_boundary or the current header line.
-    size_t m_stringIndex;
+    /// Index of the next byte to send of @c m_envelope or @c m_trailer.
+    size_t m_envelopeIndex;
 };
 
 }  // namespace http2
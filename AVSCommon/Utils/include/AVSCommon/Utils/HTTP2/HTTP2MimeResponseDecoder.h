@@ -18,10 +18,9 @@
 
 #include <memory>
 
-#include <MultipartParser/MultipartReader.h>
-
 #include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseSinkInterface.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h"
+#include "AVSCommon/Utils/HTTP2/MimeMultipartParser.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -55,27 +54,19 @@ public:
     /// @}
 
 private:
-    /** We will also need to implements the callbacks for @class MultipartReader **/
-    static void partBeginCallback(const MultipartHeaders& headers, void* userData);
-    static void partDataCallback(const char* buffer, size_t size, void* userData);
-    static void partEndCallback(void* userData);
-
     /// MIMEResponseSinkInterface implementation to pass MIME data to
     std::shared_ptr<HTTP2MimeResponseSinkInterface> m_sink;
     /// Response code that has been received, or zero.
     long m_responseCode;
-    /// Instance of a multipart MIME reader.
-    MultipartReader m_multipartReader;
+    /// Parser for the multipart MIME body.
+    MimeMultipartParser m_parser;
     /// Last parse status returned
     HTTP2ReceiveDataStatus m_lastStatus;
-    /// MIME part callbacks on current(or last in case of PAUSE) chunk
-    size_t m_index;
-    /// Number of characters left to check at the beginning of the stream for a leading CRLF sequence.
-    size_t m_leadingCRLFCharsLeftToRemove;
-    /// needed to track if boundary has been set
-    bool m_boundaryFound;
-    /// last successful MIME part callback on current chunk
-    size_t m_lastSuccessIndex;
+    /**
+     * The number of bytes at the start of the chunk last paused which were consumed before the pause.  A paused chunk
+     * is delivered again when the stream resumes, and these bytes are skipped.
+     */
+    size_t m_countOfBytesConsumedBeforePause;
 };
 
 }  // namespace http2
@@ -43,6 +43,14 @@ public:
      */
     virtual bool cancel() = 0;
 
+    /**
+     * Notify this @c HTTP2Request that its @c HTTP2RequestSourceInterface has more data to send after returning
+     * @c HTTP2SendStatus::PAUSE, or that its @c HTTP2ResponseSinkInterface can accept more data after returning
+     * @c HTTP2ReceiveDataStatus::PAUSE.  The transfer is resumed straight away, rather than when the connection next
+     * retries paused transfers.  This may be called from any thread.
+     */
+    virtual void resume() = 0;
+
     /**
      * Get an integer uniquely identifying this request.
      *
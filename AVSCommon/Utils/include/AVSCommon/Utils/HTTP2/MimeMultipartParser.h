@@ -0,0 +1,203 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_MIMEMULTIPARTPARSER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_MIMEMULTIPARTPARSER_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseSinkInterface.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2ReceiveDataStatus.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+
+/**
+ * A streaming parser for a MIME multipart body, which passes the parts to an @c HTTP2MimeResponseSinkInterface as they
+ * arrive.
+ *
+ * The body may be fed in chunks of any size.  If the sink returns @c HTTP2ReceiveDataStatus::PAUSE, @c feed() stops
+ * and reports how many bytes it consumed; the rest must be fed again later.  The parser's state always matches the
+ * bytes consumed, so nothing has to be saved or rolled back to pause.
+ *
+ * Part data is passed to the sink in place, as runs of the chunk which cannot contain a boundary.  The only bytes the
+ * parser copies are header lines, into storage reused from part to part, and bytes at the end of a chunk which may
+ * be the start of a boundary until the next chunk shows whether they are.
+ *
+ * The parser accepts these departures from RFC 2046, which have been seen in AVS responses:
+ * @li A CRLF before the first boundary.
+ * @li Duplicate boundaries, with or without an empty line between them.  The empty parts are not passed to the sink.
+ */
+class MimeMultipartParser {
+public:
+    /**
+     * Constructor.  @c setBoundary() must be called before the body is fed.
+     */
+    MimeMultipartParser();
+
+    /**
+     * Set the boundary which separates the parts, and prepare to parse a new body.
+     *
+     * @param boundary The boundary, from the @c boundary parameter of the @c Content-Type header.
+     */
+    void setBoundary(const std::string& boundary);
+
+    /**
+     * Whether @c setBoundary() has been called.
+     *
+     * @return Whether @c setBoundary() has been called.
+     */
+    bool hasBoundary() const;
+
+    /**
+     * Parse the next bytes of the body, passing the parts to a sink.
+     *
+     * @param bytes The bytes to parse.
+     * @param size The number of bytes to parse.
+     * @param sink The sink to pass the parts to.
+     * @param[out] consumed The number of bytes consumed.  This is @c size unless @c HTTP2ReceiveDataStatus::PAUSE is
+     *     returned.
+     * @return @c SUCCESS if all the bytes were consumed, @c PAUSE if the sink paused and the bytes after @c consumed
+     *     must be fed again, or @c ABORT if the body is malformed or the sink aborted.  Once @c ABORT has been returned
+     *     it is always returned.
+     */
+    HTTP2ReceiveDataStatus feed(
+        const char* bytes,
+        size_t size,
+        HTTP2MimeResponseSinkInterface& sink,
+        size_t* consumed);
+
+    /**
+     * Whether the final boundary has been parsed.  Any bytes after it are ignored.
+     *
+     * @return Whether the final boundary has been parsed.
+     */
+    bool isFinished() const;
+
+    /**
+     * Get why the body could not be parsed.
+     *
+     * @return Why the body could not be parsed, or an empty string if it has not failed.
+     */
+    const char* getErrorReason() const;
+
+private:
+    /// The states of the parser.
+    enum class State {
+        /// @c setBoundary() has not been called.
+        NO_BOUNDARY,
+        /// Matching the first boundary.
+        FIRST_BOUNDARY,
+        /// Reading the header lines of a part.
+        HEADERS,
+        /// Reading the data of a part, and looking for the boundary after it.
+        PART_DATA,
+        /// A boundary has been matched; reading what follows it.
+        AFTER_BOUNDARY,
+        /// A boundary and CR have been matched; expecting LF.
+        AFTER_BOUNDARY_CR,
+        /// A boundary and hyphen have been matched; expecting a second hyphen.
+        AFTER_BOUNDARY_HYPHEN,
+        /// The final boundary has been parsed.
+        FINISHED,
+        /// The body could not be parsed, or the sink aborted.
+        ERROR
+    };
+
+    /**
+     * Handle a byte which does not continue the boundary being matched.
+     *
+     * @param sink The sink to pass the parts to.
+     * @return The result of passing any bytes held back to the sink.
+     */
+    HTTP2ReceiveDataStatus onBoundaryMismatch(HTTP2MimeResponseSinkInterface& sink);
+
+    /**
+     * Pass part data to the sink, starting the part first if it has no headers.
+     *
+     * @param bytes The data.
+     * @param size The size of the data.
+     * @param sink The sink to pass the data to.
+     * @return The result of passing the data to the sink.
+     */
+    HTTP2ReceiveDataStatus sendPartData(const char* bytes, size_t size, HTTP2MimeResponseSinkInterface& sink);
+
+    /**
+     * Handle a complete header line.
+     *
+     * @param sink The sink to pass the part to, if this line ends the headers.
+     * @return @c SUCCESS, or @c ABORT if the line is malformed or the sink aborted.
+     */
+    HTTP2ReceiveDataStatus onHeaderLine(HTTP2MimeResponseSinkInterface& sink);
+
+    /**
+     * End the current part, if it was passed to the sink.
+     *
+     * @param sink The sink to pass the end of the part to.
+     * @return @c SUCCESS, or @c ABORT if the sink aborted.
+     */
+    HTTP2ReceiveDataStatus endPart(HTTP2MimeResponseSinkInterface& sink);
+
+    /**
+     * Prepare for the headers of the next part.
+     */
+    void beginHeaders();
+
+    /**
+     * Fail to parse the body.
+     *
+     * @param reason Why the body could not be parsed.
+     * @return @c ABORT.
+     */
+    HTTP2ReceiveDataStatus setError(const char* reason);
+
+    /// The current state.
+    State m_state;
+
+    /// The delimiter which precedes each boundary: CRLF, two hyphens and the boundary.
+    std::string m_delimiter;
+
+    /// The number of bytes of @c m_delimiter matched so far.
+    size_t m_countOfDelimiterBytesMatched;
+
+    /// Bytes of part data which matched the start of a delimiter, held back until it is known whether they are one.
+    std::string m_heldBack;
+
+    /// The header line being read.  Its capacity is kept from line to line.
+    std::string m_headerLine;
+
+    /// Whether the current header line is the first of the part.
+    bool m_isFirstHeaderLine;
+
+    /// The headers of the current part.
+    std::multimap<std::string, std::string> m_headers;
+
+    /// Whether the current part has been passed to the sink.
+    bool m_isPartBegun;
+
+    /// Why the body could not be parsed.
+    const char* m_errorReason;
+};
+
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_MIMEMULTIPARTPARSER_H_
@@ -18,8 +18,10 @@
 
 #include <chrono>
 #include <curl/curl.h>
+#include <memory>
 #include <string>
 
+#include <AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h>
 #include <AVSCommon/Utils/Logger/LogEntry.h>
 #include <AVSCommon/Utils/Logger/LoggerUtils.h>
 
@@ -312,6 +314,8 @@ private:
     curl_httppost* m_lastPost;
     /// Name for this handle.
     std::string m_id;
+    /// The share of DNS lookups and TLS sessions this handle uses, or nullptr if it does not use one.
+    std::shared_ptr<CurlShareHandleWrapper> m_share;
 
     /// If no id is provided by the user, we will generate it from this counter.
     static std::atomic<uint64_t> m_idGenerator;
@@ -0,0 +1,154 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTIHANDLEPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTIHANDLEPOOL_H_
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * A pool of idle curl multi handles, kept per origin so that the connections in their caches can be reused.
+ *
+ * A multi handle keeps the connections of the transfers it ran open once they complete, so a transfer added to the
+ * same multi handle later reuses an HTTP/1.1 keep-alive or HTTP/2 connection to the origin rather than connecting
+ * again.  A transfer acquires a multi handle for its URL, drives it on its own thread as before, and releases it when
+ * the transfer is done.  If no idle multi handle is pooled for the origin, a new one is created, so concurrent
+ * transfers to one origin each get their own.  If the server has closed a pooled connection, curl connects again.
+ *
+ * This class is thread-safe.
+ */
+class CurlMultiHandlePool {
+public:
+    /**
+     * Create a pool.
+     *
+     * @param maxIdlePerOrigin The most idle multi handles kept for each origin.
+     * @param maxIdle The most idle multi handles kept in total.
+     * @param maxIdleTime How long an idle multi handle is kept before it is discarded along with its connections.
+     * @return The new pool.
+     */
+    static std::shared_ptr<CurlMultiHandlePool> create(
+        size_t maxIdlePerOrigin = DEFAULT_MAX_IDLE_PER_ORIGIN,
+        size_t maxIdle = DEFAULT_MAX_IDLE,
+        std::chrono::seconds maxIdleTime = DEFAULT_MAX_IDLE_TIME);
+
+    /**
+     * Acquire a multi handle to fetch a URL with.
+     *
+     * @param url The URL which will be fetched.
+     * @return The multi handle most recently released for the origin of the URL, or a new multi handle if there is
+     *     none, or nullptr if a new one could not be created.
+     */
+    std::unique_ptr<CurlMultiHandleWrapper> acquire(const std::string& url);
+
+    /**
+     * Return a multi handle to the pool once the transfer using it is done and its easy handle has been removed.  The
+     * multi handle is discarded if the pool is full.
+     *
+     * @param url The URL which was fetched.
+     * @param multiHandle The multi handle.
+     */
+    void release(const std::string& url, std::unique_ptr<CurlMultiHandleWrapper> multiHandle);
+
+    /**
+     * Get the number of idle multi handles in the pool.
+     *
+     * @return The number of idle multi handles in the pool.
+     */
+    size_t getIdleCount();
+
+    /**
+     * Get the origin of a URL: its scheme, host and port.
+     *
+     * @param url The URL.
+     * @return The origin of the URL, in lower case.
+     */
+    static std::string getOrigin(const std::string& url);
+
+    /// The default for the most idle multi handles kept for each origin.
+    static const size_t DEFAULT_MAX_IDLE_PER_ORIGIN;
+
+    /// The default for the most idle multi handles kept in total.
+    static const size_t DEFAULT_MAX_IDLE;
+
+    /// The default for how long an idle multi handle is kept.
+    static const std::chrono::seconds DEFAULT_MAX_IDLE_TIME;
+
+private:
+    /// A multi handle in the pool.
+    struct IdleMultiHandle {
+        /// The multi handle.
+        std::unique_ptr<CurlMultiHandleWrapper> multiHandle;
+        /// When the multi handle was released.
+        std::chrono::steady_clock::time_point releaseTime;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param maxIdlePerOrigin The most idle multi handles kept for each origin.
+     * @param maxIdle The most idle multi handles kept in total.
+     * @param maxIdleTime How long an idle multi handle is kept.
+     */
+    CurlMultiHandlePool(size_t maxIdlePerOrigin, size_t maxIdle, std::chrono::seconds maxIdleTime);
+
+    /**
+     * Remove the multi handles which have been idle for too long.  @c m_mutex must be held.
+     *
+     * @param now The current time.
+     * @param[out] expired Receives the multi handles removed, so that they are cleaned up after @c m_mutex is released.
+     */
+    void removeExpiredLocked(
+        std::chrono::steady_clock::time_point now,
+        std::deque<std::unique_ptr<CurlMultiHandleWrapper>>* expired);
+
+    /// The most idle multi handles kept for each origin.
+    const size_t m_maxIdlePerOrigin;
+
+    /// The most idle multi handles kept in total.
+    const size_t m_maxIdle;
+
+    /// How long an idle multi handle is kept.
+    const std::chrono::seconds m_maxIdleTime;
+
+    /// Serializes access to the pool.
+    std::mutex m_mutex;
+
+    /// The idle multi handles of each origin, oldest first.
+    std::unordered_map<std::string, std::deque<IdleMultiHandle>> m_idleMultiHandles;
+
+    /// The number of idle multi handles in @c m_idleMultiHandles.
+    size_t m_idleCount;
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTIHANDLEPOOL_H_
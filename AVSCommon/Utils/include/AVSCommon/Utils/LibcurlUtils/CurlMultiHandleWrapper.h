@@ -88,6 +88,26 @@ public:
      */
     CURLMcode wait(std::chrono::milliseconds timeout, int* countHandlesUpdated);
 
+    /**
+     * Wait for actions to perform on the @c libcurl @c handles added to this @c libcurl @c multi @c handle, or for a
+     * call to @c wakeup().  Unlike @c wait(), this waits for the whole timeout even if there are no sockets to wait on.
+     *
+     * @note With versions of @c libcurl older than 7.68.0, which lack @c curl_multi_poll(), the timeout is capped so
+     * that a call to @c wakeup() is noticed within a few milliseconds.
+     *
+     * @param timeout How long to wait for actions to perform.
+     * @param[out] countHandlesUpdated The number of handles for which actions are ready to be performed.
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode poll(std::chrono::milliseconds timeout, int* countHandlesUpdated);
+
+    /**
+     * Make a call to @c poll() in progress, or the next call, return immediately.  This may be called from any thread.
+     *
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode wakeup();
+
     /**
      * Receive the next messages about the @c libcurl @c handles added to this @c libcurl @c multi @c handle.
      *
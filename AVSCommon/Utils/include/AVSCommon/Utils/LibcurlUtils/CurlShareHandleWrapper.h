@@ -0,0 +1,107 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
+
+#include <memory>
+#include <mutex>
+
+#include <curl/curl.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * Class to allocate a curl share handle, which lets curl easy handles share the results of DNS lookups and TLS
+ * sessions.  A handle which uses the share resumes the TLS session of an earlier handle to the same host, rather than
+ * performing a full handshake.
+ *
+ * The connection cache is not shared, as libcurl does not support sharing connections between threads.
+ *
+ * The 'libcurlUtils' sub-component of the global configuration supports the following option:
+ * - shareDnsAndTlsSessions If false, @c getProcessShare() returns nullptr, so that each easy handle does its own DNS
+ *   lookups and TLS handshakes.  The default is true.
+ */
+class CurlShareHandleWrapper {
+public:
+    /**
+     * Get the share used by every @c CurlEasyHandleWrapper in the process.
+     *
+     * @return The share, or nullptr if sharing is disabled by configuration or the share could not be created.
+     */
+    static std::shared_ptr<CurlShareHandleWrapper> getProcessShare();
+
+    /**
+     * Create a share.
+     *
+     * @return The new share, or nullptr if it could not be created.
+     */
+    static std::shared_ptr<CurlShareHandleWrapper> create();
+
+    /**
+     * Destructor.  Every easy handle which uses the share must have been cleaned up.
+     */
+    ~CurlShareHandleWrapper();
+
+    /**
+     * Get the underlying curl share handle, to set as @c CURLOPT_SHARE on an easy handle.
+     *
+     * @return The underlying curl share handle.
+     */
+    CURLSH* getCurlShareHandle();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param handle The curl share handle to wrap.
+     */
+    CurlShareHandleWrapper(CURLSH* handle);
+
+    /**
+     * Callback which libcurl calls to lock the data it shares.
+     *
+     * @param handle The easy handle using the data.
+     * @param data Which data to lock.
+     * @param access Whether the data is to be read or written.
+     * @param userPtr The @c CurlShareHandleWrapper which owns the data.
+     */
+    static void lockCallback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr);
+
+    /**
+     * Callback which libcurl calls to unlock the data it shares.
+     *
+     * @param handle The easy handle using the data.
+     * @param data Which data to unlock.
+     * @param userPtr The @c CurlShareHandleWrapper which owns the data.
+     */
+    static void unlockCallback(CURL* handle, curl_lock_data data, void* userPtr);
+
+    /// The curl share handle.
+    CURLSH* m_handle;
+
+    /// A mutex for each kind of data libcurl shares, so that DNS lookups do not wait for TLS sessions or vice versa.
+    std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
@@ -21,6 +21,7 @@
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandlePool.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -28,11 +29,21 @@ namespace utils {
 namespace libcurlUtils {
 
 /**
- * A class that produces @c HTTPContentFetchers.
+ * A class that produces @c HTTPContentFetchers.  The fetchers it produces share a @c CurlMultiHandlePool, so that
+ * fetching a playlist and then its segments and keys reuses the connections to each origin.
  */
 class HTTPContentFetcherFactory : public avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
 public:
+    /**
+     * Constructor.
+     */
+    HTTPContentFetcherFactory();
+
     std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> create(const std::string& url) override;
+
+private:
+    /// The pool of multi handles, and so of connections, shared by the fetchers produced.
+    std::shared_ptr<CurlMultiHandlePool> m_multiHandlePool;
 };
 
 }  // namespace libcurlUtils
@@ -23,6 +23,7 @@
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandlePool.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -35,7 +36,16 @@ namespace libcurlUtils {
  */
 class LibCurlHttpContentFetcher : public avsCommon::sdkInterfaces::HTTPContentFetcherInterface {
 public:
-    LibCurlHttpContentFetcher(const std::string& url);
+    /**
+     * Constructor.
+     *
+     * @param url The URL to fetch from.
+     * @param multiHandlePool The pool to acquire the multi handle which runs the transfer from, so that it can reuse
+     *     a connection of an earlier transfer to the same origin.  If nullptr, the transfer uses a new connection.
+     */
+    LibCurlHttpContentFetcher(
+        const std::string& url,
+        std::shared_ptr<CurlMultiHandlePool> multiHandlePool = nullptr);
 
     /// @name HTTPContentFetcherInterface methods
     /// @{
@@ -69,6 +79,21 @@ private:
     /// A no-op callback to not parse HTTP bodies.
     static size_t noopCallback(char* data, size_t size, size_t nmemb, void* userData);
 
+    /**
+     * Get a multi handle to run the transfer.
+     *
+     * @return A multi handle from @c m_multiHandlePool, or a new one if there is no pool, or nullptr on failure.
+     */
+    std::unique_ptr<CurlMultiHandleWrapper> acquireMultiHandle();
+
+    /**
+     * Dispose of the multi handle which ran the transfer, returning it to @c m_multiHandlePool to keep its connections
+     * open for later transfers.  The easy handle must have been removed from it.
+     *
+     * @param multiHandle The multi handle.
+     */
+    void releaseMultiHandle(std::unique_ptr<CurlMultiHandleWrapper> multiHandle);
+
     /// The content fetching state
     State m_state;
 
@@ -86,6 +111,9 @@ private:
     /// A libcurl wrapper.
     CurlEasyHandleWrapper m_curlWrapper;
 
+    /// The pool of multi handles to run the transfer with, or nullptr to use a new multi handle.
+    std::shared_ptr<CurlMultiHandlePool> m_multiHandlePool;
+
     /// A promise for header loading
     std::promise<bool> m_headerPromise;
 
@@ -16,10 +16,12 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "AVSCommon/Utils/HTTP2/HTTP2ConnectionInterface.h"
@@ -112,16 +114,17 @@ private:
     void cleanupCancelledAndStalledStreams();
 
     /**
-     * Determine whether all non-intermittent streams are paused.  An intermittent stream would be a persistent
-     * downchannel stream, for instace.
-     * @return True if all non-intermittent streams are paused, false otherwise.
+     * UnPause the paused streams which have been resumed, or which have been paused for long enough to try again.
      */
-    bool areStreamsPaused();
+    void unPauseActiveStreams();
 
     /**
-     * UnPause all the active streams.
+     * Work out how long the network loop may wait for activity: until a paused stream should be tried again, or a
+     * stream's activity timeout expires.  @c libcurl shortens this further for its own timers.
+     *
+     * @return How long the network loop may wait for activity.
      */
-    void unPauseActiveStreams();
+    std::chrono::milliseconds getWaitForActivityTimeout();
 
     /**
      * Cancel a stream and report CANCELLED completion status.
@@ -153,9 +156,26 @@ private:
      */
     void notifyObserversOfGoawayReceived();
 
+    /// State shared with the requests of this connection, so that they can wake up the network loop.
+    struct NetworkLoopWakeUp {
+        /**
+         * Make the network loop's wait for activity return immediately.  This may be called from any thread.
+         */
+        void wakeUp();
+
+        /// Serializes access to @c multi.
+        std::mutex mutex;
+
+        /// The multi handle the network loop waits on, or nullptr if there is none.
+        CurlMultiHandleWrapper* multi = nullptr;
+    };
+
     /// Main thread for this class.
     std::thread m_networkThread;
 
+    /// Used to wake up the network loop.  Requests keep a reference to it, as they may outlive this connection.
+    const std::shared_ptr<NetworkLoopWakeUp> m_networkLoopWakeUp;
+
     /// Represents a CURL multi handle.  Intended to only be accessed by the network loop thread.
     std::unique_ptr<avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper> m_multi;
 
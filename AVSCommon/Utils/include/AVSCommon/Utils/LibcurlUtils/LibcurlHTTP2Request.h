@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
@@ -42,9 +43,18 @@ public:
     /// @name HTTP2RequestInterface methods.
     /// @{
     bool cancel() override;
+    void resume() override;
     std::string getId() const override;
     /// @}
 
+    /**
+     * Set the function which wakes up the network loop transferring this request, so that it notices a call to
+     * @c cancel() or @c resume() straight away.  This must be called before the request is added to the network loop.
+     *
+     * @param wakeUpNetworkLoop The function which wakes up the network loop.
+     */
+    void setWakeUpNetworkLoop(std::function<void()> wakeUpNetworkLoop);
+
     /**
      * Gets the CURL easy handle associated with this stream
      *
@@ -85,6 +95,20 @@ public:
      */
     inline void setTimeOfLastTransfer();
 
+    /**
+     * Get the time of the last transfer.  For a paused stream, this is when it was paused.
+     *
+     * @return The time of the last transfer.
+     */
+    std::chrono::steady_clock::time_point getTimeOfLastTransfer() const;
+
+    /**
+     * Get the time the stream may make no progress before @c hasProgressTimedOut() returns true.
+     *
+     * @return The activity timeout, or zero if there is none.
+     */
+    std::chrono::milliseconds getActivityTimeout() const;
+
     /**
      * Un-pause read and write for this request.
      */
@@ -97,6 +121,13 @@ public:
      */
     bool isPaused() const;
 
+    /**
+     * Return whether @c resume() was called since this method last returned true.
+     *
+     * @return whether @c resume() was called since this method last returned true.
+     */
+    bool takeResumeRequest();
+
     /**
      * Return whether this request has been cancelled.
      *
@@ -182,6 +213,12 @@ private:
 
     /// Whether this request has been cancelled.
     std::atomic_bool m_isCancelled;
+
+    /// Whether @c resume() has been called since the network loop last checked.
+    std::atomic_bool m_isResumeRequested;
+
+    /// Wakes up the network loop transferring this request.
+    std::function<void()> m_wakeUpNetworkLoop;
 };
 
 void LibcurlHTTP2Request::setTimeOfLastTransfer() {
@@ -0,0 +1,235 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGWRITER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGWRITER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "AVSCommon/Utils/Logger/Level.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+#include "AVSCommon/Utils/Metrics/MetricRecorderInterface.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Moves the formatting and writing of log lines off the threads that log them.
+ *
+ * Logging threads copy each entry into a slot of a bounded, lock-free multi-producer ring buffer and return. A
+ * background thread takes entries from the ring in batches, formats them with @c LogStringFormatter and writes each
+ * batch to a file descriptor with a single @c writev() call. The background thread is only woken when it is waiting
+ * for entries, so a busy logger costs producers no system calls.
+ *
+ * When the ring is full, entries are either dropped or the logging thread waits for a free slot, depending on the
+ * @c OverflowPolicy. Dropped entries are counted; the count is available from @c getDroppedCount(), is reported as a
+ * log line once space is available again, and is recorded as a metric if a @c MetricRecorderInterface is set.
+ */
+class AsyncLogWriter {
+public:
+    /// What to do with an entry logged while the ring is full.
+    enum class OverflowPolicy {
+        /// Drop the entry and count it.
+        DROP,
+        /// Wait until the background thread frees a slot.
+        BLOCK
+    };
+
+    /**
+     * Create an @c AsyncLogWriter and start its background thread.
+     *
+     * @param fd The file descriptor to write to. It is not closed by the @c AsyncLogWriter.
+     * @param capacity The number of entries the ring holds. Rounded up to a power of two.
+     * @param policy What to do with entries logged while the ring is full.
+     * @return The new @c AsyncLogWriter, or @c nullptr if @c fd or @c capacity is invalid.
+     */
+    static std::unique_ptr<AsyncLogWriter> create(int fd, size_t capacity, OverflowPolicy policy);
+
+    /// Destructor. Writes all queued entries, then stops the background thread.
+    ~AsyncLogWriter();
+
+    /**
+     * Queue a log entry.  This method is thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     * @return @c true if the entry was queued, @c false if it was dropped.
+     */
+    bool push(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text);
+
+    /// Wait until every entry queued before this call has been written.
+    void flush();
+
+    /// The number of entries dropped because the ring was full.
+    uint64_t getDroppedCount() const;
+
+    /**
+     * Set the recorder to report dropped entries to.
+     *
+     * @param metricRecorder The recorder, or @c nullptr to stop reporting.
+     */
+    void setMetricRecorder(std::shared_ptr<metrics::MetricRecorderInterface> metricRecorder);
+
+    /**
+     * Convert a policy name as used in configuration ("DROP" or "BLOCK") to an @c OverflowPolicy.
+     *
+     * @param name The name of the policy.
+     * @param[out] policy The policy.
+     * @return Whether @c name named a policy.
+     */
+    static bool convertNameToOverflowPolicy(const std::string& name, OverflowPolicy* policy);
+
+    /// Entries of up to this many bytes of text are stored inside the ring without allocating.
+    static const size_t INLINE_TEXT_SIZE = 256;
+
+    /// The maximum number of entries written by one @c writev() call.
+    static const size_t MAX_BATCH_SIZE = 64;
+
+private:
+    /// A slot of the ring.
+    struct Slot {
+        /// Sequence number implementing the ring's lock-free hand-off between producers and the consumer.
+        std::atomic<uint64_t> sequence;
+        /// The severity of the entry.
+        Level level;
+        /// The time of the entry.
+        std::chrono::system_clock::time_point time;
+        /// The moniker of the logging thread.
+        char threadMoniker[16];
+        /// The length of the text.
+        size_t length;
+        /// The text, if it fits.
+        char text[INLINE_TEXT_SIZE];
+        /// The text, if it does not fit in @c text.
+        std::string longText;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param fd The file descriptor to write to.
+     * @param capacity The number of slots, a power of two.
+     * @param policy What to do with entries logged while the ring is full.
+     */
+    AsyncLogWriter(int fd, size_t capacity, OverflowPolicy policy);
+
+    /**
+     * Claim a slot for an entry.
+     *
+     * @param block Whether to wait for a free slot.
+     * @param[out] position The ring position of the claimed slot.
+     * @return Whether a slot was claimed; @c false if the ring is full and @c block is @c false.
+     */
+    bool claimSlot(bool block, uint64_t* position);
+
+    /// Wake the background thread if it is waiting for entries.
+    void wakeConsumer();
+
+    /// The body of the background thread.
+    void consumerLoop();
+
+    /**
+     * Format and write a batch of entries.
+     *
+     * @param first The ring position of the first entry.
+     * @param count The number of entries.
+     */
+    void writeBatch(uint64_t first, size_t count);
+
+    /**
+     * Write a line directly to the file descriptor, retrying partial writes.
+     *
+     * @param line The text to write, without the trailing newline.
+     */
+    void writeLine(const std::string& line);
+
+    /// Log and, if a recorder is set, record the entries dropped since the last report.
+    void reportDrops();
+
+    /// The file descriptor to write to.
+    const int m_fd;
+
+    /// What to do with entries logged while the ring is full.
+    const OverflowPolicy m_policy;
+
+    /// The number of slots minus one, used to map positions to slots.
+    const uint64_t m_mask;
+
+    /// The slots.
+    std::unique_ptr<Slot[]> m_slots;
+
+    /// The next position to be claimed by a producer.
+    std::atomic<uint64_t> m_enqueuePosition;
+
+    /// The next position to be written by the consumer.
+    uint64_t m_dequeuePosition;
+
+    /// The number of positions written, published for @c flush().
+    std::atomic<uint64_t> m_writtenPosition;
+
+    /// Whether the consumer is waiting for entries.
+    std::atomic<bool> m_consumerWaiting;
+
+    /// Serializes the consumer's sleep with producer wakeups, and @c flush() waits.
+    std::mutex m_mutex;
+
+    /// Wakes the consumer.
+    std::condition_variable m_entriesAvailable;
+
+    /// Wakes blocked producers and @c flush() callers when entries have been written.
+    std::condition_variable m_entriesWritten;
+
+    /// The number of blocked producers and @c flush() callers waiting on @c m_entriesWritten.
+    std::atomic<int> m_writtenWaiters;
+
+    /// The number of entries dropped.
+    std::atomic<uint64_t> m_droppedCount;
+
+    /// The number of dropped entries already reported.
+    uint64_t m_reportedDroppedCount;
+
+    /// Serializes access to @c m_metricRecorder.
+    std::mutex m_metricRecorderMutex;
+
+    /// The recorder dropped entries are reported to.
+    std::shared_ptr<metrics::MetricRecorderInterface> m_metricRecorder;
+
+    /// Formats entries on the background thread.
+    LogStringFormatter m_formatter;
+
+    /// Whether the writer is being destroyed.
+    std::atomic<bool> m_shutdown;
+
+    /// The background thread.
+    std::thread m_thread;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGWRITER_H_
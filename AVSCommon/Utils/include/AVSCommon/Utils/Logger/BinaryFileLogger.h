@@ -0,0 +1,183 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYFILELOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYFILELOGGER_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger that writes entries in a compact binary form to a set of rotating memory-mapped files.
+ *
+ * Instead of formatting a date with @c strftime() and assembling a line for every entry, this logger stores the raw
+ * clock ticks, interns thread monikers, sources, events and metadata keys to small ids, and stores integer and boolean
+ * metadata values in binary (see @c BinaryLogFormat.h). Entries are copied into a memory-mapped file, so writing one
+ * costs no system call and the kernel writes pages back in bulk. When a file is full it is renamed to "<path>.1" (and
+ * older files to "<path>.2" and so on, up to the configured number of files) and a new file is started.
+ *
+ * Files are decoded back to the text @c ConsoleLogger would have printed with @c BinaryLogDecoder, or with the
+ * BinaryLogDecoder command-line tool in tools/.
+ *
+ * Until @c open() succeeds, entries are passed on to the @c ConsoleLogger.
+ */
+class BinaryFileLogger : public Logger {
+public:
+    /**
+     * Return the one and only @c BinaryFileLogger instance, used when @c ACSDK_LOG_SINK is @c BinaryFile.
+     *
+     * @return The one and only @c BinaryFileLogger instance.
+     */
+    static std::shared_ptr<Logger> instance();
+
+    /**
+     * Create a @c BinaryFileLogger writing to the given files.
+     *
+     * @param path The path of the current file.
+     * @param fileSize The size of each file in bytes.
+     * @param fileCount The number of files to keep, including the current one.
+     * @return The new logger, or @c nullptr if the file could not be opened.
+     */
+    static std::unique_ptr<BinaryFileLogger> create(const std::string& path, size_t fileSize, size_t fileCount);
+
+    /// Destructor.
+    ~BinaryFileLogger();
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    /**
+     * Start writing to the given files. Any existing files are rotated first, so the previous run's entries are kept
+     * in "<path>.1". Once a file has been opened, calling this again has no effect.
+     *
+     * @param path The path of the current file.
+     * @param fileSize The size of each file in bytes.
+     * @param fileCount The number of files to keep, including the current one.
+     * @return Whether the file is open.
+     */
+    bool open(const std::string& path, size_t fileSize, size_t fileCount);
+
+    /// Ask the kernel to write the current file back to storage now.
+    void flush();
+
+    /// The smallest accepted file size.
+    static const size_t MIN_FILE_SIZE = 4096;
+
+private:
+    /// The sections of the text of an entry, and the types of its metadata values.
+    struct ParsedText;
+
+    /// Constructor.
+    BinaryFileLogger();
+
+    /**
+     * Encode an entry into @c m_definitions and @c m_entry, interning strings as needed.
+     *
+     * @param level The severity Level of this log line.
+     * @param ticks The time that the event to log occurred, in system clock ticks.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param text The text of the entry to log.
+     * @param parsed The result of @c parse() for @c text.
+     */
+    void encodeLocked(
+        Level level,
+        int64_t ticks,
+        const char* threadMoniker,
+        const char* text,
+        const ParsedText& parsed);
+
+    /**
+     * Split @c text into its source, event, metadata and message sections, and find the type of each metadata value.
+     * This needs no member, so it is done before @c m_mutex is taken.
+     *
+     * @param text The text of the entry.
+     * @param[out] parsed The sections of @c text.
+     */
+    static void parse(const char* text, ParsedText* parsed);
+
+    /**
+     * Append the id of a string to @c m_entry, and a definition to @c m_definitions if the string is new to this file.
+     *
+     * @param begin The start of the string.
+     * @param length The length of the string.
+     */
+    void appendStringIdLocked(const char* begin, size_t length);
+
+    /// Start a new file, rotating the older ones.
+    bool openFileLocked();
+
+    /// Unmap and close the current file.
+    void closeFileLocked();
+
+    /// Serializes access to all members.
+    std::mutex m_mutex;
+
+    /// The path of the current file.
+    std::string m_path;
+
+    /// The size of each file.
+    size_t m_fileSize;
+
+    /// The number of files kept.
+    size_t m_fileCount;
+
+    /// The descriptor of the current file, or -1.
+    int m_fd;
+
+    /// The mapping of the current file, or @c nullptr.
+    uint8_t* m_map;
+
+    /// The offset at which the next record is written.
+    size_t m_offset;
+
+    /// The ticks of the previous entry in the current file.
+    int64_t m_previousTicks;
+
+    /// The ids of the strings defined in the current file.
+    std::unordered_map<std::string, uint64_t> m_stringIds;
+
+    /// Reused to look strings up in @c m_stringIds without allocating.
+    std::string m_lookupKey;
+
+    /// The definitions of the strings first used by the entry being encoded, reused between entries.
+    std::string m_definitions;
+
+    /// The record of the entry being encoded, reused between entries.
+    std::string m_entry;
+};
+
+/**
+ * Return the singleton instance of @c BinaryFileLogger.
+ *
+ * @return The singleton instance of @c BinaryFileLogger.
+ */
+std::shared_ptr<Logger> getBinaryFileLogger();
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYFILELOGGER_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGDECODER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGDECODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * Decodes files written by @c BinaryFileLogger back to the lines @c ConsoleLogger would have printed.
+ */
+class BinaryLogDecoder {
+public:
+    /**
+     * Decode a binary log.
+     *
+     * @param data The contents of a binary log file.
+     * @param size The size of @c data.
+     * @param out The stream to write one line per entry to.
+     * @return Whether all of @c data was valid. Entries before invalid data are still written.
+     */
+    static bool decode(const uint8_t* data, size_t size, std::ostream& out);
+
+    /**
+     * Decode a binary log file.
+     *
+     * @param path The path of the file.
+     * @param out The stream to write one line per entry to.
+     * @return Whether the file could be read and was valid.
+     */
+    static bool decodeFile(const std::string& path, std::ostream& out);
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGDECODER_H_
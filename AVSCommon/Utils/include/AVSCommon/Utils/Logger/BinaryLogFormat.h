@@ -0,0 +1,127 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGFORMAT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGFORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace binaryLog {
+
+/**
+ * The layout of files written by @c BinaryFileLogger and read by @c BinaryLogDecoder.
+ *
+ * A file starts with a @c HEADER_SIZE byte header: @c MAGIC, then @c VERSION, @c HEADER_SIZE and the numerator and
+ * denominator of the period of the stored clock ticks, all little-endian. Records follow back to back until a
+ * @c RecordType::END byte or the end of the file; unused space at the end of a file is zero.
+ *
+ * Integers inside records are LEB128 varints; signed ones are zigzag encoded first. Strings are a varint length
+ * followed by that many bytes. Each file is self-contained: strings are interned per file, and the first entry of a
+ * file stores its time relative to zero.
+ *
+ * A log entry's text has the form "source:event[:key=value,...][:message]", as built by @c LogEntry. An
+ * @c RecordType::ENTRY record stores the source, the event, the keys and the thread moniker as interned string ids
+ * and each value with a type, so that the decoder reproduces the text exactly. Text that does not have that form is
+ * stored verbatim in an @c RecordType::TEXT record.
+ */
+
+/// Identifies a binary log file.
+static const char MAGIC[8] = {'A', 'C', 'S', 'D', 'K', 'B', 'L', 'G'};
+
+/// The version of the format.
+static const uint32_t VERSION = 1;
+
+/// The size of the file header.
+static const size_t HEADER_SIZE = 32;
+
+/// The type of a record, stored as its first byte.
+enum class RecordType : uint8_t {
+    /// No more records follow.
+    END = 0,
+    /// Defines the next string id: the string.
+    STRING = 1,
+    /// A structured log entry: level character, zigzag time delta in ticks, moniker id, source id, event id, flags,
+    /// then if @c FLAG_METADATA the pair count and pairs (key id, @c ValueType, value), then if @c FLAG_MESSAGE the
+    /// message string.
+    ENTRY = 2,
+    /// An unstructured log entry: level character, zigzag time delta in ticks, moniker id, then the text string.
+    TEXT = 3
+};
+
+/// Flag of an @c RecordType::ENTRY record whose text has a metadata section, which may be empty.
+static const uint8_t FLAG_METADATA = 1;
+
+/// Flag of an @c RecordType::ENTRY record whose text has a message section.
+static const uint8_t FLAG_MESSAGE = 2;
+
+/// The type of a metadata value.
+enum class ValueType : uint8_t {
+    /// A string, stored escaped as in the text.
+    STRING = 0,
+    /// A decimal integer in canonical form, stored as a zigzag varint.
+    INTEGER = 1,
+    /// The value "true".
+    TRUE_VALUE = 2,
+    /// The value "false".
+    FALSE_VALUE = 3
+};
+
+/**
+ * Append a varint.
+ *
+ * @param value The value.
+ * @param[out] out The string to append to.
+ */
+inline void appendVarint(uint64_t value, std::string* out) {
+    while (value >= 0x80) {
+        out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out->push_back(static_cast<char>(value));
+}
+
+/**
+ * Zigzag encode a signed value so that small magnitudes give short varints.
+ *
+ * @param value The value.
+ * @return The encoded value.
+ */
+inline uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/**
+ * Decode a zigzag encoded value.
+ *
+ * @param value The encoded value.
+ * @return The value.
+ */
+inline int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+}  // namespace binaryLog
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_BINARYLOGFORMAT_H_
@@ -16,6 +16,9 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 
+#include <atomic>
+
+#include "AVSCommon/Utils/Logger/AsyncLogWriter.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Logger/LogStringFormatter.h"
@@ -26,7 +29,10 @@ namespace utils {
 namespace logger {
 
 /**
- * A very simple (e.g. not asynchronous) @c Logger that logs to console.
+ * A very simple @c Logger that logs to console.
+ *
+ * By default each entry is written to @c std::cout by the logging thread. Once @c enableAsync() has been called,
+ * entries are handed to an @c AsyncLogWriter and written to standard output by its background thread instead.
  *
  * Inheriting @c std::ios_base::Init ensures that the standard iostreams objects are properly initialized before @c
  * ConsoleLogger uses them.
@@ -45,6 +51,25 @@ public:
     void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
         override;
 
+    /**
+     * Write entries to standard output from a background thread from now on. This can only be done once.
+     *
+     * @param capacity The number of entries that may be waiting to be written.
+     * @param policy What to do with entries logged while @c capacity entries are waiting.
+     * @return Whether asynchronous logging was enabled.
+     */
+    bool enableAsync(size_t capacity, AsyncLogWriter::OverflowPolicy policy);
+
+    /**
+     * Set the recorder that entries dropped by asynchronous logging are reported to.
+     *
+     * @param metricRecorder The recorder.
+     */
+    void setMetricRecorder(std::shared_ptr<metrics::MetricRecorderInterface> metricRecorder);
+
+    /// Wait until all entries logged so far have been written.
+    void flush();
+
 private:
     /**
      * Constructor.
@@ -53,6 +78,12 @@ private:
 
     std::mutex m_coutMutex;
 
+    /// The writer used once asynchronous logging is enabled. Owned by @c m_asyncWriterOwner.
+    std::atomic<AsyncLogWriter*> m_asyncWriter;
+
+    /// Owns the writer. Set once, under @c m_coutMutex, and never reset while the logger exists.
+    std::unique_ptr<AsyncLogWriter> m_asyncWriterOwner;
+
     /// Object to format log strings correctly.
     LogStringFormatter m_logFormatter;
 };
@@ -115,6 +115,12 @@ namespace logger {
  * check before evaluating the @c LX() expression.  That allows much of the CPU overhead of compiled-in log
  * lines to be selectively bypassed at run-time if the @c Logger's log level is set to not emit them.
  *
+ * Logs below a minimum severity can also be removed at compile time for all modules, or for selected modules, with
+ * the @c ACSDK_MIN_LOG_LEVEL and @c ACSDK_MIN_LOG_LEVEL_MODULES CMake options (see build/cmake/Logger.cmake).
+ * For example, to build with only warnings and above, except for the @c acl module which keeps all logs:
+ *
+ *     cmake <path-to-source> -DACSDK_MIN_LOG_LEVEL=WARN -DACSDK_MIN_LOG_LEVEL_MODULES="acl=DEBUG9"
+ *
  * Logging may also be configured on a per-module basis.  Modules are defined by defining
  * @c ACSDK_LOG_MODULE to a common name for all source files in a module.  This name specifies the name
  * of an object under @c configuration::ConfigurationNode::getRoot().  The named object contains
@@ -285,6 +291,71 @@ bool Logger::shouldLog(Level level) const {
  */
 std::shared_ptr<Logger> ACSDK_GET_SINK_LOGGER();
 
+// If @c ACSDK_MIN_LOG_LEVEL was not defined, compile in logs of all levels.
+#ifndef ACSDK_MIN_LOG_LEVEL
+#define ACSDK_MIN_LOG_LEVEL DEBUG9
+#endif
+
+// If @c ACSDK_MIN_LOG_LEVEL_OVERRIDES was not defined, no module overrides @c ACSDK_MIN_LOG_LEVEL.
+#ifndef ACSDK_MIN_LOG_LEVEL_OVERRIDES
+#define ACSDK_MIN_LOG_LEVEL_OVERRIDES ""
+#endif
+
+namespace minLogLevel {
+
+/**
+ * Match a module name at the start of an entry of a list of overrides.
+ *
+ * @param entry The start of the entry, of the form "<module>=<level number>".
+ * @param module The name of the module.
+ * @return The start of the level number if the entry is for @c module, otherwise @c nullptr.
+ */
+constexpr const char* matchModule(const char* entry, const char* module) {
+    return '\0' == *module ? ('=' == *entry ? entry + 1 : nullptr)
+                            : (*entry == *module ? matchModule(entry + 1, module + 1) : nullptr);
+}
+
+/**
+ * Parse the decimal level number at the start of a string.
+ *
+ * @param digits The digits.
+ * @param value The value of the digits parsed so far.
+ * @return The level number.
+ */
+constexpr int parseLevel(const char* digits, int value) {
+    return *digits >= '0' && *digits <= '9' ? parseLevel(digits + 1, value * 10 + (*digits - '0')) : value;
+}
+
+/**
+ * Find the override for a module in a list of overrides.
+ *
+ * @param overrides The rest of a list of overrides of the form ",<module>=<level number>,<module>=<level number>,".
+ * @param module The name of the module.
+ * @param defaultLevel The level to return if @c module has no override.
+ * @return The overriding level, or @c defaultLevel.
+ */
+constexpr Level findOverride(const char* overrides, const char* module, Level defaultLevel) {
+    return '\0' == *overrides
+               ? defaultLevel
+               : (',' == *overrides && matchModule(overrides + 1, module)
+                      ? static_cast<Level>(parseLevel(matchModule(overrides + 1, module), 0))
+                      : findOverride(overrides + 1, module, defaultLevel));
+}
+
+}  // namespace minLogLevel
+
+/**
+ * Return the lowest severity level of logs compiled in for a module.
+ *
+ * @param module The value of @c ACSDK_LOG_MODULE for the module, or an empty string.
+ * @param overrides The per-module levels, as generated into @c ACSDK_MIN_LOG_LEVEL_OVERRIDES by Logger.cmake.
+ * @param defaultLevel The level of modules without an override.
+ * @return The lowest severity level of logs compiled in for @c module.
+ */
+constexpr Level getMinLogLevel(const char* module, const char* overrides, Level defaultLevel) {
+    return '\0' == *module ? defaultLevel : minLogLevel::findOverride(overrides, module, defaultLevel);
+}
+
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
@@ -343,18 +414,45 @@ inline Logger& ACSDK_GET_LOGGER_FUNCTION() {
 
 #endif
 
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+#ifdef ACSDK_LOG_MODULE
+/// The lowest severity level of logs compiled in for the module this file belongs to.
+static constexpr Level ACSDK_COMPILED_MIN_LOG_LEVEL = getMinLogLevel(
+    ACSDK_STRINGIFY(ACSDK_LOG_MODULE),
+    ACSDK_MIN_LOG_LEVEL_OVERRIDES,
+    Level::ACSDK_MIN_LOG_LEVEL);
+#else
+/// The lowest severity level of logs compiled in for files that do not belong to a module.
+static constexpr Level ACSDK_COMPILED_MIN_LOG_LEVEL = Level::ACSDK_MIN_LOG_LEVEL;
+#endif
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
 /**
  * Common implementation for sending entries to the log.
  *
+ * Logs below @c ACSDK_COMPILED_MIN_LOG_LEVEL fail a constant check, so the compiler removes them entirely.  Logs
+ * that are compiled in but below the @c Logger's level fail the run-time check before @c entry is evaluated, so no
+ * @c LogEntry is constructed and none of the arguments of its @c d() and @c m() calls are evaluated.
+ *
  * @param level The log level to associate with the log line.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_LOG(level, entry)                                                                       \
-    do {                                                                                              \
-        auto& loggerInstance = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION(); \
-        if (loggerInstance.shouldLog(level)) {                                                        \
-            loggerInstance.log(level, entry);                                                         \
-        }                                                                                             \
+#define ACSDK_LOG(level, entry)                                                                           \
+    do {                                                                                                  \
+        if (level >= alexaClientSDK::avsCommon::utils::logger::ACSDK_COMPILED_MIN_LOG_LEVEL) {            \
+            auto& loggerInstance = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_LOGGER_FUNCTION(); \
+            if (loggerInstance.shouldLog(level)) {                                                        \
+                loggerInstance.log(level, entry);                                                         \
+            }                                                                                             \
+        }                                                                                                 \
     } while (false)
 
 #ifdef ACSDK_DEBUG_LOG_ENABLED
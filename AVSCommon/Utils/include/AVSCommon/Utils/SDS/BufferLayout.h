@@ -43,7 +43,7 @@ public:
     static const uint32_t MAGIC_NUMBER = 0x53445348;
 
     /// Version of this header layout.
-    static const uint32_t VERSION = 2;
+    static const uint32_t VERSION = 3;
 
     /**
      * The constructor only initializes a shared pointer to the provided buffer.  Attaching and/or initializing is
@@ -106,6 +106,15 @@ public:
         /// This field contains the mutex used by @c dataAvailableConditionVariable.
         Mutex dataAvailableMutex;
 
+        /**
+         * This field contains the smallest @c writeStartCursor which a @c BLOCKING @c Reader is waiting for, or
+         * @c std::numeric_limits<Index>::max() if no @c Reader is waiting.  @c Readers lower it while holding
+         * @c dataAvailableMutex, and the @c Writer resets it while holding @c dataAvailableMutex when it notifies them.
+         * This lets the @c Writer skip locking @c dataAvailableMutex and notifying for writes which no @c Reader is
+         * waiting for.
+         */
+        AtomicIndex dataAvailableWakeCursor;
+
         /**
          * This field contains the condition variable used to notify @c Writers that space is available.  Note that
          * this condition variable does not have a dedicated mutex; the condition is protected by backwardSeekMutex.
@@ -516,6 +525,7 @@ bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders,
     header->writeStartCursor = 0;
     header->writeEndCursor = 0;
     header->oldestUnconsumedCursor = 0;
+    header->dataAvailableWakeCursor = std::numeric_limits<Index>::max();
     header->referenceCount = 1;
 
     // Reader arrays initialization.
@@ -82,6 +82,14 @@ public:
         };
     };
 
+    /// Describes data in the stream's buffer as up to two regions which are each contiguous in memory.
+    struct Regions {
+        /// The start of each region.
+        const void* data[2];
+        /// The size of each region in @c wordSize words.  The second region is empty unless the data wraps.
+        size_t nWords[2];
+    };
+
     /**
      * Constructs a new @c Reader which consumes data from the provided @c SharedDataStream.  The caller must hold
      * @c Header::readerEnableMutex when constructing new Readers.
@@ -115,6 +123,57 @@ public:
      */
     ssize_t read(void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function waits for data in the stream and provides direct access to it in the stream's buffer, without
+     * copying or consuming it.  The data stays in the stream until it is released with @c consume(), so repeated calls
+     * to @c peek() without an intervening @c consume() return the same data (plus any data written since).
+     *
+     * @param[out] regions The location of the available data in the stream's buffer.  Data which wraps around the end
+     *     of the buffer is split across the two regions.
+     * @param minWords The minimum number of @c wordSize words to wait for.  If @c policy is @c NONBLOCKING and fewer
+     *     words are available, @c WOULDBLOCK is returned.  Fewer words are returned if the stream closes before
+     *     @c minWords are available.  This must not be larger than the stream's data size.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for data.  If this parameter is zero,
+     *     there is no timeout and blocking peeks will wait forever.  If @c policy is @c NONBLOCKING, this parameter
+     *     is ignored.
+     * @return The total number of @c wordSize words in @c regions, or zero if the stream has closed, or a negative
+     *     @c Error code if the stream is still open, but no data is available.
+     *
+     * @note While it is unconsumed, the data in @c regions holds off @c BLOCKING and @c ALL_OR_NOTHING @c Writers just
+     *     like data which has not been @c read().  A @c NONBLOCKABLE @c Writer may overwrite it, which @c consume()
+     *     reports with @c OVERRUN.
+     */
+    ssize_t peek(
+        Regions* regions,
+        size_t minWords = 1,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function consumes data previously returned by @c peek(), moving the @c Reader past it.
+     *
+     * @param nWords The number of @c wordSize words to consume from the start of the data returned by @c peek().
+     *     This must not be more than @c peek() returned.
+     * @return @c nWords if the data was consumed, or a negative @c Error code.  @c OVERRUN is returned (and the data
+     *     is still consumed) if a @c Writer overwrote the data before it was consumed.
+     */
+    ssize_t consume(size_t nWords);
+
+    /**
+     * This function waits until a number of words can be read from the stream, without reading them.  It lets a
+     * consumer which processes data in batches sleep until a whole batch is available, rather than waking up for
+     * every write.
+     *
+     * @param nWords The number of @c wordSize words to wait for.  Fewer words are returned if the stream closes before
+     *     @c nWords are available.  This must not be larger than the stream's data size.
+     * @param timeout The maximum time to wait for data.  If this parameter is zero, there is no timeout and blocking
+     *     waits will wait forever.  If @c policy is @c NONBLOCKING, a zero timeout returns straight away, and a
+     *     non-zero timeout waits as a @c BLOCKING reader would.  This lets a consumer which reads without blocking on
+     *     one thread be woken up on another thread when data arrives.
+     * @return The number of @c wordSize words available to read, which may be more than @c nWords, or zero if the
+     *     stream has closed, or a negative @c Error code if the stream is still open, but @c nWords are not available.
+     */
+    ssize_t wait(size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
     /**
      * This function moves the @c Reader to the specified location in the stream.  If successful, subsequent calls to
      * @c read() will start from the new location.  For this function to succeed, the specified location *must* point
@@ -188,6 +247,18 @@ private:
      */
     static const std::string TAG;
 
+    /**
+     * This function waits until a number of words can be read from the stream, as @c wait() does.
+     *
+     * @param nWords The number of @c wordSize words to wait for.
+     * @param timeout The maximum time to wait for data, if @c shouldBlock is @c true.  If this parameter is zero,
+     *     there is no timeout and the wait is forever.
+     * @param shouldBlock Whether to wait for data, rather than return @c WOULDBLOCK when it is not available.
+     * @return The number of @c wordSize words available to read, or zero if the stream has closed, or a negative
+     *     @c Error code if the stream is still open, but @c nWords are not available.
+     */
+    ssize_t waitForWords(size_t nWords, std::chrono::milliseconds timeout, bool shouldBlock);
+
     /// The @c Policy to use for reading from the stream.
     Policy m_policy;
 
@@ -253,63 +324,15 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::INVALID;
     }
 
-    // Check if closed.
-    auto readerCloseIndex = m_readerCloseIndex->load();
-    if (*m_readerCursor >= readerCloseIndex) {
-        return Error::CLOSED;
-    }
-
-    // Initial check for overrun.
-    auto header = m_bufferLayout->getHeader();
-    if ((header->writeEndCursor >= *m_readerCursor) &&
-        (header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize()) {
-        return Error::OVERRUN;
-    }
-
-    std::unique_lock<Mutex> lock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::BLOCKING == m_policy) {
-        lock.lock();
-    }
-
-    // Figure out how much we can actually copy.
-    size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
-    if (0 == wordsAvailable) {
-        if (header->writeEndCursor > 0 && !header->isWriterEnabled) {
-            return Error::CLOSED;
-        } else if (Policy::NONBLOCKING == m_policy) {
-            return Error::WOULDBLOCK;
-        } else if (Policy::BLOCKING == m_policy) {
-            // Condition for returning from read: the Writer has been closed or there is data to read
-            auto predicate = [this, header] {
-                return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
-            };
-
-            if (std::chrono::milliseconds::zero() == timeout) {
-                header->dataAvailableConditionVariable.wait(lock, predicate);
-            } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
-                return Error::TIMEDOUT;
-            }
-        }
-        wordsAvailable = tell(Reference::BEFORE_WRITER);
-
-        // If there is still no data, the writer has closed in the interim
-        if (0 == wordsAvailable) {
-            return Error::CLOSED;
-        }
-    }
-
-    if (Policy::BLOCKING == m_policy) {
-        lock.unlock();
+    // Wait for any data.
+    auto wordsAvailable = waitForWords(1, timeout, Policy::BLOCKING == m_policy);
+    if (wordsAvailable <= 0) {
+        return wordsAvailable;
     }
-    if (nWords > wordsAvailable) {
+    if (nWords > static_cast<size_t>(wordsAvailable)) {
         nWords = wordsAvailable;
     }
 
-    // Don't read beyond our close index.
-    if ((*m_readerCursor + nWords) > readerCloseIndex) {
-        nWords = readerCloseIndex - *m_readerCursor;
-    }
-
     // Split it across the wrap.
     size_t beforeWrap = m_bufferLayout->wordsUntilWrap(*m_readerCursor);
     if (beforeWrap > nWords) {
@@ -331,6 +354,7 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     *m_readerCursor += nWords;
 
     // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
+    auto header = m_bufferLayout->getHeader();
     bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
 
     // Move the unconsumed cursor before returning.
@@ -344,6 +368,152 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     return nWords;
 }
 
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::peek(Regions* regions, size_t minWords, std::chrono::milliseconds timeout) {
+    if (nullptr == regions) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "nullRegions"));
+        return Error::INVALID;
+    }
+
+    if (0 == minWords || minWords > m_bufferLayout->getDataSize()) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "invalidMinWords").d("minWords", minWords));
+        return Error::INVALID;
+    }
+
+    // Wait for the data.
+    auto wordsAvailable = waitForWords(minWords, timeout, Policy::BLOCKING == m_policy);
+    if (wordsAvailable <= 0) {
+        return wordsAvailable;
+    }
+    size_t nWords = wordsAvailable;
+
+    // Split it across the wrap.
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(*m_readerCursor);
+    if (beforeWrap > nWords) {
+        beforeWrap = nWords;
+    }
+    regions->data[0] = m_bufferLayout->getData(*m_readerCursor);
+    regions->nWords[0] = beforeWrap;
+    regions->data[1] = m_bufferLayout->getData(*m_readerCursor + beforeWrap);
+    regions->nWords[1] = nWords - beforeWrap;
+
+    // Final check for overrun, in case a writer lapped us while we were waiting.
+    auto header = m_bufferLayout->getHeader();
+    if ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize()) {
+        return Error::OVERRUN;
+    }
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::consume(size_t nWords) {
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "consumeFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        return Error::INVALID;
+    }
+
+    // Only data which could have been returned by peek() can be consumed.
+    if (nWords > tell(Reference::BEFORE_WRITER) || (*m_readerCursor + nWords) > *m_readerCloseIndex) {
+        logger::acsdkError(
+            logger::LogEntry(TAG, "consumeFailed").d("reason", "beyondPeekedData").d("numWords", nWords));
+        return Error::INVALID;
+    }
+
+    // Check whether the oldest of the data was overwritten while it was in use (do this before the
+    // updateOldestUnconsumedCursor() call below, after which the writer may legitimately overwrite it).
+    auto header = m_bufferLayout->getHeader();
+    bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
+
+    // Advance the read cursor.
+    *m_readerCursor += nWords;
+
+    // Move the unconsumed cursor before returning.
+    m_bufferLayout->updateOldestUnconsumedCursor();
+
+    if (overrun) {
+        return Error::OVERRUN;
+    }
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::wait(size_t nWords, std::chrono::milliseconds timeout) {
+    return waitForWords(nWords, timeout, Policy::BLOCKING == m_policy || timeout != std::chrono::milliseconds::zero());
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::waitForWords(size_t nWords, std::chrono::milliseconds timeout, bool shouldBlock) {
+    if (0 == nWords || nWords > m_bufferLayout->getDataSize()) {
+        logger::acsdkError(logger::LogEntry(TAG, "waitFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        return Error::INVALID;
+    }
+
+    // Check if closed.
+    auto readerCloseIndex = m_readerCloseIndex->load();
+    if (*m_readerCursor >= readerCloseIndex) {
+        return Error::CLOSED;
+    }
+
+    // Initial check for overrun.
+    auto header = m_bufferLayout->getHeader();
+    if ((header->writeEndCursor >= *m_readerCursor) &&
+        (header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize()) {
+        return Error::OVERRUN;
+    }
+
+    // Don't wait for data beyond our close index.
+    if ((*m_readerCursor + nWords) > readerCloseIndex) {
+        nWords = readerCloseIndex - *m_readerCursor;
+    }
+
+    // Note: The data can be checked without holding dataAvailableMutex; the mutex is only needed to block.
+    size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
+    bool writerClosed = header->writeEndCursor > 0 && !header->isWriterEnabled;
+    if (wordsAvailable < nWords && !writerClosed) {
+        if (!shouldBlock) {
+            return Error::WOULDBLOCK;
+        }
+
+        // Condition for returning from wait: the Writer has been closed or there is enough data.
+        // Note: The Writer only locks dataAvailableMutex and notifies once writeStartCursor reaches
+        // dataAvailableWakeCursor, so before blocking, this Reader lowers dataAvailableWakeCursor to the cursor it is
+        // waiting for and then checks the condition again.  The Writer moves writeStartCursor and then checks
+        // dataAvailableWakeCursor, so either this Reader sees the new data or the Writer sees this Reader waiting.
+        Index wakeCursor = *m_readerCursor + nWords;
+        auto predicate = [this, header, nWords, wakeCursor] {
+            if (header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) >= nWords) {
+                return true;
+            }
+            if (wakeCursor < header->dataAvailableWakeCursor) {
+                header->dataAvailableWakeCursor = wakeCursor;
+            }
+            return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) >= nWords;
+        };
+
+        std::unique_lock<Mutex> lock(header->dataAvailableMutex);
+        if (std::chrono::milliseconds::zero() == timeout) {
+            header->dataAvailableConditionVariable.wait(lock, predicate);
+        } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
+            return Error::TIMEDOUT;
+        }
+        wordsAvailable = tell(Reference::BEFORE_WRITER);
+    }
+
+    // If there is no data, the writer has closed.
+    if (0 == wordsAvailable) {
+        return Error::CLOSED;
+    }
+
+    // Don't report data beyond our close index.
+    if ((*m_readerCursor + wordsAvailable) > readerCloseIndex) {
+        wordsAvailable = readerCloseIndex - *m_readerCursor;
+    }
+
+    return wordsAvailable;
+}
+
 template <typename T>
 bool SharedDataStream<T>::Reader::seek(Index offset, Reference reference) {
     auto header = m_bufferLayout->getHeader();
@@ -0,0 +1,244 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SDSBUFFERPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SDSBUFFERPOOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AVSCommon/Utils/Metrics/MetricRecorderInterface.h"
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A pool of the buffers which @c InProcessSDS streams are created on.
+ *
+ * Buffers are grouped in size classes, each a power of two plus an allowance for the header of the stream, so that a
+ * stream of a power-of-two size fits the class of that size.  A buffer is reserved with the capacity of the smallest
+ * class holding the size requested, and resized to that size.  When the last reference to a buffer is released, the
+ * buffer is kept idle in its class, as long as the capacity of all the idle buffers stays within a bound, so that the
+ * stream of the next interaction reuses it rather than allocating.  Buffers larger than the largest class are neither
+ * rounded up nor kept.  Buffers are zeroed when acquired, so that a stream never holds data, such as audio, left by the
+ * previous user of its buffer.
+ *
+ * The memory of the pooled buffers can be advised to be backed by transparent huge pages, and locked in RAM.  Both are
+ * best effort: a failure is logged, and the buffer is used as is.
+ *
+ * This class is thread-safe.  Buffers may outlive their pool, in which case they are freed when released.
+ */
+class SDSBufferPool : public std::enable_shared_from_this<SDSBufferPool> {
+public:
+    /// The settings of a pool.
+    struct Configuration {
+        /// Constructor, with the default settings.
+        Configuration();
+
+        /// The capacity of the smallest class, without the header allowance.  Rounded up to a power of two.
+        size_t minClassSize;
+
+        /// The capacity of the largest class, without the header allowance.  Rounded up to a power of two.
+        size_t maxClassSize;
+
+        /// The capacity added to each class for the header of the stream.
+        size_t headerAllowance;
+
+        /// The most capacity kept in idle buffers, over all the classes.
+        size_t maxRetainedBytes;
+
+        /// Whether the memory of pooled buffers is advised to be backed by transparent huge pages.
+        bool useHugePages;
+
+        /// Whether the memory of pooled buffers is locked in RAM.  This makes the whole capacity resident.
+        bool lockMemory;
+    };
+
+    /// Counts of what the pool has done since it was created.
+    struct Statistics {
+        /// The number of buffers acquired.
+        uint64_t acquisitions;
+
+        /// The number of buffers acquired which reused an idle buffer.
+        uint64_t reuses;
+
+        /// The number of buffers acquired which were allocated.
+        uint64_t allocations;
+
+        /// The number of buffers released which were freed rather than kept idle.
+        uint64_t discards;
+
+        /// The capacity of the idle buffers.
+        size_t retainedBytes;
+
+        /// The capacity of the buffers acquired and not yet released.
+        size_t inUseBytes;
+    };
+
+    /**
+     * Create a pool.
+     *
+     * @param configuration The settings of the pool.
+     * @return The new pool, or nullptr if the settings are invalid.
+     */
+    static std::shared_ptr<SDSBufferPool> create(const Configuration& configuration = Configuration());
+
+    /**
+     * Get the pool shared by the streams of the process.
+     *
+     * @return The default pool.
+     */
+    static std::shared_ptr<SDSBufferPool> getDefault();
+
+    /**
+     * Set the settings used when the default pool is created.  Has no effect once @c getDefault() has been called.
+     *
+     * @param configuration The settings of the default pool.
+     */
+    static void setDefaultConfiguration(const Configuration& configuration);
+
+    /**
+     * Acquire a buffer.
+     *
+     * @param size The size of the buffer, in bytes.
+     * @return A buffer of @c size bytes, which returns to the pool when the last reference to it is released.
+     */
+    std::shared_ptr<InProcessSDSTraits::Buffer> acquire(size_t size);
+
+    /**
+     * Get the capacity a buffer acquired from this pool is reserved with.
+     *
+     * @param size The size of the buffer, in bytes.
+     * @return The capacity of the class of the buffer, or zero if the buffer is too large to be pooled.
+     */
+    size_t getClassSize(size_t size) const;
+
+    /**
+     * Get the counts of what the pool has done.
+     *
+     * @return The statistics of the pool.
+     */
+    Statistics getStatistics();
+
+    /**
+     * Set the recorder the statistics of the pool are periodically reported to.
+     *
+     * @param metricRecorder The recorder, or @c nullptr to stop reporting.
+     */
+    void setMetricRecorder(std::shared_ptr<metrics::MetricRecorderInterface> metricRecorder);
+
+    /// Destructor.
+    ~SDSBufferPool();
+
+    /// The default capacity of the smallest class.
+    static const size_t DEFAULT_MIN_CLASS_SIZE;
+
+    /// The default capacity of the largest class.
+    static const size_t DEFAULT_MAX_CLASS_SIZE;
+
+    /// The default capacity added to each class for the header of the stream.
+    static const size_t DEFAULT_HEADER_ALLOWANCE;
+
+    /// The default for the most capacity kept in idle buffers.
+    static const size_t DEFAULT_MAX_RETAINED_BYTES;
+
+    /// The number of acquisitions between two reports of the statistics to the metric recorder.
+    static const uint64_t STATISTICS_REPORT_INTERVAL;
+
+private:
+    /// A buffer owned by the pool.
+    using Buffer = std::unique_ptr<InProcessSDSTraits::Buffer>;
+
+    /**
+     * Constructor.
+     *
+     * @param configuration The settings of the pool, with the class sizes rounded up to powers of two.
+     */
+    SDSBufferPool(const Configuration& configuration);
+
+    /**
+     * Get the class of a buffer.
+     *
+     * @param size The size of the buffer, in bytes.
+     * @return The index of the class of the buffer, or the largest @c size_t if the buffer is too large to be pooled.
+     */
+    size_t getClassIndex(size_t size) const;
+
+    /**
+     * Get the capacity of a class.
+     *
+     * @param classIndex The index of the class.
+     * @return The capacity of the class.
+     */
+    size_t getClassCapacity(size_t classIndex) const;
+
+    /**
+     * Return a buffer to its class, or free it if the pool is full.
+     *
+     * @param buffer A buffer acquired from this pool.
+     * @param classIndex The index of the class of the buffer.
+     */
+    void release(Buffer buffer, size_t classIndex);
+
+    /**
+     * Allocate a buffer for a class, applying the memory settings of the pool.
+     *
+     * @param capacity The capacity of the class.
+     * @return The new buffer, empty.
+     */
+    Buffer allocate(size_t capacity);
+
+    /**
+     * Free a buffer, unlocking its memory if the pool locked it.
+     *
+     * @param buffer The buffer to free.
+     * @param isLocked Whether the memory of the buffer was locked.
+     */
+    static void freeBuffer(Buffer buffer, bool isLocked);
+
+    /// Report the statistics of the pool to the metric recorder, if one is set.
+    void reportStatistics();
+
+    /// The settings of the pool.
+    const Configuration m_configuration;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The idle buffers of each class, most recently released last.  Index 0 is the class of @c minClassSize.
+    std::vector<std::vector<Buffer>> m_idleBuffers;
+
+    /// The statistics of the pool.
+    Statistics m_statistics;
+
+    /// The statistics last reported to the metric recorder.
+    Statistics m_reportedStatistics;
+
+    /// The recorder the statistics are reported to, or nullptr.
+    std::shared_ptr<metrics::MetricRecorderInterface> m_metricRecorder;
+};
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SDSBUFFERPOOL_H_
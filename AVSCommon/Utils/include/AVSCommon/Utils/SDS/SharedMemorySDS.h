@@ -0,0 +1,308 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <pthread.h>
+#include <time.h>
+
+#include "SharedDataStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A mutex which may be placed in shared memory and locked from several processes.
+ *
+ * The mutex is robust: if a process dies while holding it, the next process to lock it takes ownership and marks it
+ * consistent again, rather than blocking forever.  The state @c SharedDataStream protects with its mutexes is either
+ * held in atomics or only updated once the update can no longer fail, so it remains usable after such a recovery.
+ *
+ * This class meets the C++ @c Lockable requirements, so it can be used with @c std::lock_guard and
+ * @c std::unique_lock.
+ */
+class SharedMemoryMutex {
+public:
+    /// Initializes the mutex for use by several processes.
+    SharedMemoryMutex();
+
+    /// Destroys the mutex.
+    ~SharedMemoryMutex();
+
+    /// Locks the mutex, recovering it if its previous owner died while holding it.
+    void lock();
+
+    /**
+     * Tries to lock the mutex without blocking, recovering it if its previous owner died while holding it.
+     *
+     * @return Whether the mutex was locked.
+     */
+    bool try_lock();
+
+    /// Unlocks the mutex.
+    void unlock();
+
+    /**
+     * Gets the underlying pthread mutex.
+     *
+     * @return The underlying pthread mutex.
+     */
+    pthread_mutex_t* native_handle();
+
+    /// The mutex may not be copied.
+    SharedMemoryMutex(const SharedMemoryMutex&) = delete;
+    SharedMemoryMutex& operator=(const SharedMemoryMutex&) = delete;
+
+private:
+    /// @c SharedMemoryConditionVariable relocks the mutex when a wait finishes, and so must recover it as well.
+    friend class SharedMemoryConditionVariable;
+
+    /**
+     * Handles the result of locking the underlying pthread mutex, recovering it if its previous owner died.
+     *
+     * @param result The value returned by the pthread function which locked the mutex.
+     * @param function The name of the function which locked the mutex, used in logs.
+     * @return Whether the mutex is held by the caller.
+     */
+    bool onLocked(int result, const char* function);
+
+    /// The underlying pthread mutex.
+    pthread_mutex_t m_mutex;
+};
+
+/**
+ * A condition variable which may be placed in shared memory and waited on from several processes.  Timed waits are
+ * measured against the monotonic clock, so they are not affected by changes to the system time.
+ *
+ * This class provides the subset of the @c std::condition_variable interface which @c SharedDataStream uses.
+ */
+class SharedMemoryConditionVariable {
+public:
+    /// Initializes the condition variable for use by several processes.
+    SharedMemoryConditionVariable();
+
+    /// Destroys the condition variable.
+    ~SharedMemoryConditionVariable();
+
+    /// Wakes one waiting thread.
+    void notify_one();
+
+    /// Wakes all waiting threads.
+    void notify_all();
+
+    /**
+     * Waits until notified.  Spurious wakeups are possible.
+     *
+     * @param lock A lock which holds the mutex protecting the condition.
+     */
+    void wait(std::unique_lock<SharedMemoryMutex>& lock);
+
+    /**
+     * Waits until a predicate is satisfied.
+     *
+     * @param lock A lock which holds the mutex protecting the condition.
+     * @param predicate The condition to wait for.
+     */
+    template <typename Predicate>
+    void wait(std::unique_lock<SharedMemoryMutex>& lock, Predicate predicate);
+
+    /**
+     * Waits until a predicate is satisfied or a timeout expires.
+     *
+     * @param lock A lock which holds the mutex protecting the condition.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait finished.
+     */
+    template <typename Rep, typename Period, typename Predicate>
+    bool wait_for(
+        std::unique_lock<SharedMemoryMutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout,
+        Predicate predicate);
+
+    /// The condition variable may not be copied.
+    SharedMemoryConditionVariable(const SharedMemoryConditionVariable&) = delete;
+    SharedMemoryConditionVariable& operator=(const SharedMemoryConditionVariable&) = delete;
+
+private:
+    /**
+     * Waits until notified or a deadline passes.  Spurious wakeups are possible.
+     *
+     * @param lock A lock which holds the mutex protecting the condition.
+     * @param deadline The time on the monotonic clock at which to stop waiting.
+     * @return Whether the deadline passed.
+     */
+    bool waitUntil(std::unique_lock<SharedMemoryMutex>& lock, const timespec& deadline);
+
+    /**
+     * Calculates the deadline of a wait.
+     *
+     * @param timeout The maximum time to wait.
+     * @return The time on the monotonic clock at which @c timeout expires.
+     */
+    static timespec deadlineAfter(std::chrono::nanoseconds timeout);
+
+    /// The underlying pthread condition variable.
+    pthread_cond_t m_condition;
+};
+
+/**
+ * A buffer of shared memory which can be mapped by several processes.
+ *
+ * A buffer is either named, so that an unrelated process can map it with @c open(), or anonymous, in which case it
+ * is shared with the processes forked after it was created.  The process which creates a named buffer owns the name,
+ * and removes it when the buffer is destroyed; processes which have already mapped the buffer keep using it.
+ */
+class SharedMemoryBuffer {
+public:
+    /**
+     * Creates an anonymous buffer, which is shared with processes forked after its creation.  This constructor lets
+     * the buffer be used in place of the @c std::vector<uint8_t> of @c InProcessSDSTraits.
+     *
+     * @param size The size of the buffer in bytes.
+     */
+    explicit SharedMemoryBuffer(size_t size);
+
+    /**
+     * Creates a named buffer.  A stale buffer left with the same name by a process which crashed is replaced.
+     *
+     * @param name The name of the buffer, which must start with '/' and contain no other '/'.
+     * @param size The size of the buffer in bytes.
+     * @return The buffer, or @c nullptr if it could not be created.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> create(const std::string& name, size_t size);
+
+    /**
+     * Maps a named buffer created by another process.
+     *
+     * @param name The name passed to @c create().
+     * @return The buffer, or @c nullptr if it could not be mapped.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> open(const std::string& name);
+
+    /// Unmaps the buffer, and removes its name if this process created it.
+    ~SharedMemoryBuffer();
+
+    /**
+     * Gets the start of the buffer.
+     *
+     * @return The start of the buffer, or @c nullptr if it could not be mapped.
+     */
+    uint8_t* data();
+
+    /**
+     * Gets the size of the buffer.
+     *
+     * @return The size of the buffer in bytes, or zero if it could not be mapped.
+     */
+    size_t size() const;
+
+    /// The buffer may not be copied.
+    SharedMemoryBuffer(const SharedMemoryBuffer&) = delete;
+    SharedMemoryBuffer& operator=(const SharedMemoryBuffer&) = delete;
+
+private:
+    /**
+     * Takes ownership of a mapping.
+     *
+     * @param data The start of the mapping.
+     * @param size The size of the mapping in bytes.
+     * @param name The name to remove when the buffer is destroyed, or an empty string.
+     */
+    SharedMemoryBuffer(uint8_t* data, size_t size, const std::string& name);
+
+    /// The start of the mapping.
+    uint8_t* m_data;
+
+    /// The size of the mapping in bytes.
+    size_t m_size;
+
+    /// The name to remove when the buffer is destroyed, or an empty string if this process does not own it.
+    std::string m_ownedName;
+};
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between processes.
+ *
+ * One process creates the stream with @c SharedDataStream::create() on a @c SharedMemoryBuffer, and the others map the
+ * same buffer and attach to the stream with @c SharedDataStream::open().  If a process dies while it has a @c Reader,
+ * that @c Reader's slot stays allocated, and a @c BLOCKING @c Writer will eventually stall behind it.  The process which
+ * restarts the reader should then call @c SharedDataStream::createReader() with the same id and @c forceReplacement set,
+ * which is safe even if the process died while holding one of the stream's mutexes.
+ */
+struct SharedMemorySDSTraits {
+    /// Lock-free std::atomic operations are address-free, so they work on memory mapped by several processes.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// Lock-free std::atomic operations are address-free, so they work on memory mapped by several processes.
+    using AtomicBool = std::atomic<bool>;
+
+    /// Shared memory which can be mapped by several processes.
+    using Buffer = SharedMemoryBuffer;
+
+    /// A process-shared robust pthread mutex.
+    using Mutex = SharedMemoryMutex;
+
+    /// A process-shared pthread condition variable.
+    using ConditionVariable = SharedMemoryConditionVariable;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::SharedMemorySDSTraits";
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "SharedMemorySDSTraits::AtomicIndex must be lock-free.");
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "SharedMemorySDSTraits::AtomicBool must be lock-free.");
+
+/// Type alias for a SharedDataStream which works between processes.
+using SharedMemorySDS = SharedDataStream<SharedMemorySDSTraits>;
+
+template <typename Predicate>
+void SharedMemoryConditionVariable::wait(std::unique_lock<SharedMemoryMutex>& lock, Predicate predicate) {
+    while (!predicate()) {
+        wait(lock);
+    }
+}
+
+template <typename Rep, typename Period, typename Predicate>
+bool SharedMemoryConditionVariable::wait_for(
+    std::unique_lock<SharedMemoryMutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout,
+    Predicate predicate) {
+    auto deadline = deadlineAfter(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    while (!predicate()) {
+        if (waitUntil(lock, deadline)) {
+            return predicate();
+        }
+    }
+    return true;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
@@ -66,6 +66,14 @@ public:
         };
     };
 
+    /// Describes space in the stream's buffer as up to two regions which are each contiguous in memory.
+    struct Regions {
+        /// The start of each region.
+        void* data[2];
+        /// The size of each region in @c wordSize words.  The second region is empty unless the space wraps.
+        size_t nWords[2];
+    };
+
     /**
      * Constructs a new @c Writer which produces data for the provided @c SharedDataStream.
      *
@@ -96,6 +104,33 @@ public:
      */
     ssize_t write(const void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function reserves space in the stream's buffer, so that data can be produced directly into the stream
+     * instead of being copied in by @c write().  Space is made available following the same @c policy rules as for
+     * @c write().  @c Readers cannot see the data until it is published with @c commit(), and each call to
+     * @c reserve() replaces any reservation which has not been committed.
+     *
+     * @param[out] regions The location of the reserved space in the stream's buffer.  Space which wraps around the end
+     *     of the buffer is split across the two regions.
+     * @param nWords The maximum number of @c wordSize words to reserve.  If @c policy is @c ALL_OR_NOTHING, this must
+     *     not be larger than the stream's data size.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space.  If this parameter is zero,
+     *     there is no timeout and blocking reservations will wait forever.  If @c policy is not @c BLOCKING, this
+     *     parameter is ignored.
+     * @return The total number of @c wordSize words in @c regions, or zero if the stream has closed, or a negative
+     *     @c Error code if the stream is still open, but no space could be reserved.
+     */
+    ssize_t reserve(Regions* regions, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function publishes data which was produced into the space returned by @c reserve() to @c Readers.
+     *
+     * @param nWords The number of @c wordSize words to publish from the start of the reserved space.  This must not be
+     *     more than @c reserve() returned.
+     * @return @c nWords if the data was published, or zero if the stream has closed, or a negative @c Error code.
+     */
+    ssize_t commit(size_t nWords);
+
     /**
      * This function reports the current position of the @c Writer in the stream.
      *
@@ -130,6 +165,23 @@ private:
      */
     static const std::string TAG;
 
+    /**
+     * This function waits (as required by @c m_policy) for space to write to, and moves @c Header::writeEndCursor
+     * past the space so that @c Readers stay out of it.
+     *
+     * @param nWords The maximum number of @c wordSize words to make space for.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space.
+     * @return The number of @c wordSize words there is space for, or a negative @c Error code.
+     */
+    ssize_t beginWrite(size_t nWords, std::chrono::milliseconds timeout);
+
+    /**
+     * This function moves @c Header::writeStartCursor to publish written data, and notifies @c Readers.
+     *
+     * @param writeStartCursor The new value of @c Header::writeStartCursor.
+     */
+    void endWrite(Index writeStartCursor);
+
     /// The @c Policy to use for writing to the stream.
     Policy m_policy;
 
@@ -142,6 +194,9 @@ private:
      * @c Header::WriterEnabledMutex.
      */
     bool m_closed;
+
+    /// The number of words reserved by the last @c reserve() call which has not been committed.
+    size_t m_reservedWords;
 };
 
 template <typename T>
@@ -151,7 +206,8 @@ template <typename T>
 SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout> bufferLayout) :
         m_policy{policy},
         m_bufferLayout{bufferLayout},
-        m_closed{false} {
+        m_closed{false},
+        m_reservedWords{0} {
     // Note - SharedDataStream::createWriter() holds writerEnableMutex while calling this function.
     auto header = m_bufferLayout->getHeader();
     header->isWriterEnabled = true;
@@ -180,8 +236,113 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         return Error::CLOSED;
     }
 
+    auto result = beginWrite(nWords, timeout);
+    if (result < 0) {
+        return result;
+    }
+    nWords = result;
     auto wordsToCopy = nWords;
     auto buf8 = static_cast<const uint8_t*>(buf);
+
+    if (Policy::ALL_OR_NOTHING == m_policy) {
+        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
+        // can safely discard the initial data and just leave the trailing data in the buffer.
+        if (wordsToCopy > m_bufferLayout->getDataSize()) {
+            wordsToCopy = m_bufferLayout->getDataSize();
+            buf8 += (nWords - wordsToCopy) * getWordSize();
+        }
+    }
+
+    // Split it across the wrap.
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > wordsToCopy) {
+        beforeWrap = wordsToCopy;
+    }
+    size_t afterWrap = wordsToCopy - beforeWrap;
+
+    // Copy the two segments.
+    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
+    if (afterWrap > 0) {
+        memcpy(
+            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
+            buf8 + beforeWrap * getWordSize(),
+            afterWrap * getWordSize());
+    }
+
+    endWrite(header->writeEndCursor);
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::reserve(Regions* regions, size_t nWords, std::chrono::milliseconds timeout) {
+    if (nullptr == regions) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "nullRegions"));
+        return Error::INVALID;
+    }
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "zeroNumWords"));
+        return Error::INVALID;
+    }
+    // Unlike write(), there is no leading data to discard if an ALL_OR_NOTHING reservation is larger than the buffer.
+    if (Policy::ALL_OR_NOTHING == m_policy && nWords > m_bufferLayout->getDataSize()) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "numWordsExceedsBuffer"));
+        return Error::INVALID;
+    }
+
+    auto header = m_bufferLayout->getHeader();
+    if (!header->isWriterEnabled) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "writerDisabled"));
+        return Error::CLOSED;
+    }
+
+    m_reservedWords = 0;
+    auto result = beginWrite(nWords, timeout);
+    if (result < 0) {
+        return result;
+    }
+    nWords = result;
+
+    // Split it across the wrap.
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > nWords) {
+        beforeWrap = nWords;
+    }
+    regions->data[0] = m_bufferLayout->getData(header->writeStartCursor);
+    regions->nWords[0] = beforeWrap;
+    regions->data[1] = m_bufferLayout->getData(header->writeStartCursor + beforeWrap);
+    regions->nWords[1] = nWords - beforeWrap;
+
+    m_reservedWords = nWords;
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commit(size_t nWords) {
+    if (0 == nWords || nWords > m_reservedWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed")
+                               .d("reason", "invalidNumWords")
+                               .d("numWords", nWords)
+                               .d("reservedWords", m_reservedWords));
+        return Error::INVALID;
+    }
+
+    auto header = m_bufferLayout->getHeader();
+    if (!header->isWriterEnabled) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed").d("reason", "writerDisabled"));
+        return Error::CLOSED;
+    }
+
+    // Note: writeEndCursor stays at the end of the reservation, in case the uncommitted part was written to.
+    m_reservedWords = 0;
+    endWrite(header->writeStartCursor + nWords);
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::beginWrite(size_t nWords, std::chrono::milliseconds timeout) {
+    auto header = m_bufferLayout->getHeader();
     std::unique_lock<Mutex> backwardSeekLock(header->backwardSeekMutex, std::defer_lock);
     Index writeEnd = header->writeStartCursor + nWords;
 
@@ -189,7 +350,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::NONBLOCKABLE:
             // For NONBLOCKABLE, we can truncate the write if it won't fit in the buffer.
             if (nWords > m_bufferLayout->getDataSize()) {
-                wordsToCopy = nWords = m_bufferLayout->getDataSize();
+                nWords = m_bufferLayout->getDataSize();
                 writeEnd = header->writeStartCursor + nWords;
             }
             break;
@@ -238,7 +399,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
 
             // For BLOCKING, we can truncate the write if it won't fit in the buffer.
             if (spaceAvailable < nWords) {
-                wordsToCopy = nWords = spaceAvailable;
+                nWords = spaceAvailable;
                 writeEnd = header->writeStartCursor + nWords;
             }
 
@@ -252,51 +413,27 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         backwardSeekLock.unlock();
     }
 
-    if (Policy::ALL_OR_NOTHING == m_policy) {
-        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
-        // can safely discard the initial data and just leave the trailing data in the buffer.
-        if (wordsToCopy > m_bufferLayout->getDataSize()) {
-            wordsToCopy = m_bufferLayout->getDataSize();
-            buf8 += (nWords - wordsToCopy) * getWordSize();
-        }
-    }
-
-    // Split it across the wrap.
-    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
-    if (beforeWrap > wordsToCopy) {
-        beforeWrap = wordsToCopy;
-    }
-    size_t afterWrap = wordsToCopy - beforeWrap;
+    return nWords;
+}
 
-    // Copy the two segments.
-    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
-            buf8 + beforeWrap * getWordSize(),
-            afterWrap * getWordSize());
-    }
+template <typename T>
+void SharedDataStream<T>::Writer::endWrite(Index writeStartCursor) {
+    auto header = m_bufferLayout->getHeader();
 
     // Advance the write cursor.
-    // Note: To prevent a race condition and ensure that readers which block on dataAvailableConditionVariable don't
-    // miss a notify, we should always lock the dataAvailableConditionVariable mutex while moving writeStartCursor.  As
-    // an optimization, we skip that lock for NONBLOCKABLE writers under the assumption that they will be writing
-    // continuously, so a missed notification is not significant.
-    // Note: As a further optimization, the lock could be omitted if no blocking readers are in use (ACSDK-251).
-    std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::NONBLOCKABLE != m_policy) {
-        dataAvailableLock.lock();
-    }
-    header->writeStartCursor = header->writeEndCursor.load();
-    if (Policy::NONBLOCKABLE != m_policy) {
+    header->writeStartCursor = writeStartCursor;
+
+    // Notify the reader(s), but only if one is waiting for the data just written.
+    // Note: A Reader lowers dataAvailableWakeCursor before checking for data and blocking, so either the Reader sees
+    // the new writeStartCursor or we see its dataAvailableWakeCursor.  In the latter case, locking dataAvailableMutex
+    // guarantees the Reader is blocked before we notify it.  All waiting Readers are woken, and those which are still
+    // waiting for more data lower dataAvailableWakeCursor again before blocking.
+    if (writeStartCursor >= header->dataAvailableWakeCursor) {
+        std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex);
+        header->dataAvailableWakeCursor = std::numeric_limits<Index>::max();
         dataAvailableLock.unlock();
+        header->dataAvailableConditionVariable.notify_all();
     }
-
-    // Notify the reader(s).
-    // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
-    header->dataAvailableConditionVariable.notify_all();
-
-    return nWords;
 }
 
 template <typename T>
@@ -19,13 +19,15 @@
 #include <atomic>
 #include <condition_variable>
 #include <chrono>
-#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <utility>
 
+#include "AVSCommon/Utils/Threading/InlineTask.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
 #include "AVSCommon/Utils/Threading/TaskThread.h"
 
 namespace alexaClientSDK {
@@ -33,19 +35,41 @@ namespace avsCommon {
 namespace utils {
 namespace threading {
 
+/**
+ * The ways an @c Executor can run its tasks.
+ */
+enum class ExecutorMode {
+    /// Tasks run as a serial @c Strand on the process-wide @c WorkStealingScheduler.
+    SHARED_SCHEDULER,
+    /// Tasks run on a @c TaskThread which the executor holds while it has work (the legacy behavior).
+    DEDICATED_THREAD
+};
+
 /**
  * An Executor is used to run callable types asynchronously.
+ *
+ * Regardless of its @c ExecutorMode, an Executor runs one task at a time, in submission order (except for tasks
+ * submitted with @c submitToFront()).
  */
 class Executor {
 public:
     /**
-     * Constructs an Executor.
+     * Constructs an Executor using the mode returned by @c getDefaultMode().
      *
      * @param delayExit The period of time that this executor will keep its thread running while waiting
-     * for a new job. We use 1s by default.
+     * for a new job. We use 1s by default. Only used in @c ExecutorMode::DEDICATED_THREAD mode.
      */
     Executor(const std::chrono::milliseconds& delayExit = std::chrono::milliseconds(1000));
 
+    /**
+     * Constructs an Executor using the given mode.
+     *
+     * @param mode The way this executor runs its tasks.
+     * @param delayExit The period of time that this executor will keep its thread running while waiting
+     * for a new job. We use 1s by default. Only used in @c ExecutorMode::DEDICATED_THREAD mode.
+     */
+    Executor(ExecutorMode mode, const std::chrono::milliseconds& delayExit = std::chrono::milliseconds(1000));
+
     /**
      * Destructs an Executor.
      */
@@ -74,6 +98,29 @@ public:
     template <typename Task, typename... Args>
     auto submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Queues a callable type to be executed on an Executor thread without creating a @c std::future for its result.
+     *
+     * This is the preferred way to submit tasks whose completion the caller does not wait for: a callable for which
+     * @c InlineTask::fitsInline() holds is queued without any heap allocation once the executor has warmed up, and
+     * larger callables cost one allocation. Any return value of @c task is discarded.
+     *
+     * @param task A callable type representing a task.
+     * @return @c true if the task was queued, @c false if the executor is shutdown.
+     */
+    template <typename Task>
+    bool execute(Task&& task);
+
+    /**
+     * Queues a callable type to the front of the internal queue to be executed on an Executor thread without creating a
+     * @c std::future for its result.
+     *
+     * @param task A callable type representing a task.
+     * @return @c true if the task was queued, @c false if the executor is shutdown.
+     */
+    template <typename Task>
+    bool executeToFront(Task&& task);
+
     /**
      * Waits for any previously submitted tasks to complete.
      */
@@ -85,9 +132,24 @@ public:
     /// Returns whether or not the executor is shutdown.
     bool isShutdown();
 
+    /**
+     * Set the mode used by executors constructed without an explicit mode. Executors which already exist keep their
+     * mode.
+     *
+     * @param mode The mode for subsequently constructed executors.
+     */
+    static void setDefaultMode(ExecutorMode mode);
+
+    /**
+     * Get the mode used by executors constructed without an explicit mode.
+     *
+     * @return The default mode.
+     */
+    static ExecutorMode getDefaultMode();
+
 private:
     /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::function<void()>>;
+    using Queue = TaskQueue;
 
     /**
      * Executes the next job in the queue.
@@ -105,11 +167,20 @@ private:
 
     /**
      * Returns and removes the task at the front of the queue. If there are no tasks, this call will return an empty
-     * function.
+     * task.
+     *
+     * @returns The next task. The task will be empty if the queue has no job.
+     */
+    InlineTask pop();
+
+    /**
+     * Pushes a type-erased task on the queue (or the strand), starting the task thread if needed.
      *
-     * @returns A function that represents a new task. The function will be empty if the queue has no job.
+     * @param front If @c true, push to the front of the queue, else push to the back.
+     * @param task The task to push.
+     * @return @c true if the task was queued, @c false if the executor is shutdown.
      */
-    std::function<void()> pop();
+    bool pushTask(bool front, InlineTask&& task);
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
@@ -124,6 +195,9 @@ private:
     template <typename Task, typename... Args>
     auto pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /// The strand tasks run on in @c ExecutorMode::SHARED_SCHEDULER mode, @c nullptr in the legacy mode.
+    std::shared_ptr<Strand> m_strand;
+
     /// The queue of tasks
     Queue m_queue;
 
@@ -158,6 +232,16 @@ auto Executor::submitToFront(Task task, Args&&... args) -> std::future<decltype(
     return pushTo(front, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
+template <typename Task>
+bool Executor::execute(Task&& task) {
+    return pushTask(false, InlineTask(std::forward<Task>(task)));
+}
+
+template <typename Task>
+bool Executor::executeToFront(Task&& task) {
+    return pushTask(true, InlineTask(std::forward<Task>(task)));
+}
+
 /**
  * Utility function which waits for a @c std::future to be fulfilled and forward the result to a @c std::promise.
  *
@@ -222,25 +306,10 @@ auto Executor::pushTo(bool front, Task task, Args&&... args) -> std::future<decl
     // Release our local reference to packaged task so that the only remaining reference is inside the lambda.
     packaged_task.reset();
 
-    {
-        bool restart = false;
-        std::lock_guard<std::mutex> queueLock{m_queueMutex};
-        if (!m_shutdown) {
-            restart = !m_threadRunning;
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), std::move(translated_task));
-        } else {
-            using FutureType = decltype(task(args...));
-            return std::future<FutureType>();
-        }
-
-        if (restart) {
-            // Restart task thread.
-            m_taskThread.start(std::bind(&Executor::runNext, this));
-            m_threadRunning = true;
-        }
+    if (!pushTask(front, std::move(translated_task))) {
+        using FutureType = decltype(task(args...));
+        return std::future<FutureType>();
     }
-
-    m_delayedCondition.notify_one();
     return cleanupFuture;
 }
 
@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_INLINETASK_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_INLINETASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A move-only callable wrapper with signature @c void().
+ *
+ * Unlike @c std::function, an @c InlineTask does not require the callable to be copyable, and callables of up to
+ * @c INLINE_SIZE bytes are stored inside the object itself so that wrapping them does not allocate. Larger callables
+ * fall back to the heap, as do callables whose move constructor may throw. @c INLINE_SIZE is sized for the lambdas
+ * hot call sites queue, which capture @c this, a couple of @c std::shared_ptr and a string or two; those call sites
+ * check @c fitsInline() with a @c static_assert. It is a fixed byte count rather than a number of pointers, as those
+ * captures shrink less than pointers do on 32-bit targets.
+ */
+class InlineTask {
+public:
+    /// Size in bytes of the inline storage.
+    static constexpr size_t INLINE_SIZE = 96;
+
+    /**
+     * Whether a callable is stored inline, and so can be wrapped without allocating.
+     *
+     * @tparam Callable The type of the callable.
+     * @return Whether @c Callable fits in the inline storage.
+     */
+    template <typename Callable>
+    static constexpr bool fitsInline() {
+        return FitsInline<typename std::decay<Callable>::type>::value;
+    }
+
+    /// Constructs an empty task.
+    InlineTask() noexcept : m_ops{nullptr} {
+    }
+
+    /// Constructs an empty task.
+    InlineTask(std::nullptr_t) noexcept : m_ops{nullptr} {
+    }
+
+    /**
+     * Constructs a task wrapping a callable.
+     *
+     * @param callable The callable to wrap. It is invoked with no arguments; any return value is discarded.
+     */
+    template <
+        typename Callable,
+        typename Decayed = typename std::decay<Callable>::type,
+        typename = typename std::enable_if<!std::is_same<Decayed, InlineTask>::value>::type>
+    InlineTask(Callable&& callable);
+
+    /// Move constructor.
+    InlineTask(InlineTask&& other) noexcept;
+
+    /// Move assignment.
+    InlineTask& operator=(InlineTask&& other) noexcept;
+
+    /// Assigning @c nullptr empties the task.
+    InlineTask& operator=(std::nullptr_t) noexcept;
+
+    /// Destructor.
+    ~InlineTask();
+
+    InlineTask(const InlineTask&) = delete;
+    InlineTask& operator=(const InlineTask&) = delete;
+
+    /// Whether the task holds a callable.
+    explicit operator bool() const noexcept {
+        return m_ops != nullptr;
+    }
+
+    /// Invokes the wrapped callable. Must not be called on an empty task.
+    void operator()() {
+        m_ops->invoke(&m_storage);
+    }
+
+private:
+    /// Type-erased operations on the stored callable.
+    struct Ops {
+        /// Invoke the callable in @c storage.
+        void (*invoke)(void* storage);
+        /// Move-construct the callable from @c source into @c destination and destroy the source.
+        void (*relocate)(void* destination, void* source);
+        /// Destroy the callable in @c storage.
+        void (*destroy)(void* storage);
+    };
+
+    /// Operations for a callable stored inline.
+    template <typename Callable>
+    struct InlineOps {
+        static void invoke(void* storage) {
+            (*static_cast<Callable*>(storage))();
+        }
+        static void relocate(void* destination, void* source) {
+            new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+            static_cast<Callable*>(source)->~Callable();
+        }
+        static void destroy(void* storage) {
+            static_cast<Callable*>(storage)->~Callable();
+        }
+        static const Ops ops;
+    };
+
+    /// Operations for a callable stored on the heap, with its pointer stored inline.
+    template <typename Callable>
+    struct HeapOps {
+        static void invoke(void* storage) {
+            (**static_cast<Callable**>(storage))();
+        }
+        static void relocate(void* destination, void* source) {
+            *static_cast<Callable**>(destination) = *static_cast<Callable**>(source);
+        }
+        static void destroy(void* storage) {
+            delete *static_cast<Callable**>(storage);
+        }
+        static const Ops ops;
+    };
+
+    /// Whether @c Callable can be stored inline.
+    template <typename Callable>
+    using FitsInline = std::integral_constant<
+        bool,
+        sizeof(Callable) <= INLINE_SIZE && alignof(std::max_align_t) % alignof(Callable) == 0 &&
+            std::is_nothrow_move_constructible<Callable>::value>;
+
+    /// Store @c callable inline.
+    template <typename Callable, typename Arg>
+    void store(Arg&& callable, std::true_type) {
+        new (&m_storage) Callable(std::forward<Arg>(callable));
+        m_ops = &InlineOps<Callable>::ops;
+    }
+
+    /// Store @c callable on the heap.
+    template <typename Callable, typename Arg>
+    void store(Arg&& callable, std::false_type) {
+        *reinterpret_cast<Callable**>(&m_storage) = new Callable(std::forward<Arg>(callable));
+        m_ops = &HeapOps<Callable>::ops;
+    }
+
+    /// Destroy the stored callable, if any, leaving the task empty.
+    void reset() noexcept {
+        if (m_ops) {
+            m_ops->destroy(&m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    /// Storage for the callable or a pointer to it.
+    typename std::aligned_storage<INLINE_SIZE, alignof(std::max_align_t)>::type m_storage;
+
+    /// Operations for the stored callable, @c nullptr when empty.
+    const Ops* m_ops;
+};
+
+template <typename Callable>
+const InlineTask::Ops InlineTask::InlineOps<Callable>::ops = {&InlineOps<Callable>::invoke,
+                                                              &InlineOps<Callable>::relocate,
+                                                              &InlineOps<Callable>::destroy};
+
+template <typename Callable>
+const InlineTask::Ops InlineTask::HeapOps<Callable>::ops = {&HeapOps<Callable>::invoke,
+                                                            &HeapOps<Callable>::relocate,
+                                                            &HeapOps<Callable>::destroy};
+
+template <typename Callable, typename Decayed, typename>
+InlineTask::InlineTask(Callable&& callable) : m_ops{nullptr} {
+    store<Decayed>(std::forward<Callable>(callable), FitsInline<Decayed>());
+}
+
+inline InlineTask::InlineTask(InlineTask&& other) noexcept : m_ops{other.m_ops} {
+    if (m_ops) {
+        m_ops->relocate(&m_storage, &other.m_storage);
+        other.m_ops = nullptr;
+    }
+}
+
+inline InlineTask& InlineTask::operator=(InlineTask&& other) noexcept {
+    if (this != &other) {
+        reset();
+        if (other.m_ops) {
+            other.m_ops->relocate(&m_storage, &other.m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline InlineTask& InlineTask::operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+}
+
+inline InlineTask::~InlineTask() {
+    reset();
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_INLINETASK_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A @c Strand runs tasks one at a time, in queue order, on a shared @c WorkStealingScheduler without owning a thread.
+ *
+ * While the strand has queued tasks exactly one drain job for it is scheduled; the drain job runs a bounded batch of
+ * tasks and then reschedules itself so that a busy strand does not monopolize a worker. Tasks of one strand therefore
+ * never overlap and run in the order given by the queue, which is what @c Executor relies on.
+ */
+class Strand : public std::enable_shared_from_this<Strand> {
+public:
+    /**
+     * Create a @c Strand.
+     *
+     * @param scheduler The scheduler to run tasks on.
+     * @return A new @c Strand, or @c nullptr if @c scheduler is @c nullptr.
+     */
+    static std::shared_ptr<Strand> create(
+        std::shared_ptr<WorkStealingScheduler> scheduler = WorkStealingScheduler::getDefaultScheduler());
+
+    /**
+     * Queue a task.
+     *
+     * @param front If @c true, push to the front of the queue, else push to the back.
+     * @param task The task to queue.
+     * @return @c true if the task was queued, @c false if the strand is shutdown.
+     */
+    bool push(bool front, InlineTask task);
+
+    /**
+     * Waits for any previously queued tasks to complete.
+     */
+    void waitForSubmittedTasks();
+
+    /// Clears the strand of outstanding tasks, refuses any additional tasks and waits for a running task to finish.
+    void shutdown();
+
+    /// Returns whether or not the strand is shutdown.
+    bool isShutdown();
+
+    /// The maximum number of tasks a drain job runs before yielding its worker to other jobs.
+    static const size_t MAX_TASKS_PER_DRAIN;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param scheduler The scheduler to run tasks on.
+     */
+    Strand(std::shared_ptr<WorkStealingScheduler> scheduler);
+
+    /// Run queued tasks, then either go idle or reschedule.
+    void drain();
+
+    /// Schedule a drain job on @c m_scheduler.
+    void scheduleDrain();
+
+    /// The scheduler to run tasks on.
+    const std::shared_ptr<WorkStealingScheduler> m_scheduler;
+
+    /// The queue of tasks.
+    TaskQueue m_queue;
+
+    /// A mutex to protect access to @c m_queue and @c m_drainScheduled.
+    std::mutex m_queueMutex;
+
+    /// Whether a drain job is scheduled or running.
+    bool m_drainScheduled;
+
+    /// A flag for whether or not the strand is expecting more tasks.
+    std::atomic_bool m_shutdown;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
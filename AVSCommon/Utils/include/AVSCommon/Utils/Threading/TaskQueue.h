@@ -0,0 +1,144 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKQUEUE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKQUEUE_H_
+
+#include <cstddef>
+
+#include "AVSCommon/Utils/Threading/InlineTask.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A double-ended queue of @c InlineTask built from intrusive linked nodes.
+ *
+ * Nodes released by the pop operations are kept on a free list (up to @c maxSpareNodes of them) and reused by later
+ * pushes, so a queue whose depth stays within its high-water mark performs no allocations in steady state.
+ *
+ * @note This class is not thread safe; callers serialize access with their own lock.
+ */
+class TaskQueue {
+public:
+    /// Default upper bound on the number of spare nodes kept for reuse.
+    static const size_t DEFAULT_MAX_SPARE_NODES;
+
+    /**
+     * Constructor.
+     *
+     * @param maxSpareNodes The maximum number of released nodes kept for reuse.
+     */
+    explicit TaskQueue(size_t maxSpareNodes = DEFAULT_MAX_SPARE_NODES);
+
+    /// Destructor. Destroys any queued tasks without running them.
+    ~TaskQueue();
+
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue& operator=(const TaskQueue&) = delete;
+
+    /**
+     * Add a task to the back of the queue.
+     *
+     * @param task The task to add.
+     */
+    void pushBack(InlineTask&& task);
+
+    /**
+     * Add a task to the front of the queue.
+     *
+     * @param task The task to add.
+     */
+    void pushFront(InlineTask&& task);
+
+    /**
+     * Remove the task at the front of the queue.
+     *
+     * @param[out] task Receives the removed task.
+     * @return @c false if the queue was empty.
+     */
+    bool popFront(InlineTask* task);
+
+    /**
+     * Remove the task at the back of the queue.
+     *
+     * @param[out] task Receives the removed task.
+     * @return @c false if the queue was empty.
+     */
+    bool popBack(InlineTask* task);
+
+    /// Destroy all queued tasks without running them.
+    void clear();
+
+    /// Whether the queue is empty.
+    bool empty() const;
+
+    /// The number of queued tasks.
+    size_t size() const;
+
+private:
+    /// A queue node.
+    struct Node {
+        /// The queued task.
+        InlineTask task;
+        /// The previous node towards the front, or the next spare node when on the free list.
+        Node* prev;
+        /// The next node towards the back.
+        Node* next;
+    };
+
+    /**
+     * Obtain a node holding @c task, reusing a spare node if one is available.
+     *
+     * @param task The task to store.
+     * @return The node.
+     */
+    Node* acquireNode(InlineTask&& task);
+
+    /**
+     * Take the task out of a node that has been unlinked and return the node to the free list.
+     *
+     * @param node The node.
+     * @param[out] task Receives the task.
+     */
+    void releaseNode(Node* node, InlineTask* task);
+
+    /// The front of the queue.
+    Node* m_head;
+
+    /// The back of the queue.
+    Node* m_tail;
+
+    /// The number of queued tasks.
+    size_t m_size;
+
+    /// Singly linked (through @c prev) list of spare nodes.
+    Node* m_spare;
+
+    /// The number of spare nodes.
+    size_t m_spareCount;
+
+    /// The maximum number of spare nodes.
+    const size_t m_maxSpareNodes;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKQUEUE_H_
@@ -0,0 +1,275 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A process-wide scheduler which runs jobs on a small, fixed set of worker threads (by default one per hardware core).
+ *
+ * Each worker owns a local job queue. Jobs scheduled from a worker thread go to that worker's queue, jobs scheduled
+ * from any other thread go to a shared injection queue, and a worker that runs out of work steals from the back of
+ * its peers' queues. The scheduler gives no ordering guarantees between jobs; serial execution is layered on top by
+ * @c Strand.
+ *
+ * Jobs are allowed to block (for example waiting on a @c std::future fulfilled by another job). To keep such patterns
+ * from starving the scheduler, a monitor thread watches for the case where every worker is busy, work is pending and
+ * no job has completed within @c starvationInterval; when that happens it adds a temporary compensation worker.
+ * Compensation workers retire after they have been idle for @c idleTimeout. The monitor only polls while the
+ * scheduler is saturated, so an idle scheduler causes no periodic wakeups.
+ */
+class WorkStealingScheduler {
+public:
+    /// The type of job accepted by the scheduler.
+    using Job = InlineTask;
+
+    /**
+     * Constructs a scheduler and starts its core workers.
+     *
+     * @param workerCount The number of core workers. If 0, @c std::thread::hardware_concurrency() is used (with a
+     *     minimum of @c MIN_DEFAULT_WORKERS).
+     * @param maxWorkerCount The upper bound on core plus compensation workers.
+     * @param starvationInterval How long a saturated scheduler may go without completing a job before a compensation
+     *     worker is added.
+     * @param idleTimeout How long a compensation worker stays idle before it exits.
+     */
+    WorkStealingScheduler(
+        size_t workerCount = 0,
+        size_t maxWorkerCount = DEFAULT_MAX_WORKERS,
+        std::chrono::milliseconds starvationInterval = DEFAULT_STARVATION_INTERVAL,
+        std::chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT);
+
+    /**
+     * Destructs the scheduler. Jobs that have not started yet are dropped; the destructor waits for running jobs.
+     */
+    ~WorkStealingScheduler();
+
+    /**
+     * Schedules a job to run on one of the workers.
+     *
+     * @param job The job to run.
+     * @return @c true if the job was accepted, @c false if it was empty or the scheduler is shutting down.
+     */
+    bool schedule(Job job);
+
+    /**
+     * Obtain the number of core workers.
+     *
+     * @return The number of core workers.
+     */
+    size_t getWorkerCount() const;
+
+    /**
+     * Obtain statistics for the scheduler.
+     *
+     * @param jobsExecuted The total number of jobs run.
+     * @param jobsStolen The number of jobs a worker took from another worker's queue.
+     * @param compensationWorkersCreated The number of compensation workers created due to saturation.
+     * @param liveWorkers The number of worker threads currently alive (core and compensation).
+     */
+    void getStats(
+        uint64_t& jobsExecuted,
+        uint64_t& jobsStolen,
+        uint64_t& compensationWorkersCreated,
+        uint64_t& liveWorkers);
+
+    /**
+     * Obtain the process-wide scheduler, creating it on first use.
+     *
+     * @return The process-wide scheduler.
+     */
+    static std::shared_ptr<WorkStealingScheduler> getDefaultScheduler();
+
+    /**
+     * Set the number of core workers the process-wide scheduler will be created with. This only has an effect if
+     * called before the first call to @c getDefaultScheduler().
+     *
+     * @param workerCount The number of core workers, or 0 to size the scheduler from the hardware.
+     */
+    static void setDefaultWorkerCount(size_t workerCount);
+
+    /// The minimum number of core workers used when sizing from the hardware.
+    static const size_t MIN_DEFAULT_WORKERS;
+
+    /// The default upper bound on core plus compensation workers.
+    static const size_t DEFAULT_MAX_WORKERS;
+
+    /// The default period after which a saturated scheduler adds a compensation worker.
+    static const std::chrono::milliseconds DEFAULT_STARVATION_INTERVAL;
+
+    /// The default period after which an idle compensation worker exits.
+    static const std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT;
+
+private:
+    /// A worker thread and, for core workers, its local job queue.
+    struct Worker {
+        /// Constructor.
+        Worker(bool isCore);
+
+        /// Whether this is a core worker (never retires and owns a local queue).
+        const bool isCore;
+
+        /// The local queue. Only core workers push to it; any worker may steal from it.
+        TaskQueue jobs;
+
+        /// Serializes access to @c jobs.
+        std::mutex jobsMutex;
+
+        /// Set by a compensation worker just before its thread exits so that it can be joined.
+        std::atomic<bool> finished;
+
+        /// The thread backing this worker.
+        std::thread thread;
+    };
+
+    /**
+     * Main loop of a worker thread.
+     *
+     * @param worker The worker this thread backs.
+     */
+    void workerLoop(Worker* worker);
+
+    /**
+     * Find the next job for a worker: its own queue, then the injection queue, then its peers' queues.
+     *
+     * @param worker The worker looking for work.
+     * @param[out] job The job found.
+     * @return Whether a job was found.
+     */
+    bool findJob(Worker* worker, Job* job);
+
+    /**
+     * Main loop of the monitor thread which adds compensation workers when the scheduler is saturated.
+     */
+    void monitorLoop();
+
+    /**
+     * Start a new worker thread. Must be called with @c m_mutex held for compensation workers.
+     *
+     * @param worker The worker to start.
+     */
+    void startWorker(Worker* worker);
+
+    /**
+     * Wake an idle worker, unless one has been woken and has not started looking for work yet.  A worker which finds
+     * work while more is pending wakes the next, so that a burst of small jobs wakes workers one at a time rather than
+     * all at once.
+     */
+    void wakeIdleWorker();
+
+    /// Join and remove compensation workers that have exited. Must be called with @c m_mutex held.
+    void reapFinishedWorkersLocked();
+
+    /**
+     * Whether every worker is busy while jobs are pending.
+     *
+     * @return Whether the scheduler is saturated.
+     */
+    bool isSaturated() const;
+
+    /// The scheduler whose worker is running on this thread, if any.
+    static thread_local WorkStealingScheduler* s_currentScheduler;
+
+    /// The worker running on this thread, if any.
+    static thread_local Worker* s_currentWorker;
+
+    /// The core workers. The vector is not modified after construction, so it may be read without a lock.
+    std::vector<std::unique_ptr<Worker>> m_coreWorkers;
+
+    /// Compensation workers, guarded by @c m_mutex.
+    std::list<std::unique_ptr<Worker>> m_compensationWorkers;
+
+    /// Jobs scheduled from outside the worker threads.
+    TaskQueue m_injectionQueue;
+
+    /// Serializes access to @c m_injectionQueue.
+    std::mutex m_injectionMutex;
+
+    /// Serializes worker sleep/wakeup, shutdown and the compensation worker list.
+    std::mutex m_mutex;
+
+    /// Used to wake idle workers.
+    std::condition_variable m_workAvailable;
+
+    /// Used to wake the monitor thread when the scheduler becomes saturated or is shutting down.
+    std::condition_variable m_monitorWakeup;
+
+    /// Whether the monitor is parked waiting for the scheduler to become saturated.
+    std::atomic<bool> m_monitorParked;
+
+    /// The number of compensation workers that have exited but have not been joined, guarded by @c m_mutex.
+    size_t m_finishedWorkers;
+
+    /// The number of workers notified but not yet awake, guarded by @c m_mutex.
+    size_t m_wakingWorkers;
+
+    /// The number of jobs queued but not yet started.
+    std::atomic<uint64_t> m_pendingJobs;
+
+    /// The number of workers parked waiting for work.
+    std::atomic<uint64_t> m_idleWorkers;
+
+    /// The number of live worker threads.
+    std::atomic<uint64_t> m_liveWorkers;
+
+    /// The total number of jobs run.
+    std::atomic<uint64_t> m_jobsExecuted;
+
+    /// The number of jobs stolen from another worker's queue.
+    std::atomic<uint64_t> m_jobsStolen;
+
+    /// The number of compensation workers created.
+    std::atomic<uint64_t> m_compensationWorkersCreated;
+
+    /// Flag indicating the scheduler is shutting down.
+    std::atomic<bool> m_shuttingDown;
+
+    /// Upper bound on core plus compensation workers.
+    const size_t m_maxWorkerCount;
+
+    /// Period after which a saturated scheduler adds a compensation worker.
+    const std::chrono::milliseconds m_starvationInterval;
+
+    /// Period after which an idle compensation worker exits.
+    const std::chrono::milliseconds m_idleTimeout;
+
+    /// The monitor thread.
+    std::thread m_monitorThread;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGSCHEDULER_H_
@@ -18,12 +18,14 @@
 
 #include <cstdint>
 #include <chrono>
-#include <condition_variable>
 #include <functional>
-#include <map>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
 
-#include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -33,6 +35,9 @@ namespace timing {
 /**
  * A @c MultiTimer is used to schedule multiple callable types to run in the future.
  *
+ * Deadlines are kept on the process-wide @c TimerWheel and due tasks run one at a time, in expiry order, on a
+ * @c Strand of the shared scheduler, so a @c MultiTimer owns no thread.
+ *
  * @note The executed function should not block since this may cause delays to trigger other tasks in the queue.
  */
 class MultiTimer {
@@ -70,43 +75,23 @@ public:
 
 private:
     /**
-     * Execute the timer inside its own thread.
-     *
-     * @return @c true if there are more timers scheduled; @c false otherwise.
-     */
-    bool executeTimer();
-
-    /**
-     * Checks if there are any pending tasks within a grace period determined by an internal timeout.
+     * Run a task whose timer has fired, unless it has been cancelled since.
      *
-     * @param lock The lock being held during the check.
-     * @return @c true if there's at least one task left; @c false if there is no pending task.
+     * @param token The token identifying the task.
      */
-    bool hasNextLocked(std::unique_lock<std::mutex>& lock);
-
-    /// Alias for the time point used in this class.
-    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
-
-    /// The condition variable used to wait for the next task.
-    std::condition_variable m_waitCondition;
-
-    /// The mutex for @c m_waitCondition.
-    std::mutex m_waitMutex;
-
-    /// The executor used to trigger tasks.
-    threading::TaskThread m_timerThread;
+    void executeTask(Token token);
 
-    /// A map of timers and the token used to identify the task to be run.
-    std::multimap<TimePoint, Token> m_timers;
+    /// The wheel holding the deadlines.
+    const std::shared_ptr<TimerWheel> m_wheel;
 
-    /// A map of tasks to be run.
-    std::map<Token, std::pair<TimePoint, std::function<void()>>> m_tasks;
+    /// The strand tasks are run on.
+    const std::shared_ptr<threading::Strand> m_strand;
 
-    /// Flag indicating whether there is an ongoing timer.
-    bool m_isRunning;
+    /// Serializes access to @c m_tasks and @c m_nextToken.
+    std::mutex m_mutex;
 
-    /// Flag indicating whether object is being destructed.
-    bool m_isBeingDestroyed;
+    /// The pending tasks and their wheel timers, by token.
+    std::unordered_map<Token, std::pair<TimerWheel::Id, std::function<void()>>> m_tasks;
 
     /// The next token available.
     Token m_nextToken;
@@ -20,6 +20,7 @@
 #include <condition_variable>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -32,6 +33,10 @@ namespace timing {
 
 /**
  * A @c Timer is used to schedule a callable type to run in the future.
+ *
+ * A @c Timer owns no thread: it waits on the process-wide @c TimerWheel and makes its task calls on the shared
+ * @c WorkStealingScheduler. This does not depend on the @c ExecutorMode, so timers keep using the shared scheduler
+ * when executors run on dedicated threads.
  */
 class Timer {
 public:
@@ -183,52 +188,30 @@ public:
     bool isActive() const;
 
 private:
-    /**
-     * Atomically activates this @c Timer (by setting @c m_running).
-     *
-     * @returns @c true if the @c Timer was previously inactive, else @c false.
-     */
-    bool activate();
+    /// The state of a @c Timer, shared with the callbacks it has pending on the @c TimerWheel.
+    struct State;
 
     /**
-     * Waits for the @c Timer @c period, then calls @c task.
+     * Activates the @c Timer and schedules the first call to @c task on the process-wide @c TimerWheel.  Task calls
+     * run on the shared @c WorkStealingScheduler rather than on a thread owned by the @c Timer.
      *
-     * @tparam Rep A type for measuring 'ticks' in a generic @c std::chrono::duration.
-     * @tparam Period A type for representing the number of ticks per second in a generic @c std::chrono::duration.
-     *
-     * @param delay The non-negative time to wait before making the first @c task call.
-     * @param period The non-negative time to wait between subsequent @c task calls.
+     * @param delay The non-negative time to wait before making the first task call.
+     * @param period The non-negative time to wait between subsequent task calls.
      * @param periodType The type of period to use when making subsequent task calls.
      * @param maxCount The desired number of times to call task.  @c Timer::getForever() means to call forever until
-     *     @c stop() is called.  Note that fewer than @c maxCount calls may occur if @c periodType is
-     *     @c PeriodType::ABSOLUTE and the task runtime exceeds @c period.
+     *     @c stop() is called.
      * @param task A callable type representing a task.
+     * @returns @c true if the timer started, else @c false.
      */
-    template <typename Rep, typename Period>
-    void callTask(
-        std::chrono::duration<Rep, Period> delay,
-        std::chrono::duration<Rep, Period> period,
+    bool startTimer(
+        std::chrono::steady_clock::duration delay,
+        std::chrono::steady_clock::duration period,
         PeriodType periodType,
         size_t maxCount,
         std::function<void()> task);
 
-    /// The condition variable used to wait for @c stop() or period timeouts.
-    std::condition_variable m_waitCondition;
-
-    /// The mutex for @c m_waitCondition.
-    std::mutex m_waitMutex;
-
-    /// The thread to execute tasks on.
-    std::thread m_thread;
-
-    /// Flag which indicates that a @c Timer is active.
-    std::atomic<bool> m_running;
-
-    /**
-     * Flag which requests that the active @c Timer be stopped.  @c m_waitMutex must be locked when modifying this
-     * variable.
-     */
-    bool m_stopping;
+    /// The timer's state.
+    const std::shared_ptr<State> m_state;
 };
 
 template <typename Rep, typename Period, typename Task, typename... Args>
@@ -239,26 +222,6 @@ bool Timer::start(
     size_t maxCount,
     Task task,
     Args&&... args) {
-    if (delay < std::chrono::duration<Rep, Period>::zero()) {
-        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startFailed").d("reason", "negativeDelay"));
-        return false;
-    }
-    if (period < std::chrono::duration<Rep, Period>::zero()) {
-        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startFailed").d("reason", "negativePeriod"));
-        return false;
-    }
-
-    // Can't start if already running.
-    if (!activate()) {
-        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startFailed").d("reason", "timerAlreadyActive"));
-        return false;
-    }
-
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     using BoundTaskType = decltype(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
     auto boundTask = std::make_shared<BoundTaskType>(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
@@ -266,11 +229,12 @@ bool Timer::start(
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [boundTask]() { boundTask->operator()(); };
 
-    // Kick off the new timer thread.
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, period, periodType, maxCount, translatedTask)};
-
-    return true;
+    return startTimer(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(period),
+        periodType,
+        maxCount,
+        translatedTask);
 }
 
 template <typename Rep, typename Period, typename Task, typename... Args>
@@ -286,18 +250,6 @@ bool Timer::start(
 template <typename Rep, typename Period, typename Task, typename... Args>
 auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Args&&... args)
     -> std::future<decltype(task(args...))> {
-    // Can't start if already running.
-    if (!activate()) {
-        logger::acsdkError(logger::LogEntry(Timer::getTag(), "startFailed").d("reason", "timerAlreadyActive"));
-        using FutureType = decltype(task(args...));
-        return std::future<FutureType>();
-    }
-
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     auto boundTask = std::bind(std::forward<Task>(task), std::forward<Args>(args)...);
 
@@ -308,70 +260,18 @@ auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Ar
      */
     using PackagedTaskType = std::packaged_task<decltype(boundTask())()>;
     auto packagedTask = std::make_shared<PackagedTaskType>(boundTask);
+    auto future = packagedTask->get_future();
 
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [packagedTask]() { packagedTask->operator()(); };
 
-    // Kick off the new timer thread.
     static const size_t once = 1;
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, delay, PeriodType::ABSOLUTE, once, translatedTask)};
-
-    return packagedTask->get_future();
-}
-
-template <typename Rep, typename Period>
-void Timer::callTask(
-    std::chrono::duration<Rep, Period> delay,
-    std::chrono::duration<Rep, Period> period,
-    PeriodType periodType,
-    size_t maxCount,
-    std::function<void()> task) {
-    // Timepoint to measure delay/period against.
-    auto now = std::chrono::steady_clock::now();
-
-    // Flag indicating whether we've drifted off schedule.
-    bool offSchedule = false;
-
-    for (size_t count = 0; maxCount == FOREVER || count < maxCount; ++count) {
-        auto waitTime = (0 == count) ? delay : period;
-        {
-            std::unique_lock<std::mutex> lock(m_waitMutex);
-
-            // Wait for stop() or a delay/period to elapse.
-            if (m_waitCondition.wait_until(lock, now + waitTime, [this]() { return m_stopping; })) {
-                m_stopping = false;
-                m_running = false;
-                return;
-            }
-        }
-
-        switch (periodType) {
-            case PeriodType::ABSOLUTE:
-                // Update our estimate of where we should be after the delay.
-                now += waitTime;
-
-                // Run the task if we're still on schedule.
-                if (!offSchedule) {
-                    task();
-                }
-
-                // If the task runtime put us off schedule, skip the next task run.
-                if (now + period < std::chrono::steady_clock::now()) {
-                    offSchedule = true;
-                } else {
-                    offSchedule = false;
-                }
-                break;
-
-            case PeriodType::RELATIVE:
-                task();
-                now = std::chrono::steady_clock::now();
-                break;
-        }
+    auto steadyDelay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay);
+    if (!startTimer(steadyDelay, steadyDelay, PeriodType::ABSOLUTE, once, translatedTask)) {
+        using FutureType = decltype(task(args...));
+        return std::future<FutureType>();
     }
-    m_stopping = false;
-    m_running = false;
+    return future;
 }
 
 }  // namespace timing
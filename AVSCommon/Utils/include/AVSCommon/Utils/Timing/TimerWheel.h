@@ -0,0 +1,232 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AVSCommon/Utils/Threading/InlineTask.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A hierarchical timing wheel which runs all of its timers from a single thread.
+ *
+ * Time is divided into ticks of one @c slack period, and deadlines are rounded up to the next tick, so timers which
+ * expire within the same tick are fired by a single wakeup and a timer never fires early. Timers are kept in six
+ * levels of 64 slots each (covering two years of 1ms ticks; later deadlines are parked in the last level and moved
+ * again when it cascades), which makes scheduling and cancelling O(1).
+ * The thread sleeps until the next occupied slot is due and is only started once the first timer is scheduled, so an
+ * idle wheel costs neither wakeups nor (before first use) a thread.
+ *
+ * Callbacks run on the wheel's thread and must return quickly; @c Timer and @c MultiTimer hand the actual work off to
+ * the shared @c WorkStealingScheduler.
+ */
+class TimerWheel {
+public:
+    /// Identifies a scheduled timer.
+    using Id = uint64_t;
+
+    /// The type of callback run when a timer expires.
+    using Callback = threading::InlineTask;
+
+    /// An @c Id which is never returned by @c schedule().
+    static const Id INVALID_ID;
+
+    /// The default tick length, and so the default coalescing slack.
+    static const std::chrono::milliseconds DEFAULT_SLACK;
+
+    /**
+     * Constructor.
+     *
+     * @param slack The tick length. Timers are fired up to this much after their deadline so that timers which expire
+     * close together share a wakeup. Values below 1ms are raised to 1ms.
+     */
+    explicit TimerWheel(std::chrono::milliseconds slack = DEFAULT_SLACK);
+
+    /// Destructor. Pending timers are dropped without running.
+    ~TimerWheel();
+
+    /**
+     * Schedule a callback to run at (or up to one tick after) a deadline.
+     *
+     * @param deadline When to run @c callback. Deadlines in the past run on the next tick.
+     * @param callback The callback to run.
+     * @return An @c Id which can be passed to @c cancel(), or @c INVALID_ID if @c callback is empty.
+     */
+    Id schedule(std::chrono::steady_clock::time_point deadline, Callback callback);
+
+    /**
+     * Cancel a timer which has not fired yet.
+     *
+     * @param id The timer to cancel.
+     * @return @c true if the timer was pending and has been cancelled, @c false if it has already fired, has already
+     *     been cancelled, or was never scheduled.
+     */
+    bool cancel(Id id);
+
+    /// The number of timers waiting to fire.
+    size_t getPendingCount();
+
+    /// The number of times the wheel's thread has woken up.
+    uint64_t getWakeupCount() const;
+
+    /// The tick length.
+    std::chrono::milliseconds getSlack() const;
+
+    /**
+     * Get the process-wide wheel used by @c Timer and @c MultiTimer.
+     *
+     * @return The default wheel.
+     */
+    static std::shared_ptr<TimerWheel> getDefault();
+
+    /**
+     * Set the slack used when the default wheel is created. Has no effect once @c getDefault() has been called.
+     *
+     * @param slack The tick length for the default wheel.
+     */
+    static void setDefaultSlack(std::chrono::milliseconds slack);
+
+private:
+    /// Number of bits of the tick count consumed by each level.
+    static const unsigned SLOT_BITS = 6;
+
+    /// Number of slots per level.
+    static const unsigned SLOTS = 1u << SLOT_BITS;
+
+    /// Number of levels.
+    static const unsigned LEVELS = 6;
+
+    /// A scheduled timer, linked into the slot which will fire (or cascade) it.
+    struct Entry {
+        /// The timer's id.
+        Id id;
+        /// The tick at which the timer expires.
+        uint64_t expiryTick;
+        /// The level of the slot holding this entry.
+        unsigned level;
+        /// The index of the slot holding this entry.
+        unsigned slot;
+        /// The callback to run.
+        Callback callback;
+        /// Previous entry in the slot.
+        Entry* prev;
+        /// Next entry in the slot.
+        Entry* next;
+    };
+
+    /// The body of the wheel's thread.
+    void loop();
+
+    /**
+     * Link an entry into the slot matching its expiry, relative to @c m_currentTick.
+     *
+     * @param entry The entry to link.
+     */
+    void linkLocked(Entry* entry);
+
+    /**
+     * Unlink an entry from its slot.
+     *
+     * @param entry The entry to unlink.
+     */
+    void unlinkLocked(Entry* entry);
+
+    /**
+     * Find the next tick after @c m_currentTick at which a slot fires or cascades.
+     *
+     * @param[out] tick The next tick.
+     * @return @c false if no timers are pending.
+     */
+    bool nextEventTickLocked(uint64_t* tick) const;
+
+    /**
+     * Advance @c m_currentTick to @c nowTick, cascading timers down the levels and collecting the callbacks of
+     * expired timers.
+     *
+     * @param nowTick The last tick which has fully elapsed.
+     * @param[out] expired Receives the callbacks to run.
+     */
+    void advanceLocked(uint64_t nowTick, threading::TaskQueue* expired);
+
+    /// Convert a time point to the first tick ending at or after it.
+    uint64_t toTickCeil(std::chrono::steady_clock::time_point timePoint) const;
+
+    /// Convert a time point to the last tick ending at or before it.
+    uint64_t toTickFloor(std::chrono::steady_clock::time_point timePoint) const;
+
+    /// The length of one tick.
+    const std::chrono::steady_clock::duration m_tick;
+
+    /// The time at which tick 0 ends.
+    const std::chrono::steady_clock::time_point m_epoch;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Wakes the thread when a timer is scheduled before its current deadline, or on shutdown.
+    std::condition_variable m_wakeUp;
+
+    /// The slots, indexed by level and then by slot.
+    Entry* m_slots[LEVELS][SLOTS];
+
+    /// Per level bitmask of non-empty slots.
+    uint64_t m_occupied[LEVELS];
+
+    /// Pending entries by id, for cancellation.
+    std::unordered_map<Id, Entry*> m_entries;
+
+    /// Scratch list of the entries expiring in the tick being processed.
+    std::vector<Entry*> m_expiring;
+
+    /// The last tick that has been processed.
+    uint64_t m_currentTick;
+
+    /// The tick the thread is sleeping until; 0 while it is awake and @c UINT64_MAX while it sleeps indefinitely.
+    uint64_t m_sleepUntilTick;
+
+    /// The next id to hand out.
+    Id m_nextId;
+
+    /// Whether the wheel is being destroyed.
+    bool m_shutdown;
+
+    /// The number of wakeups of @c m_thread.
+    std::atomic<uint64_t> m_wakeups;
+
+    /// The wheel's thread, started by the first call to @c schedule().
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
@@ -21,23 +21,34 @@ namespace avsCommon {
 namespace utils {
 namespace threading {
 
+/// The mode used by executors constructed without an explicit mode.
+static std::atomic<ExecutorMode> g_defaultMode{ExecutorMode::SHARED_SCHEDULER};
+
 Executor::~Executor() {
     shutdown();
 }
 
-Executor::Executor(const std::chrono::milliseconds& delayExit) :
+Executor::Executor(const std::chrono::milliseconds& delayExit) : Executor(g_defaultMode.load(), delayExit) {
+}
+
+Executor::Executor(ExecutorMode mode, const std::chrono::milliseconds& delayExit) :
+        m_strand{ExecutorMode::SHARED_SCHEDULER == mode ? Strand::create() : nullptr},
         m_threadRunning{false},
         m_timeout{delayExit},
         m_shutdown{false} {
 }
 
 void Executor::waitForSubmittedTasks() {
+    if (m_strand) {
+        m_strand->waitForSubmittedTasks();
+        return;
+    }
     std::unique_lock<std::mutex> lock{m_queueMutex};
     if (m_threadRunning) {
         // wait for thread to exit.
         std::promise<void> flushedPromise;
         auto flushedFuture = flushedPromise.get_future();
-        m_queue.emplace_back([&flushedPromise]() { flushedPromise.set_value(); });
+        m_queue.pushBack([&flushedPromise]() { flushedPromise.set_value(); });
 
         lock.unlock();
         m_delayedCondition.notify_one();
@@ -45,14 +56,11 @@ void Executor::waitForSubmittedTasks() {
     }
 }
 
-std::function<void()> Executor::pop() {
+InlineTask Executor::pop() {
     std::lock_guard<std::mutex> lock{m_queueMutex};
-    if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
-        m_queue.pop_front();
-        return task;
-    }
-    return std::function<void()>();
+    InlineTask task;
+    m_queue.popFront(&task);
+    return task;
 }
 
 bool Executor::hasNext() {
@@ -71,7 +79,38 @@ bool Executor::runNext() {
     return hasNext();
 }
 
+bool Executor::pushTask(bool front, InlineTask&& task) {
+    if (m_strand) {
+        return m_strand->push(front, std::move(task));
+    }
+
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        if (m_shutdown) {
+            return false;
+        }
+        if (front) {
+            m_queue.pushFront(std::move(task));
+        } else {
+            m_queue.pushBack(std::move(task));
+        }
+
+        if (!m_threadRunning) {
+            // Restart task thread.
+            m_taskThread.start(std::bind(&Executor::runNext, this));
+            m_threadRunning = true;
+        }
+    }
+
+    m_delayedCondition.notify_one();
+    return true;
+}
+
 void Executor::shutdown() {
+    if (m_strand) {
+        m_strand->shutdown();
+        return;
+    }
     std::unique_lock<std::mutex> lock{m_queueMutex};
     m_queue.clear();
     m_shutdown = true;
@@ -80,7 +119,15 @@ void Executor::shutdown() {
 }
 
 bool Executor::isShutdown() {
-    return m_shutdown;
+    return m_strand ? m_strand->isShutdown() : m_shutdown.load();
+}
+
+void Executor::setDefaultMode(ExecutorMode mode) {
+    g_defaultMode = mode;
+}
+
+ExecutorMode Executor::getDefaultMode() {
+    return g_defaultMode;
 }
 
 }  // namespace threading
@@ -14,6 +14,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <set>
 #include <utility>
@@ -49,22 +50,14 @@ std::ostream& operator<<(std::ostream& stream, HTTP2MimeRequestEncoder::State st
     switch (state) {
         case HTTP2MimeRequestEncoder::State::NEW:
             return stream << "NEW";
-        case HTTP2MimeRequestEncoder::State::GETTING_1ST_PART_HEADERS:
-            return stream << "GETTING_1ST_PART_HEADERS";
-        case HTTP2MimeRequestEncoder::State::SENDING_1ST_BOUNDARY:
-            return stream << "SENDING_1ST_BOUNDARY";
-        case HTTP2MimeRequestEncoder::State::SENDING_PART_HEADERS:
-            return stream << "SENDING_PART_HEADERS";
+        case HTTP2MimeRequestEncoder::State::GETTING_PART_HEADERS:
+            return stream << "GETTING_PART_HEADERS";
+        case HTTP2MimeRequestEncoder::State::SENDING_PART_ENVELOPE:
+            return stream << "SENDING_PART_ENVELOPE";
         case HTTP2MimeRequestEncoder::State::SENDING_PART_DATA:
             return stream << "SENDING_PART_DATA";
-        case HTTP2MimeRequestEncoder::State::SENDING_END_BOUNDARY:
-            return stream << "SENDING_END_BOUNDARY";
-        case HTTP2MimeRequestEncoder::State::GETTING_NTH_PART_HEADERS:
-            return stream << "GETTING_NTH_PART_HEADERS";
-        case HTTP2MimeRequestEncoder::State::SENDING_CRLF_AFTER_BOUNDARY:
-            return stream << "SENDING_CRLF_AFTER_BOUNDARY";
-        case HTTP2MimeRequestEncoder::State::SENDING_TERMINATING_DASHES:
-            return stream << "SENDING_TERMINATING_DASHES";
+        case HTTP2MimeRequestEncoder::State::SENDING_TRAILER:
+            return stream << "SENDING_TRAILER";
         case HTTP2MimeRequestEncoder::State::DONE:
             return stream << "DONE";
         case HTTP2MimeRequestEncoder::State::ABORT:
@@ -78,10 +71,12 @@ HTTP2MimeRequestEncoder::HTTP2MimeRequestEncoder(
     std::shared_ptr<HTTP2MimeRequestSourceInterface> source) :
         m_state{State::NEW},
         m_rawBoundary{boundary},
-        m_prefixedBoundary{CRLF + TWO_DASHES + boundary},
+        m_partBoundary{CRLF + TWO_DASHES + boundary + CRLF},
+        m_trailer{CRLF + TWO_DASHES + boundary + TWO_DASHES + CRLF},
         m_source{source},
-        m_getMimeHeaderLinesResult{HTTP2GetMimeHeadersResult::ABORT},
-        m_stringIndex{0} {
+        m_bytesCopied{0},
+        m_hasSentPart{false},
+        m_envelopeIndex{0} {
     ACSDK_DEBUG9(LX(__func__).d("boundary", boundary).d("source", source.get()));
 }
 
@@ -96,16 +91,17 @@ HTTP2SendDataResult HTTP2MimeRequestEncoder::onSendData(char* bytes, size_t size
 
     while (true) {
         switch (m_state) {
-            case State::NEW: {
-                setState(State::GETTING_1ST_PART_HEADERS);
-            } break;
+            case State::NEW:
+                setState(State::GETTING_PART_HEADERS);
+                break;
 
-            case State::GETTING_1ST_PART_HEADERS:
-                m_getMimeHeaderLinesResult = m_source->getMimePartHeaderLines();
-                switch (m_getMimeHeaderLinesResult.status) {
+            case State::GETTING_PART_HEADERS: {
+                auto result = m_source->getMimePartHeaderLines();
+                switch (result.status) {
                     case HTTP2SendStatus::CONTINUE:
-                        m_stringIndex = 0;
-                        setState(State::SENDING_1ST_BOUNDARY);
+                        buildPartEnvelope(result.headers);
+                        m_hasSentPart = true;
+                        setState(State::SENDING_PART_ENVELOPE);
                         break;
 
                     case HTTP2SendStatus::PAUSE:
@@ -115,42 +111,32 @@ HTTP2SendDataResult HTTP2MimeRequestEncoder::onSendData(char* bytes, size_t size
                         return HTTP2SendDataResult::PAUSE;
 
                     case HTTP2SendStatus::COMPLETE:
-                        setState(State::DONE);
-                        return continueResult();
+                        if (!m_hasSentPart) {
+                            setState(State::DONE);
+                            return continueResult();
+                        }
+                        m_envelopeIndex = 0;
+                        setState(State::SENDING_TRAILER);
+                        break;
 
-                    case HTTP2SendStatus::ABORT: {
+                    case HTTP2SendStatus::ABORT:
                         setState(State::ABORT);
                         return HTTP2SendDataResult::ABORT;
-                    }
                 }
-                break;
+            } break;
 
-            case State::SENDING_1ST_BOUNDARY:
-                if (!sendStringAndCRLF(bytes, size, m_prefixedBoundary)) {
+            case State::SENDING_PART_ENVELOPE:
+                if (!sendEnvelope(bytes, size, m_envelope)) {
                     return continueResult();
                 }
-                m_headerLine = m_getMimeHeaderLinesResult.headers.begin();
-                m_stringIndex = 0;
-                setState(State::SENDING_PART_HEADERS);
-                break;
-
-            case State::SENDING_PART_HEADERS:
-                while (m_headerLine != m_getMimeHeaderLinesResult.headers.end()) {
-                    if (sendStringAndCRLF(bytes, size, *m_headerLine)) {
-                        m_headerLine++;
-                        m_stringIndex = 0;
-                    } else {
-                        return continueResult();
-                    }
-                }
-                if (sendString(bytes, size, CRLF)) {
-                    setState(State::SENDING_PART_DATA);
-                } else {
+                setState(State::SENDING_PART_DATA);
+                if (m_bytesCopied == size) {
                     return continueResult();
                 }
                 break;
 
             case State::SENDING_PART_DATA: {
+                // The source copies straight in to the buffer, so part data is copied once.
                 auto sendPartResult = m_source->onSendMimePartData(bytes + m_bytesCopied, size - m_bytesCopied);
                 switch (sendPartResult.status) {
                     case HTTP2SendStatus::CONTINUE:
@@ -171,8 +157,7 @@ HTTP2SendDataResult HTTP2MimeRequestEncoder::onSendData(char* bytes, size_t size
                         return HTTP2SendDataResult::PAUSE;
 
                     case HTTP2SendStatus::COMPLETE:
-                        m_stringIndex = 0;
-                        setState(State::SENDING_END_BOUNDARY);
+                        setState(State::GETTING_PART_HEADERS);
                         break;
 
                     case HTTP2SendStatus::ABORT:
@@ -181,57 +166,14 @@ HTTP2SendDataResult HTTP2MimeRequestEncoder::onSendData(char* bytes, size_t size
                 }
             } break;
 
-            case State::SENDING_END_BOUNDARY:
-                if (!sendString(bytes, size, m_prefixedBoundary)) {
-                    return continueResult();
-                }
-                setState(State::GETTING_NTH_PART_HEADERS);
-                break;
-
-            case State::GETTING_NTH_PART_HEADERS:
-                m_getMimeHeaderLinesResult = m_source->getMimePartHeaderLines();
-                switch (m_getMimeHeaderLinesResult.status) {
-                    case HTTP2SendStatus::CONTINUE:
-                        m_stringIndex = 0;
-                        setState(State::SENDING_CRLF_AFTER_BOUNDARY);
-                        break;
-
-                    case HTTP2SendStatus::PAUSE:
-                        if (m_bytesCopied != 0) {
-                            return continueResult();
-                        }
-                        return HTTP2SendDataResult::PAUSE;
-
-                    case HTTP2SendStatus::COMPLETE:
-                        m_stringIndex = 0;
-                        setState(State::SENDING_TERMINATING_DASHES);
-                        break;
-
-                    case HTTP2SendStatus::ABORT:
-                        setState(State::ABORT);
-                        return HTTP2SendDataResult::ABORT;
-                }
-                break;
-
-            case State::SENDING_CRLF_AFTER_BOUNDARY:
-                if (!sendString(bytes, size, CRLF)) {
-                    return continueResult();
-                }
-                m_headerLine = m_getMimeHeaderLinesResult.headers.begin();
-                m_stringIndex = 0;
-                setState(State::SENDING_PART_HEADERS);
-                break;
-
-            case State::SENDING_TERMINATING_DASHES:
-                if (sendStringAndCRLF(bytes, size, TWO_DASHES)) {
+            case State::SENDING_TRAILER:
+                if (sendEnvelope(bytes, size, m_trailer)) {
                     setState(State::DONE);
                 }
                 return continueResult();
-                break;
 
             case State::DONE:
                 return HTTP2SendDataResult::COMPLETE;
-                break;
 
             case State::ABORT:
                 return HTTP2SendDataResult::ABORT;
@@ -256,21 +198,15 @@ void HTTP2MimeRequestEncoder::setState(State newState) {
     }
 
     static const std::set<std::pair<State, State>> transitions = {
-        {State::NEW, State::GETTING_1ST_PART_HEADERS},
-        {State::GETTING_1ST_PART_HEADERS, State::SENDING_1ST_BOUNDARY},
-        {State::GETTING_1ST_PART_HEADERS, State::DONE},
-        {State::GETTING_1ST_PART_HEADERS, State::ABORT},
-        {State::SENDING_1ST_BOUNDARY, State::SENDING_PART_HEADERS},
-        {State::SENDING_PART_HEADERS, State::SENDING_PART_DATA},
-        {State::SENDING_PART_DATA, State::SENDING_END_BOUNDARY},
-        {State::SENDING_PART_DATA, State::DONE},
+        {State::NEW, State::GETTING_PART_HEADERS},
+        {State::GETTING_PART_HEADERS, State::SENDING_PART_ENVELOPE},
+        {State::GETTING_PART_HEADERS, State::SENDING_TRAILER},
+        {State::GETTING_PART_HEADERS, State::DONE},
+        {State::GETTING_PART_HEADERS, State::ABORT},
+        {State::SENDING_PART_ENVELOPE, State::SENDING_PART_DATA},
+        {State::SENDING_PART_DATA, State::GETTING_PART_HEADERS},
         {State::SENDING_PART_DATA, State::ABORT},
-        {State::SENDING_END_BOUNDARY, State::GETTING_NTH_PART_HEADERS},
-        {State::GETTING_NTH_PART_HEADERS, State::SENDING_CRLF_AFTER_BOUNDARY},
-        {State::GETTING_NTH_PART_HEADERS, State::SENDING_TERMINATING_DASHES},
-        {State::GETTING_NTH_PART_HEADERS, State::ABORT},
-        {State::SENDING_CRLF_AFTER_BOUNDARY, State::SENDING_PART_HEADERS},
-        {State::SENDING_TERMINATING_DASHES, State::DONE},
+        {State::SENDING_TRAILER, State::DONE},
     };
 
     if (transitions.find({m_state, newState}) != transitions.end()) {
@@ -282,33 +218,21 @@ void HTTP2MimeRequestEncoder::setState(State newState) {
     }
 }
 
-bool HTTP2MimeRequestEncoder::sendString(char* bytes, size_t size, const std::string& text) {
-    auto bufferRemaining = size - m_bytesCopied;
-    auto textRemaining = text.size() - m_stringIndex;
-    auto result = bufferRemaining > textRemaining;
-    auto sizeToCopy = result ? textRemaining : bufferRemaining;
-    std::memcpy(bytes + m_bytesCopied, text.c_str() + m_stringIndex, sizeToCopy);
-    m_bytesCopied += sizeToCopy;
-    m_stringIndex += sizeToCopy;
-    return result;
-}
-
-bool HTTP2MimeRequestEncoder::sendStringAndCRLF(char* bytes, size_t size, const std::string& text) {
-    if (m_stringIndex < text.size()) {
-        if (!sendString(bytes, size, text)) {
-            return false;
-        }
+void HTTP2MimeRequestEncoder::buildPartEnvelope(const std::vector<std::string>& headerLines) {
+    m_envelope.assign(m_partBoundary);
+    for (const auto& line : headerLines) {
+        m_envelope.append(line).append(CRLF);
     }
+    m_envelope.append(CRLF);
+    m_envelopeIndex = 0;
+}
 
-    auto crlfBytesCopied = m_stringIndex - text.size();
-    auto bufferRemaining = size - m_bytesCopied;
-    auto crlfRemaining = CRLF.size() - crlfBytesCopied;
-    auto result = bufferRemaining > crlfRemaining;
-    auto sizeToCopy = result ? crlfRemaining : bufferRemaining;
-    std::memcpy(bytes + m_bytesCopied, CRLF.c_str() + crlfBytesCopied, sizeToCopy);
+bool HTTP2MimeRequestEncoder::sendEnvelope(char* bytes, size_t size, const std::string& envelope) {
+    auto sizeToCopy = std::min(size - m_bytesCopied, envelope.size() - m_envelopeIndex);
+    std::memcpy(bytes + m_bytesCopied, envelope.data() + m_envelopeIndex, sizeToCopy);
     m_bytesCopied += sizeToCopy;
-    m_stringIndex += sizeToCopy;
-    return result;
+    m_envelopeIndex += sizeToCopy;
+    return m_envelopeIndex == envelope.size();
 }
 
 HTTP2SendDataResult HTTP2MimeRequestEncoder::continueResult() {
@@ -0,0 +1,315 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include "AVSCommon/Utils/HTTP2/MimeMultipartParser.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+
+/// ASCII value of CR
+static const char CARRIAGE_RETURN = '\r';
+/// ASCII value of LF
+static const char LINE_FEED = '\n';
+/// ASCII value of hyphen
+static const char HYPHEN = '-';
+/// ASCII value of colon
+static const char COLON = ':';
+/// The size of a CRLF sequence.
+static const size_t CRLF_SIZE = 2;
+/// The size of the hyphens which follow the final boundary.
+static const size_t CLOSE_DELIMITER_SUFFIX_SIZE = 2;
+/// The prefix of a delimiter: CRLF and two hyphens.
+static const std::string DELIMITER_PREFIX = "\r\n--";
+/// The capacity reserved for a header line, which is enough for the headers AVS sends without reallocating.
+static const size_t HEADER_LINE_RESERVED_SIZE = 256;
+/// The longest header line accepted, to bound the memory used by a malformed body.
+static const size_t MAX_HEADER_LINE_SIZE = 8192;
+
+MimeMultipartParser::MimeMultipartParser() :
+        m_state{State::NO_BOUNDARY},
+        m_countOfDelimiterBytesMatched{0},
+        m_isFirstHeaderLine{true},
+        m_isPartBegun{false},
+        m_errorReason{""} {
+}
+
+void MimeMultipartParser::setBoundary(const std::string& boundary) {
+    m_delimiter = DELIMITER_PREFIX + boundary;
+    m_state = boundary.empty() ? State::NO_BOUNDARY : State::FIRST_BOUNDARY;
+    m_countOfDelimiterBytesMatched = 0;
+    m_heldBack.clear();
+    m_heldBack.reserve(m_delimiter.size() + CLOSE_DELIMITER_SUFFIX_SIZE);
+    m_headerLine.clear();
+    m_headerLine.reserve(HEADER_LINE_RESERVED_SIZE);
+    m_isFirstHeaderLine = true;
+    m_headers.clear();
+    m_isPartBegun = false;
+    m_errorReason = "";
+}
+
+bool MimeMultipartParser::hasBoundary() const {
+    return m_state != State::NO_BOUNDARY;
+}
+
+bool MimeMultipartParser::isFinished() const {
+    return State::FINISHED == m_state;
+}
+
+const char* MimeMultipartParser::getErrorReason() const {
+    return m_errorReason;
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::feed(
+    const char* bytes,
+    size_t size,
+    HTTP2MimeResponseSinkInterface& sink,
+    size_t* consumed) {
+    if (!bytes || !consumed) {
+        return setError("nullParameter");
+    }
+    *consumed = 0;
+
+    size_t i = 0;
+    auto status = HTTP2ReceiveDataStatus::SUCCESS;
+    while (i < size && HTTP2ReceiveDataStatus::SUCCESS == status) {
+        switch (m_state) {
+            case State::NO_BOUNDARY:
+                return setError("noBoundary");
+
+            case State::ERROR:
+                return HTTP2ReceiveDataStatus::ABORT;
+
+            case State::FINISHED:
+                // The epilogue after the final boundary is ignored.
+                i = size;
+                break;
+
+            case State::FIRST_BOUNDARY:
+                if (0 == m_countOfDelimiterBytesMatched && HYPHEN == bytes[i]) {
+                    // The CRLF before the first boundary is optional.
+                    m_countOfDelimiterBytesMatched = CRLF_SIZE;
+                }
+                if (bytes[i] != m_delimiter[m_countOfDelimiterBytesMatched]) {
+                    return setError("firstBoundaryNotFound");
+                }
+                ++i;
+                if (++m_countOfDelimiterBytesMatched == m_delimiter.size()) {
+                    m_state = State::AFTER_BOUNDARY;
+                }
+                break;
+
+            case State::HEADERS: {
+                auto lineFeed = static_cast<const char*>(memchr(bytes + i, LINE_FEED, size - i));
+                size_t end = lineFeed ? lineFeed - bytes + 1 : size;
+                if (m_headerLine.size() + (end - i) > MAX_HEADER_LINE_SIZE) {
+                    return setError("headerLineTooLong");
+                }
+                m_headerLine.append(bytes + i, end - i);
+                i = end;
+                if (lineFeed) {
+                    status = onHeaderLine(sink);
+                }
+                break;
+            }
+
+            case State::PART_DATA:
+                if (0 == m_countOfDelimiterBytesMatched) {
+                    // A delimiter starts with CR, so everything up to the next CR is part data.  memchr() is
+                    // vectorized by the C library, which makes this scan much faster than testing each byte.
+                    auto carriageReturn = static_cast<const char*>(memchr(bytes + i, CARRIAGE_RETURN, size - i));
+                    size_t end = carriageReturn ? carriageReturn - bytes : size;
+                    if (end > i) {
+                        status = sendPartData(bytes + i, end - i, sink);
+                        if (status != HTTP2ReceiveDataStatus::SUCCESS) {
+                            break;
+                        }
+                        i = end;
+                    }
+                    if (i == size) {
+                        break;
+                    }
+                }
+                if (bytes[i] == m_delimiter[m_countOfDelimiterBytesMatched]) {
+                    m_heldBack.push_back(bytes[i]);
+                    ++i;
+                    if (++m_countOfDelimiterBytesMatched == m_delimiter.size()) {
+                        m_state = State::AFTER_BOUNDARY;
+                    }
+                } else {
+                    status = onBoundaryMismatch(sink);
+                }
+                break;
+
+            case State::AFTER_BOUNDARY:
+                if (CARRIAGE_RETURN == bytes[i]) {
+                    m_state = State::AFTER_BOUNDARY_CR;
+                } else if (HYPHEN == bytes[i]) {
+                    m_state = State::AFTER_BOUNDARY_HYPHEN;
+                } else {
+                    status = onBoundaryMismatch(sink);
+                    break;
+                }
+                m_heldBack.push_back(bytes[i]);
+                ++i;
+                break;
+
+            case State::AFTER_BOUNDARY_CR:
+                if (bytes[i] != LINE_FEED) {
+                    status = onBoundaryMismatch(sink);
+                    break;
+                }
+                ++i;
+                status = endPart(sink);
+                beginHeaders();
+                break;
+
+            case State::AFTER_BOUNDARY_HYPHEN:
+                if (bytes[i] != HYPHEN) {
+                    status = onBoundaryMismatch(sink);
+                    break;
+                }
+                ++i;
+                status = endPart(sink);
+                m_state = State::FINISHED;
+                break;
+        }
+    }
+
+    if (HTTP2ReceiveDataStatus::ABORT == status) {
+        return setError(m_state == State::ERROR ? m_errorReason : "sinkAborted");
+    }
+    *consumed = i;
+    return status;
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::onBoundaryMismatch(HTTP2MimeResponseSinkInterface& sink) {
+    if (m_heldBack.empty() && m_state != State::PART_DATA) {
+        // Only the first boundary is matched without holding back part data.
+        return setError("malformedFirstBoundary");
+    }
+    // What looked like the start of a delimiter was part data after all.
+    if (!m_heldBack.empty()) {
+        auto status = sendPartData(m_heldBack.data(), m_heldBack.size(), sink);
+        if (status != HTTP2ReceiveDataStatus::SUCCESS) {
+            return status;
+        }
+        m_heldBack.clear();
+    }
+    // The byte which did not match is examined again: it may start a delimiter, but as boundaries may not contain CR
+    // it cannot continue one started by the bytes held back.
+    m_countOfDelimiterBytesMatched = 0;
+    m_state = State::PART_DATA;
+    return HTTP2ReceiveDataStatus::SUCCESS;
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::sendPartData(
+    const char* bytes,
+    size_t size,
+    HTTP2MimeResponseSinkInterface& sink) {
+    if (!m_isPartBegun) {
+        // A part without headers is only passed to the sink once it turns out to have data.
+        if (!sink.onBeginMimePart(m_headers)) {
+            return HTTP2ReceiveDataStatus::ABORT;
+        }
+        m_isPartBegun = true;
+    }
+    return sink.onReceiveMimeData(bytes, size);
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::onHeaderLine(HTTP2MimeResponseSinkInterface& sink) {
+    auto size = m_headerLine.size();
+    if (size < CRLF_SIZE || m_headerLine[size - CRLF_SIZE] != CARRIAGE_RETURN) {
+        return setError("headerLineNotEndedByCRLF");
+    }
+    auto length = size - CRLF_SIZE;
+    auto boundaryLength = m_delimiter.size() - CRLF_SIZE;
+
+    if (0 == length) {
+        // An empty line ends the headers.
+        m_headerLine.clear();
+        m_state = State::PART_DATA;
+        if (m_isFirstHeaderLine) {
+            // A part without headers.  If the empty line is followed by a boundary, it is a duplicate boundary, so
+            // the empty line doubles as the CRLF of the delimiter.
+            m_countOfDelimiterBytesMatched = CRLF_SIZE;
+            return HTTP2ReceiveDataStatus::SUCCESS;
+        }
+        m_countOfDelimiterBytesMatched = 0;
+        m_isPartBegun = true;
+        return sink.onBeginMimePart(m_headers) ? HTTP2ReceiveDataStatus::SUCCESS : HTTP2ReceiveDataStatus::ABORT;
+    }
+
+    if (m_isFirstHeaderLine && length >= boundaryLength &&
+        0 == m_headerLine.compare(0, boundaryLength, m_delimiter, CRLF_SIZE, boundaryLength)) {
+        if (length == boundaryLength) {
+            // A duplicate boundary: skip it, and read the headers after it.
+            m_headerLine.clear();
+            return HTTP2ReceiveDataStatus::SUCCESS;
+        }
+        if (length == boundaryLength + CLOSE_DELIMITER_SUFFIX_SIZE && HYPHEN == m_headerLine[boundaryLength] &&
+            HYPHEN == m_headerLine[boundaryLength + 1]) {
+            // A duplicate of the final boundary.
+            m_headerLine.clear();
+            m_state = State::FINISHED;
+            return HTTP2ReceiveDataStatus::SUCCESS;
+        }
+    }
+
+    m_isFirstHeaderLine = false;
+    auto colon = m_headerLine.find(COLON);
+    if (0 == colon || colon >= length) {
+        return setError("malformedHeaderLine");
+    }
+    auto valueStart = colon + 1;
+    while (valueStart < length && (' ' == m_headerLine[valueStart] || '\t' == m_headerLine[valueStart])) {
+        ++valueStart;
+    }
+    m_headers.emplace(m_headerLine.substr(0, colon), m_headerLine.substr(valueStart, length - valueStart));
+    m_headerLine.clear();
+    return HTTP2ReceiveDataStatus::SUCCESS;
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::endPart(HTTP2MimeResponseSinkInterface& sink) {
+    m_heldBack.clear();
+    m_countOfDelimiterBytesMatched = 0;
+    if (!m_isPartBegun) {
+        // The first boundary, or a duplicate boundary: there is no part to end.
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+    m_isPartBegun = false;
+    return sink.onEndMimePart() ? HTTP2ReceiveDataStatus::SUCCESS : HTTP2ReceiveDataStatus::ABORT;
+}
+
+void MimeMultipartParser::beginHeaders() {
+    m_state = State::HEADERS;
+    m_headerLine.clear();
+    m_isFirstHeaderLine = true;
+    m_headers.clear();
+}
+
+HTTP2ReceiveDataStatus MimeMultipartParser::setError(const char* reason) {
+    m_state = State::ERROR;
+    m_errorReason = reason;
+    return HTTP2ReceiveDataStatus::ABORT;
+}
+
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
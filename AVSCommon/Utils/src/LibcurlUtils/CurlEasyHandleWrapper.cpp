@@ -322,6 +322,13 @@ bool CurlEasyHandleWrapper::setDefaultOptions() {
             break;
         }
 
+        // Resume the TLS sessions and reuse the DNS lookups of earlier handles to the same host.
+        auto share = CurlShareHandleWrapper::getProcessShare();
+        if (!setopt(CURLOPT_SHARE, share ? share->getCurlShareHandle() : nullptr)) {
+            break;
+        }
+        m_share = std::move(share);
+
         auto config = configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY];
         std::string interfaceName;
         if (config.getString(INTERFACE_CONFIG_KEY, &interfaceName) &&
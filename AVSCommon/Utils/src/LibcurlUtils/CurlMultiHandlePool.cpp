@@ -0,0 +1,138 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandlePool.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("CurlMultiHandlePool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The separator between the scheme and the authority of a URL.
+static const std::string SCHEME_SEPARATOR = "://";
+
+/// The characters which end the authority of a URL.
+static const char* AUTHORITY_TERMINATORS = "/?#";
+
+const size_t CurlMultiHandlePool::DEFAULT_MAX_IDLE_PER_ORIGIN = 2;
+const size_t CurlMultiHandlePool::DEFAULT_MAX_IDLE = 8;
+const std::chrono::seconds CurlMultiHandlePool::DEFAULT_MAX_IDLE_TIME{60};
+
+std::shared_ptr<CurlMultiHandlePool> CurlMultiHandlePool::create(
+    size_t maxIdlePerOrigin,
+    size_t maxIdle,
+    std::chrono::seconds maxIdleTime) {
+    return std::shared_ptr<CurlMultiHandlePool>(new CurlMultiHandlePool(maxIdlePerOrigin, maxIdle, maxIdleTime));
+}
+
+CurlMultiHandlePool::CurlMultiHandlePool(size_t maxIdlePerOrigin, size_t maxIdle, std::chrono::seconds maxIdleTime) :
+        m_maxIdlePerOrigin{maxIdlePerOrigin},
+        m_maxIdle{maxIdle},
+        m_maxIdleTime{maxIdleTime},
+        m_idleCount{0} {
+}
+
+std::unique_ptr<CurlMultiHandleWrapper> CurlMultiHandlePool::acquire(const std::string& url) {
+    auto origin = getOrigin(url);
+    std::deque<std::unique_ptr<CurlMultiHandleWrapper>> expired;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        removeExpiredLocked(std::chrono::steady_clock::now(), &expired);
+        auto it = m_idleMultiHandles.find(origin);
+        if (it != m_idleMultiHandles.end()) {
+            // The most recently released multi handle is the one most likely to still have an open connection.
+            auto multiHandle = std::move(it->second.back().multiHandle);
+            it->second.pop_back();
+            if (it->second.empty()) {
+                m_idleMultiHandles.erase(it);
+            }
+            --m_idleCount;
+            ACSDK_DEBUG9(LX("acquire").d("reused", true).sensitive("origin", origin));
+            return multiHandle;
+        }
+    }
+    ACSDK_DEBUG9(LX("acquire").d("reused", false).sensitive("origin", origin));
+    return CurlMultiHandleWrapper::create();
+}
+
+void CurlMultiHandlePool::release(const std::string& url, std::unique_ptr<CurlMultiHandleWrapper> multiHandle) {
+    if (!multiHandle) {
+        return;
+    }
+    auto origin = getOrigin(url);
+    // Declared before the lock, so that the multi handles discarded are cleaned up, closing their connections, after
+    // the lock is released.
+    std::deque<std::unique_ptr<CurlMultiHandleWrapper>> expired;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto now = std::chrono::steady_clock::now();
+    removeExpiredLocked(now, &expired);
+    auto& idle = m_idleMultiHandles[origin];
+    if (idle.size() >= m_maxIdlePerOrigin || m_idleCount >= m_maxIdle) {
+        ACSDK_DEBUG9(LX("releaseDiscarded").d("reason", "poolFull").sensitive("origin", origin));
+        if (idle.empty()) {
+            m_idleMultiHandles.erase(origin);
+        }
+        expired.push_back(std::move(multiHandle));
+        return;
+    }
+    idle.push_back({std::move(multiHandle), now});
+    ++m_idleCount;
+}
+
+size_t CurlMultiHandlePool::getIdleCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idleCount;
+}
+
+std::string CurlMultiHandlePool::getOrigin(const std::string& url) {
+    auto authorityStart = url.find(SCHEME_SEPARATOR);
+    authorityStart = std::string::npos == authorityStart ? 0 : authorityStart + SCHEME_SEPARATOR.size();
+    auto origin = url.substr(0, url.find_first_of(AUTHORITY_TERMINATORS, authorityStart));
+    std::transform(origin.begin(), origin.end(), origin.begin(), ::tolower);
+    return origin;
+}
+
+void CurlMultiHandlePool::removeExpiredLocked(
+    std::chrono::steady_clock::time_point now,
+    std::deque<std::unique_ptr<CurlMultiHandleWrapper>>* expired) {
+    for (auto it = m_idleMultiHandles.begin(); it != m_idleMultiHandles.end();) {
+        auto& idle = it->second;
+        while (!idle.empty() && now - idle.front().releaseTime >= m_maxIdleTime) {
+            expired->push_back(std::move(idle.front().multiHandle));
+            idle.pop_front();
+            --m_idleCount;
+        }
+        it = idle.empty() ? m_idleMultiHandles.erase(it) : std::next(it);
+    }
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
@@ -31,6 +33,14 @@ static const std::string TAG("CurlMultiHandleWrapper");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The first version of @c libcurl with @c curl_multi_poll() and @c curl_multi_wakeup(): 7.68.0.
+#define CURL_MULTI_WAKEUP_VERSION_NUM 0x074400
+
+#if LIBCURL_VERSION_NUM < CURL_MULTI_WAKEUP_VERSION_NUM
+/// Longest time @c poll() waits when it has to fall back to @c curl_multi_wait(), which cannot be woken up.
+static const std::chrono::milliseconds POLL_FALLBACK_MAX_TIMEOUT(10);
+#endif
+
 std::unique_ptr<CurlMultiHandleWrapper> CurlMultiHandleWrapper::create() {
     auto handle = curl_multi_init();
     if (!handle) {
@@ -99,6 +109,31 @@ CURLMcode CurlMultiHandleWrapper::wait(std::chrono::milliseconds timeout, int* c
     return result;
 }
 
+CURLMcode CurlMultiHandleWrapper::poll(std::chrono::milliseconds timeout, int* countHandlesUpdated) {
+#if LIBCURL_VERSION_NUM >= CURL_MULTI_WAKEUP_VERSION_NUM
+    auto result = curl_multi_poll(m_handle, NULL, 0, timeout.count(), countHandlesUpdated);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiPollFailed").d("error", curl_multi_strerror(result)));
+    }
+    return result;
+#else
+    return wait(std::min(timeout, POLL_FALLBACK_MAX_TIMEOUT), countHandlesUpdated);
+#endif
+}
+
+CURLMcode CurlMultiHandleWrapper::wakeup() {
+#if LIBCURL_VERSION_NUM >= CURL_MULTI_WAKEUP_VERSION_NUM
+    auto result = curl_multi_wakeup(m_handle);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiWakeupFailed").d("error", curl_multi_strerror(result)));
+    }
+    return result;
+#else
+    // poll() never waits longer than POLL_FALLBACK_MAX_TIMEOUT, which is as soon as it can be woken up.
+    return CURLM_OK;
+#endif
+}
+
 CURLMsg* CurlMultiHandleWrapper::infoRead(int* messagesInQueue) {
     return curl_multi_info_read(m_handle, messagesInQueue);
 }
@@ -0,0 +1,102 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include <AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("CurlShareHandleWrapper");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Key for looking up the @c LibCurlUtil @c ConfigurationNode.
+static const std::string LIBCURLUTILS_CONFIG_KEY = "libcurlUtils";
+/// Key for looking up whether DNS lookups and TLS sessions are shared between easy handles.
+static const std::string SHARE_DNS_AND_TLS_SESSIONS_CONFIG_KEY = "shareDnsAndTlsSessions";
+
+std::shared_ptr<CurlShareHandleWrapper> CurlShareHandleWrapper::getProcessShare() {
+    bool shareDnsAndTlsSessions = true;
+    configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY].getBool(
+        SHARE_DNS_AND_TLS_SESSIONS_CONFIG_KEY, &shareDnsAndTlsSessions, true);
+    if (!shareDnsAndTlsSessions) {
+        return nullptr;
+    }
+    // Easy handles hold a reference, so the share outlives any handle which is cleaned up after this is destroyed.
+    static const std::shared_ptr<CurlShareHandleWrapper> processShare = create();
+    return processShare;
+}
+
+std::shared_ptr<CurlShareHandleWrapper> CurlShareHandleWrapper::create() {
+    auto handle = curl_share_init();
+    if (!handle) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareInitFailed"));
+        return nullptr;
+    }
+    std::shared_ptr<CurlShareHandleWrapper> share(new CurlShareHandleWrapper(handle));
+    CURLSHcode result = CURLSHE_OK;
+    if ((result = curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, lockCallback)) != CURLSHE_OK ||
+        (result = curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, unlockCallback)) != CURLSHE_OK ||
+        (result = curl_share_setopt(handle, CURLSHOPT_USERDATA, share.get())) != CURLSHE_OK ||
+        (result = curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS)) != CURLSHE_OK ||
+        (result = curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION)) != CURLSHE_OK) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareSetoptFailed").d("error", curl_share_strerror(result)));
+        return nullptr;
+    }
+    return share;
+}
+
+CurlShareHandleWrapper::CurlShareHandleWrapper(CURLSH* handle) : m_handle{handle} {
+}
+
+CurlShareHandleWrapper::~CurlShareHandleWrapper() {
+    auto result = curl_share_cleanup(m_handle);
+    if (result != CURLSHE_OK) {
+        ACSDK_ERROR(LX("curlShareCleanupFailed").d("error", curl_share_strerror(result)));
+    }
+}
+
+CURLSH* CurlShareHandleWrapper::getCurlShareHandle() {
+    return m_handle;
+}
+
+void CurlShareHandleWrapper::lockCallback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr) {
+    auto share = static_cast<CurlShareHandleWrapper*>(userPtr);
+    if (share && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        share->m_mutexes[data].lock();
+    }
+}
+
+void CurlShareHandleWrapper::unlockCallback(CURL* handle, curl_lock_data data, void* userPtr) {
+    auto share = static_cast<CurlShareHandleWrapper*>(userPtr);
+    if (share && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        share->m_mutexes[data].unlock();
+    }
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -33,10 +33,13 @@ static const std::string TAG("HTTPContentFetcherFactory");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+HTTPContentFetcherFactory::HTTPContentFetcherFactory() : m_multiHandlePool{CurlMultiHandlePool::create()} {
+}
+
 std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> HTTPContentFetcherFactory::create(
     const std::string& url) {
     ACSDK_DEBUG9(LX(__func__).sensitive("URL", url).m("Creating a new http content fetcher"));
-    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url);
+    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url, m_multiHandlePool);
 }
 
 }  // namespace libcurlUtils
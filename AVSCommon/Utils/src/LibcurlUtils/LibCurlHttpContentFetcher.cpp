@@ -66,7 +66,10 @@ size_t LibCurlHttpContentFetcher::headerCallback(char* data, size_t size, size_t
 
     ACSDK_DEBUG9(LX(__func__).sensitive("url", fetcher->m_url).m("CALLED"));
 
-    fetcher->stateTransition(State::FETCHING_HEADER, true);
+    // getBody() may already have been called, in which case the headers are parsed while fetching the body.
+    if (State::INITIALIZED == fetcher->getState()) {
+        fetcher->stateTransition(State::FETCHING_HEADER, true);
+    }
 
     std::string line(static_cast<const char*>(data), size * nmemb);
     std::transform(line.begin(), line.end(), line.begin(), ::tolower);
@@ -201,9 +204,12 @@ size_t LibCurlHttpContentFetcher::noopCallback(char* data, size_t size, size_t n
     return 0;
 }
 
-LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(const std::string& url) :
+LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(
+    const std::string& url,
+    std::shared_ptr<CurlMultiHandlePool> multiHandlePool) :
         m_state{HTTPContentFetcherInterface::State::INITIALIZED},
         m_url{url},
+        m_multiHandlePool{std::move(multiHandlePool)},
         m_currentContentReceivedLength{0},
         m_totalContentReceivedLength{0},
         m_done{false},
@@ -342,7 +348,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
             }
             stateTransition(State::FETCHING_HEADER, true);
             m_thread = std::thread([this, headerList]() {
-                auto curlMultiHandle = CurlMultiHandleWrapper::create();
+                auto curlMultiHandle = acquireMultiHandle();
                 if (!curlMultiHandle) {
                     ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
                     // Set the promises because of errors.
@@ -403,6 +409,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
 
                 // Abort any curl operation by removing the curl handle.
                 curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+                releaseMultiHandle(std::move(curlMultiHandle));
             });
             break;
         case FetchOptions::ENTIRE_BODY:
@@ -421,7 +428,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
 
             m_thread = std::thread([this, writerWasCreatedLocally, headerList]() {
                 ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).m("start"));
-                auto curlMultiHandle = avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper::create();
+                auto curlMultiHandle = acquireMultiHandle();
                 if (!curlMultiHandle) {
                     ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
                     // Set the promises because of errors.
@@ -513,6 +520,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
 
                 // Abort any curl operation by removing the curl handle.
                 curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+                releaseMultiHandle(std::move(curlMultiHandle));
 
                 if (State::INITIALIZED == getState() || State::ERROR == getState()) {
                     ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).m("end with error"));
@@ -530,6 +538,21 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
     return nullptr;
 }
 
+std::unique_ptr<CurlMultiHandleWrapper> LibCurlHttpContentFetcher::acquireMultiHandle() {
+    if (m_multiHandlePool) {
+        return m_multiHandlePool->acquire(m_url);
+    }
+    return CurlMultiHandleWrapper::create();
+}
+
+void LibCurlHttpContentFetcher::releaseMultiHandle(std::unique_ptr<CurlMultiHandleWrapper> multiHandle) {
+    // curl closes the connection of a transfer which was removed before it completed, so what is pooled is only ever
+    // connections which can be reused.
+    if (m_multiHandlePool) {
+        m_multiHandlePool->release(m_url, std::move(multiHandle));
+    }
+}
+
 curl_slist* LibCurlHttpContentFetcher::getCustomHeaderList(std::vector<std::string> customHeaders) {
     struct curl_slist* headers = nullptr;
     for (const auto& header : customHeaders) {
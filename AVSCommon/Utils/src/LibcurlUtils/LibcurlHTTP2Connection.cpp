@@ -12,6 +12,8 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <algorithm>
+
 #include <curl/multi.h>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -38,10 +40,12 @@ static const std::string TAG("LibcurlHTTP2Connection");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// Timeout for curl_multi_wait
-const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(100);
-/// Timeout for curl_multi_wait while all non-intermittent HTTP/2 streams are paused.
-const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT(10);
+/// Longest time to wait for activity.  Requests, cancellations and resumed streams wake up the network loop, so this
+/// only bounds how long an idle connection sleeps between checks.
+const static std::chrono::milliseconds MAX_WAIT_FOR_ACTIVITY_TIMEOUT(std::chrono::minutes(1));
+/// How long a paused stream which has not been resumed waits before it is tried again, for sources and sinks which do
+/// not call @c HTTP2RequestInterface::resume().
+const static std::chrono::milliseconds PAUSED_STREAM_RETRY_INTERVAL(10);
 
 #ifdef ACSDK_OPENSSL_MIN_VER_REQUIRED
 /**
@@ -115,11 +119,15 @@ static bool performCurlChecks() {
     return true;
 }
 
-LibcurlHTTP2Connection::LibcurlHTTP2Connection() : m_isStopping{false} {
+LibcurlHTTP2Connection::LibcurlHTTP2Connection() :
+        m_networkLoopWakeUp{std::make_shared<NetworkLoopWakeUp>()},
+        m_isStopping{false} {
     m_networkThread = std::thread(&LibcurlHTTP2Connection::networkLoop, this);
 }
 
 bool LibcurlHTTP2Connection::createMultiHandle() {
+    std::lock_guard<std::mutex> lock(m_networkLoopWakeUp->mutex);
+    m_networkLoopWakeUp->multi = nullptr;
     m_multi = CurlMultiHandleWrapper::create();
     if (!m_multi) {
         ACSDK_ERROR(LX("initFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
@@ -130,10 +138,25 @@ bool LibcurlHTTP2Connection::createMultiHandle() {
         ACSDK_ERROR(LX("initFailed").d("reason", "enableHTTP2PipeliningFailed"));
         return false;
     }
+    // Keep every stream on the one connection.  Streams beyond the server's SETTINGS_MAX_CONCURRENT_STREAMS then wait
+    // for a stream to finish, rather than opening another connection to the server.
+    if (curl_multi_setopt(m_multi->getCurlHandle(), CURLMOPT_MAX_HOST_CONNECTIONS, 1L) != CURLM_OK) {
+        m_multi.reset();
+        ACSDK_ERROR(LX("initFailed").d("reason", "setMaxHostConnectionsFailed"));
+        return false;
+    }
+    m_networkLoopWakeUp->multi = m_multi.get();
 
     return true;
 }
 
+void LibcurlHTTP2Connection::NetworkLoopWakeUp::wakeUp() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (multi) {
+        multi->wakeup();
+    }
+}
+
 std::shared_ptr<LibcurlHTTP2Connection> LibcurlHTTP2Connection::create() {
     if (!performCurlChecks()) {
         return nullptr;
@@ -155,6 +178,7 @@ void LibcurlHTTP2Connection::setIsStopping() {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_isStopping = true;
     m_cv.notify_one();
+    m_networkLoopWakeUp->wakeUp();
 }
 
 std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
@@ -225,40 +249,25 @@ void LibcurlHTTP2Connection::networkLoop() {
 
             processNextRequest();
 
-            auto before = std::chrono::time_point<std::chrono::steady_clock>::max();
-            auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
-            bool paused = areStreamsPaused();
-            if (paused) {
-                multiWaitTimeout = WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT;
-                before = std::chrono::steady_clock::now();
-            }
-
+            // Wait for socket activity, or for addStream(), cancel() or resume() to wake us up.  Paused streams do
+            // not make this return early, so there is no need to sleep to give their sources time to catch up.
             int numTransfersUpdated = 0;
-            result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated);
+            result = m_multi->poll(getWaitForActivityTimeout(), &numTransfersUpdated);
             if (result != CURLM_OK) {
                 ACSDK_ERROR(
-                    LX("networkLoopStopping").d("reason", "multiWaitFailed").d("error", curl_multi_strerror(result)));
+                    LX("networkLoopStopping").d("reason", "multiPollFailed").d("error", curl_multi_strerror(result)));
                 setIsStopping();
                 break;
             }
 
-            // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
-            // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause
-            // transfers to give the readers / writers time to catch up, we must perform a local sleep of our own.
-            if (paused) {
-                auto after = std::chrono::steady_clock::now();
-                auto elapsed = after - before;
-                auto remaining = multiWaitTimeout - elapsed;
-
-                // sanity check that remainingMs is valid before performing a sleep.
-                if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
-                    std::this_thread::sleep_for(remaining);
-                }
-            }
             unPauseActiveStreams();
         }
         cancelAllStreams();
-        m_multi.reset();
+        {
+            std::lock_guard<std::mutex> lock(m_networkLoopWakeUp->mutex);
+            m_networkLoopWakeUp->multi = nullptr;
+            m_multi.reset();
+        }
     }
 
     ACSDK_DEBUG5(LX("networkLoopExiting"));
@@ -266,6 +275,8 @@ void LibcurlHTTP2Connection::networkLoop() {
 
 std::shared_ptr<HTTP2RequestInterface> LibcurlHTTP2Connection::createAndSendRequest(const HTTP2RequestConfig& config) {
     auto req = std::make_shared<LibcurlHTTP2Request>(config, config.getId());
+    auto networkLoopWakeUp = m_networkLoopWakeUp;
+    req->setWakeUpNetworkLoop([networkLoopWakeUp] { networkLoopWakeUp->wakeUp(); });
     addStream(req);
     return req;
 }
@@ -317,6 +328,7 @@ bool LibcurlHTTP2Connection::addStream(std::shared_ptr<LibcurlHTTP2Request> stre
     }
     m_requestQueue.push_back(std::move(stream));
     m_cv.notify_one();
+    m_networkLoopWakeUp->wakeUp();
     return true;
 }
 
@@ -362,25 +374,42 @@ void LibcurlHTTP2Connection::cleanupCancelledAndStalledStreams() {
     }
 }
 
-bool LibcurlHTTP2Connection::areStreamsPaused() {
-    size_t numberNonIntermittentStreams = 0;
-    size_t numberPausedStreams = 0;
-    for (const auto& entry : m_activeStreams) {
-        const auto& stream = entry.second;
-        if (!stream->isIntermittentTransferExpected()) {
-            numberNonIntermittentStreams++;
-            if (entry.second->isPaused()) {
-                numberPausedStreams++;
-            }
+void LibcurlHTTP2Connection::unPauseActiveStreams() {
+    auto now = std::chrono::steady_clock::now();
+    for (auto& entry : m_activeStreams) {
+        auto& stream = entry.second;
+        // Always take the resume request, so that one made while the stream was running is not applied later.
+        auto isResumeRequested = stream->takeResumeRequest();
+        if (stream->isPaused() &&
+            (isResumeRequested || now >= stream->getTimeOfLastTransfer() + PAUSED_STREAM_RETRY_INTERVAL)) {
+            stream->unPause();
         }
     }
-    return numberPausedStreams > 0 && (numberPausedStreams == numberNonIntermittentStreams);
 }
 
-void LibcurlHTTP2Connection::unPauseActiveStreams() {
-    for (auto& stream : m_activeStreams) {
-        stream.second->unPause();
+std::chrono::milliseconds LibcurlHTTP2Connection::getWaitForActivityTimeout() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_requestQueue.empty()) {
+            return std::chrono::milliseconds::zero();
+        }
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto deadline = now + MAX_WAIT_FOR_ACTIVITY_TIMEOUT;
+    for (const auto& entry : m_activeStreams) {
+        const auto& stream = entry.second;
+        if (stream->isPaused()) {
+            deadline = std::min(deadline, stream->getTimeOfLastTransfer() + PAUSED_STREAM_RETRY_INTERVAL);
+        }
+        if (stream->getActivityTimeout() != std::chrono::milliseconds::zero()) {
+            deadline = std::min(deadline, stream->getTimeOfLastTransfer() + stream->getActivityTimeout());
+        }
+    }
+    if (deadline <= now) {
+        return std::chrono::milliseconds::zero();
     }
+    // Round up, so that the deadline has passed when the wait times out.
+    return std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1);
 }
 
 bool LibcurlHTTP2Connection::cancelStream(LibcurlHTTP2Request& stream) {
@@ -144,7 +144,8 @@ LibcurlHTTP2Request::LibcurlHTTP2Request(
         m_stream{std::move(id)},
         m_isIntermittentTransferExpected{config.isIntermittentTransferExpected()},
         m_isPaused{false},
-        m_isCancelled{false} {
+        m_isCancelled{false},
+        m_isResumeRequested{false} {
     switch (config.getRequestType()) {
         case HTTP2RequestType::GET:
             m_stream.setTransferType(CurlEasyHandleWrapper::TransferType::kGET);
@@ -159,6 +160,8 @@ LibcurlHTTP2Request::LibcurlHTTP2Request(
     m_stream.setHeaderCallback(LibcurlHTTP2Request::headerCallback, this);
     m_stream.setopt(CURLOPT_TCP_KEEPALIVE, 1);
     m_stream.setopt(CURLOPT_STREAM_WEIGHT, config.getPriority());
+    // Wait for the connection to the server to be known to multiplex, instead of opening another one.
+    m_stream.setopt(CURLOPT_PIPEWAIT, 1L);
 
     if (config.getSource()) {
         m_source = config.getSource();
@@ -200,15 +203,41 @@ bool LibcurlHTTP2Request::isPaused() const {
     return m_isPaused;
 }
 
+bool LibcurlHTTP2Request::takeResumeRequest() {
+    return m_isResumeRequested.exchange(false);
+}
+
+std::chrono::steady_clock::time_point LibcurlHTTP2Request::getTimeOfLastTransfer() const {
+    return m_timeOfLastTransfer;
+}
+
+std::chrono::milliseconds LibcurlHTTP2Request::getActivityTimeout() const {
+    return m_activityTimeout;
+}
+
 bool LibcurlHTTP2Request::isCancelled() const {
     return m_isCancelled;
 }
 
 bool LibcurlHTTP2Request::cancel() {
     m_isCancelled = true;
+    if (m_wakeUpNetworkLoop) {
+        m_wakeUpNetworkLoop();
+    }
     return true;
 }
 
+void LibcurlHTTP2Request::resume() {
+    m_isResumeRequested = true;
+    if (m_wakeUpNetworkLoop) {
+        m_wakeUpNetworkLoop();
+    }
+}
+
+void LibcurlHTTP2Request::setWakeUpNetworkLoop(std::function<void()> wakeUpNetworkLoop) {
+    m_wakeUpNetworkLoop = std::move(wakeUpNetworkLoop);
+}
+
 std::string LibcurlHTTP2Request::getId() const {
     return m_stream.getId();
 }
@@ -0,0 +1,358 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogWriter.h"
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+#include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
+#include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+using namespace avsCommon::utils::metrics;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AsyncLogWriter");
+
+/// Name of the event logged and the metric recorded when entries have been dropped.
+static const std::string LOG_ENTRIES_DROPPED = "logEntriesDropped";
+
+/// Activity name of the metric recorded when entries have been dropped.
+static const std::string LOG_ENTRIES_DROPPED_ACTIVITY = TAG + "-" + LOG_ENTRIES_DROPPED;
+
+/// Name of the @c OverflowPolicy::DROP policy in configuration.
+static const std::string DROP_POLICY_NAME = "DROP";
+
+/// Name of the @c OverflowPolicy::BLOCK policy in configuration.
+static const std::string BLOCK_POLICY_NAME = "BLOCK";
+
+/// The largest ring a writer may be created with.
+static const size_t MAX_CAPACITY = 1 << 20;
+
+/// How long a blocked producer waits before checking the ring again.
+static const std::chrono::milliseconds BLOCKED_PRODUCER_RECHECK_INTERVAL(10);
+
+/// The line terminator written after each entry.
+static const char NEWLINE = '\n';
+
+/// Whether the calling thread is the background thread of an @c AsyncLogWriter, whose own entries must never block.
+static thread_local bool s_isConsumerThread = false;
+
+std::unique_ptr<AsyncLogWriter> AsyncLogWriter::create(int fd, size_t capacity, OverflowPolicy policy) {
+    if (fd < 0 || 0 == capacity || capacity > MAX_CAPACITY) {
+        return nullptr;
+    }
+    size_t slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    return std::unique_ptr<AsyncLogWriter>(new AsyncLogWriter(fd, slots, policy));
+}
+
+AsyncLogWriter::AsyncLogWriter(int fd, size_t capacity, OverflowPolicy policy) :
+        m_fd{fd},
+        m_policy{policy},
+        m_mask{capacity - 1},
+        m_slots{new Slot[capacity]},
+        m_enqueuePosition{0},
+        m_dequeuePosition{0},
+        m_writtenPosition{0},
+        m_consumerWaiting{false},
+        m_writtenWaiters{0},
+        m_droppedCount{0},
+        m_reportedDroppedCount{0},
+        m_shutdown{false} {
+    for (size_t i = 0; i < capacity; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_thread = std::thread(&AsyncLogWriter::consumerLoop, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    m_shutdown = true;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entriesAvailable.notify_one();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool AsyncLogWriter::push(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    uint64_t position = 0;
+    bool block = OverflowPolicy::BLOCK == m_policy && !s_isConsumerThread;
+    if (!claimSlot(block, &position)) {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Slot& slot = m_slots[position & m_mask];
+    slot.level = level;
+    slot.time = time;
+    std::strncpy(slot.threadMoniker, threadMoniker ? threadMoniker : "", sizeof(slot.threadMoniker) - 1);
+    slot.threadMoniker[sizeof(slot.threadMoniker) - 1] = '\0';
+    if (!text) {
+        text = "";
+    }
+    slot.length = std::strlen(text);
+    if (slot.length < INLINE_TEXT_SIZE) {
+        std::memcpy(slot.text, text, slot.length + 1);
+    } else {
+        // assign() reuses the capacity left by earlier long entries in this slot.
+        slot.longText.assign(text, slot.length);
+    }
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    wakeConsumer();
+    return true;
+}
+
+bool AsyncLogWriter::claimSlot(bool block, uint64_t* position) {
+    uint64_t candidate = m_enqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = m_slots[candidate & m_mask];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == candidate) {
+            if (m_enqueuePosition.compare_exchange_weak(candidate, candidate + 1, std::memory_order_relaxed)) {
+                *position = candidate;
+                return true;
+            }
+        } else if (sequence < candidate) {
+            // The slot still holds an entry from the previous lap, so the ring is full.
+            if (!block || m_shutdown) {
+                return false;
+            }
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_writtenWaiters++;
+            if (slot.sequence.load() < candidate) {
+                m_entriesWritten.wait_for(lock, BLOCKED_PRODUCER_RECHECK_INTERVAL);
+            }
+            m_writtenWaiters--;
+            candidate = m_enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            candidate = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void AsyncLogWriter::wakeConsumer() {
+    // Pairs with the fence in consumerLoop(): either the consumer sees the published entry, or we see it waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumerWaiting.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entriesAvailable.notify_one();
+    }
+}
+
+void AsyncLogWriter::consumerLoop() {
+    s_isConsumerThread = true;
+    ThreadMoniker::setThisThreadMoniker("AL");
+
+    auto isReady = [this](uint64_t position) {
+        return m_slots[position & m_mask].sequence.load(std::memory_order_acquire) == position + 1;
+    };
+
+    while (true) {
+        size_t count = 0;
+        while (count < MAX_BATCH_SIZE && isReady(m_dequeuePosition + count)) {
+            ++count;
+        }
+        if (count > 0) {
+            writeBatch(m_dequeuePosition, count);
+            continue;
+        }
+        if (m_droppedCount.load(std::memory_order_relaxed) != m_reportedDroppedCount) {
+            reportDrops();
+            continue;
+        }
+        if (m_shutdown) {
+            if (m_enqueuePosition.load() == m_dequeuePosition) {
+                return;
+            }
+            // A producer has claimed a slot but not yet published it.
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_consumerWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_entriesAvailable.wait(lock, [this, &isReady] {
+            return m_shutdown || isReady(m_dequeuePosition) ||
+                   m_droppedCount.load(std::memory_order_relaxed) != m_reportedDroppedCount;
+        });
+        m_consumerWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogWriter::writeBatch(uint64_t first, size_t count) {
+    std::vector<std::string> lines;
+    lines.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Slot& slot = m_slots[(first + i) & m_mask];
+        const char* text = slot.length < INLINE_TEXT_SIZE ? slot.text : slot.longText.c_str();
+        lines.push_back(m_formatter.format(slot.level, slot.time, slot.threadMoniker, text));
+        slot.sequence.store(first + i + m_mask + 1, std::memory_order_release);
+    }
+    m_dequeuePosition = first + count;
+
+    // Slots are free again; let blocked producers in before spending time in writev().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_writtenWaiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entriesWritten.notify_all();
+    }
+
+    std::vector<iovec> iov;
+    iov.reserve(count * 2);
+    for (const auto& line : lines) {
+        iov.push_back({const_cast<char*>(line.data()), line.size()});
+        iov.push_back({const_cast<char*>(&NEWLINE), 1});
+    }
+    size_t next = 0;
+    while (next < iov.size()) {
+        int iovCount = static_cast<int>(std::min<size_t>(iov.size() - next, IOV_MAX));
+        ssize_t written = writev(m_fd, &iov[next], iovCount);
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            // Nowhere left to report the failure; drop the rest of the batch.
+            break;
+        }
+        // Skip the fully written buffers and trim a partially written one.
+        size_t remaining = static_cast<size_t>(written);
+        while (next < iov.size() && remaining >= iov[next].iov_len) {
+            remaining -= iov[next].iov_len;
+            ++next;
+        }
+        if (remaining > 0) {
+            iov[next].iov_base = static_cast<char*>(iov[next].iov_base) + remaining;
+            iov[next].iov_len -= remaining;
+        }
+    }
+
+    m_writtenPosition.store(m_dequeuePosition);
+    if (m_writtenWaiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entriesWritten.notify_all();
+    }
+}
+
+void AsyncLogWriter::writeLine(const std::string& line) {
+    iovec iov[2] = {{const_cast<char*>(line.data()), line.size()}, {const_cast<char*>(&NEWLINE), 1}};
+    size_t next = 0;
+    while (next < 2) {
+        ssize_t written = writev(m_fd, &iov[next], static_cast<int>(2 - next));
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return;
+        }
+        size_t remaining = static_cast<size_t>(written);
+        while (next < 2 && remaining >= iov[next].iov_len) {
+            remaining -= iov[next].iov_len;
+            ++next;
+        }
+        if (remaining > 0) {
+            iov[next].iov_base = static_cast<char*>(iov[next].iov_base) + remaining;
+            iov[next].iov_len -= remaining;
+        }
+    }
+}
+
+void AsyncLogWriter::reportDrops() {
+    uint64_t dropped = m_droppedCount.load(std::memory_order_relaxed);
+    uint64_t count = dropped - m_reportedDroppedCount;
+    m_reportedDroppedCount = dropped;
+
+    LogEntry entry(TAG, LOG_ENTRIES_DROPPED);
+    entry.d("count", count).d("total", dropped);
+    writeLine(m_formatter.format(
+        Level::WARN,
+        std::chrono::system_clock::now(),
+        ThreadMoniker::getThisThreadMoniker().c_str(),
+        entry.c_str()));
+
+    std::shared_ptr<MetricRecorderInterface> metricRecorder;
+    {
+        std::lock_guard<std::mutex> lock(m_metricRecorderMutex);
+        metricRecorder = m_metricRecorder;
+    }
+    recordMetric(
+        metricRecorder,
+        MetricEventBuilder{}
+            .setActivityName(LOG_ENTRIES_DROPPED_ACTIVITY)
+            .addDataPoint(DataPointCounterBuilder{}.setName(LOG_ENTRIES_DROPPED).increment(count).build())
+            .build());
+}
+
+void AsyncLogWriter::flush() {
+    if (s_isConsumerThread) {
+        return;
+    }
+    uint64_t target = m_enqueuePosition.load();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_writtenWaiters++;
+    m_entriesWritten.wait(lock, [this, target] { return m_writtenPosition.load() >= target; });
+    m_writtenWaiters--;
+}
+
+uint64_t AsyncLogWriter::getDroppedCount() const {
+    return m_droppedCount.load();
+}
+
+void AsyncLogWriter::setMetricRecorder(std::shared_ptr<MetricRecorderInterface> metricRecorder) {
+    std::lock_guard<std::mutex> lock(m_metricRecorderMutex);
+    m_metricRecorder = std::move(metricRecorder);
+}
+
+bool AsyncLogWriter::convertNameToOverflowPolicy(const std::string& name, OverflowPolicy* policy) {
+    if (!policy) {
+        return false;
+    }
+    if (DROP_POLICY_NAME == name) {
+        *policy = OverflowPolicy::DROP;
+        return true;
+    }
+    if (BLOCK_POLICY_NAME == name) {
+        *policy = OverflowPolicy::BLOCK;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,423 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/BinaryFileLogger.h"
+#include "AVSCommon/Utils/Logger/BinaryLogFormat.h"
+#include "AVSCommon/Utils/Logger/ConsoleLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+using namespace binaryLog;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("BinaryFileLogger");
+
+/// Configuration key for BinaryFileLogger settings.
+static const std::string CONFIG_KEY_BINARY_FILE_LOGGER = "binaryFileLogger";
+
+/// Separates the sections of a @c LogEntry's text.
+static const char SECTION_SEPARATOR = ':';
+
+/// Separates metadata pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Separates a metadata key from its value.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+/// Escapes the next character of a metadata value.
+static const char METADATA_ESCAPE = '\\';
+
+/// Text of a @c true metadata value.
+static const std::string BOOL_TRUE = "true";
+
+/// Text of a @c false metadata value.
+static const std::string BOOL_FALSE = "false";
+
+/// The most digits of an integer value that is stored in binary; longer ones may not fit an @c int64_t.
+static const size_t MAX_INTEGER_DIGITS = 18;
+
+/**
+ * Write a little-endian integer.
+ *
+ * @param value The value.
+ * @param size The number of bytes to write.
+ * @param[out] out Where to write.
+ */
+static void writeLittleEndian(uint64_t value, size_t size, uint8_t* out) {
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+/**
+ * Parse a decimal integer that @c LogEntry would print exactly the same way, so it can be stored in binary.
+ *
+ * @param begin The start of the text.
+ * @param length The length of the text.
+ * @param[out] value The value.
+ * @return Whether the text is such an integer.
+ */
+static bool parseCanonicalInteger(const char* begin, size_t length, int64_t* value) {
+    bool negative = length > 0 && '-' == begin[0];
+    const char* digits = negative ? begin + 1 : begin;
+    size_t count = negative ? length - 1 : length;
+    if (0 == count || count > MAX_INTEGER_DIGITS || ('0' == digits[0] && (count > 1 || negative))) {
+        return false;
+    }
+    int64_t result = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (digits[i] < '0' || digits[i] > '9') {
+            return false;
+        }
+        result = result * 10 + (digits[i] - '0');
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+struct BinaryFileLogger::ParsedText {
+    /// Whether the text has the form built by @c LogEntry.
+    bool isStructured;
+
+    /// The @c binaryLog flags of the entry.
+    uint8_t flags;
+
+    /// The sections of the text, as (start, length) pairs: source, event, then key and value of each metadata pair.
+    std::vector<std::pair<const char*, size_t>> sections;
+
+    /// The type of each metadata value, and the value of those stored as an integer.
+    std::vector<std::pair<ValueType, int64_t>> values;
+
+    /// The message.
+    std::pair<const char*, size_t> message;
+};
+
+std::shared_ptr<Logger> BinaryFileLogger::instance() {
+    static std::shared_ptr<Logger> singleBinaryFileLogger = std::shared_ptr<BinaryFileLogger>(new BinaryFileLogger);
+    return singleBinaryFileLogger;
+}
+
+std::unique_ptr<BinaryFileLogger> BinaryFileLogger::create(
+    const std::string& path,
+    size_t fileSize,
+    size_t fileCount) {
+    std::unique_ptr<BinaryFileLogger> logger(new BinaryFileLogger);
+    if (!logger->open(path, fileSize, fileCount)) {
+        return nullptr;
+    }
+    return logger;
+}
+
+BinaryFileLogger::BinaryFileLogger() :
+        Logger(Level::UNKNOWN),
+        m_fileSize{0},
+        m_fileCount{0},
+        m_fd{-1},
+        m_map{nullptr},
+        m_offset{0},
+        m_previousTicks{0} {
+#ifdef DEBUG
+    setLevel(Level::DEBUG0);
+#else
+    setLevel(Level::INFO);
+#endif  // DEBUG
+    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_BINARY_FILE_LOGGER]);
+}
+
+BinaryFileLogger::~BinaryFileLogger() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    closeFileLocked();
+}
+
+void BinaryFileLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (!text) {
+        text = "";
+    }
+    if (!threadMoniker) {
+        threadMoniker = "";
+    }
+    // Reused by each thread, so that parsing allocates only for the largest entry the thread has logged.
+    static thread_local ParsedText parsed;
+    parse(text, &parsed);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_map) {
+        lock.unlock();
+        getConsoleLogger()->emit(level, time, threadMoniker, text);
+        return;
+    }
+
+    int64_t ticks = static_cast<int64_t>(time.time_since_epoch().count());
+    encodeLocked(level, ticks, threadMoniker, text, parsed);
+    if (m_offset + m_definitions.size() + m_entry.size() > m_fileSize) {
+        if (!openFileLocked()) {
+            return;
+        }
+        encodeLocked(level, ticks, threadMoniker, text, parsed);
+        if (m_offset + m_definitions.size() + m_entry.size() > m_fileSize) {
+            // Too large for any file. The strings it interned were never written, so forget them.
+            m_stringIds.clear();
+            return;
+        }
+    }
+    std::memcpy(m_map + m_offset, m_definitions.data(), m_definitions.size());
+    m_offset += m_definitions.size();
+    std::memcpy(m_map + m_offset, m_entry.data(), m_entry.size());
+    m_offset += m_entry.size();
+    m_previousTicks = ticks;
+}
+
+bool BinaryFileLogger::open(const std::string& path, size_t fileSize, size_t fileCount) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_map) {
+        return true;
+    }
+    if (path.empty() || fileSize < MIN_FILE_SIZE || 0 == fileCount) {
+        return false;
+    }
+    m_path = path;
+    m_fileSize = fileSize;
+    m_fileCount = fileCount;
+    return openFileLocked();
+}
+
+void BinaryFileLogger::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_map) {
+        msync(m_map, m_fileSize, MS_ASYNC);
+    }
+}
+
+void BinaryFileLogger::encodeLocked(
+    Level level,
+    int64_t ticks,
+    const char* threadMoniker,
+    const char* text,
+    const ParsedText& parsed) {
+    m_definitions.clear();
+    m_entry.clear();
+
+    m_entry.push_back(static_cast<char>(parsed.isStructured ? RecordType::ENTRY : RecordType::TEXT));
+    m_entry.push_back(convertLevelToChar(level));
+    appendVarint(zigzagEncode(ticks - m_previousTicks), &m_entry);
+    appendStringIdLocked(threadMoniker, std::strlen(threadMoniker));
+    if (!parsed.isStructured) {
+        size_t length = std::strlen(text);
+        appendVarint(length, &m_entry);
+        m_entry.append(text, length);
+        return;
+    }
+
+    const auto& sections = parsed.sections;
+    appendStringIdLocked(sections[0].first, sections[0].second);
+    appendStringIdLocked(sections[1].first, sections[1].second);
+    m_entry.push_back(static_cast<char>(parsed.flags));
+    if (parsed.flags & FLAG_METADATA) {
+        appendVarint(parsed.values.size(), &m_entry);
+        for (size_t i = 0; i < parsed.values.size(); ++i) {
+            const auto& key = sections[2 + 2 * i];
+            const auto& value = sections[3 + 2 * i];
+            auto type = parsed.values[i].first;
+            appendStringIdLocked(key.first, key.second);
+            m_entry.push_back(static_cast<char>(type));
+            if (ValueType::INTEGER == type) {
+                appendVarint(zigzagEncode(parsed.values[i].second), &m_entry);
+            } else if (ValueType::STRING == type) {
+                appendVarint(value.second, &m_entry);
+                m_entry.append(value.first, value.second);
+            }
+        }
+    }
+    if (parsed.flags & FLAG_MESSAGE) {
+        appendVarint(parsed.message.second, &m_entry);
+        m_entry.append(parsed.message.first, parsed.message.second);
+    }
+}
+
+/**
+ * Find how a metadata value is stored.
+ *
+ * @param value The start of the value.
+ * @param length The length of the value.
+ * @return The type the value is stored as, and its value if that is @c ValueType::INTEGER.
+ */
+static std::pair<ValueType, int64_t> classifyValue(const char* value, size_t length) {
+    int64_t integer = 0;
+    if (BOOL_TRUE.size() == length && 0 == BOOL_TRUE.compare(0, length, value, length)) {
+        return {ValueType::TRUE_VALUE, 0};
+    } else if (BOOL_FALSE.size() == length && 0 == BOOL_FALSE.compare(0, length, value, length)) {
+        return {ValueType::FALSE_VALUE, 0};
+    } else if (parseCanonicalInteger(value, length, &integer)) {
+        return {ValueType::INTEGER, integer};
+    }
+    return {ValueType::STRING, 0};
+}
+
+void BinaryFileLogger::parse(const char* text, ParsedText* parsed) {
+    auto& sections = parsed->sections;
+    sections.clear();
+    parsed->values.clear();
+    parsed->flags = 0;
+    parsed->isStructured = false;
+
+    const char* separator = std::strchr(text, SECTION_SEPARATOR);
+    if (!separator) {
+        return;
+    }
+    sections.emplace_back(text, separator - text);
+    const char* position = separator + 1;
+    separator = std::strchr(position, SECTION_SEPARATOR);
+    if (!separator) {
+        sections.emplace_back(position, std::strlen(position));
+        parsed->isStructured = true;
+        return;
+    }
+    sections.emplace_back(position, separator - position);
+    position = separator + 1;
+    parsed->flags |= FLAG_METADATA;
+
+    // An empty metadata section, as LogEntry::m() writes when no metadata precedes the message.
+    if (SECTION_SEPARATOR == *position) {
+        parsed->flags |= FLAG_MESSAGE;
+        parsed->message = std::make_pair(position + 1, std::strlen(position + 1));
+        parsed->isStructured = true;
+        return;
+    }
+    while ('\0' != *position) {
+        const char* key = position;
+        while (*position != KEY_VALUE_SEPARATOR) {
+            if ('\0' == *position || PAIR_SEPARATOR == *position || SECTION_SEPARATOR == *position) {
+                return;
+            }
+            ++position;
+        }
+        sections.emplace_back(key, position - key);
+        const char* value = ++position;
+        while ('\0' != *position && PAIR_SEPARATOR != *position && SECTION_SEPARATOR != *position) {
+            if (METADATA_ESCAPE == *position && '\0' == *++position) {
+                return;
+            }
+            ++position;
+        }
+        sections.emplace_back(value, position - value);
+        parsed->values.push_back(classifyValue(value, position - value));
+        if (PAIR_SEPARATOR == *position) {
+            ++position;
+            if ('\0' == *position) {
+                return;
+            }
+        } else if (SECTION_SEPARATOR == *position) {
+            parsed->flags |= FLAG_MESSAGE;
+            parsed->message = std::make_pair(position + 1, std::strlen(position + 1));
+            parsed->isStructured = true;
+            return;
+        }
+    }
+    parsed->isStructured = true;
+}
+
+void BinaryFileLogger::appendStringIdLocked(const char* begin, size_t length) {
+    m_lookupKey.assign(begin, length);
+    auto it = m_stringIds.find(m_lookupKey);
+    if (it != m_stringIds.end()) {
+        appendVarint(it->second, &m_entry);
+        return;
+    }
+    uint64_t id = m_stringIds.size();
+    m_stringIds.emplace(m_lookupKey, id);
+    m_definitions.push_back(static_cast<char>(RecordType::STRING));
+    appendVarint(length, &m_definitions);
+    m_definitions.append(begin, length);
+    appendVarint(id, &m_entry);
+}
+
+bool BinaryFileLogger::openFileLocked() {
+    closeFileLocked();
+
+    for (size_t i = m_fileCount - 1; i > 0; --i) {
+        std::string from = 1 == i ? m_path : m_path + "." + std::to_string(i - 1);
+        std::string to = m_path + "." + std::to_string(i);
+        // The older file may not exist yet.
+        std::rename(from.c_str(), to.c_str());
+    }
+
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0 || ftruncate(m_fd, static_cast<off_t>(m_fileSize)) != 0) {
+        int error = errno;
+        closeFileLocked();
+        // Log without ACSDK_* macros, which may lead back to this logger.
+        getConsoleLogger()->log(Level::ERROR, LogEntry(TAG, "openFileFailed").d("path", m_path).d("errno", error));
+        return false;
+    }
+    void* map = mmap(nullptr, m_fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (MAP_FAILED == map) {
+        int error = errno;
+        closeFileLocked();
+        getConsoleLogger()->log(Level::ERROR, LogEntry(TAG, "mmapFailed").d("path", m_path).d("errno", error));
+        return false;
+    }
+    m_map = static_cast<uint8_t*>(map);
+
+    std::memcpy(m_map, MAGIC, sizeof(MAGIC));
+    writeLittleEndian(VERSION, 4, m_map + 8);
+    writeLittleEndian(HEADER_SIZE, 4, m_map + 12);
+    writeLittleEndian(std::chrono::system_clock::period::num, 8, m_map + 16);
+    writeLittleEndian(std::chrono::system_clock::period::den, 8, m_map + 24);
+    m_offset = HEADER_SIZE;
+    m_previousTicks = 0;
+    m_stringIds.clear();
+    return true;
+}
+
+void BinaryFileLogger::closeFileLocked() {
+    if (m_map) {
+        munmap(m_map, m_fileSize);
+        m_map = nullptr;
+        // Give back the unused, zero-filled tail of the file.
+        if (ftruncate(m_fd, static_cast<off_t>(m_offset)) != 0) {
+            m_offset = 0;
+        }
+    }
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+std::shared_ptr<Logger> getBinaryFileLogger() {
+    return BinaryFileLogger::instance();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
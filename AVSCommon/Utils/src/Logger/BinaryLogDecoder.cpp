@@ -0,0 +1,287 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/BinaryLogDecoder.h"
+#include "AVSCommon/Utils/Logger/BinaryLogFormat.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+using namespace binaryLog;
+
+/// Separates the sections of a @c LogEntry's text.
+static const char SECTION_SEPARATOR = ':';
+
+/// Separates metadata pairs.
+static const char PAIR_SEPARATOR = ',';
+
+/// Separates a metadata key from its value.
+static const char KEY_VALUE_SEPARATOR = '=';
+
+/// Text of a @c true metadata value.
+static const std::string BOOL_TRUE = "true";
+
+/// Text of a @c false metadata value.
+static const std::string BOOL_FALSE = "false";
+
+/// Number of nanoseconds per second.
+static const long double NANOSECONDS_PER_SECOND = 1e9;
+
+/// Reads the fields of a binary log. Each read method returns @c false if the data ends before the field does.
+class BinaryLogReader {
+public:
+    BinaryLogReader(const uint8_t* data, size_t size) : m_position{data}, m_end{data + size} {
+    }
+
+    /// Whether all data has been read.
+    bool atEnd() const {
+        return m_position == m_end;
+    }
+
+    /// Read one byte.
+    bool readByte(uint8_t* value) {
+        if (atEnd()) {
+            return false;
+        }
+        *value = *m_position++;
+        return true;
+    }
+
+    /// Read a varint.
+    bool readVarint(uint64_t* value) {
+        uint64_t result = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = 0;
+            if (!readByte(&byte)) {
+                return false;
+            }
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                *value = result;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Read a little-endian integer of @c size bytes.
+    bool readLittleEndian(size_t size, uint64_t* value) {
+        if (static_cast<size_t>(m_end - m_position) < size) {
+            return false;
+        }
+        *value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            *value |= static_cast<uint64_t>(m_position[i]) << (8 * i);
+        }
+        m_position += size;
+        return true;
+    }
+
+    /// Read a length-prefixed string.
+    bool readString(std::string* value) {
+        uint64_t length = 0;
+        if (!readVarint(&length) || static_cast<uint64_t>(m_end - m_position) < length) {
+            return false;
+        }
+        value->assign(reinterpret_cast<const char*>(m_position), static_cast<size_t>(length));
+        m_position += length;
+        return true;
+    }
+
+    /// Skip @c size bytes.
+    bool skip(size_t size) {
+        if (static_cast<size_t>(m_end - m_position) < size) {
+            return false;
+        }
+        m_position += size;
+        return true;
+    }
+
+private:
+    /// The next byte to read.
+    const uint8_t* m_position;
+
+    /// The end of the data.
+    const uint8_t* m_end;
+};
+
+/**
+ * Convert a level character as written by @c convertLevelToChar() back to a @c Level.
+ *
+ * @param character The character.
+ * @return The level, or @c Level::UNKNOWN.
+ */
+static Level convertCharToLevel(char character) {
+    for (int i = static_cast<int>(Level::DEBUG9); i <= static_cast<int>(Level::UNKNOWN); ++i) {
+        if (convertLevelToChar(static_cast<Level>(i)) == character) {
+            return static_cast<Level>(i);
+        }
+    }
+    return Level::UNKNOWN;
+}
+
+bool BinaryLogDecoder::decode(const uint8_t* data, size_t size, std::ostream& out) {
+    BinaryLogReader reader(data, size);
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 || !reader.skip(sizeof(MAGIC))) {
+        return false;
+    }
+    uint64_t version = 0;
+    uint64_t headerSize = 0;
+    uint64_t periodNum = 0;
+    uint64_t periodDen = 0;
+    if (!reader.readLittleEndian(4, &version) || version != VERSION || !reader.readLittleEndian(4, &headerSize) ||
+        !reader.readLittleEndian(8, &periodNum) || !reader.readLittleEndian(8, &periodDen) || 0 == periodDen ||
+        headerSize < HEADER_SIZE || !reader.skip(headerSize - HEADER_SIZE)) {
+        return false;
+    }
+    long double nanosecondsPerTick = static_cast<long double>(periodNum) * NANOSECONDS_PER_SECOND / periodDen;
+
+    LogStringFormatter formatter;
+    std::vector<std::string> strings;
+    int64_t ticks = 0;
+    std::string text;
+    std::string value;
+
+    auto readStringId = [&reader, &strings](const std::string** string) {
+        uint64_t id = 0;
+        if (!reader.readVarint(&id) || id >= strings.size()) {
+            return false;
+        }
+        *string = &strings[static_cast<size_t>(id)];
+        return true;
+    };
+
+    while (!reader.atEnd()) {
+        uint8_t type = 0;
+        reader.readByte(&type);
+        if (static_cast<uint8_t>(RecordType::END) == type) {
+            return true;
+        }
+        if (static_cast<uint8_t>(RecordType::STRING) == type) {
+            strings.emplace_back();
+            if (!reader.readString(&strings.back())) {
+                return false;
+            }
+            continue;
+        }
+        if (type != static_cast<uint8_t>(RecordType::ENTRY) && type != static_cast<uint8_t>(RecordType::TEXT)) {
+            return false;
+        }
+
+        uint8_t levelChar = 0;
+        uint64_t delta = 0;
+        const std::string* moniker = nullptr;
+        if (!reader.readByte(&levelChar) || !reader.readVarint(&delta) || !readStringId(&moniker)) {
+            return false;
+        }
+        ticks += zigzagDecode(delta);
+
+        if (static_cast<uint8_t>(RecordType::TEXT) == type) {
+            if (!reader.readString(&text)) {
+                return false;
+            }
+        } else {
+            const std::string* source = nullptr;
+            const std::string* event = nullptr;
+            uint8_t flags = 0;
+            if (!readStringId(&source) || !readStringId(&event) || !reader.readByte(&flags)) {
+                return false;
+            }
+            text = *source;
+            text += SECTION_SEPARATOR;
+            text += *event;
+            if (flags & FLAG_METADATA) {
+                text += SECTION_SEPARATOR;
+                uint64_t count = 0;
+                if (!reader.readVarint(&count)) {
+                    return false;
+                }
+                for (uint64_t i = 0; i < count; ++i) {
+                    const std::string* key = nullptr;
+                    uint8_t valueType = 0;
+                    if (!readStringId(&key) || !reader.readByte(&valueType)) {
+                        return false;
+                    }
+                    if (i > 0) {
+                        text += PAIR_SEPARATOR;
+                    }
+                    text += *key;
+                    text += KEY_VALUE_SEPARATOR;
+                    switch (static_cast<ValueType>(valueType)) {
+                        case ValueType::STRING:
+                            if (!reader.readString(&value)) {
+                                return false;
+                            }
+                            text += value;
+                            break;
+                        case ValueType::INTEGER: {
+                            uint64_t integer = 0;
+                            if (!reader.readVarint(&integer)) {
+                                return false;
+                            }
+                            text += std::to_string(zigzagDecode(integer));
+                            break;
+                        }
+                        case ValueType::TRUE_VALUE:
+                            text += BOOL_TRUE;
+                            break;
+                        case ValueType::FALSE_VALUE:
+                            text += BOOL_FALSE;
+                            break;
+                        default:
+                            return false;
+                    }
+                }
+            }
+            if (flags & FLAG_MESSAGE) {
+                if (!reader.readString(&value)) {
+                    return false;
+                }
+                text += SECTION_SEPARATOR;
+                text += value;
+            }
+        }
+
+        auto nanoseconds = std::chrono::nanoseconds(static_cast<int64_t>(ticks * nanosecondsPerTick));
+        std::chrono::system_clock::time_point time(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(nanoseconds));
+        out << formatter.format(convertCharToLevel(static_cast<char>(levelChar)), time, moniker->c_str(), text.c_str())
+            << '\n';
+    }
+    return true;
+}
+
+bool BinaryLogDecoder::decodeFile(const std::string& path, std::ostream& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    return decode(data.data(), data.size(), out);
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
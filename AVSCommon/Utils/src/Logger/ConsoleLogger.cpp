@@ -18,6 +18,8 @@
 #include <iostream>
 #include <mutex>
 
+#include <unistd.h>
+
 #include "AVSCommon/Utils/Logger/ConsoleLogger.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Logger/ThreadMoniker.h"
@@ -41,11 +43,48 @@ void ConsoleLogger::emit(
     std::chrono::system_clock::time_point time,
     const char* threadMoniker,
     const char* text) {
+    auto asyncWriter = m_asyncWriter.load(std::memory_order_acquire);
+    if (asyncWriter) {
+        asyncWriter->push(level, time, threadMoniker, text);
+        return;
+    }
     std::lock_guard<std::mutex> lock(m_coutMutex);
     std::cout << m_logFormatter.format(level, time, threadMoniker, text) << std::endl;
 }
 
-ConsoleLogger::ConsoleLogger() : Logger(Level::UNKNOWN) {
+bool ConsoleLogger::enableAsync(size_t capacity, AsyncLogWriter::OverflowPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_coutMutex);
+    if (m_asyncWriterOwner) {
+        return false;
+    }
+    // Lines already handed to std::cout must reach standard output before the writer's first writev().
+    std::cout.flush();
+    m_asyncWriterOwner = AsyncLogWriter::create(STDOUT_FILENO, capacity, policy);
+    if (!m_asyncWriterOwner) {
+        return false;
+    }
+    m_asyncWriter.store(m_asyncWriterOwner.get(), std::memory_order_release);
+    return true;
+}
+
+void ConsoleLogger::setMetricRecorder(std::shared_ptr<metrics::MetricRecorderInterface> metricRecorder) {
+    auto asyncWriter = m_asyncWriter.load(std::memory_order_acquire);
+    if (asyncWriter) {
+        asyncWriter->setMetricRecorder(std::move(metricRecorder));
+    }
+}
+
+void ConsoleLogger::flush() {
+    auto asyncWriter = m_asyncWriter.load(std::memory_order_acquire);
+    if (asyncWriter) {
+        asyncWriter->flush();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_coutMutex);
+    std::cout.flush();
+}
+
+ConsoleLogger::ConsoleLogger() : Logger(Level::UNKNOWN), m_asyncWriter{nullptr} {
 #ifdef DEBUG
     setLevel(Level::DEBUG0);
 #else
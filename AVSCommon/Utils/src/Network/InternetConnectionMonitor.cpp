@@ -14,6 +14,7 @@
  */
 
 #include "AVSCommon/Utils/Network/InternetConnectionMonitor.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachment.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -130,7 +131,7 @@ void InternetConnectionMonitor::testConnection() {
     auto contentFetcher = m_contentFetcherFactory->create(S3_TEST_URL);
     auto httpContent = contentFetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
 
-    auto stream = std::make_shared<InProcessAttachment>(PROCESS_ATTACHMENT_ID_PREFIX + S3_TEST_URL);
+    auto stream = std::make_shared<ChunkedAttachment>(PROCESS_ATTACHMENT_ID_PREFIX + S3_TEST_URL);
     std::shared_ptr<AttachmentWriter> streamWriter = stream->createWriter(WriterPolicy::BLOCKING);
 
     HTTPContentFetcherInterface::Header header = contentFetcher->getHeader(&m_isShuttingDown);
@@ -0,0 +1,324 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Metrics.h"
+#include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
+#include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+using namespace metrics;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SDSBufferPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Activity name of the metric the statistics are reported in.
+static const std::string STATISTICS_ACTIVITY = TAG + "-statistics";
+
+/// The class index of a buffer too large to be pooled.
+static const size_t NO_CLASS = std::numeric_limits<size_t>::max();
+
+/// The largest power of two a @c size_t holds.
+static const size_t MAX_POWER_OF_TWO = (std::numeric_limits<size_t>::max() >> 1) + 1;
+
+const size_t SDSBufferPool::DEFAULT_MIN_CLASS_SIZE = 4 * 1024;
+const size_t SDSBufferPool::DEFAULT_MAX_CLASS_SIZE = 4 * 1024 * 1024;
+// A page, which holds the header of a stream with dozens of readers.
+const size_t SDSBufferPool::DEFAULT_HEADER_ALLOWANCE = 4 * 1024;
+const size_t SDSBufferPool::DEFAULT_MAX_RETAINED_BYTES = 4 * 1024 * 1024;
+const uint64_t SDSBufferPool::STATISTICS_REPORT_INTERVAL = 100;
+
+/// Serializes access to @c g_defaultConfiguration.
+static std::mutex g_defaultConfigurationMutex;
+
+/// The settings the default pool is created with.
+static SDSBufferPool::Configuration g_defaultConfiguration;
+
+/**
+ * Round a size up to a power of two.
+ *
+ * @param size The size, which must be at most @c MAX_POWER_OF_TWO.
+ * @return The smallest power of two which is at least @c size.
+ */
+static size_t roundUpToPowerOfTwo(size_t size) {
+    size_t powerOfTwo = 1;
+    while (powerOfTwo < size) {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+
+SDSBufferPool::Configuration::Configuration() :
+        minClassSize{DEFAULT_MIN_CLASS_SIZE},
+        maxClassSize{DEFAULT_MAX_CLASS_SIZE},
+        headerAllowance{DEFAULT_HEADER_ALLOWANCE},
+        maxRetainedBytes{DEFAULT_MAX_RETAINED_BYTES},
+        useHugePages{false},
+        lockMemory{false} {
+}
+
+std::shared_ptr<SDSBufferPool> SDSBufferPool::create(const Configuration& configuration) {
+    if (0 == configuration.minClassSize) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroMinClassSize"));
+        return nullptr;
+    }
+    if (configuration.maxClassSize < configuration.minClassSize) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "maxClassSizeBelowMinClassSize")
+                        .d("minClassSize", configuration.minClassSize)
+                        .d("maxClassSize", configuration.maxClassSize));
+        return nullptr;
+    }
+    if (configuration.maxClassSize > MAX_POWER_OF_TWO) {
+        ACSDK_ERROR(
+            LX("createFailed").d("reason", "maxClassSizeTooLarge").d("maxClassSize", configuration.maxClassSize));
+        return nullptr;
+    }
+    if (configuration.headerAllowance > std::numeric_limits<size_t>::max() - MAX_POWER_OF_TWO) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "headerAllowanceTooLarge")
+                        .d("headerAllowance", configuration.headerAllowance));
+        return nullptr;
+    }
+#ifndef __linux__
+    if (configuration.useHugePages || configuration.lockMemory) {
+        ACSDK_WARN(LX("create").d("reason", "memorySettingsUnsupported"));
+    }
+#endif
+    auto rounded = configuration;
+    rounded.minClassSize = roundUpToPowerOfTwo(configuration.minClassSize);
+    rounded.maxClassSize = roundUpToPowerOfTwo(configuration.maxClassSize);
+    return std::shared_ptr<SDSBufferPool>(new SDSBufferPool(rounded));
+}
+
+std::shared_ptr<SDSBufferPool> SDSBufferPool::getDefault() {
+    static auto pool = [] {
+        std::lock_guard<std::mutex> lock(g_defaultConfigurationMutex);
+        auto defaultPool = create(g_defaultConfiguration);
+        if (!defaultPool) {
+            ACSDK_WARN(LX("getDefault").d("reason", "invalidConfiguration").d("action", "useDefaults"));
+            defaultPool = create();
+        }
+        return defaultPool;
+    }();
+    return pool;
+}
+
+void SDSBufferPool::setDefaultConfiguration(const Configuration& configuration) {
+    std::lock_guard<std::mutex> lock(g_defaultConfigurationMutex);
+    g_defaultConfiguration = configuration;
+}
+
+SDSBufferPool::SDSBufferPool(const Configuration& configuration) :
+        m_configuration(configuration),
+        m_statistics(),
+        m_reportedStatistics() {
+    size_t classes = 1;
+    for (auto size = m_configuration.minClassSize; size < m_configuration.maxClassSize; size <<= 1) {
+        ++classes;
+    }
+    m_idleBuffers.resize(classes);
+}
+
+SDSBufferPool::~SDSBufferPool() {
+    for (auto& idle : m_idleBuffers) {
+        for (auto& buffer : idle) {
+            freeBuffer(std::move(buffer), m_configuration.lockMemory);
+        }
+    }
+}
+
+std::shared_ptr<InProcessSDSTraits::Buffer> SDSBufferPool::acquire(size_t size) {
+    auto classIndex = getClassIndex(size);
+    auto classSize = NO_CLASS == classIndex ? 0 : getClassCapacity(classIndex);
+
+    Buffer buffer;
+    bool shouldReport = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_statistics.acquisitions;
+        if (classIndex != NO_CLASS && !m_idleBuffers[classIndex].empty()) {
+            buffer = std::move(m_idleBuffers[classIndex].back());
+            m_idleBuffers[classIndex].pop_back();
+            m_statistics.retainedBytes -= classSize;
+            ++m_statistics.reuses;
+        } else {
+            ++m_statistics.allocations;
+        }
+        m_statistics.inUseBytes += classIndex != NO_CLASS ? classSize : size;
+        shouldReport = m_metricRecorder && 0 == m_statistics.acquisitions % STATISTICS_REPORT_INTERVAL;
+    }
+
+    // Allocated without the lock held.
+    if (!buffer) {
+        buffer = NO_CLASS == classIndex ? Buffer(new InProcessSDSTraits::Buffer(size)) : allocate(classSize);
+    }
+    // Within the capacity reserved, so this never reallocates.  Idle buffers are kept empty, so this zeroes the whole
+    // buffer.
+    buffer->resize(size);
+
+    if (shouldReport) {
+        reportStatistics();
+    }
+
+    auto isLocked = NO_CLASS != classIndex && m_configuration.lockMemory;
+    std::weak_ptr<SDSBufferPool> weakPool = shared_from_this();
+    return std::shared_ptr<InProcessSDSTraits::Buffer>(
+        buffer.release(), [weakPool, classIndex, isLocked](InProcessSDSTraits::Buffer* released) {
+            Buffer buffer(released);
+            auto pool = weakPool.lock();
+            if (pool) {
+                pool->release(std::move(buffer), classIndex);
+            } else {
+                freeBuffer(std::move(buffer), isLocked);
+            }
+        });
+}
+
+size_t SDSBufferPool::getClassSize(size_t size) const {
+    auto classIndex = getClassIndex(size);
+    return NO_CLASS == classIndex ? 0 : getClassCapacity(classIndex);
+}
+
+size_t SDSBufferPool::getClassIndex(size_t size) const {
+    if (size > m_configuration.maxClassSize + m_configuration.headerAllowance) {
+        return NO_CLASS;
+    }
+    size_t classIndex = 0;
+    while (getClassCapacity(classIndex) < size) {
+        ++classIndex;
+    }
+    return classIndex;
+}
+
+size_t SDSBufferPool::getClassCapacity(size_t classIndex) const {
+    return (m_configuration.minClassSize << classIndex) + m_configuration.headerAllowance;
+}
+
+SDSBufferPool::Statistics SDSBufferPool::getStatistics() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void SDSBufferPool::setMetricRecorder(std::shared_ptr<MetricRecorderInterface> metricRecorder) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_metricRecorder = std::move(metricRecorder);
+}
+
+void SDSBufferPool::release(Buffer buffer, size_t classIndex) {
+    auto capacity = NO_CLASS == classIndex ? buffer->size() : buffer->capacity();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistics.inUseBytes -= capacity;
+        if (classIndex != NO_CLASS && m_statistics.retainedBytes + capacity <= m_configuration.maxRetainedBytes) {
+            m_statistics.retainedBytes += capacity;
+            // Keeps the capacity, and lets the next acquire() zero the buffer as it resizes it.
+            buffer->clear();
+            m_idleBuffers[classIndex].push_back(std::move(buffer));
+            return;
+        }
+        ++m_statistics.discards;
+    }
+    // Freed without the lock held.
+    freeBuffer(std::move(buffer), NO_CLASS != classIndex && m_configuration.lockMemory);
+}
+
+SDSBufferPool::Buffer SDSBufferPool::allocate(size_t capacity) {
+    Buffer buffer(new InProcessSDSTraits::Buffer());
+    buffer->reserve(capacity);
+#ifdef __linux__
+    if (m_configuration.useHugePages) {
+        // madvise() needs page-aligned bounds, so only the whole pages of the buffer are advised.
+        auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        auto begin = reinterpret_cast<uintptr_t>(buffer->data());
+        auto alignedBegin = (begin + pageSize - 1) & ~(pageSize - 1);
+        auto alignedEnd = (begin + capacity) & ~(pageSize - 1);
+        if (alignedEnd > alignedBegin &&
+            madvise(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, MADV_HUGEPAGE) != 0) {
+            ACSDK_WARN(LX("allocate").d("reason", "madviseFailed").d("errno", errno).d("capacity", capacity));
+        }
+    }
+    if (m_configuration.lockMemory && mlock(buffer->data(), capacity) != 0) {
+        ACSDK_WARN(LX("allocate").d("reason", "mlockFailed").d("errno", errno).d("capacity", capacity));
+    }
+#endif
+    return buffer;
+}
+
+void SDSBufferPool::freeBuffer(Buffer buffer, bool isLocked) {
+#ifdef __linux__
+    if (isLocked) {
+        munlock(buffer->data(), buffer->capacity());
+    }
+#endif
+}
+
+void SDSBufferPool::reportStatistics() {
+    std::shared_ptr<MetricRecorderInterface> metricRecorder;
+    Statistics current;
+    Statistics reported;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        metricRecorder = m_metricRecorder;
+        current = m_statistics;
+        reported = m_reportedStatistics;
+        m_reportedStatistics = m_statistics;
+    }
+    recordMetric(
+        metricRecorder,
+        MetricEventBuilder{}
+            .setActivityName(STATISTICS_ACTIVITY)
+            .addDataPoint(DataPointCounterBuilder{}
+                              .setName("acquisitions")
+                              .increment(current.acquisitions - reported.acquisitions)
+                              .build())
+            .addDataPoint(
+                DataPointCounterBuilder{}.setName("reuses").increment(current.reuses - reported.reuses).build())
+            .addDataPoint(DataPointCounterBuilder{}
+                              .setName("allocations")
+                              .increment(current.allocations - reported.allocations)
+                              .build())
+            .addDataPoint(
+                DataPointCounterBuilder{}.setName("discards").increment(current.discards - reported.discards).build())
+            .addDataPoint(DataPointCounterBuilder{}.setName("retainedBytes").increment(current.retainedBytes).build())
+            .addDataPoint(DataPointCounterBuilder{}.setName("inUseBytes").increment(current.inUseBytes).build())
+            .build());
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,239 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedMemorySDS");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// The number of nanoseconds in a second.
+static const long NANOSECONDS_PER_SECOND = 1000000000L;
+
+/// Permissions of a named buffer; only processes running as the creating user may map it.
+static const mode_t NAMED_BUFFER_MODE = 0600;
+
+SharedMemoryMutex::SharedMemoryMutex() {
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    auto result = pthread_mutex_init(&m_mutex, &attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("initMutexFailed").d("error", result));
+    }
+    pthread_mutexattr_destroy(&attributes);
+}
+
+SharedMemoryMutex::~SharedMemoryMutex() {
+    pthread_mutex_destroy(&m_mutex);
+}
+
+void SharedMemoryMutex::lock() {
+    onLocked(pthread_mutex_lock(&m_mutex), "lock");
+}
+
+bool SharedMemoryMutex::try_lock() {
+    auto result = pthread_mutex_trylock(&m_mutex);
+    if (EBUSY == result) {
+        return false;
+    }
+    return onLocked(result, "try_lock");
+}
+
+void SharedMemoryMutex::unlock() {
+    pthread_mutex_unlock(&m_mutex);
+}
+
+pthread_mutex_t* SharedMemoryMutex::native_handle() {
+    return &m_mutex;
+}
+
+bool SharedMemoryMutex::onLocked(int result, const char* function) {
+    switch (result) {
+        case 0:
+            return true;
+        case EOWNERDEAD:
+            // The previous owner died while holding the mutex; the lock has passed to us, and the mutex must be marked
+            // consistent before it is unlocked or it becomes permanently unusable.
+            ACSDK_WARN(LX("recoveringMutex").d("reason", "ownerDied").d("function", function));
+            pthread_mutex_consistent(&m_mutex);
+            return true;
+        default:
+            ACSDK_ERROR(LX("lockMutexFailed").d("function", function).d("error", result));
+            return false;
+    }
+}
+
+SharedMemoryConditionVariable::SharedMemoryConditionVariable() {
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    auto result = pthread_cond_init(&m_condition, &attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("initConditionVariableFailed").d("error", result));
+    }
+    pthread_condattr_destroy(&attributes);
+}
+
+SharedMemoryConditionVariable::~SharedMemoryConditionVariable() {
+    pthread_cond_destroy(&m_condition);
+}
+
+void SharedMemoryConditionVariable::notify_one() {
+    pthread_cond_signal(&m_condition);
+}
+
+void SharedMemoryConditionVariable::notify_all() {
+    pthread_cond_broadcast(&m_condition);
+}
+
+void SharedMemoryConditionVariable::wait(std::unique_lock<SharedMemoryMutex>& lock) {
+    auto mutex = lock.mutex();
+    mutex->onLocked(pthread_cond_wait(&m_condition, mutex->native_handle()), "wait");
+}
+
+bool SharedMemoryConditionVariable::waitUntil(std::unique_lock<SharedMemoryMutex>& lock, const timespec& deadline) {
+    auto mutex = lock.mutex();
+    auto result = pthread_cond_timedwait(&m_condition, mutex->native_handle(), &deadline);
+    if (ETIMEDOUT == result) {
+        return true;
+    }
+    mutex->onLocked(result, "waitUntil");
+    return false;
+}
+
+timespec SharedMemoryConditionVariable::deadlineAfter(std::chrono::nanoseconds timeout) {
+    timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    deadline.tv_sec += seconds.count();
+    deadline.tv_nsec += (timeout - seconds).count();
+    if (deadline.tv_nsec >= NANOSECONDS_PER_SECOND) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+    }
+    return deadline;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(size_t size) : m_data{nullptr}, m_size{0} {
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("createAnonymousBufferFailed").d("reason", "mmapFailed").d("size", size).d("errno", errno));
+        return;
+    }
+    m_data = static_cast<uint8_t*>(data);
+    m_size = size;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(uint8_t* data, size_t size, const std::string& name) :
+        m_data{data},
+        m_size{size},
+        m_ownedName{name} {
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::create(const std::string& name, size_t size) {
+    if (0 == size) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "sizeZero").d("name", name));
+        return nullptr;
+    }
+
+    // A buffer left behind by a creator which crashed would otherwise make O_EXCL fail.
+    shm_unlink(name.c_str());
+    auto fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, NAMED_BUFFER_MODE);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "shmOpenFailed").d("name", name).d("errno", errno));
+        return nullptr;
+    }
+    if (ftruncate(fd, size) != 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncateFailed").d("name", name).d("errno", errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps the memory alive; the descriptor is no longer needed.
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mmapFailed").d("name", name).d("errno", errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(static_cast<uint8_t*>(data), size, name));
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::open(const std::string& name) {
+    auto fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "shmOpenFailed").d("name", name).d("errno", errno));
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidSize").d("name", name).d("errno", errno));
+        close(fd);
+        return nullptr;
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "mmapFailed").d("name", name).d("errno", errno));
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(static_cast<uint8_t*>(data), size, ""));
+}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() {
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    if (!m_ownedName.empty()) {
+        shm_unlink(m_ownedName.c_str());
+    }
+}
+
+uint8_t* SharedMemoryBuffer::data() {
+    return m_data;
+}
+
+size_t SharedMemoryBuffer::size() const {
+    return m_size;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,123 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <future>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("Strand");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+const size_t Strand::MAX_TASKS_PER_DRAIN = 16;
+
+std::shared_ptr<Strand> Strand::create(std::shared_ptr<WorkStealingScheduler> scheduler) {
+    if (!scheduler) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullScheduler"));
+        return nullptr;
+    }
+    return std::shared_ptr<Strand>(new Strand(std::move(scheduler)));
+}
+
+Strand::Strand(std::shared_ptr<WorkStealingScheduler> scheduler) :
+        m_scheduler{std::move(scheduler)},
+        m_drainScheduled{false},
+        m_shutdown{false} {
+}
+
+bool Strand::push(bool front, InlineTask task) {
+    {
+        std::lock_guard<std::mutex> lock{m_queueMutex};
+        if (m_shutdown) {
+            return false;
+        }
+        if (front) {
+            m_queue.pushFront(std::move(task));
+        } else {
+            m_queue.pushBack(std::move(task));
+        }
+        if (m_drainScheduled) {
+            return true;
+        }
+        m_drainScheduled = true;
+    }
+    scheduleDrain();
+    return true;
+}
+
+void Strand::waitForSubmittedTasks() {
+    std::unique_lock<std::mutex> lock{m_queueMutex};
+    if (m_drainScheduled) {
+        std::promise<void> flushedPromise;
+        auto flushedFuture = flushedPromise.get_future();
+        m_queue.pushBack([&flushedPromise]() { flushedPromise.set_value(); });
+
+        lock.unlock();
+        flushedFuture.wait();
+    }
+}
+
+void Strand::shutdown() {
+    std::unique_lock<std::mutex> lock{m_queueMutex};
+    m_queue.clear();
+    m_shutdown = true;
+    lock.unlock();
+    waitForSubmittedTasks();
+}
+
+bool Strand::isShutdown() {
+    return m_shutdown;
+}
+
+void Strand::drain() {
+    for (size_t i = 0; i < MAX_TASKS_PER_DRAIN; ++i) {
+        InlineTask task;
+        {
+            std::lock_guard<std::mutex> lock{m_queueMutex};
+            if (!m_queue.popFront(&task)) {
+                m_drainScheduled = false;
+                return;
+            }
+        }
+        task();
+    }
+    scheduleDrain();
+}
+
+void Strand::scheduleDrain() {
+    auto self = shared_from_this();
+    if (!m_scheduler->schedule([self] { self->drain(); })) {
+        ACSDK_ERROR(LX("scheduleDrainFailed").d("reason", "schedulerRejectedJob"));
+        std::lock_guard<std::mutex> lock{m_queueMutex};
+        m_drainScheduled = false;
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,141 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+const size_t TaskQueue::DEFAULT_MAX_SPARE_NODES = 64;
+
+TaskQueue::TaskQueue(size_t maxSpareNodes) :
+        m_head{nullptr},
+        m_tail{nullptr},
+        m_size{0},
+        m_spare{nullptr},
+        m_spareCount{0},
+        m_maxSpareNodes{maxSpareNodes} {
+}
+
+TaskQueue::~TaskQueue() {
+    clear();
+    while (m_spare) {
+        auto node = m_spare;
+        m_spare = node->prev;
+        delete node;
+    }
+}
+
+void TaskQueue::pushBack(InlineTask&& task) {
+    auto node = acquireNode(std::move(task));
+    node->prev = m_tail;
+    node->next = nullptr;
+    if (m_tail) {
+        m_tail->next = node;
+    } else {
+        m_head = node;
+    }
+    m_tail = node;
+    m_size++;
+}
+
+void TaskQueue::pushFront(InlineTask&& task) {
+    auto node = acquireNode(std::move(task));
+    node->prev = nullptr;
+    node->next = m_head;
+    if (m_head) {
+        m_head->prev = node;
+    } else {
+        m_tail = node;
+    }
+    m_head = node;
+    m_size++;
+}
+
+bool TaskQueue::popFront(InlineTask* task) {
+    auto node = m_head;
+    if (!node) {
+        return false;
+    }
+    m_head = node->next;
+    if (m_head) {
+        m_head->prev = nullptr;
+    } else {
+        m_tail = nullptr;
+    }
+    m_size--;
+    releaseNode(node, task);
+    return true;
+}
+
+bool TaskQueue::popBack(InlineTask* task) {
+    auto node = m_tail;
+    if (!node) {
+        return false;
+    }
+    m_tail = node->prev;
+    if (m_tail) {
+        m_tail->next = nullptr;
+    } else {
+        m_head = nullptr;
+    }
+    m_size--;
+    releaseNode(node, task);
+    return true;
+}
+
+void TaskQueue::clear() {
+    InlineTask discarded;
+    while (popFront(&discarded)) {
+        discarded = nullptr;
+    }
+}
+
+bool TaskQueue::empty() const {
+    return 0 == m_size;
+}
+
+size_t TaskQueue::size() const {
+    return m_size;
+}
+
+TaskQueue::Node* TaskQueue::acquireNode(InlineTask&& task) {
+    if (m_spare) {
+        auto node = m_spare;
+        m_spare = node->prev;
+        m_spareCount--;
+        node->task = std::move(task);
+        return node;
+    }
+    return new Node{std::move(task), nullptr, nullptr};
+}
+
+void TaskQueue::releaseNode(Node* node, InlineTask* task) {
+    *task = std::move(node->task);
+    if (m_spareCount < m_maxSpareNodes) {
+        node->prev = m_spare;
+        m_spare = node;
+        m_spareCount++;
+    } else {
+        delete node;
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
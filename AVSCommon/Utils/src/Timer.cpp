@@ -13,14 +13,182 @@
  * permissions and limitations under the License.
  */
 
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
 #include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("Timer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace timing {
 
-Timer::Timer() : m_running(false), m_stopping(false) {
+using namespace std::chrono;
+using threading::WorkStealingScheduler;
+
+/// The state of the timer whose task is being called on this thread, used to let @c stop() be called from a task.
+static thread_local const void* s_callingState = nullptr;
+
+struct Timer::State : public std::enable_shared_from_this<Timer::State> {
+    /// Constructor.
+    State();
+
+    /**
+     * Schedule the next task call on the wheel.  @c mutex must be held.
+     *
+     * @param deadline When to make the call.
+     */
+    void armLocked(steady_clock::time_point deadline);
+
+    /**
+     * Make a task call (on a scheduler worker) and schedule the next one.
+     *
+     * @param expectedGeneration The @c generation the call was scheduled for; stale calls are ignored.
+     */
+    void onExpired(uint64_t expectedGeneration);
+
+    /// Serializes access to the members below.
+    std::mutex mutex;
+
+    /// Notified when a task call completes.
+    std::condition_variable callCompleted;
+
+    /// Whether the timer is active.
+    std::atomic<bool> running;
+
+    /// Incremented by every @c start() and @c stop(), invalidating calls scheduled before.
+    uint64_t generation;
+
+    /// The pending wheel timer, if any.
+    TimerWheel::Id wheelId;
+
+    /// The task to call.
+    std::shared_ptr<std::function<void()>> task;
+
+    /// Time to wait before the first call.
+    steady_clock::duration delay;
+
+    /// Time to wait between calls.
+    steady_clock::duration period;
+
+    /// How @c period is applied.
+    PeriodType periodType;
+
+    /// The number of calls to make, or @c FOREVER.
+    size_t maxCount;
+
+    /// The number of calls made (or skipped) so far.
+    size_t count;
+
+    /// The time point the next wait is measured from.
+    steady_clock::time_point anchor;
+
+    /// Whether the task runtime put an @c ABSOLUTE timer off schedule, skipping the next call.
+    bool offSchedule;
+
+    /// The number of task calls in progress.
+    size_t callsInProgress;
+
+    /// The wheel used to wait.
+    const std::shared_ptr<TimerWheel> wheel;
+
+    /// The scheduler task calls run on.
+    const std::shared_ptr<WorkStealingScheduler> scheduler;
+};
+
+Timer::State::State() :
+        running{false},
+        generation{0},
+        wheelId{TimerWheel::INVALID_ID},
+        delay{steady_clock::duration::zero()},
+        period{steady_clock::duration::zero()},
+        periodType{PeriodType::ABSOLUTE},
+        maxCount{FOREVER},
+        count{0},
+        offSchedule{false},
+        callsInProgress{0},
+        wheel{TimerWheel::getDefault()},
+        scheduler{WorkStealingScheduler::getDefaultScheduler()} {
+}
+
+void Timer::State::armLocked(steady_clock::time_point deadline) {
+    std::weak_ptr<State> weakState = shared_from_this();
+    auto expectedGeneration = generation;
+    wheelId = wheel->schedule(deadline, [weakState, expectedGeneration] {
+        // The wheel's thread only hands the call off, so that a slow task cannot delay other timers.
+        if (auto state = weakState.lock()) {
+            state->scheduler->schedule([state, expectedGeneration] { state->onExpired(expectedGeneration); });
+        }
+    });
+}
+
+void Timer::State::onExpired(uint64_t expectedGeneration) {
+    std::shared_ptr<std::function<void()>> finishedTask;
+    std::unique_lock<std::mutex> lock(mutex);
+    if (expectedGeneration != generation) {
+        return;
+    }
+    wheelId = TimerWheel::INVALID_ID;
+
+    auto waitTime = (0 == count) ? delay : period;
+    bool callTask = true;
+    if (PeriodType::ABSOLUTE == periodType) {
+        // Update our estimate of where we should be after the delay, and only call the task if still on schedule.
+        anchor += waitTime;
+        callTask = !offSchedule;
+    }
+
+    if (callTask) {
+        auto currentTask = task;
+        callsInProgress++;
+        lock.unlock();
+
+        auto previousCallingState = s_callingState;
+        s_callingState = this;
+        (*currentTask)();
+        s_callingState = previousCallingState;
+        currentTask.reset();
+
+        lock.lock();
+        callsInProgress--;
+        callCompleted.notify_all();
+        if (expectedGeneration != generation) {
+            return;
+        }
+    }
+
+    switch (periodType) {
+        case PeriodType::ABSOLUTE:
+            // If the task runtime put us off schedule, skip the next task call.
+            offSchedule = anchor + period < steady_clock::now();
+            break;
+        case PeriodType::RELATIVE:
+            anchor = steady_clock::now();
+            break;
+    }
+
+    if (FOREVER != maxCount && ++count >= maxCount) {
+        finishedTask = std::move(task);
+        running = false;
+        return;
+    }
+    if (FOREVER == maxCount) {
+        count = 1;
+    }
+    armLocked(anchor + period);
+}
+
+Timer::Timer() : m_state{std::make_shared<State>()} {
 }
 
 Timer::~Timer() {
@@ -28,25 +196,59 @@ Timer::~Timer() {
 }
 
 void Timer::stop() {
-    {
-        std::lock_guard<std::mutex> lock(m_waitMutex);
-        if (m_running) {
-            m_stopping = true;
-        }
-        m_waitCondition.notify_all();
+    std::shared_ptr<std::function<void()>> stoppedTask;
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->generation++;
+    if (TimerWheel::INVALID_ID != m_state->wheelId) {
+        m_state->wheel->cancel(m_state->wheelId);
+        m_state->wheelId = TimerWheel::INVALID_ID;
     }
+    stoppedTask = std::move(m_state->task);
+    m_state->running = false;
 
-    if (std::this_thread::get_id() != m_thread.get_id() && m_thread.joinable()) {
-        m_thread.join();
+    // Block until an in-progress task call completes, unless stop() is being called from that task.
+    if (s_callingState != m_state.get()) {
+        m_state->callCompleted.wait(lock, [this] { return 0 == m_state->callsInProgress; });
     }
 }
 
 bool Timer::isActive() const {
-    return m_running;
+    return m_state->running;
 }
 
-bool Timer::activate() {
-    return !m_running.exchange(true);
+bool Timer::startTimer(
+    steady_clock::duration delay,
+    steady_clock::duration period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    if (delay < steady_clock::duration::zero()) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "negativeDelay"));
+        return false;
+    }
+    if (period < steady_clock::duration::zero()) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "negativePeriod"));
+        return false;
+    }
+
+    // Can't start if already running.
+    if (m_state->running.exchange(true)) {
+        ACSDK_ERROR(LX("startFailed").d("reason", "timerAlreadyActive"));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->generation++;
+    m_state->task = std::make_shared<std::function<void()>>(std::move(task));
+    m_state->delay = delay;
+    m_state->period = period;
+    m_state->periodType = periodType;
+    m_state->maxCount = maxCount;
+    m_state->count = 0;
+    m_state->offSchedule = false;
+    m_state->anchor = steady_clock::now();
+    m_state->armLocked(m_state->anchor + delay);
+    return true;
 }
 
 }  // namespace timing
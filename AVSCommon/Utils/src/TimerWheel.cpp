@@ -0,0 +1,324 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerWheel");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+using namespace std::chrono;
+
+const TimerWheel::Id TimerWheel::INVALID_ID = 0;
+
+const milliseconds TimerWheel::DEFAULT_SLACK{1};
+
+/// The longest the wheel's thread sleeps in one go, which keeps deadline arithmetic far from overflowing.
+static const hours MAX_SLEEP{1};
+
+/// The slack the process-wide wheel is created with, in milliseconds.
+static std::atomic<int64_t> g_defaultSlackMs{TimerWheel::DEFAULT_SLACK.count()};
+
+/**
+ * Count the trailing zero bits of a non-zero value.
+ *
+ * @param value The value, which must not be zero.
+ * @return The index of the lowest set bit.
+ */
+static unsigned countTrailingZeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned count = 0;
+    while (!(value & 1)) {
+        value >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+TimerWheel::TimerWheel(milliseconds slack) :
+        m_tick{std::max(slack, milliseconds(1))},
+        m_epoch{steady_clock::now()},
+        m_occupied{},
+        m_currentTick{0},
+        m_sleepUntilTick{0},
+        m_nextId{INVALID_ID + 1},
+        m_shutdown{false},
+        m_wakeups{0} {
+    for (auto& level : m_slots) {
+        std::fill(std::begin(level), std::end(level), nullptr);
+    }
+}
+
+TimerWheel::~TimerWheel() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wakeUp.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    for (auto& idAndEntry : m_entries) {
+        delete idAndEntry.second;
+    }
+}
+
+TimerWheel::Id TimerWheel::schedule(steady_clock::time_point deadline, Callback callback) {
+    if (!callback) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "emptyCallback"));
+        return INVALID_ID;
+    }
+
+    auto entry = new Entry{INVALID_ID, 0, 0, 0, std::move(callback), nullptr, nullptr};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_shutdown) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "shuttingDown"));
+        delete entry;
+        return INVALID_ID;
+    }
+
+    entry->id = m_nextId++;
+    entry->expiryTick = std::max(toTickCeil(deadline), m_currentTick + 1);
+    linkLocked(entry);
+    m_entries[entry->id] = entry;
+
+    if (!m_thread.joinable()) {
+        m_thread = std::thread(&TimerWheel::loop, this);
+    } else if (entry->expiryTick < m_sleepUntilTick) {
+        m_wakeUp.notify_one();
+    }
+    return entry->id;
+}
+
+bool TimerWheel::cancel(Id id) {
+    // Destroy the callback after releasing the lock, in case its destructor cancels or schedules timers.
+    Callback callback;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            return false;
+        }
+        auto entry = it->second;
+        m_entries.erase(it);
+        unlinkLocked(entry);
+        callback = std::move(entry->callback);
+        delete entry;
+    }
+    return true;
+}
+
+size_t TimerWheel::getPendingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+uint64_t TimerWheel::getWakeupCount() const {
+    return m_wakeups;
+}
+
+milliseconds TimerWheel::getSlack() const {
+    return duration_cast<milliseconds>(m_tick);
+}
+
+std::shared_ptr<TimerWheel> TimerWheel::getDefault() {
+    // Intentionally never destroyed: timers may be cancelled from static destructors.
+    static auto singleton =
+        new std::shared_ptr<TimerWheel>(std::make_shared<TimerWheel>(milliseconds(g_defaultSlackMs.load())));
+    return *singleton;
+}
+
+void TimerWheel::setDefaultSlack(milliseconds slack) {
+    g_defaultSlackMs = slack.count();
+}
+
+void TimerWheel::loop() {
+    logger::ThreadMoniker::setThisThreadMoniker(logger::ThreadMoniker::generateMoniker());
+
+    threading::TaskQueue expired;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown) {
+        advanceLocked(toTickFloor(steady_clock::now()), &expired);
+        if (!expired.empty()) {
+            lock.unlock();
+            Callback callback;
+            while (expired.popFront(&callback)) {
+                callback();
+                callback = nullptr;
+            }
+            lock.lock();
+            continue;
+        }
+
+        uint64_t nextTick = 0;
+        if (nextEventTickLocked(&nextTick)) {
+            m_sleepUntilTick = nextTick;
+            if (nextTick - m_currentTick <= static_cast<uint64_t>(MAX_SLEEP / m_tick)) {
+                m_wakeUp.wait_until(lock, m_epoch + m_tick * nextTick);
+            } else {
+                m_wakeUp.wait_for(lock, MAX_SLEEP);
+            }
+        } else {
+            m_sleepUntilTick = std::numeric_limits<uint64_t>::max();
+            m_wakeUp.wait(lock);
+        }
+        m_sleepUntilTick = 0;
+        m_wakeups++;
+    }
+}
+
+void TimerWheel::linkLocked(Entry* entry) {
+    uint64_t delta = entry->expiryTick > m_currentTick ? entry->expiryTick - m_currentTick : 0;
+    unsigned level = 0;
+    while (level + 1 < LEVELS && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+
+    // Deadlines beyond the last level are parked in its furthest slot and placed again when that slot cascades.
+    uint64_t placementTick = entry->expiryTick;
+    const uint64_t horizon = uint64_t(1) << (SLOT_BITS * LEVELS);
+    if (delta >= horizon) {
+        placementTick = m_currentTick + horizon - 1;
+    }
+
+    unsigned slot = (placementTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    entry->level = level;
+    entry->slot = slot;
+    entry->prev = nullptr;
+    entry->next = m_slots[level][slot];
+    if (entry->next) {
+        entry->next->prev = entry;
+    }
+    m_slots[level][slot] = entry;
+    m_occupied[level] |= uint64_t(1) << slot;
+}
+
+void TimerWheel::unlinkLocked(Entry* entry) {
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        m_slots[entry->level][entry->slot] = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    }
+    if (!m_slots[entry->level][entry->slot]) {
+        m_occupied[entry->level] &= ~(uint64_t(1) << entry->slot);
+    }
+}
+
+bool TimerWheel::nextEventTickLocked(uint64_t* tick) const {
+    bool found = false;
+    for (unsigned level = 0; level < LEVELS; ++level) {
+        uint64_t occupied = m_occupied[level];
+        if (!occupied) {
+            continue;
+        }
+        // Rotate the bitmask so that bit 0 is the slot after the current one, then find the nearest occupied slot.
+        unsigned shift = SLOT_BITS * level;
+        uint64_t index = m_currentTick >> shift;
+        unsigned rotation = (index + 1) & (SLOTS - 1);
+        uint64_t rotated = rotation ? (occupied >> rotation) | (occupied << (SLOTS - rotation)) : occupied;
+        uint64_t eventTick = (index + countTrailingZeros(rotated) + 1) << shift;
+        if (!found || eventTick < *tick) {
+            *tick = eventTick;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void TimerWheel::advanceLocked(uint64_t nowTick, threading::TaskQueue* expired) {
+    uint64_t eventTick = 0;
+    while (nextEventTickLocked(&eventTick) && eventTick <= nowTick) {
+        m_currentTick = eventTick;
+
+        // Cascade slots whose range starts now, from the top level down so that entries can cascade more than once.
+        for (unsigned level = LEVELS - 1; level > 0; --level) {
+            unsigned shift = SLOT_BITS * level;
+            if (m_currentTick & ((uint64_t(1) << shift) - 1)) {
+                continue;
+            }
+            unsigned slot = (m_currentTick >> shift) & (SLOTS - 1);
+            auto entry = m_slots[level][slot];
+            m_slots[level][slot] = nullptr;
+            m_occupied[level] &= ~(uint64_t(1) << slot);
+            while (entry) {
+                auto next = entry->next;
+                linkLocked(entry);
+                entry = next;
+            }
+        }
+
+        unsigned slot = m_currentTick & (SLOTS - 1);
+        auto entry = m_slots[0][slot];
+        m_slots[0][slot] = nullptr;
+        m_occupied[0] &= ~(uint64_t(1) << slot);
+        for (; entry; entry = entry->next) {
+            m_expiring.push_back(entry);
+        }
+
+        // Timers expiring in the same tick fire in the order they were scheduled.
+        std::sort(m_expiring.begin(), m_expiring.end(), [](const Entry* lhs, const Entry* rhs) {
+            return lhs->id < rhs->id;
+        });
+        for (auto expiring : m_expiring) {
+            m_entries.erase(expiring->id);
+            expired->pushBack(std::move(expiring->callback));
+            delete expiring;
+        }
+        m_expiring.clear();
+    }
+    m_currentTick = std::max(m_currentTick, nowTick);
+}
+
+uint64_t TimerWheel::toTickCeil(steady_clock::time_point timePoint) const {
+    if (timePoint <= m_epoch) {
+        return 0;
+    }
+    auto elapsed = timePoint - m_epoch;
+    return elapsed / m_tick + (elapsed % m_tick != steady_clock::duration::zero() ? 1 : 0);
+}
+
+uint64_t TimerWheel::toTickFloor(steady_clock::time_point timePoint) const {
+    if (timePoint <= m_epoch) {
+        return 0;
+    }
+    return (timePoint - m_epoch) / m_tick;
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
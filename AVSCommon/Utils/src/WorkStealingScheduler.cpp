@@ -0,0 +1,348 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+#include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("WorkStealingScheduler");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+using namespace logger;
+
+const size_t WorkStealingScheduler::MIN_DEFAULT_WORKERS = 2;
+
+const size_t WorkStealingScheduler::DEFAULT_MAX_WORKERS = 128;
+
+const std::chrono::milliseconds WorkStealingScheduler::DEFAULT_STARVATION_INTERVAL{10};
+
+const std::chrono::milliseconds WorkStealingScheduler::DEFAULT_IDLE_TIMEOUT{1000};
+
+thread_local WorkStealingScheduler* WorkStealingScheduler::s_currentScheduler = nullptr;
+
+thread_local WorkStealingScheduler::Worker* WorkStealingScheduler::s_currentWorker = nullptr;
+
+/// The number of core workers the process-wide scheduler is created with (0 means size from the hardware).
+static std::atomic<size_t> g_defaultWorkerCount{0};
+
+WorkStealingScheduler::Worker::Worker(bool isCore) : isCore{isCore}, finished{false} {
+}
+
+WorkStealingScheduler::WorkStealingScheduler(
+    size_t workerCount,
+    size_t maxWorkerCount,
+    std::chrono::milliseconds starvationInterval,
+    std::chrono::milliseconds idleTimeout) :
+        m_monitorParked{false},
+        m_finishedWorkers{0},
+        m_wakingWorkers{0},
+        m_pendingJobs{0},
+        m_idleWorkers{0},
+        m_liveWorkers{0},
+        m_jobsExecuted{0},
+        m_jobsStolen{0},
+        m_compensationWorkersCreated{0},
+        m_shuttingDown{false},
+        m_maxWorkerCount{std::max(maxWorkerCount, static_cast<size_t>(1))},
+        m_starvationInterval{starvationInterval},
+        m_idleTimeout{idleTimeout} {
+    if (0 == workerCount) {
+        workerCount = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), MIN_DEFAULT_WORKERS);
+    }
+    workerCount = std::min(workerCount, m_maxWorkerCount);
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_coreWorkers.push_back(memory::make_unique<Worker>(true));
+    }
+    for (auto& worker : m_coreWorkers) {
+        startWorker(worker.get());
+    }
+    m_monitorThread = std::thread(&WorkStealingScheduler::monitorLoop, this);
+
+    ACSDK_DEBUG5(LX("created").d("workers", workerCount).d("maxWorkers", m_maxWorkerCount));
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shuttingDown = true;
+    }
+    m_workAvailable.notify_all();
+    m_monitorWakeup.notify_all();
+
+    auto joinOrDetach = [](std::thread& thread) {
+        if (!thread.joinable()) {
+            return;
+        }
+        // The last reference to the scheduler may be released by a job running on one of its own workers.  Clearing
+        // s_currentScheduler tells that worker's loop to return without touching the destroyed scheduler.
+        if (thread.get_id() == std::this_thread::get_id()) {
+            s_currentScheduler = nullptr;
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    };
+
+    joinOrDetach(m_monitorThread);
+    for (auto& worker : m_coreWorkers) {
+        joinOrDetach(worker->thread);
+    }
+    // The monitor has stopped, so no compensation worker is added.  They are joined without m_mutex held, as a worker
+    // returning from its idle wait needs it to leave its loop.
+    std::list<std::unique_ptr<Worker>> compensationWorkers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        compensationWorkers.swap(m_compensationWorkers);
+    }
+    for (auto& worker : compensationWorkers) {
+        joinOrDetach(worker->thread);
+    }
+
+    std::lock_guard<std::mutex> lock(m_injectionMutex);
+    m_injectionQueue.clear();
+}
+
+bool WorkStealingScheduler::schedule(Job job) {
+    if (!job) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "emptyJob"));
+        return false;
+    }
+    if (m_shuttingDown) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "shuttingDown"));
+        return false;
+    }
+
+    // Count the job before publishing it so that a worker which takes it never observes a negative count.
+    m_pendingJobs++;
+    auto worker = s_currentScheduler == this ? s_currentWorker : nullptr;
+    if (worker && worker->isCore) {
+        std::lock_guard<std::mutex> lock(worker->jobsMutex);
+        worker->jobs.pushBack(std::move(job));
+    } else {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        m_injectionQueue.pushBack(std::move(job));
+    }
+
+    if (m_idleWorkers > 0) {
+        wakeIdleWorker();
+    } else if (m_monitorParked) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_monitorWakeup.notify_one();
+    }
+    return true;
+}
+
+size_t WorkStealingScheduler::getWorkerCount() const {
+    return m_coreWorkers.size();
+}
+
+void WorkStealingScheduler::getStats(
+    uint64_t& jobsExecuted,
+    uint64_t& jobsStolen,
+    uint64_t& compensationWorkersCreated,
+    uint64_t& liveWorkers) {
+    jobsExecuted = m_jobsExecuted;
+    jobsStolen = m_jobsStolen;
+    compensationWorkersCreated = m_compensationWorkersCreated;
+    liveWorkers = m_liveWorkers;
+}
+
+std::shared_ptr<WorkStealingScheduler> WorkStealingScheduler::getDefaultScheduler() {
+    // Intentionally never destroyed: strands may release their last reference from a worker during static destruction.
+    static auto singleton = new std::shared_ptr<WorkStealingScheduler>(
+        std::make_shared<WorkStealingScheduler>(g_defaultWorkerCount.load()));
+    return *singleton;
+}
+
+void WorkStealingScheduler::setDefaultWorkerCount(size_t workerCount) {
+    g_defaultWorkerCount = workerCount;
+}
+
+void WorkStealingScheduler::startWorker(Worker* worker) {
+    m_liveWorkers++;
+    worker->thread = std::thread(&WorkStealingScheduler::workerLoop, this, worker);
+}
+
+void WorkStealingScheduler::workerLoop(Worker* worker) {
+    ThreadMoniker::setThisThreadMoniker(ThreadMoniker::generateMoniker());
+    s_currentScheduler = this;
+    s_currentWorker = worker;
+
+    Job job;
+    while (!m_shuttingDown) {
+        if (findJob(worker, &job)) {
+            if (m_pendingJobs > 0 && m_idleWorkers > 0) {
+                wakeIdleWorker();
+            }
+            job();
+            // Running or releasing the job may have destroyed this scheduler; if so, touch no members.
+            if (s_currentScheduler != this) {
+                return;
+            }
+            job = nullptr;
+            if (s_currentScheduler != this) {
+                return;
+            }
+            m_jobsExecuted++;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idleWorkers++;
+        auto hasWork = [this] { return m_shuttingDown || m_pendingJobs > 0; };
+        auto deadline = std::chrono::steady_clock::now() + m_idleTimeout;
+        bool woken = true;
+        while (woken && !hasWork()) {
+            if (worker->isCore) {
+                m_workAvailable.wait(lock);
+            } else if (std::cv_status::timeout == m_workAvailable.wait_until(lock, deadline)) {
+                woken = hasWork();
+            }
+            // Every wakeup, whether or not work is left for this worker, allows the next notification.
+            if (m_wakingWorkers > 0) {
+                m_wakingWorkers--;
+            }
+        }
+        m_idleWorkers--;
+
+        if (!woken) {
+            // An idle compensation worker retires; the monitor joins it.
+            m_liveWorkers--;
+            worker->finished = true;
+            m_finishedWorkers++;
+            m_monitorWakeup.notify_one();
+            return;
+        }
+    }
+    m_liveWorkers--;
+}
+
+void WorkStealingScheduler::wakeIdleWorker() {
+    // Taking the lock guarantees a worker which has checked for work but not yet parked is not missed.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (0 == m_wakingWorkers && m_idleWorkers > 0) {
+        m_wakingWorkers++;
+        m_workAvailable.notify_one();
+    }
+}
+
+bool WorkStealingScheduler::findJob(Worker* worker, Job* job) {
+    if (worker->isCore) {
+        std::lock_guard<std::mutex> lock(worker->jobsMutex);
+        if (worker->jobs.popFront(job)) {
+            m_pendingJobs--;
+            return true;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        if (m_injectionQueue.popFront(job)) {
+            m_pendingJobs--;
+            return true;
+        }
+    }
+
+    // Steal from the back of a peer's queue, starting at a different victim for each worker to spread contention.
+    auto count = m_coreWorkers.size();
+    auto start = std::hash<Worker*>()(worker) % count;
+    for (size_t i = 0; i < count; ++i) {
+        auto victim = m_coreWorkers[(start + i) % count].get();
+        if (victim == worker) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(victim->jobsMutex);
+        if (victim->jobs.popBack(job)) {
+            m_pendingJobs--;
+            m_jobsStolen++;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingScheduler::isSaturated() const {
+    return m_pendingJobs > 0 && 0 == m_idleWorkers;
+}
+
+void WorkStealingScheduler::monitorLoop() {
+    ThreadMoniker::setThisThreadMoniker(ThreadMoniker::generateMoniker());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shuttingDown) {
+        reapFinishedWorkersLocked();
+
+        m_monitorParked = true;
+        m_monitorWakeup.wait(lock, [this] { return m_shuttingDown || m_finishedWorkers > 0 || isSaturated(); });
+        m_monitorParked = false;
+        if (m_shuttingDown || !isSaturated()) {
+            continue;
+        }
+
+        // The scheduler is saturated; give the running jobs one interval to make progress.
+        uint64_t executed = m_jobsExecuted;
+        m_monitorWakeup.wait_for(lock, m_starvationInterval, [this] { return m_shuttingDown.load(); });
+        if (m_shuttingDown || !isSaturated() || executed != m_jobsExecuted) {
+            continue;
+        }
+
+        if (m_liveWorkers >= m_maxWorkerCount) {
+            ACSDK_WARN(LX("schedulerStarved").d("reason", "maxWorkersReached").d("maxWorkers", m_maxWorkerCount));
+            continue;
+        }
+
+        ACSDK_DEBUG5(LX("addingCompensationWorker").d("pendingJobs", m_pendingJobs).d("liveWorkers", m_liveWorkers));
+        m_compensationWorkers.push_back(memory::make_unique<Worker>(false));
+        m_compensationWorkersCreated++;
+        startWorker(m_compensationWorkers.back().get());
+    }
+}
+
+void WorkStealingScheduler::reapFinishedWorkersLocked() {
+    if (0 == m_finishedWorkers) {
+        return;
+    }
+    for (auto it = m_compensationWorkers.begin(); it != m_compensationWorkers.end();) {
+        if ((*it)->finished) {
+            if ((*it)->thread.joinable()) {
+                (*it)->thread.join();
+            }
+            it = m_compensationWorkers.erase(it);
+            m_finishedWorkers--;
+        } else {
+            ++it;
+        }
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
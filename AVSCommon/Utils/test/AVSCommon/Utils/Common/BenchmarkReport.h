@@ -0,0 +1,48 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_BENCHMARKREPORT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_BENCHMARKREPORT_H_
+
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+
+/**
+ * Utility function to report a result of a benchmark.  The result is printed to stdout on a line starting with
+ * "[ BENCHMARK ]", and recorded as a property of the current test named "<variant>_<name>".
+ *
+ * @param variant The variant of the code measured.
+ * @param name The name of the result.
+ * @param value The value of the result.
+ */
+void reportBenchmarkResult(const std::string& variant, const std::string& name, double value);
+
+/**
+ * Utility function to report a result of a benchmark which measures a single variant.  The result is printed to
+ * stdout on a line starting with "[ BENCHMARK ]", and recorded as a property of the current test named @c name.
+ *
+ * @param name The name of the result.
+ * @param value The value of the result.
+ */
+void reportBenchmarkResult(const std::string& name, double value);
+
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_BENCHMARKREPORT_H_
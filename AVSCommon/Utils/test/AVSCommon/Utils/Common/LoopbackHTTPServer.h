@@ -0,0 +1,116 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_LOOPBACKHTTPSERVER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_LOOPBACKHTTPSERVER_H_
+
+#ifdef __linux__
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface, which accepts a single request with a chunked body and records
+ * when each part of the body arrives.  It answers with an empty 200 response once the body is complete.
+ *
+ * Requests are sent to it in clear text.  No HTTP/2 server is available to unit tests, and the network loop of a
+ * connection does not depend on the protocol version.
+ */
+class LoopbackHTTPServer {
+public:
+    /// Destructor.
+    ~LoopbackHTTPServer();
+
+    /**
+     * Start listening.
+     *
+     * @return Whether the server started.
+     */
+    bool start();
+
+    /**
+     * Get the URL of the server, without a path.
+     *
+     * @return The URL of the server.
+     */
+    std::string getUrl() const;
+
+    /**
+     * Wait for more of the body than has arrived so far.
+     *
+     * @param size The number of bytes of the body which have arrived so far.
+     * @param timeout The maximum time to wait.
+     * @param[out] arrival When the latest part of the body arrived.
+     * @return The number of bytes of the body which have arrived, or @c size if none arrived before the timeout.
+     */
+    size_t waitForBody(size_t size, std::chrono::milliseconds timeout, std::chrono::steady_clock::time_point* arrival);
+
+    /**
+     * Wait for the body to contain some text.
+     *
+     * @param text The text to wait for.
+     * @param timeout The maximum time to wait.
+     * @return The number of bytes of the body which have arrived, or zero if @c text did not arrive before the timeout.
+     */
+    size_t waitForBodyContaining(const std::string& text, std::chrono::milliseconds timeout);
+
+private:
+    /// Accept a request, send interim and final responses, and record the body as it arrives.
+    void serve();
+
+    /**
+     * Record part of the body.
+     *
+     * @param data The part of the body.
+     * @param arrival When it arrived.
+     */
+    void appendBody(const std::string& data, std::chrono::steady_clock::time_point arrival);
+
+    /// The socket listening for the request.
+    int m_listenSocket = -1;
+
+    /// The port listened on.
+    int m_port = 0;
+
+    /// The thread serving the request.
+    std::thread m_thread;
+
+    /// Serializes access to @c m_body and @c m_lastArrival.
+    std::mutex m_mutex;
+
+    /// Notified when more of the body arrives.
+    std::condition_variable m_wakeTrigger;
+
+    /// The body received so far, including the chunked encoding.
+    std::string m_body;
+
+    /// When the body last grew.
+    std::chrono::steady_clock::time_point m_lastArrival;
+};
+
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_COMMON_LOOPBACKHTTPSERVER_H_
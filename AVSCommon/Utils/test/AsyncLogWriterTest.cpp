@@ -0,0 +1,316 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogWriter.h"
+#include "AVSCommon/Utils/Metrics/MetricEvent.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+using namespace ::testing;
+using namespace metrics;
+using namespace metrics::test;
+
+/// Moniker passed with every test entry.
+static const char* TEST_MONIKER = "TST";
+
+/// Number of entries logged by each producer thread.
+static const int ENTRIES_PER_PRODUCER = 500;
+
+/// Number of producer threads.
+static const int PRODUCER_COUNT = 4;
+
+/// Capacity of the writer in tests that exercise a full ring.
+static const size_t SMALL_CAPACITY = 8;
+
+/// Capacity of the writer in the other tests.
+static const size_t CAPACITY = 256;
+
+/**
+ * Test fixture that collects everything written to a pipe on a separate thread.
+ */
+class AsyncLogWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /// Start collecting everything written to the pipe.
+    void startReading();
+
+    /**
+     * Close the write end of the pipe and return everything written to it.
+     *
+     * @return The lines written to the pipe.
+     */
+    std::vector<std::string> closeAndRead();
+
+    /**
+     * Log an entry with the test moniker.
+     *
+     * @param writer The writer to log to.
+     * @param text The text of the entry.
+     * @return Whether the entry was queued.
+     */
+    bool push(AsyncLogWriter* writer, const std::string& text);
+
+    /// The read and write ends of the pipe.
+    int m_pipe[2];
+
+    /// Everything read from the pipe.
+    std::string m_output;
+
+    /// The thread reading the pipe.
+    std::thread m_reader;
+};
+
+void AsyncLogWriterTest::SetUp() {
+    ASSERT_EQ(0, pipe(m_pipe));
+}
+
+void AsyncLogWriterTest::TearDown() {
+    if (m_pipe[1] >= 0) {
+        close(m_pipe[1]);
+    }
+    if (m_reader.joinable()) {
+        m_reader.join();
+    }
+    close(m_pipe[0]);
+}
+
+void AsyncLogWriterTest::startReading() {
+    m_reader = std::thread([this] {
+        char buffer[4096];
+        ssize_t count;
+        while ((count = read(m_pipe[0], buffer, sizeof(buffer))) > 0) {
+            m_output.append(buffer, static_cast<size_t>(count));
+        }
+    });
+}
+
+std::vector<std::string> AsyncLogWriterTest::closeAndRead() {
+    close(m_pipe[1]);
+    m_pipe[1] = -1;
+    m_reader.join();
+    std::vector<std::string> lines;
+    std::istringstream stream(m_output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bool AsyncLogWriterTest::push(AsyncLogWriter* writer, const std::string& text) {
+    return writer->push(Level::INFO, std::chrono::system_clock::now(), TEST_MONIKER, text.c_str());
+}
+
+/**
+ * Return whether a formatted line ends with the given text.
+ *
+ * @param line The formatted line.
+ * @param text The expected text of the entry.
+ * @return Whether @c line ends with @c text.
+ */
+static bool endsWith(const std::string& line, const std::string& text) {
+    return line.size() >= text.size() && 0 == line.compare(line.size() - text.size(), text.size(), text);
+}
+
+/**
+ * Verify that @c create() rejects invalid arguments.
+ */
+TEST_F(AsyncLogWriterTest, test_createWithInvalidArguments) {
+    EXPECT_EQ(nullptr, AsyncLogWriter::create(-1, CAPACITY, AsyncLogWriter::OverflowPolicy::DROP));
+    EXPECT_EQ(nullptr, AsyncLogWriter::create(m_pipe[1], 0, AsyncLogWriter::OverflowPolicy::DROP));
+}
+
+/**
+ * Verify that entries from one thread are written in order, formatted, one per line.
+ */
+TEST_F(AsyncLogWriterTest, test_entriesWrittenInOrder) {
+    startReading();
+    auto writer = AsyncLogWriter::create(m_pipe[1], CAPACITY, AsyncLogWriter::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(writer);
+    for (int i = 0; i < ENTRIES_PER_PRODUCER; ++i) {
+        ASSERT_TRUE(push(writer.get(), "entry " + std::to_string(i)));
+    }
+    writer.reset();
+
+    auto lines = closeAndRead();
+    ASSERT_EQ(static_cast<size_t>(ENTRIES_PER_PRODUCER), lines.size());
+    for (int i = 0; i < ENTRIES_PER_PRODUCER; ++i) {
+        EXPECT_TRUE(endsWith(lines[i], " I entry " + std::to_string(i))) << lines[i];
+        EXPECT_NE(std::string::npos, lines[i].find(std::string("[") + TEST_MONIKER + "]")) << lines[i];
+    }
+}
+
+/**
+ * Verify that text too long to be stored inline in the ring is written intact.
+ */
+TEST_F(AsyncLogWriterTest, test_longEntryWrittenIntact) {
+    startReading();
+    auto writer = AsyncLogWriter::create(m_pipe[1], CAPACITY, AsyncLogWriter::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(writer);
+    std::string longText(AsyncLogWriter::INLINE_TEXT_SIZE * 4, 'x');
+    ASSERT_TRUE(push(writer.get(), longText));
+    ASSERT_TRUE(push(writer.get(), "short"));
+    writer.reset();
+
+    auto lines = closeAndRead();
+    ASSERT_EQ(2u, lines.size());
+    EXPECT_TRUE(endsWith(lines[0], longText));
+    EXPECT_TRUE(endsWith(lines[1], "short"));
+}
+
+/**
+ * Verify that with @c OverflowPolicy::BLOCK no entry from several threads is lost while the ring is much smaller than
+ * the number of entries, and that each thread's entries stay in order.
+ */
+TEST_F(AsyncLogWriterTest, test_blockPolicyLosesNothingUnderContention) {
+    startReading();
+    auto writer = AsyncLogWriter::create(m_pipe[1], SMALL_CAPACITY, AsyncLogWriter::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(writer);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCER_COUNT; ++producer) {
+        producers.emplace_back([this, &writer, producer] {
+            for (int i = 0; i < ENTRIES_PER_PRODUCER; ++i) {
+                push(writer.get(), "p" + std::to_string(producer) + " " + std::to_string(i));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(0u, writer->getDroppedCount());
+    writer.reset();
+
+    auto lines = closeAndRead();
+    ASSERT_EQ(static_cast<size_t>(PRODUCER_COUNT * ENTRIES_PER_PRODUCER), lines.size());
+    std::vector<int> next(PRODUCER_COUNT, 0);
+    for (const auto& line : lines) {
+        auto position = line.rfind(" p");
+        ASSERT_NE(std::string::npos, position) << line;
+        std::istringstream fields(line.substr(position + 2));
+        int producer = -1;
+        int index = -1;
+        fields >> producer >> index;
+        ASSERT_GE(producer, 0);
+        ASSERT_LT(producer, PRODUCER_COUNT);
+        EXPECT_EQ(next[producer], index) << line;
+        next[producer] = index + 1;
+    }
+}
+
+/**
+ * Verify that @c flush() returns only once earlier entries are readable from the file descriptor.
+ */
+TEST_F(AsyncLogWriterTest, test_flushWaitsForEarlierEntries) {
+    auto writer = AsyncLogWriter::create(m_pipe[1], CAPACITY, AsyncLogWriter::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(push(writer.get(), "flushed"));
+    writer->flush();
+
+    ASSERT_EQ(0, fcntl(m_pipe[0], F_SETFL, fcntl(m_pipe[0], F_GETFL) | O_NONBLOCK));
+    char buffer[1024];
+    ssize_t count = read(m_pipe[0], buffer, sizeof(buffer));
+    ASSERT_GT(count, 0);
+    EXPECT_TRUE(endsWith(std::string(buffer, static_cast<size_t>(count)), "flushed\n"));
+}
+
+/**
+ * Verify that with @c OverflowPolicy::DROP entries logged while the writer is stuck are dropped without blocking,
+ * and that the drops are counted, logged, and (when metrics recording is enabled) recorded as a metric once the writer
+ * can make progress again.
+ */
+TEST_F(AsyncLogWriterTest, test_dropPolicyCountsAndReportsDrops) {
+    auto metricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
+    std::shared_ptr<MetricEvent> recorded;
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(*metricRecorder, recordMetric(_)).WillOnce(SaveArg<0>(&recorded));
+#else
+    EXPECT_CALL(*metricRecorder, recordMetric(_)).Times(0);
+#endif
+
+    auto writer = AsyncLogWriter::create(m_pipe[1], SMALL_CAPACITY, AsyncLogWriter::OverflowPolicy::DROP);
+    ASSERT_TRUE(writer);
+    writer->setMetricRecorder(metricRecorder);
+
+    // Nothing reads the pipe yet, so the writer blocks in writev() once the pipe is full and the ring fills up.
+    std::string text(AsyncLogWriter::INLINE_TEXT_SIZE - 1, 'y');
+    uint64_t attempts = 0;
+    while (0 == writer->getDroppedCount()) {
+        push(writer.get(), text);
+        ASSERT_LT(++attempts, 1000000u);
+    }
+    auto dropped = writer->getDroppedCount();
+
+    startReading();
+    writer->flush();
+    writer.reset();
+
+    auto lines = closeAndRead();
+    size_t reports = 0;
+    for (const auto& line : lines) {
+        if (line.find("logEntriesDropped") != std::string::npos) {
+            ++reports;
+            EXPECT_NE(std::string::npos, line.find(" W AsyncLogWriter:")) << line;
+        }
+    }
+    EXPECT_GE(reports, 1u);
+    EXPECT_EQ(attempts, lines.size() - reports + dropped);
+
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    ASSERT_TRUE(recorded);
+    EXPECT_EQ("AsyncLogWriter-logEntriesDropped", recorded->getActivityName());
+    auto dataPoint = recorded->getDataPoint("logEntriesDropped", DataType::COUNTER);
+    ASSERT_TRUE(dataPoint.hasValue());
+    EXPECT_EQ(std::to_string(dropped), dataPoint.value().getValue());
+#endif
+}
+
+/**
+ * Verify the conversion of configured policy names.
+ */
+TEST_F(AsyncLogWriterTest, test_convertNameToOverflowPolicy) {
+    auto policy = AsyncLogWriter::OverflowPolicy::BLOCK;
+    EXPECT_TRUE(AsyncLogWriter::convertNameToOverflowPolicy("DROP", &policy));
+    EXPECT_EQ(AsyncLogWriter::OverflowPolicy::DROP, policy);
+    EXPECT_TRUE(AsyncLogWriter::convertNameToOverflowPolicy("BLOCK", &policy));
+    EXPECT_EQ(AsyncLogWriter::OverflowPolicy::BLOCK, policy);
+    EXPECT_FALSE(AsyncLogWriter::convertNameToOverflowPolicy("drop", &policy));
+    EXPECT_FALSE(AsyncLogWriter::convertNameToOverflowPolicy("DROP", nullptr));
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,197 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AsyncLoggerBenchmarkTest.cpp
+///
+/// Measures the latency an @c ACSDK_INFO style call adds to the logging thread when several threads log at once, for
+/// a logger that formats and writes each line while holding a mutex (as @c ConsoleLogger does by default) and for one
+/// that hands entries to an @c AsyncLogWriter. Lines are written to /dev/null so that only the logging path itself is
+/// measured. Percentiles are printed to stdout and recorded as test properties; only correctness is asserted so that
+/// the test is stable on loaded build machines.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogWriter.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+using namespace std::chrono;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AsyncLoggerBenchmarkTest");
+
+/// Create a @c LogEntry using this file's @c TAG and the specified event string.
+#define LX(event) LogEntry(TAG, event)
+
+/// Number of concurrently logging threads.
+static const int THREAD_COUNT = 8;
+
+/// Number of entries logged by each thread.
+static const int ENTRIES_PER_THREAD = 20000;
+
+/// Number of entries the asynchronous writer can hold, enough for a burst from every thread.
+static const size_t ASYNC_CAPACITY = 16384;
+
+/// A @c Logger that formats and writes each line on the logging thread while holding a mutex.
+class SynchronousFdLogger : public Logger {
+public:
+    SynchronousFdLogger(int fd) : Logger(Level::INFO), m_fd{fd} {
+    }
+
+    void emit(Level level, system_clock::time_point time, const char* threadMoniker, const char* text) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto line = m_formatter.format(level, time, threadMoniker, text);
+        line += '\n';
+        if (write(m_fd, line.data(), line.size()) < 0) {
+            m_failures++;
+        }
+    }
+
+    /// The number of failed writes.
+    int m_failures = 0;
+
+private:
+    int m_fd;
+    std::mutex m_mutex;
+    LogStringFormatter m_formatter;
+};
+
+/// A @c Logger that hands each entry to an @c AsyncLogWriter.
+class AsynchronousFdLogger : public Logger {
+public:
+    AsynchronousFdLogger(int fd, AsyncLogWriter::OverflowPolicy policy) :
+            Logger(Level::INFO),
+            m_writer{AsyncLogWriter::create(fd, ASYNC_CAPACITY, policy)} {
+    }
+
+    void emit(Level level, system_clock::time_point time, const char* threadMoniker, const char* text) override {
+        m_writer->push(level, time, threadMoniker, text);
+    }
+
+    /// The writer.
+    std::unique_ptr<AsyncLogWriter> m_writer;
+};
+
+/// Fixture which opens /dev/null.
+class AsyncLoggerBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_devNull = open("/dev/null", O_WRONLY);
+        ASSERT_GE(m_devNull, 0);
+    }
+
+    void TearDown() override {
+        close(m_devNull);
+    }
+
+    /**
+     * Log from @c THREAD_COUNT threads at once, exactly as @c ACSDK_INFO does, and report latency percentiles.
+     *
+     * @param variant The name of the logger variant.
+     * @param logger The logger to log to.
+     */
+    void measure(const std::string& variant, Logger& logger) {
+        std::vector<std::vector<nanoseconds::rep>> latencies(THREAD_COUNT);
+        std::atomic<int> ready{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([t, &logger, &latencies, &ready] {
+                auto& mine = latencies[t];
+                mine.reserve(ENTRIES_PER_THREAD);
+                ready++;
+                while (ready < THREAD_COUNT) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < ENTRIES_PER_THREAD; ++i) {
+                    auto start = steady_clock::now();
+                    if (logger.shouldLog(Level::INFO)) {
+                        logger.log(Level::INFO, LX("benchmark").d("thread", t).d("index", i).m("payload"));
+                    }
+                    mine.push_back(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::vector<nanoseconds::rep> all;
+        for (auto& mine : latencies) {
+            all.insert(all.end(), mine.begin(), mine.end());
+        }
+        ASSERT_EQ(static_cast<size_t>(THREAD_COUNT * ENTRIES_PER_THREAD), all.size());
+        std::sort(all.begin(), all.end());
+        auto percentile = [&all](double p) {
+            return static_cast<double>(all[static_cast<size_t>(p * (all.size() - 1))]) / 1000.0;
+        };
+        reportBenchmarkResult(variant, "p50Us", percentile(0.50));
+        reportBenchmarkResult(variant, "p99Us", percentile(0.99));
+        reportBenchmarkResult(variant, "p999Us", percentile(0.999));
+        reportBenchmarkResult(variant, "maxUs", percentile(1.0));
+    }
+
+    /// The file descriptor lines are written to.
+    int m_devNull = -1;
+};
+
+/// Per-call latency of a mutex-guarded synchronous logger versus @c AsyncLogWriter, with 8 logging threads.
+TEST_F(AsyncLoggerBenchmarkTest, testSlow_infoLatencyUnderContention) {
+    {
+        SynchronousFdLogger logger(m_devNull);
+        measure("SYNCHRONOUS", logger);
+        EXPECT_EQ(0, logger.m_failures);
+    }
+    // DROP shows the cost of the hand-off itself; when the background thread cannot keep up, entries are dropped.
+    {
+        AsynchronousFdLogger logger(m_devNull, AsyncLogWriter::OverflowPolicy::DROP);
+        ASSERT_TRUE(logger.m_writer);
+        measure("ASYNC_DROP", logger);
+        logger.m_writer->flush();
+        reportBenchmarkResult("ASYNC_DROP", "dropped", static_cast<double>(logger.m_writer->getDroppedCount()));
+    }
+    // BLOCK writes every entry, so logging threads wait whenever the ring is full.
+    {
+        AsynchronousFdLogger logger(m_devNull, AsyncLogWriter::OverflowPolicy::BLOCK);
+        ASSERT_TRUE(logger.m_writer);
+        measure("ASYNC_BLOCK", logger);
+        logger.m_writer->flush();
+        EXPECT_EQ(0u, logger.m_writer->getDroppedCount());
+    }
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,207 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file BinaryFileLoggerBenchmarkTest.cpp
+///
+/// Measures the CPU time and wall time it takes several threads logging at once to log entries with the metadata an
+/// @c ACSDK_INFO call typically has, through @c ConsoleLogger and through @c BinaryFileLogger.  Standard output is
+/// redirected to /dev/null while @c ConsoleLogger is measured, so that only the logging path itself is measured; the
+/// binary files are written to a temporary directory.  Both include building the text of each @c LogEntry.  Results
+/// are printed to stdout and recorded as test properties; only correctness is asserted so that the test is stable on
+/// loaded build machines.
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/Logger/BinaryFileLogger.h"
+#include "AVSCommon/Utils/Logger/BinaryLogDecoder.h"
+#include "AVSCommon/Utils/Logger/ConsoleLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+using namespace std::chrono;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("BinaryFileLoggerBenchmarkTest");
+
+/// Create a @c LogEntry using this file's @c TAG and the specified event string.
+#define LX(event) LogEntry(TAG, event)
+
+/// Number of concurrently logging threads.
+static const int THREAD_COUNT = 8;
+
+/// Number of entries logged by each thread.
+static const int ENTRIES_PER_THREAD = 20000;
+
+/// Size of the binary file, large enough to hold every entry.
+static const size_t FILE_SIZE = 64 * 1024 * 1024;
+
+/// Number of binary files kept.
+static const size_t FILE_COUNT = 2;
+
+/**
+ * Get the CPU time this process has used so far, in user and system mode.
+ *
+ * @return The CPU time.
+ */
+static microseconds cpuTime() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/// Fixture which provides a temporary directory for the binary files.
+class BinaryFileLoggerBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/BinaryFileLoggerBenchmarkTestXXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(pattern));
+        m_directory = pattern;
+        m_path = m_directory + "/sdk.binlog";
+    }
+
+    void TearDown() override {
+        unlink(m_path.c_str());
+        for (size_t i = 1; i < FILE_COUNT; ++i) {
+            unlink((m_path + "." + std::to_string(i)).c_str());
+        }
+        rmdir(m_directory.c_str());
+    }
+
+    /**
+     * Log from @c THREAD_COUNT threads at once, exactly as @c ACSDK_INFO does, and measure the CPU and wall time per
+     * entry.
+     *
+     * @param logger The logger to log to.
+     * @param[out] cpuPerEntry The CPU time per entry, in microseconds.
+     * @param[out] wallPerEntry The wall time per entry, in microseconds.
+     */
+    void measure(Logger& logger, double* cpuPerEntry, double* wallPerEntry) {
+        std::atomic<int> ready{0};
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([t, &logger, &ready, &start] {
+                ready++;
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < ENTRIES_PER_THREAD; ++i) {
+                    if (logger.shouldLog(Level::INFO)) {
+                        logger.log(
+                            Level::INFO,
+                            LX("benchmark")
+                                .d("reason", "requestTimedOut")
+                                .d("thread", t)
+                                .d("index", i)
+                                .d("isActive", 0 == i % 2)
+                                .m("payload"));
+                    }
+                }
+            });
+        }
+        while (ready < THREAD_COUNT) {
+            std::this_thread::yield();
+        }
+        auto cpuStart = cpuTime();
+        auto wallStart = steady_clock::now();
+        start = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        duration<double, std::micro> wall = steady_clock::now() - wallStart;
+        duration<double, std::micro> cpu = cpuTime() - cpuStart;
+        *cpuPerEntry = cpu.count() / (THREAD_COUNT * ENTRIES_PER_THREAD);
+        *wallPerEntry = wall.count() / (THREAD_COUNT * ENTRIES_PER_THREAD);
+    }
+
+    /// The temporary directory.
+    std::string m_directory;
+
+    /// The path of the current binary file.
+    std::string m_path;
+};
+
+/// CPU time per entry of @c ConsoleLogger versus @c BinaryFileLogger, with 8 logging threads.
+TEST_F(BinaryFileLoggerBenchmarkTest, testSlow_cpuTimeUnderContention) {
+    double consoleCpu = 0;
+    double consoleWall = 0;
+    {
+        auto console = getConsoleLogger();
+        ASSERT_TRUE(console->shouldLog(Level::INFO));
+        std::cout.flush();
+        int savedStdout = dup(STDOUT_FILENO);
+        int devNull = open("/dev/null", O_WRONLY);
+        ASSERT_GE(savedStdout, 0);
+        ASSERT_GE(devNull, 0);
+        ASSERT_GE(dup2(devNull, STDOUT_FILENO), 0);
+        close(devNull);
+        measure(*console, &consoleCpu, &consoleWall);
+        std::cout.flush();
+        dup2(savedStdout, STDOUT_FILENO);
+        close(savedStdout);
+    }
+    reportBenchmarkResult("CONSOLE", "cpuMicrosecondsPerEntry", consoleCpu);
+    reportBenchmarkResult("CONSOLE", "wallMicrosecondsPerEntry", consoleWall);
+
+    double binaryCpu = 0;
+    double binaryWall = 0;
+    {
+        auto binary = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(binary);
+        ASSERT_TRUE(binary->shouldLog(Level::INFO));
+        measure(*binary, &binaryCpu, &binaryWall);
+    }
+    reportBenchmarkResult("BINARY_FILE", "cpuMicrosecondsPerEntry", binaryCpu);
+    reportBenchmarkResult("BINARY_FILE", "wallMicrosecondsPerEntry", binaryWall);
+    reportBenchmarkResult("BINARY_FILE", "cpuSavedPercent", 100.0 * (1.0 - binaryCpu / consoleCpu));
+
+    std::stringstream decoded;
+    ASSERT_TRUE(BinaryLogDecoder::decodeFile(m_path, decoded));
+    size_t lines = 0;
+    std::string line;
+    while (std::getline(decoded, line)) {
+        ++lines;
+    }
+    EXPECT_EQ(static_cast<size_t>(THREAD_COUNT * ENTRIES_PER_THREAD), lines);
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
@@ -0,0 +1,270 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/BinaryFileLogger.h"
+#include "AVSCommon/Utils/Logger/BinaryLogDecoder.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("BinaryFileLoggerTest");
+
+/// Create a @c LogEntry using this file's @c TAG and the specified event string.
+#define LX(event) LogEntry(TAG, event)
+
+/// Size of each file in the rotation test.
+static const size_t SMALL_FILE_SIZE = BinaryFileLogger::MIN_FILE_SIZE;
+
+/// Size of each file in the other tests.
+static const size_t FILE_SIZE = 1024 * 1024;
+
+/// Number of files kept in the rotation test.
+static const size_t FILE_COUNT = 3;
+
+/// Number of entries logged in the rotation and size tests.
+static const int ENTRY_COUNT = 1000;
+
+/**
+ * Test fixture which provides a temporary directory for log files.
+ */
+class BinaryFileLoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/BinaryFileLoggerTestXXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(pattern));
+        m_directory = pattern;
+        m_path = m_directory + "/sdk.binlog";
+    }
+
+    void TearDown() override {
+        for (size_t i = 0; i <= FILE_COUNT; ++i) {
+            unlink(fileName(i).c_str());
+        }
+        rmdir(m_directory.c_str());
+    }
+
+    /**
+     * The name of a file of the rotation.
+     *
+     * @param index 0 for the current file, 1 for the previous one and so on.
+     * @return The name of the file.
+     */
+    std::string fileName(size_t index) {
+        return 0 == index ? m_path : m_path + "." + std::to_string(index);
+    }
+
+    /**
+     * Decode a file into lines.
+     *
+     * @param path The file.
+     * @param[out] lines The decoded lines are appended here.
+     * @return Whether the file was valid.
+     */
+    bool decode(const std::string& path, std::vector<std::string>* lines) {
+        std::stringstream out;
+        bool result = BinaryLogDecoder::decodeFile(path, out);
+        std::string line;
+        while (std::getline(out, line)) {
+            lines->push_back(line);
+        }
+        return result;
+    }
+
+    /// The temporary directory.
+    std::string m_directory;
+
+    /// The path of the current file.
+    std::string m_path;
+};
+
+/**
+ * Verify that decoding reproduces exactly the lines @c ConsoleLogger would print, for entries using every kind of
+ * metadata value, messages, and text not built by @c LogEntry.
+ */
+TEST_F(BinaryFileLoggerTest, test_decodeReproducesTextFormat) {
+    std::vector<std::string> texts = {
+        LX("noMetadata").c_str(),
+        LX("integers").d("zero", 0).d("positive", 42).d("negative", -17).d("large", 123456789012345678LL).c_str(),
+        LX("notCanonicalIntegers").d("leadingZero", "007").d("plus", "+5").d("minusZero", "-0").c_str(),
+        LX("tooLongForInteger").d("digits", "1234567890123456789012").c_str(),
+        LX("booleans").d("yes", true).d("no", false).c_str(),
+        LX("escaped").d("reserved", R"(a\b,c:d=e)").d("empty", "").c_str(),
+        LX("messageOnly").m("a message: with separators, and = signs").c_str(),
+        LX("metadataAndMessage").d("key", "value").m("message").c_str(),
+        LX("").c_str(),
+        "free text without separators",
+        "source:event:malformed pair",
+        "source:event:key=value,",
+        "source:event:",
+        "",
+    };
+
+    LogStringFormatter formatter;
+    std::vector<std::string> expected;
+    {
+        auto logger = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        auto time = std::chrono::system_clock::now();
+        const char* monikers[] = {"1", "2", "a long thread moniker"};
+        for (size_t i = 0; i < texts.size(); ++i) {
+            // Include out-of-order times; deltas are signed.
+            auto entryTime = time + std::chrono::milliseconds(static_cast<int>(i % 3) * 250 - 100);
+            auto level = 0 == i % 2 ? Level::INFO : Level::ERROR;
+            const char* moniker = monikers[i % 3];
+            logger->emit(level, entryTime, moniker, texts[i].c_str());
+            expected.push_back(formatter.format(level, entryTime, moniker, texts[i].c_str()));
+        }
+    }
+
+    std::vector<std::string> lines;
+    ASSERT_TRUE(decode(m_path, &lines));
+    ASSERT_EQ(expected.size(), lines.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i], lines[i]);
+    }
+}
+
+/**
+ * Verify that entries logged through @c Logger::log(), as the ACSDK_* macros do, are decoded.
+ */
+TEST_F(BinaryFileLoggerTest, test_logThroughLoggerInterface) {
+    {
+        auto logger = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        logger->setLevel(Level::INFO);
+        logger->log(Level::INFO, LX("logged").d("index", 1));
+        logger->log(Level::DEBUG9, LX("filtered"));
+    }
+    std::vector<std::string> lines;
+    ASSERT_TRUE(decode(m_path, &lines));
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_NE(std::string::npos, lines[0].find(" I BinaryFileLoggerTest:logged:index=1"));
+}
+
+/**
+ * Verify that full files are rotated, only the configured number of files is kept, each file decodes on its own, and
+ * the kept files hold the most recent entries in order.
+ */
+TEST_F(BinaryFileLoggerTest, test_rotation) {
+    {
+        auto logger = BinaryFileLogger::create(m_path, SMALL_FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        for (int i = 0; i < ENTRY_COUNT; ++i) {
+            logger->log(Level::INFO, LX("rotation").d("index", i).d("text", "some text to fill the file"));
+        }
+    }
+
+    struct stat status;
+    EXPECT_NE(0, stat(fileName(FILE_COUNT).c_str(), &status));
+    std::vector<std::string> lines;
+    for (size_t i = FILE_COUNT; i > 0; --i) {
+        ASSERT_EQ(0, stat(fileName(i - 1).c_str(), &status));
+        EXPECT_LE(static_cast<size_t>(status.st_size), SMALL_FILE_SIZE);
+        ASSERT_TRUE(decode(fileName(i - 1), &lines));
+    }
+    ASSERT_FALSE(lines.empty());
+    ASSERT_LT(lines.size(), static_cast<size_t>(ENTRY_COUNT));
+    int index = ENTRY_COUNT - static_cast<int>(lines.size());
+    for (const auto& line : lines) {
+        EXPECT_NE(std::string::npos, line.find(":rotation:index=" + std::to_string(index++) + ",")) << line;
+    }
+}
+
+/**
+ * Verify that opening rotates files left by an earlier run instead of overwriting them.
+ */
+TEST_F(BinaryFileLoggerTest, test_openKeepsPreviousRun) {
+    {
+        auto logger = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        logger->log(Level::INFO, LX("firstRun"));
+    }
+    {
+        auto logger = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        logger->log(Level::INFO, LX("secondRun"));
+    }
+    std::vector<std::string> previous;
+    std::vector<std::string> current;
+    ASSERT_TRUE(decode(fileName(1), &previous));
+    ASSERT_TRUE(decode(fileName(0), &current));
+    ASSERT_EQ(1u, previous.size());
+    ASSERT_EQ(1u, current.size());
+    EXPECT_NE(std::string::npos, previous[0].find("firstRun"));
+    EXPECT_NE(std::string::npos, current[0].find("secondRun"));
+}
+
+/**
+ * Verify that repetitive entries take much less space than their text.
+ */
+TEST_F(BinaryFileLoggerTest, test_binarySmallerThanText) {
+    size_t textSize = 0;
+    {
+        auto logger = BinaryFileLogger::create(m_path, FILE_SIZE, FILE_COUNT);
+        ASSERT_TRUE(logger);
+        LogStringFormatter formatter;
+        for (int i = 0; i < ENTRY_COUNT; ++i) {
+            LogEntry entry(TAG, "onFocusChanged");
+            entry.d("channel", "Dialog").d("newFocus", "FOREGROUND").d("offset", i * 20);
+            auto now = std::chrono::system_clock::now();
+            logger->emit(Level::INFO, now, "12", entry.c_str());
+            textSize += formatter.format(Level::INFO, now, "12", entry.c_str()).size() + 1;
+        }
+    }
+    struct stat status;
+    ASSERT_EQ(0, stat(m_path.c_str(), &status));
+    EXPECT_LT(static_cast<size_t>(status.st_size) * 3, textSize);
+}
+
+/**
+ * Verify that invalid files are rejected.
+ */
+TEST_F(BinaryFileLoggerTest, test_decodeRejectsInvalidData) {
+    std::stringstream out;
+    std::vector<uint8_t> garbage(64, 0x5a);
+    EXPECT_FALSE(BinaryLogDecoder::decode(garbage.data(), garbage.size(), out));
+    EXPECT_FALSE(BinaryLogDecoder::decodeFile(m_directory + "/missing", out));
+    EXPECT_TRUE(out.str().empty());
+}
+
+/**
+ * Verify that invalid settings are rejected.
+ */
+TEST_F(BinaryFileLoggerTest, test_createWithInvalidSettings) {
+    EXPECT_FALSE(BinaryFileLogger::create("", FILE_SIZE, FILE_COUNT));
+    EXPECT_FALSE(BinaryFileLogger::create(m_path, BinaryFileLogger::MIN_FILE_SIZE - 1, FILE_COUNT));
+    EXPECT_FALSE(BinaryFileLogger::create(m_path, FILE_SIZE, 0));
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,38 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Common/BenchmarkReport.h"
+
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+
+void reportBenchmarkResult(const std::string& variant, const std::string& name, double value) {
+    std::cout << "[ BENCHMARK ] " << variant << " " << name << "=" << value << std::endl;
+    ::testing::Test::RecordProperty(variant + "_" + name, std::to_string(value));
+}
+
+void reportBenchmarkResult(const std::string& name, double value) {
+    std::cout << "[ BENCHMARK ] " << name << "=" << value << std::endl;
+    ::testing::Test::RecordProperty(name, std::to_string(value));
+}
+
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
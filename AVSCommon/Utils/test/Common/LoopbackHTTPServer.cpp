@@ -0,0 +1,135 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Common/LoopbackHTTPServer.h"
+
+#ifdef __linux__
+
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+
+using namespace std::chrono;
+
+/// The end of a chunked request body.
+static const std::string LAST_CHUNK = "0\r\n\r\n";
+
+LoopbackHTTPServer::~LoopbackHTTPServer() {
+    if (m_listenSocket >= 0) {
+        // Unblocks a thread which is still waiting in accept().
+        shutdown(m_listenSocket, SHUT_RDWR);
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    if (m_listenSocket >= 0) {
+        close(m_listenSocket);
+    }
+}
+
+bool LoopbackHTTPServer::start() {
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenSocket < 0) {
+        return false;
+    }
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 || listen(m_listenSocket, 1) != 0 ||
+        getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return false;
+    }
+    m_port = ntohs(address.sin_port);
+    m_thread = std::thread(&LoopbackHTTPServer::serve, this);
+    return true;
+}
+
+std::string LoopbackHTTPServer::getUrl() const {
+    return "http://127.0.0.1:" + std::to_string(m_port);
+}
+
+size_t LoopbackHTTPServer::waitForBody(size_t size, milliseconds timeout, steady_clock::time_point* arrival) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_wakeTrigger.wait_for(lock, timeout, [this, size] { return m_body.size() > size; });
+    *arrival = m_lastArrival;
+    return m_body.size();
+}
+
+size_t LoopbackHTTPServer::waitForBodyContaining(const std::string& text, milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_wakeTrigger.wait_for(lock, timeout, [this, &text] { return m_body.find(text) != std::string::npos; })) {
+        return 0;
+    }
+    return m_body.size();
+}
+
+void LoopbackHTTPServer::serve() {
+    auto connection = accept(m_listenSocket, nullptr, nullptr);
+    if (connection < 0) {
+        return;
+    }
+    std::string headers;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = recv(connection, buffer, sizeof(buffer), 0)) > 0) {
+        auto arrival = steady_clock::now();
+        if (headers.find("\r\n\r\n") == std::string::npos) {
+            headers.append(buffer, count);
+            auto end = headers.find("\r\n\r\n");
+            if (end == std::string::npos) {
+                continue;
+            }
+            std::string interim = "HTTP/1.1 100 Continue\r\n\r\n";
+            send(connection, interim.data(), interim.size(), MSG_NOSIGNAL);
+            appendBody(headers.substr(end + 4), arrival);
+        } else {
+            appendBody(std::string(buffer, count), arrival);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_body.size() >= LAST_CHUNK.size() &&
+            m_body.compare(m_body.size() - LAST_CHUNK.size(), LAST_CHUNK.size(), LAST_CHUNK) == 0) {
+            break;
+        }
+    }
+    std::string response = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+    send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+    close(connection);
+}
+
+void LoopbackHTTPServer::appendBody(const std::string& data, steady_clock::time_point arrival) {
+    if (data.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_body += data;
+    m_lastArrival = arrival;
+    m_wakeTrigger.notify_all();
+}
+
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
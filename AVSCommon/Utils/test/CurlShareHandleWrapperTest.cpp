@@ -0,0 +1,341 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file CurlShareHandleWrapperTest.cpp
+///
+/// Tests that easy handles resume the TLS sessions of earlier handles through the process share.  The requests are
+/// sent to an HTTPS server on the loopback interface with a self-signed certificate, which closes each connection
+/// after one request and counts the full and resumed handshakes.
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h"
+#include "AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::utils::configuration;
+
+/// The number of requests sent by each test, each on a new easy handle.
+static const int REQUEST_COUNT = 5;
+
+/// The response the server sends to every request, closing the connection so that the next one needs a handshake.
+static const std::string RESPONSE = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\nConnection: close\r\n\r\nOK";
+
+/**
+ * A minimal HTTPS server on the loopback interface, which answers each request on a new connection and counts how
+ * many of the TLS handshakes resumed a session.
+ */
+class LoopbackTlsServer {
+public:
+    /// Destructor.
+    ~LoopbackTlsServer() {
+        if (m_listenSocket >= 0) {
+            // Unblocks the thread waiting in accept().
+            shutdown(m_listenSocket, SHUT_RDWR);
+        }
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        if (m_listenSocket >= 0) {
+            close(m_listenSocket);
+        }
+        SSL_CTX_free(m_context);
+        X509_free(m_certificate);
+        EVP_PKEY_free(m_key);
+        if (!m_certificatePath.empty()) {
+            unlink(m_certificatePath.c_str());
+        }
+    }
+
+    /**
+     * Create a self-signed certificate for 127.0.0.1 and start listening.
+     *
+     * @return Whether the server started.
+     */
+    bool start() {
+        return createCertificate() && writeCertificate() && createContext() && listenOnLoopback();
+    }
+
+    /**
+     * Get the URL to send requests to.
+     *
+     * @return The URL to send requests to.
+     */
+    std::string getUrl() const {
+        return "https://127.0.0.1:" + std::to_string(m_port) + "/";
+    }
+
+    /**
+     * Get the path of a file holding the server's certificate in PEM format, for clients to trust.
+     *
+     * @return The path of the certificate.
+     */
+    std::string getCertificatePath() const {
+        return m_certificatePath;
+    }
+
+    /// The number of handshakes which negotiated a new session.
+    std::atomic<int> countOfFullHandshakes{0};
+
+    /// The number of handshakes which resumed an earlier session.
+    std::atomic<int> countOfResumedHandshakes{0};
+
+private:
+    /// Generate a key and a self-signed certificate for 127.0.0.1.
+    bool createCertificate() {
+        auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+        bool generated = keyContext && EVP_PKEY_keygen_init(keyContext) > 0 &&
+                         EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1) > 0 &&
+                         EVP_PKEY_keygen(keyContext, &m_key) > 0;
+        EVP_PKEY_CTX_free(keyContext);
+        m_certificate = X509_new();
+        if (!generated || !m_certificate) {
+            return false;
+        }
+        X509_set_version(m_certificate, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(m_certificate), 1);
+        X509_gmtime_adj(X509_getm_notBefore(m_certificate), -60);
+        X509_gmtime_adj(X509_getm_notAfter(m_certificate), 60 * 60);
+        X509_set_pubkey(m_certificate, m_key);
+        auto name = X509_get_subject_name(m_certificate);
+        X509_NAME_add_entry_by_txt(
+            name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("127.0.0.1"), -1, -1, 0);
+        X509_set_issuer_name(m_certificate, name);
+
+        X509V3_CTX extensionContext;
+        X509V3_set_ctx_nodb(&extensionContext);
+        X509V3_set_ctx(&extensionContext, m_certificate, m_certificate, nullptr, nullptr, 0);
+        const std::vector<std::pair<int, const char*>> extensions = {{NID_basic_constraints, "critical,CA:TRUE"},
+                                                                     {NID_subject_key_identifier, "hash"},
+                                                                     {NID_subject_alt_name, "IP:127.0.0.1"}};
+        for (auto& extension : extensions) {
+            auto created =
+                X509V3_EXT_conf_nid(nullptr, &extensionContext, extension.first, const_cast<char*>(extension.second));
+            if (!created) {
+                return false;
+            }
+            X509_add_ext(m_certificate, created, -1);
+            X509_EXTENSION_free(created);
+        }
+        return X509_sign(m_certificate, m_key, EVP_sha256()) > 0;
+    }
+
+    /// Write the certificate to a temporary file.
+    bool writeCertificate() {
+        char path[] = "/tmp/CurlShareHandleWrapperTest-XXXXXX";
+        auto fd = mkstemp(path);
+        if (fd < 0) {
+            return false;
+        }
+        m_certificatePath = path;
+        auto file = fdopen(fd, "w");
+        if (!file) {
+            close(fd);
+            return false;
+        }
+        bool written = PEM_write_X509(file, m_certificate) > 0;
+        fclose(file);
+        return written;
+    }
+
+    /// Create the TLS context, which caches sessions and issues session tickets as servers do by default.
+    bool createContext() {
+        m_context = SSL_CTX_new(TLS_server_method());
+        static const unsigned char SESSION_ID_CONTEXT[] = "CurlShareHandleWrapperTest";
+        return m_context && SSL_CTX_use_certificate(m_context, m_certificate) > 0 &&
+               SSL_CTX_use_PrivateKey(m_context, m_key) > 0 &&
+               SSL_CTX_set_session_id_context(m_context, SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1) > 0;
+    }
+
+    /// Listen on an ephemeral port of the loopback interface, and start serving.
+    bool listenOnLoopback() {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listenSocket < 0) {
+            return false;
+        }
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            listen(m_listenSocket, REQUEST_COUNT) != 0 ||
+            getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread(&LoopbackTlsServer::serve, this);
+        return true;
+    }
+
+    /// Answer a request on each connection accepted, until the listening socket is shut down.
+    void serve() {
+        int connection;
+        while ((connection = accept(m_listenSocket, nullptr, nullptr)) >= 0) {
+            auto ssl = SSL_new(m_context);
+            SSL_set_fd(ssl, connection);
+            if (SSL_accept(ssl) > 0) {
+                if (SSL_session_reused(ssl)) {
+                    ++countOfResumedHandshakes;
+                } else {
+                    ++countOfFullHandshakes;
+                }
+                std::string request;
+                char buffer[4096];
+                int count;
+                while (request.find("\r\n\r\n") == std::string::npos &&
+                       (count = SSL_read(ssl, buffer, sizeof(buffer))) > 0) {
+                    request.append(buffer, count);
+                }
+                SSL_write(ssl, RESPONSE.data(), static_cast<int>(RESPONSE.size()));
+                SSL_shutdown(ssl);
+            }
+            SSL_free(ssl);
+            close(connection);
+        }
+    }
+
+    /// The server's key.
+    EVP_PKEY* m_key = nullptr;
+
+    /// The server's self-signed certificate.
+    X509* m_certificate = nullptr;
+
+    /// The path of the file holding the certificate.
+    std::string m_certificatePath;
+
+    /// The TLS context of the connections.
+    SSL_CTX* m_context = nullptr;
+
+    /// The socket listening for connections.
+    int m_listenSocket = -1;
+
+    /// The port listened on.
+    int m_port = 0;
+
+    /// The thread which serves the connections.
+    std::thread m_thread;
+};
+
+/**
+ * Callback which discards the response body.
+ *
+ * @return The size of the data, to tell curl it was consumed.
+ */
+static size_t discardCallback(char* buffer, size_t blockSize, size_t numBlocks, void* userData) {
+    return blockSize * numBlocks;
+}
+
+/// Test harness for sharing TLS sessions between @c CurlEasyHandleWrapper instances.
+class CurlShareHandleWrapperTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+    }
+
+    void TearDown() override {
+        ConfigurationNode::uninitialize();
+    }
+
+    /**
+     * Configure libcurl to trust the server, and whether to share TLS sessions.
+     *
+     * @param shareDnsAndTlsSessions The value of the @c shareDnsAndTlsSessions configuration option.
+     */
+    void configure(bool shareDnsAndTlsSessions) {
+        std::stringstream json;
+        json << R"({"libcurlUtils":{"CURLOPT_CAINFO":")" << m_server.getCertificatePath()
+             << R"(","shareDnsAndTlsSessions":)" << (shareDnsAndTlsSessions ? "true" : "false") << "}}";
+        ConfigurationNode::uninitialize();
+        ASSERT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>(json.str())}));
+    }
+
+    /// Send @c REQUEST_COUNT requests to the server, each on a new easy handle.
+    void sendRequests() {
+        for (int i = 0; i < REQUEST_COUNT; ++i) {
+            CurlEasyHandleWrapper handle;
+            ASSERT_TRUE(handle.isValid());
+            ASSERT_TRUE(handle.setURL(m_server.getUrl()));
+            ASSERT_TRUE(handle.setTransferType(CurlEasyHandleWrapper::TransferType::kGET));
+            ASSERT_TRUE(handle.setWriteCallback(discardCallback, nullptr));
+            ASSERT_EQ(handle.perform(), CURLE_OK);
+            ASSERT_EQ(handle.getHTTPResponseCode(), 200);
+        }
+    }
+
+    /// The server the requests are sent to.
+    LoopbackTlsServer m_server;
+};
+
+/**
+ * Test that only the first of several handles to a server performs a full TLS handshake, and the others resume its
+ * session.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_laterHandlesResumeTlsSession) {
+    configure(true);
+    ASSERT_NE(CurlShareHandleWrapper::getProcessShare(), nullptr);
+    sendRequests();
+    EXPECT_EQ(m_server.countOfFullHandshakes, 1);
+    EXPECT_EQ(m_server.countOfResumedHandshakes, REQUEST_COUNT - 1);
+}
+
+/**
+ * Test that each handle performs a full TLS handshake when sharing is disabled by configuration.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_sharingDisabledByConfiguration) {
+    configure(false);
+    ASSERT_EQ(CurlShareHandleWrapper::getProcessShare(), nullptr);
+    sendRequests();
+    EXPECT_EQ(m_server.countOfFullHandshakes, REQUEST_COUNT);
+    EXPECT_EQ(m_server.countOfResumedHandshakes, 0);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
@@ -0,0 +1,304 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file ExecutorBenchmarkTest.cpp
+///
+/// Compares the dedicated thread and shared scheduler @c Executor modes, and the cost of the @c submit() and
+/// @c execute() submission paths. Results are printed to stdout and recorded as test properties; only correctness is
+/// asserted so that the tests are stable on loaded build machines.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/AVS/CapabilityTag.h"
+#include "AVSCommon/Utils/Threading/Executor.h"
+
+/// The number of calls to the global @c operator @c new made by this process.
+static std::atomic<uint64_t> g_allocationCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocationCount++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// GCC 11 and later flag the inlined free() of memory from the replaced operator new as mismatched.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+using namespace std::chrono;
+
+/// Number of executors used, roughly the number of @c Executor members in a full SDK client.
+static const size_t EXECUTOR_COUNT = 50;
+
+/// Number of tasks submitted to each executor in the throughput benchmark.
+static const size_t TASKS_PER_EXECUTOR = 2000;
+
+/// Number of round trips in the latency benchmark.
+static const size_t ROUND_TRIPS = 2000;
+
+/// Number of tasks submitted in the submission cost benchmark.
+static const size_t SUBMISSION_TASKS = 20000;
+
+/// Number of tasks submitted before waiting for them, keeping the queue depth within the reused node pool.
+static const size_t SUBMISSION_BURST = 32;
+
+/// Timeout used while waiting for the benchmark to complete.
+static const seconds WAIT_TIMEOUT{30};
+
+/**
+ * Read a numeric field such as "Threads:" or "VmRSS:" from /proc/self/status.
+ *
+ * @param field The field name including the trailing colon.
+ * @return The value of the field, or 0 if it is unavailable.
+ */
+static uint64_t readProcStatus(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string name;
+    while (status >> name) {
+        if (name == field) {
+            uint64_t value = 0;
+            status >> value;
+            return value;
+        }
+        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+}
+
+/// Fixture parameterized on the executor mode under test.
+class ExecutorBenchmarkTest : public ::testing::TestWithParam<ExecutorMode> {
+protected:
+    /// Human readable name of the mode under test.
+    std::string modeName() {
+        return GetParam() == ExecutorMode::SHARED_SCHEDULER ? "SHARED_SCHEDULER" : "DEDICATED_THREAD";
+    }
+};
+
+/// Many executors each receive a burst of tasks; measures throughput, peak threads and RSS.
+TEST_P(ExecutorBenchmarkTest, testSlow_throughputThreadsAndRss) {
+    auto baseThreads = readProcStatus("Threads:");
+    auto baseRssKb = readProcStatus("VmRSS:");
+
+    std::vector<std::unique_ptr<Executor>> executors;
+    for (size_t i = 0; i < EXECUTOR_COUNT; ++i) {
+        executors.emplace_back(new Executor(GetParam()));
+    }
+
+    std::atomic<size_t> remaining{EXECUTOR_COUNT * TASKS_PER_EXECUTOR};
+    std::promise<void> donePromise;
+    auto doneFuture = donePromise.get_future();
+    std::atomic<uint64_t> sink{0};
+
+    auto start = steady_clock::now();
+    for (size_t t = 0; t < TASKS_PER_EXECUTOR; ++t) {
+        for (auto& executor : executors) {
+            executor->submit([&remaining, &donePromise, &sink, t] {
+                sink += t;
+                if (0 == --remaining) {
+                    donePromise.set_value();
+                }
+            });
+        }
+    }
+    auto peakThreads = readProcStatus("Threads:");
+    auto peakRssKb = readProcStatus("VmRSS:");
+    ASSERT_EQ(doneFuture.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    auto elapsed = duration_cast<microseconds>(steady_clock::now() - start).count();
+
+    reportBenchmarkResult(
+        modeName(), "tasksPerSecond", EXECUTOR_COUNT * TASKS_PER_EXECUTOR * 1e6 / std::max<int64_t>(elapsed, 1));
+    reportBenchmarkResult(modeName(), "extraThreads", static_cast<double>(peakThreads) - baseThreads);
+    reportBenchmarkResult(modeName(), "extraRssKb", static_cast<double>(peakRssKb) - baseRssKb);
+}
+
+/// A single task round trip (submit and wait on the future) while other executors are idle; measures latency.
+TEST_P(ExecutorBenchmarkTest, testSlow_roundTripLatency) {
+    std::vector<std::unique_ptr<Executor>> executors;
+    for (size_t i = 0; i < EXECUTOR_COUNT; ++i) {
+        executors.emplace_back(new Executor(GetParam()));
+    }
+
+    std::vector<int64_t> samples;
+    samples.reserve(ROUND_TRIPS);
+    for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+        auto& executor = executors[i % EXECUTOR_COUNT];
+        auto start = steady_clock::now();
+        auto future = executor->submit([i] { return i; });
+        ASSERT_EQ(future.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+        ASSERT_EQ(future.get(), i);
+        samples.push_back(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    reportBenchmarkResult(modeName(), "p50LatencyUs", samples[samples.size() / 2] / 1000.0);
+    reportBenchmarkResult(modeName(), "p99LatencyUs", samples[samples.size() * 99 / 100] / 1000.0);
+}
+
+/**
+ * Submit tasks in bursts through @c submitOne and wait for each burst to complete, without allocating while waiting.
+ *
+ * @param submitOne Submits one task which increments the given counter.
+ * @param completed The counter incremented by the tasks.
+ * @param[out] allocationsPerTask The average number of allocations made per task.
+ * @param[out] nsPerTask The average wall clock time per task in nanoseconds.
+ */
+template <typename SubmitOne>
+static void measureSubmission(
+    SubmitOne submitOne,
+    std::atomic<size_t>& completed,
+    double& allocationsPerTask,
+    double& nsPerTask) {
+    auto runBursts = [&](size_t taskCount) {
+        size_t submitted = 0;
+        while (submitted < taskCount) {
+            for (size_t i = 0; i < SUBMISSION_BURST; ++i) {
+                submitOne();
+            }
+            submitted += SUBMISSION_BURST;
+            while (completed < submitted) {
+                std::this_thread::yield();
+            }
+        }
+        completed = 0;
+    };
+
+    // Warm up so that node pools and worker threads are in their steady state.
+    runBursts(SUBMISSION_BURST * 4);
+
+    auto allocationsBefore = g_allocationCount.load();
+    auto start = steady_clock::now();
+    runBursts(SUBMISSION_TASKS);
+    auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    allocationsPerTask = static_cast<double>(g_allocationCount - allocationsBefore) / SUBMISSION_TASKS;
+    nsPerTask = static_cast<double>(elapsed) / SUBMISSION_TASKS;
+}
+
+/// Measures allocations and time per task for @c submit() and the fire-and-forget @c execute().
+TEST_P(ExecutorBenchmarkTest, testSlow_submissionCost) {
+    Executor executor(GetParam());
+    std::atomic<size_t> completed{0};
+    double allocationsPerTask = 0;
+    double nsPerTask = 0;
+
+    measureSubmission(
+        [&executor, &completed] { executor.submit([&completed] { completed++; }); },
+        completed,
+        allocationsPerTask,
+        nsPerTask);
+    reportBenchmarkResult(modeName(), "submitAllocationsPerTask", allocationsPerTask);
+    reportBenchmarkResult(modeName(), "submitNsPerTask", nsPerTask);
+    auto submitAllocationsPerTask = allocationsPerTask;
+
+    measureSubmission(
+        [&executor, &completed] { executor.execute([&completed] { completed++; }); },
+        completed,
+        allocationsPerTask,
+        nsPerTask);
+    reportBenchmarkResult(modeName(), "executeAllocationsPerTask", allocationsPerTask);
+    reportBenchmarkResult(modeName(), "executeNsPerTask", nsPerTask);
+
+    EXPECT_LT(allocationsPerTask, submitAllocationsPerTask);
+}
+
+/**
+ * Measures allocations per task for @c execute() with the capture shapes of two migrated call sites:
+ * @c ContextManager::getContext(), which is stored inline, and @c ContextManager::setState(), whose @c CapabilityTag
+ * capture is not nothrow movable and so is stored on the heap. The strings fit the small string buffer so that only
+ * the submission path is counted.
+ */
+TEST_P(ExecutorBenchmarkTest, testSlow_executeCallSiteCaptureCost) {
+    Executor executor(GetParam());
+    std::atomic<size_t> completed{0};
+    // Not const, as by-copy captures of const strings are not nothrow movable and would be stored on the heap.
+    auto requester = std::make_shared<int>(0);
+    std::string endpointId("endpointId");
+    unsigned int token = 1;
+    milliseconds timeout{100};
+    double allocationsPerTask = 0;
+    double nsPerTask = 0;
+
+    measureSubmission(
+        [&executor, &completed, &requester, &endpointId, token, timeout] {
+            auto counter = &completed;
+            auto task = [counter, requester, endpointId, token, timeout] {
+                if (requester && !endpointId.empty() && token && timeout.count()) {
+                    (*counter)++;
+                }
+            };
+            static_assert(InlineTask::fitsInline<decltype(task)>(), "getContext shaped task should fit inline");
+            executor.execute(std::move(task));
+        },
+        completed,
+        allocationsPerTask,
+        nsPerTask);
+    reportBenchmarkResult(modeName(), "getContextExecuteAllocationsPerTask", allocationsPerTask);
+    reportBenchmarkResult(modeName(), "getContextExecuteNsPerTask", nsPerTask);
+    EXPECT_LT(allocationsPerTask, 0.1);
+
+    const avs::CapabilityTag capabilityIdentifier("Alerts", "AlertsState", "endpointId");
+    const std::string jsonState("{}");
+    measureSubmission(
+        [&executor, &completed, &capabilityIdentifier, &jsonState, token] {
+            auto counter = &completed;
+            executor.execute([counter, capabilityIdentifier, jsonState, token] {
+                if (!capabilityIdentifier.name.empty() && !jsonState.empty() && token) {
+                    (*counter)++;
+                }
+            });
+        },
+        completed,
+        allocationsPerTask,
+        nsPerTask);
+    reportBenchmarkResult(modeName(), "setStateExecuteAllocationsPerTask", allocationsPerTask);
+    reportBenchmarkResult(modeName(), "setStateExecuteNsPerTask", nsPerTask);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Modes,
+    ExecutorBenchmarkTest,
+    ::testing::Values(ExecutorMode::DEDICATED_THREAD, ExecutorMode::SHARED_SCHEDULER));
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
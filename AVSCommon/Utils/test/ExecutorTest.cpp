@@ -14,6 +14,9 @@
  */
 
 #include <list>
+#include <memory>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "ExecutorTestUtils.h"
@@ -26,44 +29,50 @@ namespace utils {
 namespace threading {
 namespace test {
 
-class ExecutorTest : public ::testing::Test {
+/// Fixture parameterized on the @c ExecutorMode so that both modes honor the same contract.
+class ExecutorTest : public ::testing::TestWithParam<ExecutorMode> {
 public:
+    /// Constructor.
+    ExecutorTest() : executor{GetParam()} {
+    }
+
+    /// The executor under test.
     Executor executor;
 };
 
-TEST_F(ExecutorTest, test_submitStdFunctionAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitStdFunctionAndVerifyExecution) {
     std::function<void()> function = []() {};
     auto future = executor.submit(function);
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitStdBindAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitStdBindAndVerifyExecution) {
     auto future = executor.submit(std::bind(exampleFunctionParams, 0));
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitLambdaAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitLambdaAndVerifyExecution) {
     auto future = executor.submit([]() {});
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionPointerAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionPointerAndVerifyExecution) {
     auto future = executor.submit(&exampleFunction);
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitFunctorAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctorAndVerifyExecution) {
     ExampleFunctor exampleFunctor;
     auto future = executor.submit(exampleFunctor);
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeNoArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeNoArgsAndVerifyExecution) {
     int value = VALUE;
     auto future = executor.submit([=]() { return value; });
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
@@ -71,7 +80,7 @@ TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeNoArgsAndVerifyEx
     ASSERT_EQ(future.get(), value);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypeNoArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithObjectReturnTypeNoArgsAndVerifyExecution) {
     SimpleObject value(VALUE);
     auto future = executor.submit([=]() { return value; });
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
@@ -79,21 +88,21 @@ TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypeNoArgsAndVerifyExecu
     ASSERT_EQ(future.get().getValue(), value.getValue());
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithNoReturnTypePrimitiveArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithNoReturnTypePrimitiveArgsAndVerifyExecution) {
     int value = VALUE;
     auto future = executor.submit([](int number) {}, value);
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithNoReturnTypeObjectArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithNoReturnTypeObjectArgsAndVerifyExecution) {
     SimpleObject arg(0);
     auto future = executor.submit([](SimpleObject object) {}, arg);
     auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
     ASSERT_EQ(future_status, std::future_status::ready);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeObjectArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeObjectArgsAndVerifyExecution) {
     int value = VALUE;
     SimpleObject arg(0);
     auto future = executor.submit([=](SimpleObject object) { return value; }, arg);
@@ -102,7 +111,7 @@ TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypeObjectArgsAndVeri
     ASSERT_EQ(future.get(), value);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypePrimitiveArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithObjectReturnTypePrimitiveArgsAndVerifyExecution) {
     int arg = 0;
     SimpleObject value(VALUE);
     auto future = executor.submit([=](int primitive) { return value; }, arg);
@@ -111,7 +120,7 @@ TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypePrimitiveArgsAndVeri
     ASSERT_EQ(future.get().getValue(), value.getValue());
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypePrimitiveArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypePrimitiveArgsAndVerifyExecution) {
     int arg = 0;
     int value = VALUE;
     auto future = executor.submit([=](int number) { return value; }, arg);
@@ -120,7 +129,7 @@ TEST_F(ExecutorTest, test_submitFunctionWithPrimitiveReturnTypePrimitiveArgsAndV
     ASSERT_EQ(future.get(), value);
 }
 
-TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypeObjectArgsAndVerifyExecution) {
+TEST_P(ExecutorTest, test_submitFunctionWithObjectReturnTypeObjectArgsAndVerifyExecution) {
     SimpleObject value(VALUE);
     SimpleObject arg(0);
     auto future = executor.submit([=](SimpleObject object) { return value; }, arg);
@@ -129,7 +138,7 @@ TEST_F(ExecutorTest, test_submitFunctionWithObjectReturnTypeObjectArgsAndVerifyE
     ASSERT_EQ(future.get().getValue(), value.getValue());
 }
 
-TEST_F(ExecutorTest, test_submitToFront) {
+TEST_P(ExecutorTest, test_submitToFront) {
     std::atomic<bool> ready(false);
     std::atomic<bool> blocked(false);
     std::list<int> order;
@@ -168,7 +177,7 @@ TEST_F(ExecutorTest, test_submitToFront) {
     ASSERT_EQ(order.back(), 2);
 }
 
-TEST_F(ExecutorTest, test_executionOrderEqualToSubmitOrder) {
+TEST_P(ExecutorTest, test_executionOrderEqualToSubmitOrder) {
     WaitEvent waitSetUp;
     executor.submit([&waitSetUp] { waitSetUp.wait(SHORT_TIMEOUT_MS); });
 
@@ -218,7 +227,7 @@ struct SlowDestructor {
 };
 
 /// This test verifies that the executor waits to fulfill its promise until after the task is cleaned up.
-TEST_F(ExecutorTest, test_futureWaitsForTaskCleanup) {
+TEST_P(ExecutorTest, test_futureWaitsForTaskCleanup) {
     std::atomic<bool> cleanedUp(false);
     SlowDestructor slowDestructor;
 
@@ -237,7 +246,7 @@ TEST_F(ExecutorTest, test_futureWaitsForTaskCleanup) {
 }
 
 /// This test verifies that the shutdown function completes the current task and does not accept new tasks.
-TEST_F(ExecutorTest, test_shutdown) {
+TEST_P(ExecutorTest, test_shutdown) {
     std::atomic<bool> ready(false);
     std::atomic<bool> blocked(false);
 
@@ -273,7 +282,7 @@ TEST_F(ExecutorTest, test_shutdown) {
 }
 
 /// Test that calling submit after shutdown will fail the job.
-TEST_F(ExecutorTest, test_pushAfterExecutordownFail) {
+TEST_P(ExecutorTest, test_pushAfterExecutordownFail) {
     executor.shutdown();
     ASSERT_TRUE(executor.isShutdown());
 
@@ -282,7 +291,7 @@ TEST_F(ExecutorTest, test_pushAfterExecutordownFail) {
 }
 
 /// Test that shutdown cancel jobs in the queue.
-TEST_F(ExecutorTest, test_shutdownCancelJob) {
+TEST_P(ExecutorTest, test_shutdownCancelJob) {
     bool executed = false;
     WaitEvent waitSetUp, waitJobStart;
     std::future<void> jobToDropResult;
@@ -314,6 +323,95 @@ TEST_F(ExecutorTest, test_shutdownCancelJob) {
     // Executed should still be false.
     EXPECT_FALSE(executed);
 }
+
+/// Test that tasks submitted to many executors from many threads keep per-executor submission order.
+TEST_P(ExecutorTest, test_manyExecutorsKeepPerExecutorOrder) {
+    const int executorCount = 8;
+    const int tasksPerExecutor = 500;
+    std::vector<std::unique_ptr<Executor>> executors;
+    std::vector<std::vector<int>> orders(executorCount);
+    for (int i = 0; i < executorCount; ++i) {
+        executors.emplace_back(new Executor(GetParam()));
+    }
+
+    std::vector<std::thread> submitters;
+    for (int i = 0; i < executorCount; ++i) {
+        submitters.emplace_back([&executors, &orders, i, tasksPerExecutor] {
+            for (int value = 0; value < tasksPerExecutor; ++value) {
+                executors[i]->submit([&orders, i, value] { orders[i].push_back(value); });
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+
+    for (int i = 0; i < executorCount; ++i) {
+        executors[i]->waitForSubmittedTasks();
+        ASSERT_EQ(orders[i].size(), static_cast<size_t>(tasksPerExecutor));
+        for (int value = 0; value < tasksPerExecutor; ++value) {
+            ASSERT_EQ(orders[i][value], value);
+        }
+    }
+}
+
+/// Test that a task blocked waiting on another executor does not deadlock, regardless of the worker count.
+TEST_P(ExecutorTest, test_taskWaitingOnAnotherExecutorCompletes) {
+    Executor other{GetParam()};
+    auto future = executor.submit([&other] { return other.submit([] { return VALUE; }).get(); });
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(future.get(), VALUE);
+}
+
+/// A task which cannot be copied, appending a value to a list when run.
+struct MoveOnlyTask {
+    MoveOnlyTask(std::list<int>* order, int value) : order{order}, value{new int(value)} {
+    }
+    void operator()() {
+        order->push_back(*value);
+    }
+    std::list<int>* order;
+    std::unique_ptr<int> value;
+};
+
+/// Test that execute runs a move-only task and that executeToFront queues ahead of pending tasks.
+TEST_P(ExecutorTest, test_executeAndExecuteToFront) {
+    std::atomic<bool> ready(false);
+    std::atomic<bool> blocked(false);
+    std::list<int> order;
+
+    ASSERT_TRUE(executor.execute([&] {
+        blocked = true;
+        while (!ready) {
+            std::this_thread::yield();
+        }
+    }));
+    while (!blocked) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_TRUE(executor.execute(MoveOnlyTask(&order, 1)));
+    ASSERT_TRUE(executor.execute([&] { order.push_back(2); }));
+    ASSERT_TRUE(executor.executeToFront([&] { order.push_back(3); }));
+
+    ready = true;
+    executor.waitForSubmittedTasks();
+
+    ASSERT_EQ(order, (std::list<int>{3, 1, 2}));
+}
+
+/// Test that execute is rejected after shutdown.
+TEST_P(ExecutorTest, test_executeAfterShutdownFails) {
+    executor.shutdown();
+    EXPECT_FALSE(executor.execute([] {}));
+    EXPECT_FALSE(executor.executeToFront([] {}));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Modes,
+    ExecutorTest,
+    ::testing::Values(ExecutorMode::SHARED_SCHEDULER, ExecutorMode::DEDICATED_THREAD));
+
 }  // namespace test
 }  // namespace threading
 }  // namespace utils
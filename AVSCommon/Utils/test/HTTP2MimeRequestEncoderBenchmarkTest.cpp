@@ -0,0 +1,267 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file HTTP2MimeRequestEncoderBenchmarkTest.cpp
+///
+/// Measures the throughput and CPU time of encoding a Recognize event carrying 10 seconds of 16 kHz PCM with
+/// @c HTTP2MimeRequestEncoder, reading the audio from an attachment as @c MessageRequestHandler does.  The audio is
+/// either buffered before the request is sent, or streamed a 10 ms frame at a time as a microphone produces it.
+/// Results are printed to stdout and recorded as test properties; only correctness is asserted so that the test is
+/// stable on loaded build machines.
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2MimeRequestSourceInterface.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+namespace test {
+
+using namespace avs::attachment;
+using namespace std::chrono;
+
+/// The size of the Recognize audio: 10 seconds of 16 kHz, 16 bit PCM.
+static const size_t AUDIO_SIZE = 10 * 16000 * sizeof(int16_t);
+
+/// The size of a 10 ms frame of the audio.
+static const size_t FRAME_SIZE = AUDIO_SIZE / 1000;
+
+/// The size of the buffer curl passes to the read callback of an upload.
+static const size_t CURL_BUFFER_SIZE = 16 * 1024;
+
+/// The number of Recognize events encoded by each variant.
+static const size_t RECOGNIZE_EVENTS = 200;
+
+/// The boundary of the request.
+static const std::string BOUNDARY = "WhooHooZeerOoonie=";
+
+/// The JSON of the Recognize event.
+static const std::string RECOGNIZE_JSON =
+    "{\"context\":[],\"event\":{\"header\":{\"namespace\":\"SpeechRecognizer\",\"name\":\"Recognize\",\"messageId\":"
+    "\"9b5e2c0e-5f4b-4d5a-9d7c-2b3a1f0e6c4d\",\"dialogRequestId\":\"0b1e7a4c-3f6d-4e2b-8a9c-5d7f1e3b2a6c\"},"
+    "\"payload\":{\"profile\":\"NEAR_FIELD\",\"format\":\"AUDIO_L16_RATE_16000_CHANNELS_1\",\"initiator\":{\"type\":"
+    "\"TAP\"}}}}";
+
+/**
+ * A source which sends a Recognize event and its audio attachment in the way @c MessageRequestHandler does, including
+ * not reading the attachment again after a read which emptied it.
+ */
+class RecognizeSource : public HTTP2MimeRequestSourceInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param reader The reader of the audio attachment.
+     */
+    RecognizeSource(std::unique_ptr<AttachmentReader> reader) :
+            m_reader{std::move(reader)},
+            m_countOfPartsSent{0},
+            m_countOfJsonBytesSent{0},
+            m_wasLastReadShort{false},
+            m_countOfReads{0} {
+    }
+
+    std::vector<std::string> getRequestHeaderLines() override {
+        return {};
+    }
+
+    HTTP2GetMimeHeadersResult getMimePartHeaderLines() override {
+        switch (m_countOfPartsSent) {
+            case 0:
+                return HTTP2GetMimeHeadersResult(
+                    {"Content-Disposition: form-data; name=\"metadata\"", "Content-Type: application/json"});
+            case 1:
+                return HTTP2GetMimeHeadersResult(
+                    {"Content-Disposition: form-data; name=\"audio\"", "Content-Type: application/octet-stream"});
+            default:
+                return HTTP2GetMimeHeadersResult::COMPLETE;
+        }
+    }
+
+    HTTP2SendDataResult onSendMimePartData(char* bytes, size_t size) override {
+        if (0 == m_countOfPartsSent) {
+            auto countToCopy = std::min(size, RECOGNIZE_JSON.size() - m_countOfJsonBytesSent);
+            if (0 == countToCopy) {
+                ++m_countOfPartsSent;
+                return HTTP2SendDataResult::COMPLETE;
+            }
+            memcpy(bytes, RECOGNIZE_JSON.data() + m_countOfJsonBytesSent, countToCopy);
+            m_countOfJsonBytesSent += countToCopy;
+            return HTTP2SendDataResult(countToCopy);
+        }
+        if (m_wasLastReadShort) {
+            m_wasLastReadShort = false;
+            return HTTP2SendDataResult::PAUSE;
+        }
+        ++m_countOfReads;
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        auto bytesRead = m_reader->read(bytes, size, &readStatus);
+        switch (readStatus) {
+            case AttachmentReader::ReadStatus::OK:
+            case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+            case AttachmentReader::ReadStatus::OK_TIMEDOUT:
+                m_wasLastReadShort = bytesRead != 0 && bytesRead < size;
+                return bytesRead != 0 ? HTTP2SendDataResult(bytesRead) : HTTP2SendDataResult::PAUSE;
+            case AttachmentReader::ReadStatus::CLOSED:
+                ++m_countOfPartsSent;
+                return HTTP2SendDataResult::COMPLETE;
+            default:
+                return HTTP2SendDataResult::ABORT;
+        }
+    }
+
+    /// The reader of the audio attachment.
+    std::unique_ptr<AttachmentReader> m_reader;
+    /// The number of parts sent.
+    size_t m_countOfPartsSent;
+    /// The number of bytes of @c RECOGNIZE_JSON sent.
+    size_t m_countOfJsonBytesSent;
+    /// Whether the last read of the audio attachment returned less than was asked for.
+    bool m_wasLastReadShort;
+    /// The number of reads of the audio attachment.
+    size_t m_countOfReads;
+};
+
+/**
+ * Get the CPU time used by this process so far.
+ *
+ * @return The user and system CPU time.
+ */
+static microseconds cpuTime() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/// Fixture which holds the audio and the expected request.
+class HTTP2MimeRequestEncoderBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_audio.resize(AUDIO_SIZE);
+        for (size_t i = 0; i < AUDIO_SIZE; ++i) {
+            m_audio[i] = static_cast<char>(i * 7 + i / 256);
+        }
+        m_expected = "\r\n--" + BOUNDARY +
+                     "\r\nContent-Disposition: form-data; name=\"metadata\"\r\nContent-Type: application/json\r\n\r\n" +
+                     RECOGNIZE_JSON + "\r\n--" + BOUNDARY +
+                     "\r\nContent-Disposition: form-data; name=\"audio\"\r\nContent-Type: application/octet-stream"
+                     "\r\n\r\n" +
+                     m_audio + "\r\n--" + BOUNDARY + "--\r\n";
+    }
+
+    /**
+     * Encode Recognize events, and report the throughput and CPU time.
+     *
+     * @param variant The name of the variant.
+     * @param isStreamed Whether the audio is written a frame at a time while the request is sent, rather than before.
+     */
+    void run(const std::string& variant, bool isStreamed) {
+        // Room for a whole buffer after the request, as curl always offers a full buffer.
+        std::vector<char> request(m_expected.size() + CURL_BUFFER_SIZE);
+        size_t countOfCallbacks = 0;
+        size_t countOfReads = 0;
+        duration<double> elapsed{0};
+        microseconds cpu{0};
+
+        for (size_t event = 0; event < RECOGNIZE_EVENTS; ++event) {
+            InProcessAttachment attachment("audio");
+            auto writer = attachment.createWriter();
+            auto source = std::make_shared<RecognizeSource>(
+                attachment.createReader(InProcessAttachmentReader::SDSTypeReader::Policy::NONBLOCKING));
+            HTTP2MimeRequestEncoder encoder(BOUNDARY, source);
+            size_t written = 0;
+            size_t sent = 0;
+            auto writeStatus = AttachmentWriter::WriteStatus::OK;
+            if (!isStreamed) {
+                ASSERT_EQ(writer->write(m_audio.data(), AUDIO_SIZE, &writeStatus), AUDIO_SIZE);
+                written = AUDIO_SIZE;
+                writer->close();
+            }
+
+            auto startCpu = cpuTime();
+            auto start = steady_clock::now();
+            while (true) {
+                auto result = encoder.onSendData(request.data() + sent, CURL_BUFFER_SIZE);
+                ++countOfCallbacks;
+                if (HTTP2SendStatus::COMPLETE == result.status) {
+                    break;
+                }
+                ASSERT_NE(result.status, HTTP2SendStatus::ABORT);
+                sent += result.size;
+                if (HTTP2SendStatus::PAUSE == result.status) {
+                    // Stands in for the microphone producing the next frame.
+                    ASSERT_LT(written, AUDIO_SIZE);
+                    ASSERT_EQ(writer->write(m_audio.data() + written, FRAME_SIZE, &writeStatus), FRAME_SIZE);
+                    written += FRAME_SIZE;
+                    if (AUDIO_SIZE == written) {
+                        writer->close();
+                    }
+                }
+            }
+            elapsed += steady_clock::now() - start;
+            cpu += duration_cast<microseconds>(cpuTime() - startCpu);
+            countOfReads += source->m_countOfReads;
+
+            ASSERT_EQ(sent, m_expected.size());
+            ASSERT_EQ(0, memcmp(request.data(), m_expected.data(), sent));
+        }
+
+        auto bytes = static_cast<double>(m_expected.size() * RECOGNIZE_EVENTS);
+        reportBenchmarkResult(variant, "megabytesPerSecond", bytes / elapsed.count() / 1e6);
+        reportBenchmarkResult(
+            variant, "cpuMicrosecondsPerRecognize", static_cast<double>(cpu.count()) / RECOGNIZE_EVENTS);
+        reportBenchmarkResult(
+            variant, "callbacksPerRecognize", static_cast<double>(countOfCallbacks) / RECOGNIZE_EVENTS);
+        reportBenchmarkResult(
+            variant, "attachmentReadsPerRecognize", static_cast<double>(countOfReads) / RECOGNIZE_EVENTS);
+    }
+
+    /// The Recognize audio.
+    std::string m_audio;
+    /// The encoded request.
+    std::string m_expected;
+};
+
+/// A Recognize event whose audio is buffered before the request is sent, as when the audio comes from a file.
+TEST_F(HTTP2MimeRequestEncoderBenchmarkTest, testSlow_bufferedRecognize) {
+    run("BUFFERED", false);
+}
+
+/// A Recognize event whose audio arrives a 10 ms frame at a time while the request is sent.
+TEST_F(HTTP2MimeRequestEncoderBenchmarkTest, testSlow_streamedRecognize) {
+    run("STREAMED", true);
+}
+
+}  // namespace test
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,329 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LibCurlHttpContentFetcherBenchmarkTest.cpp
+///
+/// Measures the wall time and the number of connections opened to fetch an HLS playlist and its 200 segments with
+/// @c LibCurlHttpContentFetcher, one fetcher per URL as @c UrlContentToAttachmentConverter does, with and without a
+/// @c CurlMultiHandlePool.  The server is an HTTP/1.1 server on the loopback interface which keeps connections alive.
+/// Results are printed to stdout and recorded as test properties; only correctness and connection reuse are asserted
+/// so that the test is stable on loaded build machines.
+
+#ifdef __linux__
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/LibcurlUtils/CurlMultiHandlePool.h"
+#include "AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avs::attachment;
+using namespace sdkInterfaces;
+using namespace std::chrono;
+
+/// The number of segments in the playlist.
+static const int SEGMENT_COUNT = 200;
+
+/// The size of a segment: 4 seconds of 128 kbps audio.
+static const size_t SEGMENT_SIZE = 64 * 1024;
+
+/// How long to wait for a fetch to make progress before giving up.
+static const milliseconds TIMEOUT{5000};
+
+/// The path of the playlist.
+static const std::string PLAYLIST_PATH = "/playlist.m3u8";
+
+/**
+ * Get the path of a segment.
+ *
+ * @param index The index of the segment.
+ * @return The path of the segment.
+ */
+static std::string getSegmentPath(int index) {
+    return "/segment" + std::to_string(index) + ".ts";
+}
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface, which serves the playlist and its segments on keep-alive
+ * connections and counts the connections accepted.
+ */
+class LoopbackServer {
+public:
+    /// Constructor.
+    LoopbackServer() : m_countOfConnections{0} {
+        m_playlist = "#EXTM3U\n#EXT-X-TARGETDURATION:4\n";
+        for (int i = 0; i < SEGMENT_COUNT; ++i) {
+            m_playlist += "#EXTINF:4.0,\n" + getSegmentPath(i).substr(1) + "\n";
+        }
+        m_playlist += "#EXT-X-ENDLIST\n";
+        m_segment.resize(SEGMENT_SIZE);
+        for (size_t i = 0; i < SEGMENT_SIZE; ++i) {
+            m_segment[i] = static_cast<char>(i * 7 + i / 256);
+        }
+    }
+
+    /// Destructor.
+    ~LoopbackServer() {
+        if (m_listenSocket >= 0) {
+            // Unblocks the thread waiting in accept().
+            shutdown(m_listenSocket, SHUT_RDWR);
+        }
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        {
+            // Unblocks the threads waiting for the next request on a connection kept alive.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto connection : m_connections) {
+                shutdown(connection, SHUT_RDWR);
+            }
+        }
+        for (auto& thread : m_connectionThreads) {
+            thread.join();
+        }
+        for (auto connection : m_connections) {
+            close(connection);
+        }
+        if (m_listenSocket >= 0) {
+            close(m_listenSocket);
+        }
+    }
+
+    /**
+     * Start listening.
+     *
+     * @return Whether the server started.
+     */
+    bool start() {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listenSocket < 0) {
+            return false;
+        }
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            listen(m_listenSocket, SOMAXCONN) != 0 ||
+            getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread(&LoopbackServer::acceptConnections, this);
+        return true;
+    }
+
+    /**
+     * Get the URL of a path on the server.
+     *
+     * @param path The path.
+     * @return The URL.
+     */
+    std::string getUrl(const std::string& path) const {
+        return "http://127.0.0.1:" + std::to_string(m_port) + path;
+    }
+
+    /// The playlist.
+    std::string m_playlist;
+
+    /// The content of every segment.
+    std::string m_segment;
+
+    /// The number of connections accepted.
+    std::atomic<size_t> m_countOfConnections;
+
+private:
+    /// Accept connections until the listening socket is shut down, serving each on its own thread.
+    void acceptConnections() {
+        int connection;
+        while ((connection = accept(m_listenSocket, nullptr, nullptr)) >= 0) {
+            ++m_countOfConnections;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_connections.push_back(connection);
+            m_connectionThreads.emplace_back(&LoopbackServer::serve, this, connection);
+        }
+    }
+
+    /**
+     * Answer the requests on a connection until the client closes it.  The connection is closed by the destructor.
+     *
+     * @param connection The connection.
+     */
+    void serve(int connection) {
+        std::string received;
+        char buffer[4096];
+        ssize_t count;
+        while ((count = recv(connection, buffer, sizeof(buffer), 0)) > 0) {
+            received.append(buffer, count);
+            size_t end;
+            while ((end = received.find("\r\n\r\n")) != std::string::npos) {
+                auto pathStart = received.find(' ') + 1;
+                auto path = received.substr(pathStart, received.find(' ', pathStart) - pathStart);
+                received.erase(0, end + 4);
+                const std::string& body = PLAYLIST_PATH == path ? m_playlist : m_segment;
+                auto response = std::string("HTTP/1.1 200 OK\r\nContent-Type: ") +
+                                (PLAYLIST_PATH == path ? "application/vnd.apple.mpegurl" : "video/mp2t") +
+                                "\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+                if (send(connection, response.data(), response.size(), MSG_NOSIGNAL) !=
+                    static_cast<ssize_t>(response.size())) {
+                    break;
+                }
+            }
+        }
+    }
+
+    /// The socket listening for connections.
+    int m_listenSocket = -1;
+
+    /// The port listened on.
+    int m_port = 0;
+
+    /// The thread which accepts connections.
+    std::thread m_thread;
+
+    /// Serializes access to @c m_connections and @c m_connectionThreads.
+    std::mutex m_mutex;
+
+    /// The connections accepted.
+    std::vector<int> m_connections;
+
+    /// The threads serving the connections.
+    std::vector<std::thread> m_connectionThreads;
+};
+
+/// Fixture which runs the server.
+class LibCurlHttpContentFetcherBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+    }
+
+    /**
+     * Fetch a URL as @c UrlContentToAttachmentConverter does, into an attachment.
+     *
+     * @param url The URL to fetch.
+     * @param expectedSize The size of the body.
+     * @param multiHandlePool The pool the fetcher uses, or nullptr.
+     * @param[out] body The body fetched.
+     */
+    void fetch(
+        const std::string& url,
+        size_t expectedSize,
+        std::shared_ptr<CurlMultiHandlePool> multiHandlePool,
+        std::string* body) {
+        LibCurlHttpContentFetcher fetcher(url, multiHandlePool);
+        InProcessAttachment attachment(url);
+        std::shared_ptr<AttachmentWriter> writer = attachment.createWriter(sds::WriterPolicy::BLOCKING);
+        auto reader = attachment.createReader(sds::ReaderPolicy::BLOCKING);
+        fetcher.getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+        ASSERT_TRUE(fetcher.getBody(writer));
+
+        body->clear();
+        char buffer[16 * 1024];
+        while (body->size() < expectedSize) {
+            auto readStatus = AttachmentReader::ReadStatus::OK;
+            auto count = reader->read(buffer, sizeof(buffer), &readStatus, TIMEOUT);
+            ASSERT_GT(count, 0u);
+            body->append(buffer, count);
+        }
+
+        // Wait for the transfer to complete, as destroying the fetcher before then aborts it.
+        auto start = steady_clock::now();
+        while (HTTPContentFetcherInterface::State::FETCHING_BODY == fetcher.getState()) {
+            ASSERT_LT(steady_clock::now() - start, TIMEOUT);
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        ASSERT_EQ(fetcher.getState(), HTTPContentFetcherInterface::State::BODY_DONE);
+        EXPECT_EQ(fetcher.getHeader(nullptr).responseCode, http::HTTPResponseCode::SUCCESS_OK);
+    }
+
+    /**
+     * Fetch the playlist and each of its segments with a new fetcher, and report the wall time and connections opened.
+     *
+     * @param variant The name of the variant.
+     * @param multiHandlePool The pool the fetchers use, or nullptr.
+     * @param[out] countOfConnections The number of connections opened.
+     */
+    void run(
+        const std::string& variant,
+        std::shared_ptr<CurlMultiHandlePool> multiHandlePool,
+        size_t* countOfConnections) {
+        auto start = steady_clock::now();
+        std::string body;
+        fetch(m_server.getUrl(PLAYLIST_PATH), m_server.m_playlist.size(), multiHandlePool, &body);
+        ASSERT_EQ(body, m_server.m_playlist);
+        for (int i = 0; i < SEGMENT_COUNT; ++i) {
+            fetch(m_server.getUrl(getSegmentPath(i)), SEGMENT_SIZE, multiHandlePool, &body);
+            ASSERT_EQ(body, m_server.m_segment);
+        }
+        duration<double> elapsed = steady_clock::now() - start;
+        *countOfConnections = m_server.m_countOfConnections;
+
+        reportBenchmarkResult(variant, "wallSeconds", elapsed.count());
+        reportBenchmarkResult(variant, "millisecondsPerFetch", elapsed.count() * 1000 / (SEGMENT_COUNT + 1));
+        reportBenchmarkResult(variant, "socketsOpened", static_cast<double>(*countOfConnections));
+    }
+
+    /// The server the playlist is fetched from.
+    LoopbackServer m_server;
+};
+
+/// Each fetcher opens its own connection.
+TEST_F(LibCurlHttpContentFetcherBenchmarkTest, testSlow_unpooledPlaylist) {
+    size_t countOfConnections = 0;
+    run("UNPOOLED", nullptr, &countOfConnections);
+    EXPECT_EQ(countOfConnections, static_cast<size_t>(SEGMENT_COUNT + 1));
+}
+
+/// The fetchers reuse the connection kept alive by the multi handles of earlier fetchers.
+TEST_F(LibCurlHttpContentFetcherBenchmarkTest, testSlow_pooledPlaylist) {
+    auto multiHandlePool = CurlMultiHandlePool::create();
+    size_t countOfConnections = 0;
+    run("POOLED", multiHandlePool, &countOfConnections);
+    EXPECT_EQ(countOfConnections, 1u);
+    EXPECT_EQ(multiHandlePool->getIdleCount(), 1u);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
@@ -0,0 +1,267 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifdef __linux__
+
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h"
+#include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avs::attachment;
+using namespace logger;
+using namespace sdkInterfaces;
+using namespace std::chrono;
+
+/// How long to wait for a fetch to make progress before giving up.
+static const milliseconds TIMEOUT{5000};
+
+/// The body served.
+static const std::string BODY = "#EXTM3U\n#EXTINF:4.0,\nsegment0.ts\n#EXT-X-ENDLIST\n";
+
+/// The name of the function logging an invalid state transition.
+static const std::string INVALID_STATE_TRANSITION = "reportInvalidStateTransitionAttempt";
+
+/// A @c Logger which keeps the text of the logs emitted.
+class CapturingLogger : public Logger {
+public:
+    /// Constructor.
+    CapturingLogger() : Logger(Level::DEBUG9) {
+    }
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_logs.push_back(text);
+    }
+
+    /**
+     * Count the logs containing a string.
+     *
+     * @param text The string.
+     * @return The number of logs containing @c text.
+     */
+    size_t count(const std::string& text) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t count = 0;
+        for (const auto& log : m_logs) {
+            if (log.find(text) != std::string::npos) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+private:
+    /// Serializes access to @c m_logs.
+    std::mutex m_mutex;
+
+    /// The text of the logs emitted.
+    std::vector<std::string> m_logs;
+};
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface, which answers a single request once told to.
+ */
+class DelayedResponseServer {
+public:
+    /// Destructor.
+    ~DelayedResponseServer() {
+        respond();
+        if (m_listenSocket >= 0) {
+            // Unblocks the thread waiting in accept().
+            shutdown(m_listenSocket, SHUT_RDWR);
+        }
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        if (m_listenSocket >= 0) {
+            close(m_listenSocket);
+        }
+    }
+
+    /**
+     * Start listening.
+     *
+     * @return Whether the server started.
+     */
+    bool start() {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listenSocket < 0) {
+            return false;
+        }
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t length = sizeof(address);
+        if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            listen(m_listenSocket, 1) != 0 ||
+            getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread(&DelayedResponseServer::serve, this);
+        return true;
+    }
+
+    /**
+     * Get the URL of the server.
+     *
+     * @return The URL.
+     */
+    std::string getUrl() const {
+        return "http://127.0.0.1:" + std::to_string(m_port) + "/playlist.m3u8";
+    }
+
+    /**
+     * Wait for the request to be received.
+     *
+     * @return Whether the request was received before @c TIMEOUT.
+     */
+    bool waitForRequest() {
+        return std::future_status::ready == m_requestReceived.get_future().wait_for(TIMEOUT);
+    }
+
+    /// Send the response to the request.
+    void respond() {
+        std::call_once(m_respondOnce, [this] { m_respond.set_value(); });
+    }
+
+private:
+    /// Accept a connection, and answer its request once @c respond() is called.
+    void serve() {
+        auto connection = accept(m_listenSocket, nullptr, nullptr);
+        if (connection < 0) {
+            return;
+        }
+        std::string received;
+        char buffer[4096];
+        ssize_t count;
+        while (received.find("\r\n\r\n") == std::string::npos &&
+               (count = recv(connection, buffer, sizeof(buffer), 0)) > 0) {
+            received.append(buffer, count);
+        }
+        m_requestReceived.set_value();
+        m_respond.get_future().wait();
+        auto response = "HTTP/1.1 200 OK\r\nContent-Type: application/vnd.apple.mpegurl\r\nContent-Length: " +
+                        std::to_string(BODY.size()) + "\r\nConnection: close\r\n\r\n" + BODY;
+        send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+        close(connection);
+    }
+
+    /// The socket listening for connections.
+    int m_listenSocket = -1;
+
+    /// The port listened on.
+    int m_port = 0;
+
+    /// The thread serving the request.
+    std::thread m_thread;
+
+    /// Set when the request has been received.
+    std::promise<void> m_requestReceived;
+
+    /// Set when the response may be sent.
+    std::promise<void> m_respond;
+
+    /// Ensures @c m_respond is only set once.
+    std::once_flag m_respondOnce;
+};
+
+/// Test fixture, which runs the server and captures the logs.
+class LibCurlHttpContentFetcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+        m_logger = std::make_shared<CapturingLogger>();
+        LoggerSinkManager::instance().initialize(m_logger);
+    }
+
+    void TearDown() override {
+        LoggerSinkManager::instance().initialize(ACSDK_GET_SINK_LOGGER());
+    }
+
+    /// The server the body is fetched from.
+    DelayedResponseServer m_server;
+
+    /// The logger capturing the logs of the fetcher.
+    std::shared_ptr<CapturingLogger> m_logger;
+};
+
+/**
+ * Verify that when @c getBody() is called before the headers arrive, the headers are parsed while fetching the body
+ * without attempting to move the fetcher back to fetching the headers.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_getBodyBeforeHeadersArrive) {
+    LibCurlHttpContentFetcher fetcher(m_server.getUrl());
+    InProcessAttachment attachment("playlist");
+    std::shared_ptr<AttachmentWriter> writer = attachment.createWriter(sds::WriterPolicy::BLOCKING);
+    auto reader = attachment.createReader(sds::ReaderPolicy::BLOCKING);
+    fetcher.getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    ASSERT_TRUE(m_server.waitForRequest());
+    ASSERT_TRUE(fetcher.getBody(writer));
+    EXPECT_EQ(HTTPContentFetcherInterface::State::FETCHING_BODY, fetcher.getState());
+    m_server.respond();
+
+    std::string body;
+    char buffer[1024];
+    while (body.size() < BODY.size()) {
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        auto count = reader->read(buffer, sizeof(buffer), &readStatus, TIMEOUT);
+        ASSERT_GT(count, 0u);
+        body.append(buffer, count);
+    }
+    EXPECT_EQ(BODY, body);
+
+    auto start = steady_clock::now();
+    while (HTTPContentFetcherInterface::State::FETCHING_BODY == fetcher.getState()) {
+        ASSERT_LT(steady_clock::now() - start, TIMEOUT);
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+    EXPECT_EQ(HTTPContentFetcherInterface::State::BODY_DONE, fetcher.getState());
+    EXPECT_EQ(http::HTTPResponseCode::SUCCESS_OK, fetcher.getHeader(nullptr).responseCode);
+    EXPECT_EQ(0u, m_logger->count(INVALID_STATE_TRANSITION));
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
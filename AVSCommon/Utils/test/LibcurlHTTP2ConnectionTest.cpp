@@ -0,0 +1,283 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LibcurlHTTP2ConnectionTest.cpp
+///
+/// Tests how quickly @c LibcurlHTTP2Connection's network loop reacts to paused streams being resumed and cancelled.
+/// The requests are sent in clear text to a server on the loopback interface, which answers with HTTP/1.1; the network
+/// loop does not depend on the protocol version, and an HTTP/2 server is not available to unit tests.
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+#include <AVSCommon/Utils/Common/LoopbackHTTPServer.h>
+
+#include "AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2RequestSourceInterface.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h"
+#include "AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2Connection.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::utils::http2;
+using namespace std::chrono;
+
+/// How long to wait for something which should happen before giving up.
+static const milliseconds TIMEOUT{5000};
+
+/// The number of chunks sent by the latency test.
+static const size_t LATENCY_CHUNKS = 50;
+
+/// The size of a chunk: 10 ms of 16 kHz 16-bit audio.
+static const size_t CHUNK_SIZE = 320;
+
+/// How long to wait after a chunk arrives before sending the next one, so that the stream is paused in between.
+static const milliseconds CHUNK_INTERVAL{3};
+
+/// The median latency from @c resume() to the chunk arriving which the test requires.  The network loop retries
+/// streams which are paused but not resumed after 10 ms, so this is only met when @c resume() wakes it up.
+static const milliseconds MAX_MEDIAN_LATENCY{2};
+
+/// A request source which sends chunks as the test provides them, and pauses while it has none.
+class ChunkSource : public HTTP2RequestSourceInterface {
+public:
+    /**
+     * Provide a chunk to send.
+     *
+     * @param chunk The chunk to send.
+     */
+    void push(const std::string& chunk) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.insert(m_pending.end(), chunk.begin(), chunk.end());
+    }
+
+    /// Complete the body once the chunks provided so far have been sent.
+    void finish() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isFinished = true;
+    }
+
+    /// @name HTTP2RequestSourceInterface methods.
+    /// @{
+    std::vector<std::string> getRequestHeaderLines() override {
+        return {};
+    }
+
+    HTTP2SendDataResult onSendData(char* bytes, size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.empty()) {
+            return m_isFinished ? HTTP2SendDataResult::COMPLETE : HTTP2SendDataResult::PAUSE;
+        }
+        auto count = std::min(size, m_pending.size());
+        std::copy(m_pending.begin(), m_pending.begin() + count, bytes);
+        m_pending.erase(m_pending.begin(), m_pending.begin() + count);
+        return HTTP2SendDataResult(count);
+    }
+    /// @}
+
+private:
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The bytes provided but not yet sent.
+    std::deque<char> m_pending;
+
+    /// Whether the body is complete once @c m_pending has been sent.
+    bool m_isFinished = false;
+};
+
+/// A response sink which records how the response finished.
+class FinishedSink : public HTTP2ResponseSinkInterface {
+public:
+    /**
+     * Wait for the response to finish.
+     *
+     * @param[out] status How the response finished.
+     * @return Whether the response finished before the timeout.
+     */
+    bool waitForFinished(HTTP2ResponseFinishedStatus* status) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_wakeTrigger.wait_for(lock, TIMEOUT, [this] { return m_isFinished; })) {
+            return false;
+        }
+        *status = m_status;
+        return true;
+    }
+
+    /// @name HTTP2ResponseSinkInterface methods.
+    /// @{
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_status = status;
+        m_isFinished = true;
+        m_wakeTrigger.notify_all();
+    }
+    /// @}
+
+private:
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when the response finishes.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether the response has finished.
+    bool m_isFinished = false;
+
+    /// How the response finished.
+    HTTP2ResponseFinishedStatus m_status = HTTP2ResponseFinishedStatus::INTERNAL_ERROR;
+};
+
+class LibcurlHTTP2ConnectionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_server.start());
+        m_connection = LibcurlHTTP2Connection::create();
+        ASSERT_NE(m_connection, nullptr);
+        m_source = std::make_shared<ChunkSource>();
+        m_sink = std::make_shared<FinishedSink>();
+    }
+
+    void TearDown() override {
+        if (m_connection) {
+            m_connection->disconnect();
+        }
+    }
+
+    /**
+     * Send a POST request whose body comes from @c m_source.
+     *
+     * @return The request.
+     */
+    std::shared_ptr<HTTP2RequestInterface> sendRequest() {
+        HTTP2RequestConfig config{HTTP2RequestType::POST, m_server.getUrl(), "test"};
+        config.setRequestSource(m_source);
+        config.setResponseSink(m_sink);
+        return m_connection->createAndSendRequest(config);
+    }
+
+    /// The server receiving the request.
+    LoopbackHTTPServer m_server;
+
+    /// The connection under test.
+    std::shared_ptr<LibcurlHTTP2Connection> m_connection;
+
+    /// The source of the request body.
+    std::shared_ptr<ChunkSource> m_source;
+
+    /// The sink of the response.
+    std::shared_ptr<FinishedSink> m_sink;
+};
+
+/// Verify that a paused stream sends a chunk as soon as it is resumed, rather than when paused streams are retried.
+TEST_F(LibcurlHTTP2ConnectionTest, test_resumedStreamSendsChunkPromptly) {
+    auto request = sendRequest();
+    ASSERT_NE(request, nullptr);
+
+    size_t received = 0;
+    steady_clock::time_point arrival;
+    std::vector<microseconds> latencies;
+    for (size_t i = 0; i < LATENCY_CHUNKS; ++i) {
+        std::this_thread::sleep_for(CHUNK_INTERVAL);
+        auto sent = steady_clock::now();
+        m_source->push(std::string(CHUNK_SIZE, 'a' + i % 26));
+        request->resume();
+        auto next = m_server.waitForBody(received, TIMEOUT, &arrival);
+        ASSERT_GT(next, received) << "chunk " << i << " did not arrive";
+        received = next;
+        latencies.push_back(duration_cast<microseconds>(arrival - sent));
+    }
+    m_source->finish();
+    request->resume();
+
+    HTTP2ResponseFinishedStatus status;
+    ASSERT_TRUE(m_sink->waitForFinished(&status));
+    EXPECT_EQ(status, HTTP2ResponseFinishedStatus::COMPLETE);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto median = latencies[latencies.size() / 2];
+    reportBenchmarkResult("medianChunkLatencyUs", median.count());
+    reportBenchmarkResult("maxChunkLatencyUs", latencies.back().count());
+    EXPECT_LT(median, MAX_MEDIAN_LATENCY);
+}
+
+/// Verify that a paused stream which is not resumed is still retried, for sources which do not call resume().
+TEST_F(LibcurlHTTP2ConnectionTest, test_pausedStreamIsRetriedWithoutResume) {
+    auto request = sendRequest();
+    ASSERT_NE(request, nullptr);
+
+    std::this_thread::sleep_for(CHUNK_INTERVAL);
+    m_source->push(std::string(CHUNK_SIZE, 'a'));
+    steady_clock::time_point arrival;
+    ASSERT_GT(m_server.waitForBody(0, TIMEOUT, &arrival), 0u);
+
+    m_source->finish();
+    HTTP2ResponseFinishedStatus status;
+    ASSERT_TRUE(m_sink->waitForFinished(&status));
+    EXPECT_EQ(status, HTTP2ResponseFinishedStatus::COMPLETE);
+}
+
+/// Verify that cancelling a paused stream completes it straight away.
+TEST_F(LibcurlHTTP2ConnectionTest, test_cancelPausedStream) {
+    auto request = sendRequest();
+    ASSERT_NE(request, nullptr);
+    m_source->push(std::string(CHUNK_SIZE, 'a'));
+    request->resume();
+    steady_clock::time_point arrival;
+    ASSERT_GT(m_server.waitForBody(0, TIMEOUT, &arrival), 0u);
+
+    auto cancelled = steady_clock::now();
+    ASSERT_TRUE(request->cancel());
+    HTTP2ResponseFinishedStatus status;
+    ASSERT_TRUE(m_sink->waitForFinished(&status));
+    EXPECT_EQ(status, HTTP2ResponseFinishedStatus::CANCELLED);
+    EXPECT_LT(steady_clock::now() - cancelled, MAX_MEDIAN_LATENCY * 10);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
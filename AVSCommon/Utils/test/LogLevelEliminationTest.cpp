@@ -0,0 +1,282 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/Level.h"
+
+// Remember the levels the rest of the module was built with.
+#ifdef ACSDK_MIN_LOG_LEVEL
+/// The compiled-in minimum level of modules without an override.
+static constexpr alexaClientSDK::avsCommon::utils::logger::Level BUILD_MIN_LOG_LEVEL =
+    alexaClientSDK::avsCommon::utils::logger::Level::ACSDK_MIN_LOG_LEVEL;
+#else
+/// The compiled-in minimum level of modules without an override.
+static constexpr alexaClientSDK::avsCommon::utils::logger::Level BUILD_MIN_LOG_LEVEL =
+    alexaClientSDK::avsCommon::utils::logger::Level::DEBUG9;
+#endif
+
+#ifdef ACSDK_MIN_LOG_LEVEL_OVERRIDES
+/// The compiled-in minimum levels of modules with an override.
+static constexpr const char* BUILD_MIN_LOG_LEVEL_OVERRIDES = ACSDK_MIN_LOG_LEVEL_OVERRIDES;
+#else
+/// The compiled-in minimum levels of modules with an override.
+static constexpr const char* BUILD_MIN_LOG_LEVEL_OVERRIDES = "";
+#endif
+
+// Compile this file as if built with -DACSDK_MIN_LOG_LEVEL=WARN, whatever the build options are.
+#undef ACSDK_MIN_LOG_LEVEL
+#define ACSDK_MIN_LOG_LEVEL WARN
+#undef ACSDK_MIN_LOG_LEVEL_OVERRIDES
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/HTTP/HttpResponseCode.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h"
+#include "AVSCommon/Utils/Logger/ConsoleLogger.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+
+/// The number of calls to the global @c operator @c new made by this process.
+static std::atomic<uint64_t> g_allocationCount{0};
+
+void* operator new(std::size_t size) {
+    g_allocationCount++;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// GCC 11 and later flag the inlined free() of memory from the replaced operator new as mismatched.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+using namespace http;
+using namespace http2;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LogLevelEliminationTest");
+
+/// Create a @c LogEntry using this file's @c TAG and the specified event string.
+#define LX(event) LogEntry(TAG, event)
+
+/// The MIME boundary of the decoded response.
+static const std::string BOUNDARY = "eliminationTestBoundary";
+
+/// The header line announcing @c BOUNDARY.
+static const std::string BOUNDARY_HEADER = "content-type: multipart/related; boundary=" + BOUNDARY + "; type=json";
+
+/// The start of the single part of the decoded response.
+static const std::string PART_START = "--" + BOUNDARY + "\r\nContent-Type: application/octet-stream\r\n\r\n";
+
+/// The end of the decoded response.
+static const std::string RESPONSE_END = "\r\n--" + BOUNDARY + "--\r\n";
+
+/// Size of each chunk of part data passed to the decoder.
+static const size_t CHUNK_SIZE = 64;
+
+/// Number of chunks of part data passed to the decoder.
+static const int CHUNK_COUNT = 1000;
+
+/// Number of times @c countEvaluation() was called.
+static int g_evaluationCount = 0;
+
+/**
+ * A @c LogEntry argument that counts its evaluations.
+ *
+ * @return The number of evaluations so far.
+ */
+static int countEvaluation() {
+    return ++g_evaluationCount;
+}
+
+/// Number of entries emitted to the @c CountingLogger.
+static std::atomic<int> g_emitCount{0};
+
+/**
+ * A sink @c Logger that emits every level and only counts what it is given.
+ */
+class CountingLogger : public Logger {
+public:
+    CountingLogger() : Logger(Level::DEBUG9) {
+    }
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override {
+        g_emitCount++;
+    }
+};
+
+/**
+ * A MIME sink that accepts everything without allocating.
+ */
+class NonAllocatingSink : public HTTP2MimeResponseSinkInterface {
+public:
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+    bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) override {
+        return true;
+    }
+    HTTP2ReceiveDataStatus onReceiveMimeData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+    bool onEndMimePart() override {
+        return true;
+    }
+    HTTP2ReceiveDataStatus onReceiveNonMimeData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+    }
+};
+
+/**
+ * Test fixture which sends logs to a @c CountingLogger.
+ */
+class LogLevelEliminationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        g_evaluationCount = 0;
+        LoggerSinkManager::instance().initialize(std::make_shared<CountingLogger>());
+    }
+
+    void TearDown() override {
+        ACSDK_GET_LOGGER_FUNCTION().setLevel(Level::INFO);
+        LoggerSinkManager::instance().initialize(getConsoleLogger());
+    }
+
+    /**
+     * Decode a response of @c CHUNK_COUNT chunks of part data, with the module's log level set to @c level.
+     *
+     * @param level The log level of the module the decoder belongs to.
+     * @param[out] emitCount The number of entries emitted while passing the chunks of part data to the decoder.
+     * @return The number of allocations made while passing the chunks of part data to the decoder.
+     */
+    uint64_t countDecodeAllocations(Level level, int* emitCount) {
+        ACSDK_GET_LOGGER_FUNCTION().setLevel(level);
+        std::string chunk(CHUNK_SIZE, 'x');
+        HTTP2MimeResponseDecoder decoder(std::make_shared<NonAllocatingSink>());
+        EXPECT_TRUE(decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK));
+        EXPECT_TRUE(decoder.onReceiveHeaderLine(BOUNDARY_HEADER));
+        EXPECT_EQ(HTTP2ReceiveDataStatus::SUCCESS, decoder.onReceiveData(PART_START.data(), PART_START.size()));
+
+        auto before = g_allocationCount.load();
+        auto emitsBefore = g_emitCount.load();
+        for (int i = 0; i < CHUNK_COUNT; ++i) {
+            EXPECT_EQ(HTTP2ReceiveDataStatus::SUCCESS, decoder.onReceiveData(chunk.data(), chunk.size()));
+        }
+        auto allocations = g_allocationCount.load() - before;
+        *emitCount = g_emitCount.load() - emitsBefore;
+
+        EXPECT_EQ(HTTP2ReceiveDataStatus::SUCCESS, decoder.onReceiveData(RESPONSE_END.data(), RESPONSE_END.size()));
+        decoder.onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+        return allocations;
+    }
+};
+
+/**
+ * Verify that the minimum level of a module is looked up in the overrides generated by Logger.cmake.
+ */
+TEST_F(LogLevelEliminationTest, test_getMinLogLevel) {
+    static_assert(Level::WARN == ACSDK_COMPILED_MIN_LOG_LEVEL, "ACSDK_MIN_LOG_LEVEL not applied");
+    static_assert(Level::INFO == getMinLogLevel("acl", "", Level::INFO), "no overrides");
+    static_assert(Level::INFO == getMinLogLevel("", ",acl=0,", Level::INFO), "no module");
+    static_assert(Level::DEBUG9 == getMinLogLevel("acl", ",acl=0,", Level::INFO), "only override");
+    static_assert(Level::ERROR == getMinLogLevel("acl", ",avsCommon=0,acl=12,", Level::INFO), "last override");
+    static_assert(Level::INFO == getMinLogLevel("acl", ",aclX=0,xacl=0,", Level::INFO), "partial names");
+    static_assert(Level::DEBUG9 == getMinLogLevel("aclX", ",acl=12,aclX=0,", Level::INFO), "longer name");
+    static_assert(Level::NONE == getMinLogLevel("avsCommon", ",avsCommon=14,", Level::INFO), "NONE");
+}
+
+/**
+ * Verify that logs below the compiled-in minimum level are never evaluated, whatever the run-time level.
+ */
+TEST_F(LogLevelEliminationTest, test_compiledOutLogsAreNotEvaluated) {
+    ACSDK_GET_LOGGER_FUNCTION().setLevel(Level::DEBUG9);
+    ACSDK_INFO(LX("compiledOut").d("count", countEvaluation()));
+    EXPECT_EQ(0, g_evaluationCount);
+    ACSDK_WARN(LX("compiledIn").d("count", countEvaluation()));
+    EXPECT_EQ(1, g_evaluationCount);
+}
+
+/**
+ * Verify that logs filtered by the run-time level never construct a @c LogEntry or evaluate its arguments.
+ */
+TEST_F(LogLevelEliminationTest, test_filteredLogsAreNotEvaluated) {
+    ACSDK_GET_LOGGER_FUNCTION().setLevel(Level::CRITICAL);
+    auto before = g_allocationCount.load();
+    ACSDK_WARN(LX("filtered").d("count", countEvaluation()).d("text", std::string(100, 'x')));
+    ACSDK_ERROR(LX("filtered").d("count", countEvaluation()).m(std::string(100, 'x')));
+    EXPECT_EQ(before, g_allocationCount.load());
+    EXPECT_EQ(0, g_evaluationCount);
+
+    ACSDK_CRITICAL(LX("emitted").d("count", countEvaluation()));
+    EXPECT_EQ(1, g_evaluationCount);
+}
+
+/**
+ * Verify that the per-chunk debug logs on the MIME decode path neither emit nor allocate once filtered out.
+ */
+TEST_F(LogLevelEliminationTest, test_filteredLogsDoNotAllocateOnMimeDecodePath) {
+    int filteredEmits = 0;
+    int disabledEmits = 0;
+    int enabledEmits = 0;
+    auto filtered = countDecodeAllocations(Level::INFO, &filteredEmits);
+    auto disabled = countDecodeAllocations(Level::NONE, &disabledEmits);
+    auto enabled = countDecodeAllocations(Level::DEBUG9, &enabledEmits);
+    EXPECT_EQ(0, filteredEmits);
+    EXPECT_EQ(0, disabledEmits);
+    EXPECT_EQ(disabled, filtered);
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+    constexpr Level decoderMinLogLevel =
+        getMinLogLevel(ACSDK_STRINGIFY(ACSDK_LOG_MODULE), BUILD_MIN_LOG_LEVEL_OVERRIDES, BUILD_MIN_LOG_LEVEL);
+    if (Level::DEBUG9 == decoderMinLogLevel) {
+        // The per-chunk logs are compiled in, and only cost anything when enabled.
+        EXPECT_GE(enabledEmits, CHUNK_COUNT);
+        EXPECT_GE(enabled, filtered);
+        return;
+    }
+#endif
+    // The per-chunk logs are compiled out, so enabling them at run time changes nothing.
+    EXPECT_EQ(0, enabledEmits);
+    EXPECT_EQ(filtered, enabled);
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
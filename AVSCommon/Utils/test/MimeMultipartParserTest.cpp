@@ -0,0 +1,377 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file MimeMultipartParserTest.cpp
+///
+/// Tests of @c MimeMultipartParser, and a benchmark which feeds a downchannel response of Speak directives with large
+/// audio attachments through @c HTTP2MimeResponseDecoder in 1 byte, 1 KB and 16 KB chunks.  Benchmark results are
+/// printed to stdout and recorded as test properties; only correctness is asserted so that the test is stable on
+/// loaded build machines.
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/HTTP/HttpResponseCode.h"
+#include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h"
+#include "AVSCommon/Utils/HTTP2/MimeMultipartParser.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+namespace test {
+
+using namespace std::chrono;
+
+/// The boundary of the test bodies, in the format AVS uses.
+static const std::string BOUNDARY = "84109348-943b-4446-85e6-e73eda9fac43";
+
+/// The number of Speak directives in the downchannel capture.
+static const size_t SPEAK_DIRECTIVES = 20;
+
+/// The size of the audio attachment of each Speak directive: about 16 s of 32 kbps MP3.
+static const size_t AUDIO_ATTACHMENT_SIZE = 64 * 1024;
+
+/// The sizes of the chunks the capture is fed in.
+static const std::vector<size_t> CHUNK_SIZES = {1, 1024, 16 * 1024};
+
+/// The number of times the capture is fed in each chunk size, after one untimed pass.
+static const size_t BENCHMARK_PASSES = 5;
+
+/// A part of a multipart body.
+struct Part {
+    /// The headers of the part.
+    std::multimap<std::string, std::string> headers;
+    /// The data of the part.
+    std::string data;
+
+    bool operator==(const Part& rhs) const {
+        return headers == rhs.headers && data == rhs.data;
+    }
+};
+
+/**
+ * Print a part for failure messages.
+ */
+static std::ostream& operator<<(std::ostream& stream, const Part& part) {
+    return stream << "Part{headers=" << part.headers.size() << ", dataSize=" << part.data.size() << "}";
+}
+
+/// A sink which records the parts it receives, and which can pause periodically.
+class RecordingSink : public HTTP2MimeResponseSinkInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param pauseInterval Pause every this many calls to @c onReceiveMimeData(), or never if zero.  A paused call
+     *     does not consume its data.
+     * @param isRecording Whether to record the data, or only count it.
+     */
+    RecordingSink(size_t pauseInterval = 0, bool isRecording = true) :
+            m_pauseInterval{pauseInterval},
+            m_isRecording{isRecording},
+            m_countOfDataCalls{0},
+            m_countOfPauses{0},
+            m_countOfBytes{0},
+            m_isPartOpen{false},
+            m_hasProtocolError{false} {
+    }
+
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) override {
+        m_hasProtocolError |= m_isPartOpen;
+        m_isPartOpen = true;
+        m_parts.push_back({headers, ""});
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveMimeData(const char* bytes, size_t size) override {
+        m_hasProtocolError |= !m_isPartOpen || 0 == size;
+        if (m_pauseInterval && 0 == ++m_countOfDataCalls % m_pauseInterval) {
+            ++m_countOfPauses;
+            return HTTP2ReceiveDataStatus::PAUSE;
+        }
+        if (m_isRecording) {
+            m_parts.back().data.append(bytes, size);
+        }
+        m_countOfBytes += size;
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    bool onEndMimePart() override {
+        m_hasProtocolError |= !m_isPartOpen;
+        m_isPartOpen = false;
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveNonMimeData(const char* bytes, size_t size) override {
+        m_hasProtocolError = true;
+        return HTTP2ReceiveDataStatus::ABORT;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+    }
+
+    /// The pause interval.
+    const size_t m_pauseInterval;
+    /// Whether data is recorded.
+    const bool m_isRecording;
+    /// The number of calls to @c onReceiveMimeData().
+    size_t m_countOfDataCalls;
+    /// The number of calls to @c onReceiveMimeData() which paused.
+    size_t m_countOfPauses;
+    /// The number of bytes of part data consumed.
+    size_t m_countOfBytes;
+    /// Whether a part has begun and not ended.
+    bool m_isPartOpen;
+    /// Whether the calls were out of order, or a call passed no data.
+    bool m_hasProtocolError;
+    /// The parts received.
+    std::vector<Part> m_parts;
+};
+
+/**
+ * Build a multipart body.
+ *
+ * @param parts The parts, whose headers are written in order.
+ * @param prefix Bytes before the first boundary.
+ * @return The body.
+ */
+static std::string buildBody(const std::vector<Part>& parts, const std::string& prefix = "\r\n") {
+    std::string body = prefix;
+    for (auto& part : parts) {
+        body += "--" + BOUNDARY + "\r\n";
+        for (auto& header : part.headers) {
+            body += header.first + ": " + header.second + "\r\n";
+        }
+        body += "\r\n" + part.data + "\r\n";
+    }
+    body += "--" + BOUNDARY + "--";
+    return body;
+}
+
+/**
+ * Build the parts of a downchannel response carrying Speak directives, each followed by its audio attachment.  The
+ * audio is random, with CRs, CRLFs and partial boundaries inserted so that the boundary search has to look past them.
+ *
+ * @param directives The number of Speak directives.
+ * @param attachmentSize The size of each audio attachment.
+ * @return The parts.
+ */
+static std::vector<Part> buildDownchannelParts(size_t directives, size_t attachmentSize) {
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<Part> parts;
+    for (size_t i = 0; i < directives; ++i) {
+        auto id = std::to_string(i);
+        Part directive;
+        directive.headers.insert({"Content-Type", "application/json; charset=UTF-8"});
+        directive.data =
+            "{\"directive\":{\"header\":{\"namespace\":\"SpeechSynthesizer\",\"name\":\"Speak\",\"messageId\":"
+            "\"a8b5b3a6-2f3c-4c4b-a3a1-5b0d0c8e7f" +
+            id +
+            "\",\"dialogRequestId\":\"dd1f0b7e-4b8c-4b1e-9b70-3b7f5e1c2a0d\"},\"payload\":{\"url\":\"cid:"
+            "DeviceTTSRendererV4_" +
+            id + "\",\"format\":\"AUDIO_MPEG\",\"token\":\"amzn1.as-ct.v1.Domain:Application:Knowledge#ACRI#" + id +
+            "\"}}}";
+        parts.push_back(directive);
+
+        Part audio;
+        audio.headers.insert({"Content-Type", "application/octet-stream"});
+        audio.headers.insert({"Content-ID", "<DeviceTTSRendererV4_" + id + ">"});
+        audio.data.reserve(attachmentSize);
+        while (audio.data.size() < attachmentSize) {
+            switch (byte(random) % 512) {
+                case 0:
+                    audio.data += "\r\n--" + BOUNDARY.substr(0, byte(random) % BOUNDARY.size());
+                    break;
+                case 1:
+                    audio.data += "\r\r\n";
+                    break;
+                default:
+                    audio.data += static_cast<char>(byte(random));
+                    break;
+            }
+        }
+        audio.data.resize(attachmentSize);
+        parts.push_back(audio);
+    }
+    return parts;
+}
+
+/**
+ * Feed a body to a parser in chunks, feeding again from the first byte not consumed whenever the sink pauses.
+ *
+ * @param parser The parser.
+ * @param body The body.
+ * @param chunkSize The size of the chunks.
+ * @param sink The sink.
+ * @return The status of the last feed.
+ */
+static HTTP2ReceiveDataStatus feedInChunks(
+    MimeMultipartParser& parser,
+    const std::string& body,
+    size_t chunkSize,
+    RecordingSink& sink) {
+    size_t offset = 0;
+    while (offset < body.size()) {
+        size_t consumed = 0;
+        auto status = parser.feed(body.data() + offset, std::min(chunkSize, body.size() - offset), sink, &consumed);
+        if (HTTP2ReceiveDataStatus::ABORT == status) {
+            return status;
+        }
+        offset += consumed;
+    }
+    return HTTP2ReceiveDataStatus::SUCCESS;
+}
+
+/// Verify that parts are parsed whatever the size of the chunks they arrive in.
+TEST(MimeMultipartParserTest, test_partsInAnyChunkSize) {
+    auto parts = buildDownchannelParts(2, 4096);
+    auto body = buildBody(parts);
+    for (size_t chunkSize : {static_cast<size_t>(1), static_cast<size_t>(7), BOUNDARY.size() + 4, body.size()}) {
+        MimeMultipartParser parser;
+        parser.setBoundary(BOUNDARY);
+        RecordingSink sink;
+        ASSERT_EQ(feedInChunks(parser, body, chunkSize, sink), HTTP2ReceiveDataStatus::SUCCESS) << chunkSize;
+        EXPECT_TRUE(parser.isFinished());
+        EXPECT_FALSE(sink.m_hasProtocolError);
+        EXPECT_FALSE(sink.m_isPartOpen);
+        EXPECT_EQ(sink.m_parts, parts) << chunkSize;
+    }
+}
+
+/// Verify that after a pause, feeding from the first byte not consumed continues without losing or repeating data.
+TEST(MimeMultipartParserTest, test_pauseReportsBytesConsumed) {
+    auto parts = buildDownchannelParts(2, 4096);
+    auto body = buildBody(parts);
+    for (size_t chunkSize : {static_cast<size_t>(1), static_cast<size_t>(100), body.size()}) {
+        MimeMultipartParser parser;
+        parser.setBoundary(BOUNDARY);
+        RecordingSink sink(3);
+        ASSERT_EQ(feedInChunks(parser, body, chunkSize, sink), HTTP2ReceiveDataStatus::SUCCESS) << chunkSize;
+        EXPECT_GT(sink.m_countOfPauses, 0u);
+        EXPECT_TRUE(parser.isFinished());
+        EXPECT_FALSE(sink.m_hasProtocolError);
+        EXPECT_EQ(sink.m_parts, parts) << chunkSize;
+    }
+}
+
+/// Verify that data which looks like the start of a boundary is passed on as data.
+TEST(MimeMultipartParserTest, test_boundaryLookalikesAreData) {
+    std::vector<Part> parts(1);
+    parts[0].headers.insert({"Content-Type", "application/octet-stream"});
+    parts[0].data = "\r\r\n--" + BOUNDARY.substr(0, 5) + "\r\n--" + BOUNDARY + "x\r\n--" + BOUNDARY + "\rx\r\n--" +
+                    BOUNDARY + "-x\r";
+    auto body = buildBody(parts, "");
+    for (size_t chunkSize = 1; chunkSize <= body.size(); ++chunkSize) {
+        MimeMultipartParser parser;
+        parser.setBoundary(BOUNDARY);
+        RecordingSink sink;
+        ASSERT_EQ(feedInChunks(parser, body, chunkSize, sink), HTTP2ReceiveDataStatus::SUCCESS) << chunkSize;
+        EXPECT_EQ(sink.m_parts, parts) << chunkSize;
+    }
+}
+
+/// Verify that malformed bodies are rejected, and that the parser stays failed.
+TEST(MimeMultipartParserTest, test_malformedBodies) {
+    RecordingSink sink;
+    size_t consumed = 0;
+    MimeMultipartParser parser;
+    EXPECT_FALSE(parser.hasBoundary());
+    EXPECT_EQ(parser.feed("x", 1, sink, &consumed), HTTP2ReceiveDataStatus::ABORT);
+
+    for (auto& body : {std::string("x"),
+                       "\r\n--" + BOUNDARY + "x",
+                       "--" + BOUNDARY + "\r\nno colon\r\n\r\n",
+                       "--" + BOUNDARY + "\r\n: no name\r\n\r\n",
+                       "--" + BOUNDARY + "\r\nname: no CR\n\r\n",
+                       "--" + BOUNDARY + "\r\nname: " + std::string(10000, 'x') + "\r\n\r\n"}) {
+        parser.setBoundary(BOUNDARY);
+        ASSERT_TRUE(parser.hasBoundary());
+        EXPECT_EQ(parser.feed(body.data(), body.size(), sink, &consumed), HTTP2ReceiveDataStatus::ABORT) << body;
+        EXPECT_STRNE(parser.getErrorReason(), "");
+        EXPECT_EQ(parser.feed("\r\n", 2, sink, &consumed), HTTP2ReceiveDataStatus::ABORT);
+    }
+    EXPECT_TRUE(sink.m_parts.empty());
+}
+
+/**
+ * Feed a downchannel response through @c HTTP2MimeResponseDecoder in 1 byte, 1 KB and 16 KB chunks; measures megabytes
+ * parsed per second.  The capture is generated rather than recorded so that it can be shared: it has the headers and
+ * JSON of real Speak directives, and MP3-sized attachments of random data.
+ */
+TEST(MimeMultipartParserBenchmarkTest, testSlow_downchannelSpeakDirectives) {
+    auto parts = buildDownchannelParts(SPEAK_DIRECTIVES, AUDIO_ATTACHMENT_SIZE);
+    auto body = buildBody(parts);
+    size_t dataSize = 0;
+    for (auto& part : parts) {
+        dataSize += part.data.size();
+    }
+
+    for (auto chunkSize : CHUNK_SIZES) {
+        duration<double> elapsed{0};
+        for (size_t pass = 0; pass <= BENCHMARK_PASSES; ++pass) {
+            // The untimed pass records the parts to check them, and the timed passes only count the data.
+            auto sink = std::make_shared<RecordingSink>(0, 0 == pass);
+            HTTP2MimeResponseDecoder decoder(sink);
+            ASSERT_TRUE(decoder.onReceiveResponseCode(http::HTTPResponseCode::SUCCESS_OK));
+            ASSERT_TRUE(decoder.onReceiveHeaderLine("content-type: multipart/related; boundary=" + BOUNDARY));
+
+            auto start = steady_clock::now();
+            for (size_t offset = 0; offset < body.size(); offset += chunkSize) {
+                auto status = decoder.onReceiveData(body.data() + offset, std::min(chunkSize, body.size() - offset));
+                ASSERT_EQ(status, HTTP2ReceiveDataStatus::SUCCESS);
+            }
+            if (pass > 0) {
+                elapsed += steady_clock::now() - start;
+            }
+
+            ASSERT_FALSE(sink->m_hasProtocolError);
+            ASSERT_EQ(sink->m_parts.size(), parts.size());
+            ASSERT_EQ(sink->m_countOfBytes, dataSize);
+            if (0 == pass) {
+                ASSERT_EQ(sink->m_parts, parts);
+            }
+        }
+
+        reportBenchmarkResult(
+            "CHUNK_" + std::to_string(chunkSize),
+            "megabytesPerSecond",
+            body.size() * BENCHMARK_PASSES / elapsed.count() / 1e6);
+    }
+}
+
+}  // namespace test
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
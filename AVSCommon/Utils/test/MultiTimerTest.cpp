@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "AVSCommon/Utils/Timing/MultiTimer.h"
@@ -93,6 +95,37 @@ TEST(MultiTimerTest, test_multipleTasksGetCalledInOrder) {
     EXPECT_EQ(counter, 2u);
 }
 
+/// Test that a task cancelled after its timer has fired, but before it has started running, does not run.
+TEST(MultiTimerTest, test_taskCancelledAfterTimerFiredShouldNotRun) {
+    WaitEvent blockingTaskStarted;
+    WaitEvent releaseBlockingTask;
+    WaitEvent blockingTaskDone;
+    MultiTimer timer;
+    size_t counter = 0;
+
+    // Due tasks run one at a time, so this task holds the next one in the queue after its timer has fired.
+    timer.submitTask(std::chrono::milliseconds(10), [&blockingTaskStarted, &releaseBlockingTask, &blockingTaskDone] {
+        blockingTaskStarted.wakeUp();
+        releaseBlockingTask.wait(std::chrono::seconds(5));
+        blockingTaskDone.wakeUp();
+    });
+    auto token = timer.submitTask(std::chrono::milliseconds(10), [&counter] {
+        // This task should never be called.
+        counter++;
+        EXPECT_TRUE(false);
+    });
+
+    ASSERT_TRUE(blockingTaskStarted.wait(std::chrono::seconds(5)));
+    // Give the second timer time to fire and queue its task.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    timer.cancelTask(token);
+    releaseBlockingTask.wakeUp();
+
+    EXPECT_TRUE(blockingTaskDone.wait(std::chrono::seconds(5)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(counter, 0u);
+}
+
 }  // namespace test
 }  // namespace timing
 }  // namespace utils
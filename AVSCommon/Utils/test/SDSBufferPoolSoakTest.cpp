@@ -0,0 +1,211 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SDSBufferPoolSoakTest.cpp
+///
+/// Measures the resident memory of the process over 10,000 simulated interactions, each of which creates the streams
+/// an interaction does: a small attachment made from a buffer as @c AttachmentUtils::createAttachmentReader() does, the
+/// stream of encoded audio of @c SpeechEncoder, and a 1 MiB attachment for the speech of the response.  Between the
+/// streams, longer-lived allocations are made and freed as the rest of the SDK does, which interleaves them with the
+/// stream buffers on the heap.  The buffers are either allocated for each stream or acquired from an
+/// @c SDSBufferPool.  Results are printed to stdout and recorded as test properties; only correctness is asserted so
+/// that the test is stable on loaded build machines.
+
+#ifdef __linux__
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+using namespace std::chrono;
+
+/// The number of interactions simulated by each variant.
+static const int INTERACTIONS = 10000;
+
+/// The number of interactions after which the resident memory is sampled.
+static const int SAMPLE_INTERVAL = 1000;
+
+/// The size of the data of an attachment, as @c InProcessAttachment buffers by default.
+static const size_t ATTACHMENT_SIZE = 0x100000;
+
+/// The amount of speech written to the attachment in each interaction.
+static const size_t SPEECH_SIZE = 48 * 1024;
+
+/// The size of the encoded audio stream: 20 Opus packets of 80 bytes, with 10 readers, as @c SpeechEncoder uses.
+static const size_t ENCODED_STREAM_SIZE = 20 * 80;
+
+/// The number of readers of the encoded audio stream.
+static const size_t ENCODED_STREAM_READERS = 10;
+
+/// The number of longer-lived allocations kept, standing in for directives, contexts and log lines.
+static const size_t LIVE_ALLOCATIONS = 256;
+
+/// A function which provides a buffer of a given size.
+using BufferFactory = std::function<std::shared_ptr<InProcessSDSTraits::Buffer>(size_t)>;
+
+/**
+ * Get the resident memory of this process.
+ *
+ * @return The resident memory, in KiB.
+ */
+static size_t residentKb() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+}
+
+/**
+ * Get the number of minor page faults of this process so far.
+ *
+ * @return The number of minor page faults.
+ */
+static long minorFaults() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+/**
+ * Create a stream on a buffer, write data to it, and check that a reader reads the same data back.
+ *
+ * @param buffer The buffer of the stream.
+ * @param maxReaders The number of readers the stream is created for.
+ * @param data The data to write.
+ * @param size The size of the data.
+ * @return Whether the data was read back.
+ */
+static bool passThroughStream(
+    std::shared_ptr<InProcessSDSTraits::Buffer> buffer,
+    size_t maxReaders,
+    const uint8_t* data,
+    size_t size) {
+    auto stream = InProcessSDS::create(buffer, 1, maxReaders);
+    if (!stream) {
+        return false;
+    }
+    auto writer = stream->createWriter(InProcessSDS::Writer::Policy::NONBLOCKABLE);
+    auto reader = stream->createReader(InProcessSDS::Reader::Policy::NONBLOCKING);
+    if (!writer || !reader || writer->write(data, size) != static_cast<ssize_t>(size)) {
+        return false;
+    }
+    std::vector<uint8_t> readBack(size);
+    return reader->read(readBack.data(), size) == static_cast<ssize_t>(size) &&
+           0 == memcmp(readBack.data(), data, size);
+}
+
+/// Fixture which simulates interactions and reports the resident memory.
+class SDSBufferPoolSoakTest : public ::testing::Test {
+protected:
+    /**
+     * Simulate interactions, and report the resident memory after each @c SAMPLE_INTERVAL interactions.
+     *
+     * @param variant The name of the variant.
+     * @param bufferFactory Provides the buffers of the streams.
+     */
+    void run(const std::string& variant, BufferFactory bufferFactory) {
+        std::vector<uint8_t> speech(SPEECH_SIZE);
+        for (size_t i = 0; i < speech.size(); ++i) {
+            speech[i] = static_cast<uint8_t>(i * 7 + i / 256);
+        }
+        std::vector<std::string> liveAllocations(LIVE_ALLOCATIONS);
+
+        auto attachmentBufferSize = InProcessSDS::calculateBufferSize(ATTACHMENT_SIZE);
+        auto encodedBufferSize = InProcessSDS::calculateBufferSize(ENCODED_STREAM_SIZE, 1, ENCODED_STREAM_READERS);
+        size_t firstSampleKb = 0;
+        size_t maxKb = 0;
+        auto faults = minorFaults();
+        auto start = steady_clock::now();
+        for (int interaction = 1; interaction <= INTERACTIONS; ++interaction) {
+            // The size of the small attachment varies with its content, from 1 KiB to 4 KiB.
+            auto smallSize = 1024 + (interaction * 97) % 3072;
+            ASSERT_TRUE(passThroughStream(
+                bufferFactory(InProcessSDS::calculateBufferSize(smallSize)), 1, speech.data(), smallSize));
+
+            auto encoded = bufferFactory(encodedBufferSize);
+            liveAllocations[interaction % LIVE_ALLOCATIONS].assign(100 + (interaction * 37) % 900, 'x');
+            auto attachment = bufferFactory(attachmentBufferSize);
+            liveAllocations[(interaction * 7) % LIVE_ALLOCATIONS].assign(100 + (interaction * 53) % 900, 'y');
+
+            ASSERT_TRUE(passThroughStream(encoded, ENCODED_STREAM_READERS, speech.data(), ENCODED_STREAM_SIZE));
+            ASSERT_TRUE(passThroughStream(attachment, 1, speech.data(), speech.size()));
+
+            if (0 == interaction % SAMPLE_INTERVAL) {
+                auto kb = residentKb();
+                reportBenchmarkResult(
+                    variant, "residentKbAfter" + std::to_string(interaction), static_cast<double>(kb));
+                if (0 == firstSampleKb) {
+                    firstSampleKb = kb;
+                }
+                maxKb = std::max(maxKb, kb);
+            }
+        }
+        duration<double> elapsed = steady_clock::now() - start;
+        faults = minorFaults() - faults;
+
+        reportBenchmarkResult(variant, "residentKbGrowthAfterFirstSample", static_cast<double>(maxKb - firstSampleKb));
+        reportBenchmarkResult(variant, "minorFaultsPerInteraction", static_cast<double>(faults) / INTERACTIONS);
+        reportBenchmarkResult(variant, "microsecondsPerInteraction", elapsed.count() * 1000000 / INTERACTIONS);
+    }
+};
+
+/// Each stream allocates its buffer, which is freed when the stream is destroyed.
+TEST_F(SDSBufferPoolSoakTest, testSlow_allocatedBuffers) {
+    run("ALLOCATED", [](size_t size) { return std::make_shared<InProcessSDSTraits::Buffer>(size); });
+}
+
+/// Each stream acquires its buffer from a pool with the default settings.
+TEST_F(SDSBufferPoolSoakTest, testSlow_pooledBuffers) {
+    auto pool = SDSBufferPool::create();
+    ASSERT_TRUE(pool);
+    run("POOLED", [pool](size_t size) { return pool->acquire(size); });
+
+    auto stats = pool->getStatistics();
+    reportBenchmarkResult("POOLED", "allocations", static_cast<double>(stats.allocations));
+    reportBenchmarkResult("POOLED", "retainedKb", static_cast<double>(stats.retainedBytes / 1024));
+    EXPECT_EQ(static_cast<uint64_t>(3 * INTERACTIONS), stats.acquisitions);
+    EXPECT_EQ(stats.acquisitions, stats.reuses + stats.allocations);
+    EXPECT_EQ(0u, stats.inUseBytes);
+    EXPECT_LE(stats.retainedBytes, SDSBufferPool::DEFAULT_MAX_RETAINED_BYTES);
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
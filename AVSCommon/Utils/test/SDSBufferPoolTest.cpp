@@ -0,0 +1,301 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
+
+#include "AVSCommon/Utils/Metrics/MetricEvent.h"
+#include "AVSCommon/Utils/SDS/SDSBufferPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+using namespace ::testing;
+using namespace metrics;
+using namespace metrics::test;
+
+/// The capacity of the smallest class of the pools tested.
+static const size_t MIN_CLASS_SIZE = 4 * 1024;
+
+/// The capacity of the largest class of the pools tested.
+static const size_t MAX_CLASS_SIZE = 64 * 1024;
+
+/// The capacity the pools tested add to each class for the header of the stream.
+static const size_t HEADER_ALLOWANCE = 1024;
+
+/// The capacity of the smallest class of the pools tested, with its header allowance.
+static const size_t MIN_CLASS_CAPACITY = MIN_CLASS_SIZE + HEADER_ALLOWANCE;
+
+/// The capacity of the second smallest class of the pools tested, with its header allowance.
+static const size_t SECOND_CLASS_CAPACITY = 2 * MIN_CLASS_SIZE + HEADER_ALLOWANCE;
+
+/// The capacity of the largest class of the pools tested, with its header allowance.
+static const size_t MAX_CLASS_CAPACITY = MAX_CLASS_SIZE + HEADER_ALLOWANCE;
+
+/// The most capacity the pools tested keep in idle buffers: two buffers of the largest class.
+static const size_t MAX_RETAINED_BYTES = 2 * MAX_CLASS_CAPACITY;
+
+/// Test fixture, which creates a pool with small classes.
+class SDSBufferPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SDSBufferPool::Configuration configuration;
+        configuration.minClassSize = MIN_CLASS_SIZE;
+        configuration.maxClassSize = MAX_CLASS_SIZE;
+        configuration.headerAllowance = HEADER_ALLOWANCE;
+        configuration.maxRetainedBytes = MAX_RETAINED_BYTES;
+        m_pool = SDSBufferPool::create(configuration);
+        ASSERT_TRUE(m_pool);
+    }
+
+    /// The pool tested.
+    std::shared_ptr<SDSBufferPool> m_pool;
+};
+
+/**
+ * Verify that invalid settings are rejected.
+ */
+TEST_F(SDSBufferPoolTest, test_createWithInvalidConfiguration) {
+    SDSBufferPool::Configuration configuration;
+    configuration.minClassSize = 0;
+    EXPECT_FALSE(SDSBufferPool::create(configuration));
+
+    configuration.minClassSize = MAX_CLASS_SIZE;
+    configuration.maxClassSize = MIN_CLASS_SIZE;
+    EXPECT_FALSE(SDSBufferPool::create(configuration));
+
+    configuration = SDSBufferPool::Configuration();
+    configuration.headerAllowance = std::numeric_limits<size_t>::max();
+    EXPECT_FALSE(SDSBufferPool::create(configuration));
+}
+
+/**
+ * Verify that sizes are rounded up to power-of-two classes plus the header allowance, and that sizes above the largest
+ * class are not pooled.
+ */
+TEST_F(SDSBufferPoolTest, test_classSizes) {
+    EXPECT_EQ(MIN_CLASS_CAPACITY, m_pool->getClassSize(0));
+    EXPECT_EQ(MIN_CLASS_CAPACITY, m_pool->getClassSize(1));
+    EXPECT_EQ(MIN_CLASS_CAPACITY, m_pool->getClassSize(MIN_CLASS_CAPACITY));
+    EXPECT_EQ(SECOND_CLASS_CAPACITY, m_pool->getClassSize(MIN_CLASS_CAPACITY + 1));
+    EXPECT_EQ(MAX_CLASS_CAPACITY, m_pool->getClassSize(MAX_CLASS_CAPACITY));
+    EXPECT_EQ(0u, m_pool->getClassSize(MAX_CLASS_CAPACITY + 1));
+
+    SDSBufferPool::Configuration configuration;
+    configuration.minClassSize = 3000;
+    configuration.maxClassSize = 60000;
+    auto pool = SDSBufferPool::create(configuration);
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(4096u + SDSBufferPool::DEFAULT_HEADER_ALLOWANCE, pool->getClassSize(1));
+    EXPECT_EQ(65536u + SDSBufferPool::DEFAULT_HEADER_ALLOWANCE, pool->getClassSize(65536));
+}
+
+/**
+ * Verify that a stream with a power-of-two data size takes the class of that size rather than the next one.
+ */
+TEST_F(SDSBufferPoolTest, test_streamOfPowerOfTwoSizeFitsItsClass) {
+    EXPECT_EQ(MAX_CLASS_CAPACITY, m_pool->getClassSize(InProcessSDS::calculateBufferSize(MAX_CLASS_SIZE)));
+
+    // The 1 MiB buffer of an attachment, with a reader per interaction in a default pool.
+    static const size_t ATTACHMENT_SIZE = 1024 * 1024;
+    auto pool = SDSBufferPool::create();
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(
+        ATTACHMENT_SIZE + SDSBufferPool::DEFAULT_HEADER_ALLOWANCE,
+        pool->getClassSize(InProcessSDS::calculateBufferSize(ATTACHMENT_SIZE, 1, 32)));
+}
+
+/**
+ * Verify that a buffer has the size requested and the capacity of its class.
+ */
+TEST_F(SDSBufferPoolTest, test_acquireHasSizeAndClassCapacity) {
+    auto buffer = m_pool->acquire(6000);
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(6000u, buffer->size());
+    EXPECT_EQ(SECOND_CLASS_CAPACITY, buffer->capacity());
+
+    auto large = m_pool->acquire(MAX_CLASS_CAPACITY + 1);
+    ASSERT_TRUE(large);
+    EXPECT_EQ(MAX_CLASS_CAPACITY + 1, large->size());
+}
+
+/**
+ * Verify that a released buffer is reused for a size of the same class, and not for a size of another class.
+ */
+TEST_F(SDSBufferPoolTest, test_releasedBufferIsReusedWithinItsClass) {
+    auto buffer = m_pool->acquire(6000);
+    auto data = buffer->data();
+    buffer.reset();
+
+    auto stats = m_pool->getStatistics();
+    EXPECT_EQ(SECOND_CLASS_CAPACITY, stats.retainedBytes);
+    EXPECT_EQ(0u, stats.inUseBytes);
+
+    auto other = m_pool->acquire(MIN_CLASS_SIZE);
+    EXPECT_EQ(0u, m_pool->getStatistics().reuses);
+
+    buffer = m_pool->acquire(7000);
+    EXPECT_EQ(data, buffer->data());
+    EXPECT_EQ(7000u, buffer->size());
+
+    stats = m_pool->getStatistics();
+    EXPECT_EQ(3u, stats.acquisitions);
+    EXPECT_EQ(1u, stats.reuses);
+    EXPECT_EQ(2u, stats.allocations);
+    EXPECT_EQ(0u, stats.retainedBytes);
+    EXPECT_EQ(SECOND_CLASS_CAPACITY + MIN_CLASS_CAPACITY, stats.inUseBytes);
+}
+
+/**
+ * Verify that a reused buffer holds none of the data of its previous user.
+ */
+TEST_F(SDSBufferPoolTest, test_reusedBufferIsZeroed) {
+    auto buffer = m_pool->acquire(6000);
+    auto data = buffer->data();
+    memset(buffer->data(), 0x5a, buffer->size());
+    buffer.reset();
+
+    buffer = m_pool->acquire(7000);
+    ASSERT_EQ(data, buffer->data());
+    EXPECT_EQ(buffer->end(), std::find_if(buffer->begin(), buffer->end(), [](uint8_t byte) { return byte != 0; }));
+}
+
+/**
+ * Verify that buffers are freed rather than kept once the idle buffers reach the retained bound, and that buffers too
+ * large to be pooled are never kept.
+ */
+TEST_F(SDSBufferPoolTest, test_retainedBytesAreBounded) {
+    std::vector<std::shared_ptr<InProcessSDSTraits::Buffer>> buffers;
+    for (int i = 0; i < 3; ++i) {
+        buffers.push_back(m_pool->acquire(MAX_CLASS_CAPACITY));
+    }
+    buffers.push_back(m_pool->acquire(MAX_CLASS_CAPACITY + 1));
+    EXPECT_EQ(3 * MAX_CLASS_CAPACITY + MAX_CLASS_CAPACITY + 1, m_pool->getStatistics().inUseBytes);
+    buffers.clear();
+
+    auto stats = m_pool->getStatistics();
+    EXPECT_EQ(MAX_RETAINED_BYTES, stats.retainedBytes);
+    EXPECT_EQ(0u, stats.inUseBytes);
+    EXPECT_EQ(2u, stats.discards);
+}
+
+/**
+ * Verify that a buffer released after its pool is destroyed is freed.
+ */
+TEST_F(SDSBufferPoolTest, test_bufferOutlivesPool) {
+    auto buffer = m_pool->acquire(100);
+    m_pool.reset();
+    (*buffer)[99] = 1;
+    buffer.reset();
+}
+
+/**
+ * Verify that a stream can be created on a reused buffer, and only reads back the data written to it.
+ */
+TEST_F(SDSBufferPoolTest, test_streamOnReusedBuffer) {
+    static const std::string FIRST = "first interaction";
+    static const std::string SECOND = "second";
+    auto size = InProcessSDS::calculateBufferSize(1024);
+
+    for (const auto& text : {FIRST, SECOND}) {
+        auto stream = InProcessSDS::create(m_pool->acquire(size));
+        ASSERT_TRUE(stream);
+        auto writer = stream->createWriter(InProcessSDS::Writer::Policy::NONBLOCKABLE);
+        auto reader = stream->createReader(InProcessSDS::Reader::Policy::NONBLOCKING);
+        ASSERT_TRUE(writer && reader);
+        ASSERT_EQ(static_cast<ssize_t>(text.size()), writer->write(text.data(), text.size()));
+
+        char buffer[64];
+        ASSERT_EQ(static_cast<ssize_t>(text.size()), reader->read(buffer, sizeof(buffer)));
+        EXPECT_EQ(text, std::string(buffer, text.size()));
+        EXPECT_EQ(InProcessSDS::Reader::Error::WOULDBLOCK, reader->read(buffer, sizeof(buffer)));
+    }
+    EXPECT_EQ(1u, m_pool->getStatistics().reuses);
+}
+
+/**
+ * Verify that buffers can be acquired and released concurrently, and that the accounting balances afterwards.
+ */
+TEST_F(SDSBufferPoolTest, test_concurrentAcquireAndRelease) {
+    static const int THREADS = 4;
+    static const int ITERATIONS = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([this, t] {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                auto buffer = m_pool->acquire(((i + t) % 16 + 1) * 4000);
+                memset(buffer->data(), t, buffer->size());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = m_pool->getStatistics();
+    EXPECT_EQ(static_cast<uint64_t>(THREADS * ITERATIONS), stats.acquisitions);
+    EXPECT_EQ(stats.acquisitions, stats.reuses + stats.allocations);
+    EXPECT_EQ(0u, stats.inUseBytes);
+    EXPECT_LE(stats.retainedBytes, MAX_RETAINED_BYTES);
+}
+
+/**
+ * Verify that the statistics are reported to the metric recorder every @c STATISTICS_REPORT_INTERVAL acquisitions
+ * (when metrics recording is enabled).
+ */
+TEST_F(SDSBufferPoolTest, test_statisticsAreReported) {
+    auto metricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
+    std::shared_ptr<MetricEvent> recorded;
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(*metricRecorder, recordMetric(_)).WillOnce(SaveArg<0>(&recorded));
+#else
+    EXPECT_CALL(*metricRecorder, recordMetric(_)).Times(0);
+#endif
+    m_pool->setMetricRecorder(metricRecorder);
+
+    for (uint64_t i = 0; i < SDSBufferPool::STATISTICS_REPORT_INTERVAL; ++i) {
+        m_pool->acquire(100);
+    }
+
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    ASSERT_TRUE(recorded);
+    EXPECT_EQ("SDSBufferPool-statistics", recorded->getActivityName());
+    auto acquisitions = recorded->getDataPoint("acquisitions", DataType::COUNTER);
+    ASSERT_TRUE(acquisitions.hasValue());
+    EXPECT_EQ(std::to_string(SDSBufferPool::STATISTICS_REPORT_INTERVAL), acquisitions.value().getValue());
+    auto reuses = recorded->getDataPoint("reuses", DataType::COUNTER);
+    ASSERT_TRUE(reuses.hasValue());
+    EXPECT_EQ(std::to_string(SDSBufferPool::STATISTICS_REPORT_INTERVAL - 1), reuses.value().getValue());
+#endif
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
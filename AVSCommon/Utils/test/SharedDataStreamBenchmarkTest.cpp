@@ -0,0 +1,368 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedDataStreamBenchmarkTest.cpp
+///
+/// Compares the throughput of audio passed through a @c SharedDataStream with @c Writer::write() and
+/// @c Reader::read(), which copy every sample into and out of the stream, against @c Writer::reserve()/@c commit() and
+/// @c Reader::peek()/@c consume(), which produce and consume samples in place.  Also measures the wakeups and lock
+/// traffic of a microphone stream with several blocking readers.  Results are printed to stdout and recorded as test
+/// properties; only correctness is asserted so that the test is stable on loaded build machines.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+using namespace std::chrono;
+
+/// The size of a sample, which is the word size of the streams.
+static const size_t WORD_SIZE = sizeof(int16_t);
+
+/// The number of audio frames per second; a frame is 10 ms of audio, as delivered by a typical microphone.
+static const size_t FRAMES_PER_SECOND = 100;
+
+/// The amount of audio buffered by the streams.
+static const seconds BUFFERED_AUDIO{1};
+
+/// The amount of audio passed through the stream by each variant.
+static const seconds STREAMED_AUDIO{120};
+
+/// The stream type used.
+using Sds = SharedDataStream<InProcessSDSTraits>;
+
+/// Describes the audio passed through a stream.
+struct StreamFormat {
+    /// The name of the format.
+    std::string name;
+    /// The number of samples per second for each channel.
+    size_t sampleRateHz;
+    /// The number of interleaved channels.
+    size_t channels;
+};
+
+/// The number of readers of the stream in the wakeup benchmark, standing in for KWD, AIP, encoder and diagnostics.
+static const size_t WAKEUP_READERS = 4;
+
+/// The number of frames the batching reader in the wakeup benchmark waits for.
+static const size_t BATCH_FRAMES = 4;
+
+/// The interval at which the non-blocking reader in the wakeup benchmark polls.
+static const milliseconds POLL_INTERVAL{100};
+
+/// The amount of audio passed through the stream in the wakeup benchmark, which runs in real time.
+static const seconds REAL_TIME_AUDIO{2};
+
+/// Counts of the synchronization operations which may make a system call.
+struct SyncCounts {
+    /// The number of times a mutex was locked while another thread held it.
+    std::atomic<uint64_t> contendedLocks;
+    /// The number of times a condition variable was notified.
+    std::atomic<uint64_t> notifies;
+    /// The number of times a thread blocked on a condition variable.
+    std::atomic<uint64_t> waits;
+};
+
+/// The counts of the operations of @c CountingTraits.
+static SyncCounts g_syncCounts;
+
+/// In-process traits which count the synchronization operations the stream performs.
+struct CountingTraits {
+    using AtomicIndex = InProcessSDSTraits::AtomicIndex;
+    using AtomicBool = InProcessSDSTraits::AtomicBool;
+    using Buffer = InProcessSDSTraits::Buffer;
+
+    /// A std::mutex which counts contended locks.
+    class Mutex {
+    public:
+        void lock() {
+            if (!m_mutex.try_lock()) {
+                ++g_syncCounts.contendedLocks;
+                m_mutex.lock();
+            }
+        }
+        void unlock() {
+            m_mutex.unlock();
+        }
+
+    private:
+        std::mutex m_mutex;
+    };
+
+    /// A condition variable which counts notifies and waits.
+    class ConditionVariable {
+    public:
+        void notify_all() {
+            ++g_syncCounts.notifies;
+            m_condition.notify_all();
+        }
+        void wait(std::unique_lock<Mutex>& lock) {
+            ++g_syncCounts.waits;
+            m_condition.wait(lock);
+        }
+        template <typename Predicate>
+        void wait(std::unique_lock<Mutex>& lock, Predicate predicate) {
+            while (!predicate()) {
+                wait(lock);
+            }
+        }
+        template <typename Rep, typename Period, typename Predicate>
+        bool wait_for(std::unique_lock<Mutex>& lock, const duration<Rep, Period>& timeout, Predicate predicate) {
+            auto deadline = steady_clock::now() + timeout;
+            while (!predicate()) {
+                ++g_syncCounts.waits;
+                if (std::cv_status::timeout == m_condition.wait_until(lock, deadline)) {
+                    return predicate();
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::condition_variable_any m_condition;
+    };
+
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::test::CountingTraits";
+};
+
+/**
+ * Get the number of context switches of this process so far.
+ *
+ * @return The number of voluntary and involuntary context switches.
+ */
+static uint64_t contextSwitches() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+/**
+ * Produce the samples of a frame, standing in for a microphone driver.
+ *
+ * @param frame The number of the frame.
+ * @param samples The samples to write to.
+ * @param count The number of samples to write.
+ */
+static void produce(size_t frame, int16_t* samples, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = static_cast<int16_t>(frame + i);
+    }
+}
+
+/**
+ * Consume samples, standing in for a keyword detector or encoder.
+ *
+ * @param samples The samples to consume.
+ * @param count The number of samples.
+ * @return A checksum of the samples.
+ */
+static uint64_t consume(const int16_t* samples, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += static_cast<uint16_t>(samples[i]);
+    }
+    return sum;
+}
+
+/// Fixture parameterized on the format of the audio streamed.
+class SharedDataStreamBenchmarkTest : public ::testing::TestWithParam<StreamFormat> {
+protected:
+    /// Create a stream which buffers @c BUFFERED_AUDIO and a half frame, so that frames regularly wrap.
+    std::shared_ptr<Sds> createStream() {
+        auto samplesPerSecond = GetParam().sampleRateHz * GetParam().channels;
+        auto words = samplesPerSecond * BUFFERED_AUDIO.count() + samplesPerSecond / FRAMES_PER_SECOND / 2;
+        auto buffer = std::make_shared<Sds::Buffer>(Sds::calculateBufferSize(words, WORD_SIZE, 1));
+        return Sds::create(buffer, WORD_SIZE, 1);
+    }
+};
+
+/// Copying read/write versus in-place peek/consume and reserve/commit; measures audio processed per second.
+TEST_P(SharedDataStreamBenchmarkTest, testSlow_throughput) {
+    const size_t frameWords = GetParam().sampleRateHz * GetParam().channels / FRAMES_PER_SECOND;
+    const size_t frames = FRAMES_PER_SECOND * STREAMED_AUDIO.count();
+    uint64_t copiedSum = 0;
+    uint64_t inPlaceSum = 0;
+
+    // Copying: the producer fills its own frame and writes it, and the consumer reads into its own frame.
+    {
+        auto stream = createStream();
+        ASSERT_NE(stream, nullptr);
+        auto writer = stream->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+        auto reader = stream->createReader(Sds::Reader::Policy::NONBLOCKING);
+        std::vector<int16_t> producerFrame(frameWords);
+        std::vector<int16_t> consumerFrame(frameWords);
+        auto start = steady_clock::now();
+        for (size_t frame = 0; frame < frames; ++frame) {
+            produce(frame, producerFrame.data(), frameWords);
+            ASSERT_EQ(writer->write(producerFrame.data(), frameWords), static_cast<ssize_t>(frameWords));
+            ASSERT_EQ(reader->read(consumerFrame.data(), frameWords), static_cast<ssize_t>(frameWords));
+            copiedSum += consume(consumerFrame.data(), frameWords);
+        }
+        auto elapsed = duration_cast<duration<double>>(steady_clock::now() - start).count();
+        auto variant = GetParam().name + "_COPY";
+        reportBenchmarkResult(variant, "audioSecondsPerSecond", STREAMED_AUDIO.count() / elapsed);
+        reportBenchmarkResult(variant, "megabytesPerSecond", frames * frameWords * WORD_SIZE / elapsed / 1e6);
+    }
+
+    // In place: the producer fills reserved space and the consumer uses peeked data, wrapping in two regions.
+    {
+        auto stream = createStream();
+        ASSERT_NE(stream, nullptr);
+        auto writer = stream->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+        auto reader = stream->createReader(Sds::Reader::Policy::NONBLOCKING);
+        std::vector<int16_t> wrappedFrame(frameWords);
+        auto start = steady_clock::now();
+        for (size_t frame = 0; frame < frames; ++frame) {
+            Sds::Writer::Regions space;
+            ASSERT_EQ(writer->reserve(&space, frameWords), static_cast<ssize_t>(frameWords));
+            if (0 == space.nWords[1]) {
+                produce(frame, static_cast<int16_t*>(space.data[0]), frameWords);
+            } else {
+                // A frame which wraps is produced into a scratch frame, as a driver writing to its own buffer would.
+                produce(frame, wrappedFrame.data(), frameWords);
+                memcpy(space.data[0], wrappedFrame.data(), space.nWords[0] * WORD_SIZE);
+                memcpy(space.data[1], wrappedFrame.data() + space.nWords[0], space.nWords[1] * WORD_SIZE);
+            }
+            ASSERT_EQ(writer->commit(frameWords), static_cast<ssize_t>(frameWords));
+
+            Sds::Reader::Regions data;
+            ASSERT_EQ(reader->peek(&data, frameWords), static_cast<ssize_t>(frameWords));
+            inPlaceSum += consume(static_cast<const int16_t*>(data.data[0]), data.nWords[0]);
+            inPlaceSum += consume(static_cast<const int16_t*>(data.data[1]), data.nWords[1]);
+            ASSERT_EQ(reader->consume(frameWords), static_cast<ssize_t>(frameWords));
+        }
+        auto elapsed = duration_cast<duration<double>>(steady_clock::now() - start).count();
+        auto variant = GetParam().name + "_IN_PLACE";
+        reportBenchmarkResult(variant, "audioSecondsPerSecond", STREAMED_AUDIO.count() / elapsed);
+        reportBenchmarkResult(variant, "megabytesPerSecond", frames * frameWords * WORD_SIZE / elapsed / 1e6);
+    }
+
+    EXPECT_EQ(copiedSum, inPlaceSum);
+}
+
+/**
+ * A 16 kHz microphone stream read by a reader which reads every frame, a reader which waits for batches of frames, a
+ * reader which peeks at every frame, and a non-blocking reader which polls; measures the operations per second of audio
+ * which may make a system call.  The writer only locks and notifies when a reader is waiting for the data it wrote, so
+ * the polling reader adds no notifies; the batching reader adds none either, but it is woken to re-check whenever the
+ * writer notifies the readers of every frame.
+ */
+TEST(SharedDataStreamWakeupBenchmarkTest, testSlow_wakeupsWithFourReaders) {
+    using CountingSds = SharedDataStream<CountingTraits>;
+    const size_t frameWords = 16000 / FRAMES_PER_SECOND;
+    const size_t frames = FRAMES_PER_SECOND * REAL_TIME_AUDIO.count();
+    const size_t batchWords = frameWords * BATCH_FRAMES;
+    auto bufferSize = CountingSds::calculateBufferSize(
+        frameWords * FRAMES_PER_SECOND * BUFFERED_AUDIO.count(), WORD_SIZE, WAKEUP_READERS);
+    auto stream = CountingSds::create(std::make_shared<CountingSds::Buffer>(bufferSize), WORD_SIZE, WAKEUP_READERS);
+    ASSERT_NE(stream, nullptr);
+    auto writer = stream->createWriter(CountingSds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+
+    std::atomic<uint64_t> wordsRead{0};
+    std::vector<std::thread> readers;
+    std::shared_ptr<CountingSds::Reader> everyFrame = stream->createReader(CountingSds::Reader::Policy::BLOCKING);
+    readers.emplace_back([everyFrame, frameWords, &wordsRead] {
+        std::vector<int16_t> frame(frameWords);
+        ssize_t result;
+        while ((result = everyFrame->read(frame.data(), frameWords)) > 0) {
+            wordsRead += result;
+        }
+    });
+    std::shared_ptr<CountingSds::Reader> batching = stream->createReader(CountingSds::Reader::Policy::BLOCKING);
+    readers.emplace_back([batching, batchWords, &wordsRead] {
+        std::vector<int16_t> batch(batchWords);
+        while (batching->wait(batchWords) > 0) {
+            wordsRead += batching->read(batch.data(), batchWords);
+        }
+    });
+    std::shared_ptr<CountingSds::Reader> peeking = stream->createReader(CountingSds::Reader::Policy::BLOCKING);
+    readers.emplace_back([peeking, frameWords, &wordsRead] {
+        CountingSds::Reader::Regions data;
+        ssize_t result;
+        while ((result = peeking->peek(&data, frameWords)) > 0) {
+            wordsRead += peeking->consume(result);
+        }
+    });
+    std::shared_ptr<CountingSds::Reader> polling = stream->createReader(CountingSds::Reader::Policy::NONBLOCKING);
+    readers.emplace_back([polling, batchWords, &wordsRead] {
+        std::vector<int16_t> batch(batchWords);
+        ssize_t result;
+        while ((result = polling->read(batch.data(), batchWords)) != CountingSds::Reader::Error::CLOSED) {
+            if (result > 0) {
+                wordsRead += result;
+            } else {
+                std::this_thread::sleep_for(POLL_INTERVAL);
+            }
+        }
+    });
+
+    g_syncCounts.contendedLocks = 0;
+    g_syncCounts.notifies = 0;
+    g_syncCounts.waits = 0;
+    auto startContextSwitches = contextSwitches();
+    std::vector<int16_t> frame(frameWords);
+    auto nextFrame = steady_clock::now();
+    for (size_t i = 0; i < frames; ++i) {
+        std::this_thread::sleep_until(nextFrame);
+        nextFrame += milliseconds(1000 / FRAMES_PER_SECOND);
+        produce(i, frame.data(), frameWords);
+        ASSERT_EQ(writer->write(frame.data(), frameWords), static_cast<ssize_t>(frameWords));
+    }
+    writer->close();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    auto seconds = static_cast<double>(REAL_TIME_AUDIO.count());
+
+    EXPECT_EQ(wordsRead, WAKEUP_READERS * frames * frameWords);
+    const std::string variant = "16kHz_1ch_4readers";
+    reportBenchmarkResult(variant, "writesPerSecond", frames / seconds);
+    reportBenchmarkResult(variant, "notifiesPerSecond", g_syncCounts.notifies / seconds);
+    reportBenchmarkResult(variant, "waitsPerSecond", g_syncCounts.waits / seconds);
+    reportBenchmarkResult(variant, "contendedLocksPerSecond", g_syncCounts.contendedLocks / seconds);
+    reportBenchmarkResult(variant, "contextSwitchesPerSecond", (contextSwitches() - startContextSwitches) / seconds);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    AudioFormats,
+    SharedDataStreamBenchmarkTest,
+    ::testing::Values(StreamFormat{"16kHz_1ch", 16000, 1}, StreamFormat{"48kHz_8ch", 48000, 8}));
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
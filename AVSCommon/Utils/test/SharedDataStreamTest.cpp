@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <chrono>
 #include <climits>
+#include <cstring>
 #include <functional>
 #include <random>
 #include <unordered_map>
@@ -1132,6 +1133,198 @@ TEST_F(SharedDataStreamTest, test_writerGetWordSize) {
     }
 }
 
+/// This tests @c SharedDataStream::Reader::peek() and @c SharedDataStream::Reader::consume().
+TEST_F(SharedDataStreamTest, test_readerPeekConsume) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 2;
+    static const std::chrono::milliseconds TIMEOUT{100};
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    std::shared_ptr<Sds::Reader> blocking = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(blocking, nullptr);
+    auto nonblocking = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(nonblocking, nullptr);
+
+    uint16_t writeBuf[WORDCOUNT] = {1, 2, 3, 4};
+    Sds::Reader::Regions regions;
+
+    // Verify bad parameter handling.
+    ASSERT_EQ(nonblocking->peek(nullptr), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(nonblocking->peek(&regions, 0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(nonblocking->peek(&regions, WORDCOUNT + 1), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(nonblocking->consume(0), Sds::Reader::Error::INVALID);
+
+    // Verify peeking at an empty stream blocks or times out as per policy.
+    ASSERT_EQ(nonblocking->peek(&regions), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(blocking->peek(&regions, 1, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    // Verify data can be peeked at in place, repeatedly, without consuming it.
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(nonblocking->peek(&regions), 3);
+    ASSERT_EQ(regions.nWords[0], 3U);
+    ASSERT_EQ(regions.nWords[1], 0U);
+    ASSERT_EQ(memcmp(regions.data[0], writeBuf, 3 * WORDSIZE), 0);
+    ASSERT_EQ(nonblocking->peek(&regions), 3);
+    ASSERT_EQ(nonblocking->tell(), 0U);
+
+    // Verify minWords is honored.
+    ASSERT_EQ(nonblocking->peek(&regions, 4), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(blocking->peek(&regions, 4, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    // Verify unconsumed data holds off an all-or-nothing writer, and consumed data does not.
+    ASSERT_EQ(nonblocking->consume(4), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(nonblocking->consume(2), 2);
+    ASSERT_EQ(blocking->consume(2), 2);
+    ASSERT_EQ(writer->write(writeBuf, 4), Sds::Writer::Error::WOULDBLOCK);
+    ASSERT_EQ(writer->write(writeBuf, 2), 2);
+
+    // Verify data which wraps is returned as two regions.
+    ASSERT_EQ(nonblocking->peek(&regions), 3);
+    ASSERT_EQ(regions.nWords[0], 2U);
+    ASSERT_EQ(regions.nWords[1], 1U);
+    ASSERT_EQ(memcmp(regions.data[0], writeBuf + 2, WORDSIZE), 0);
+    ASSERT_EQ(memcmp(regions.data[1], writeBuf + 1, WORDSIZE), 0);
+
+    // Verify a blocked peek unblocks once minWords are available.
+    auto result = std::async([blocking]() {
+        Sds::Reader::Regions regions;
+        return blocking->peek(&regions, 4, TIMEOUT * 10);
+    });
+    ASSERT_NE(result.wait_for(std::chrono::milliseconds::zero()), std::future_status::ready);
+    ASSERT_EQ(nonblocking->consume(3), 3);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(result.get(), 4);
+
+    // Verify peeks stop at the close index.
+    nonblocking->close(1, Sds::Reader::Reference::AFTER_READER);
+    ASSERT_EQ(nonblocking->peek(&regions, 2), 1);
+    ASSERT_EQ(nonblocking->consume(1), 1);
+    ASSERT_EQ(nonblocking->peek(&regions), Sds::Reader::Error::CLOSED);
+
+    // Verify the remaining data can be peeked at after the writer closes, and then the stream is closed.
+    writer->close();
+    ASSERT_EQ(blocking->peek(&regions, 4), 4);
+    ASSERT_EQ(blocking->consume(4), 4);
+    ASSERT_EQ(blocking->peek(&regions), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests that @c SharedDataStream::Reader::consume() reports data overwritten by a nonblockable @c Writer.
+TEST_F(SharedDataStreamTest, test_readerConsumeOverrun) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    uint8_t writeBuf[WORDCOUNT] = {};
+    Sds::Reader::Regions regions;
+    ASSERT_EQ(writer->write(writeBuf, 2), 2);
+    ASSERT_EQ(reader->peek(&regions), 2);
+
+    // Overwrite the first peeked word, then verify consume() reports it and the reader still advances.
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(reader->consume(2), Sds::Reader::Error::OVERRUN);
+    ASSERT_EQ(reader->tell(), 2U);
+    ASSERT_EQ(reader->peek(&regions), 3);
+    ASSERT_EQ(reader->consume(3), 3);
+}
+
+/// This tests @c SharedDataStream::Writer::reserve() and @c SharedDataStream::Writer::commit().
+TEST_F(SharedDataStreamTest, test_writerReserveCommit) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::milliseconds TIMEOUT{100};
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer1 = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds1 = Sds::create(buffer1, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds1, nullptr);
+    auto buffer2 = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds2 = Sds::create(buffer2, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds2, nullptr);
+    auto buffer3 = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds3 = Sds::create(buffer3, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds3, nullptr);
+
+    auto nonblockable = sds1->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(nonblockable, nullptr);
+    auto allOrNothing = sds2->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(allOrNothing, nullptr);
+    auto blocking = sds3->createWriter(Sds::Writer::Policy::BLOCKING);
+    ASSERT_NE(blocking, nullptr);
+    auto reader = sds1->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto reader2 = sds2->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader2, nullptr);
+    auto reader3 = sds3->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader3, nullptr);
+
+    Sds::Writer::Regions regions;
+
+    // Verify bad parameter handling.
+    ASSERT_EQ(nonblockable->reserve(nullptr, 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(nonblockable->reserve(&regions, 0), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(nonblockable->commit(1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(allOrNothing->reserve(&regions, WORDCOUNT + 1), Sds::Writer::Error::INVALID);
+
+    // Verify reserved data is not visible to readers until it is committed, and committing is limited to the
+    // reservation.
+    ASSERT_EQ(nonblockable->reserve(&regions, 3), 3);
+    ASSERT_EQ(regions.nWords[0], 3U);
+    ASSERT_EQ(regions.nWords[1], 0U);
+    uint16_t words[] = {1, 2, 3};
+    memcpy(regions.data[0], words, sizeof(words));
+    uint16_t readBuf[WORDCOUNT] = {};
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(nonblockable->commit(4), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(nonblockable->commit(2), 2);
+    ASSERT_EQ(nonblockable->commit(1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 2);
+    ASSERT_EQ(readBuf[0], 1);
+    ASSERT_EQ(readBuf[1], 2);
+    ASSERT_EQ(nonblockable->tell(), 2U);
+
+    // Verify space which wraps is returned as two regions, and a nonblockable writer truncates to the buffer size.
+    ASSERT_EQ(nonblockable->reserve(&regions, WORDCOUNT * 2), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(regions.nWords[0], 2U);
+    ASSERT_EQ(regions.nWords[1], 2U);
+    ASSERT_EQ(regions.data[1], buffer1->data() + (bufferSize - WORDCOUNT * WORDSIZE));
+
+    // Verify an all-or-nothing writer can't reserve over unconsumed data.
+    ASSERT_EQ(allOrNothing->reserve(&regions, 3), 3);
+    ASSERT_EQ(allOrNothing->commit(3), 3);
+    ASSERT_EQ(allOrNothing->reserve(&regions, 2), Sds::Writer::Error::WOULDBLOCK);
+    ASSERT_EQ(allOrNothing->reserve(&regions, 1), 1);
+
+    // Verify a blocking writer reserves only the space available, and waits when there is none.
+    ASSERT_EQ(blocking->reserve(&regions, 3), 3);
+    ASSERT_EQ(blocking->commit(3), 3);
+    ASSERT_EQ(blocking->reserve(&regions, 3), 1);
+    ASSERT_EQ(blocking->commit(1), 1);
+    ASSERT_EQ(blocking->reserve(&regions, 1, TIMEOUT), Sds::Writer::Error::TIMEDOUT);
+    ASSERT_EQ(reader3->read(readBuf, 2), 2);
+    ASSERT_EQ(blocking->reserve(&regions, 3, TIMEOUT), 2);
+
+    // Verify a closed writer can neither reserve nor commit.
+    blocking->close();
+    ASSERT_EQ(blocking->commit(1), Sds::Writer::Error::CLOSED);
+    ASSERT_EQ(blocking->reserve(&regions, 1), Sds::Writer::Error::CLOSED);
+}
+
 // Disabled test due to ACSDK-3414
 /// This tests a nonblockable, slow @c Writer streaming concurrently to two fast @c Readers (one of each type).
 TEST_F(SharedDataStreamTest, DISABLED_testTimer_concurrencyNonblockableWriterDualReader) {
@@ -1168,6 +1361,89 @@ TEST_F(SharedDataStreamTest, DISABLED_testTimer_concurrencyNonblockableWriterDua
     ASSERT_GE(nonblockingWords.get(), TEST_SIZE_WORDS);
 }
 
+/// This tests @c Reader::wait().
+TEST_F(SharedDataStreamTest, test_readerWaitForWords) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 2;
+    static const std::chrono::milliseconds TIMEOUT{100};
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    std::shared_ptr<Sds::Reader> blocking = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(blocking, nullptr);
+    std::shared_ptr<Sds::Reader> nonblocking = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(nonblocking, nullptr);
+
+    uint16_t buf[WORDCOUNT] = {1, 2, 3, 4};
+
+    // Verify bad parameter handling.
+    ASSERT_EQ(nonblocking->wait(0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(nonblocking->wait(WORDCOUNT + 1), Sds::Reader::Error::INVALID);
+
+    // Verify waiting on an empty stream blocks or times out as per policy.
+    ASSERT_EQ(nonblocking->wait(1), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(blocking->wait(1, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    // Verify a non-blocking reader waits when given a timeout, and is woken up by a write.
+    ASSERT_EQ(nonblocking->wait(1, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+    auto woken = std::async([nonblocking]() { return nonblocking->wait(1, TIMEOUT * 10); });
+    ASSERT_EQ(writer->write(buf, 2), 2);
+    ASSERT_EQ(woken.get(), 2);
+
+    // Verify all available words are reported, without being read.
+    ASSERT_EQ(nonblocking->wait(2), 2);
+    ASSERT_EQ(nonblocking->wait(3), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(blocking->wait(1, TIMEOUT), 2);
+    ASSERT_EQ(blocking->tell(), 0U);
+
+    // Verify a blocked wait sleeps through writes which don't complete the batch.
+    auto result = std::async([blocking]() { return blocking->wait(WORDCOUNT, TIMEOUT * 10); });
+    ASSERT_EQ(writer->write(buf, 1), 1);
+    ASSERT_EQ(result.wait_for(TIMEOUT), std::future_status::timeout);
+    ASSERT_EQ(writer->write(buf, 1), 1);
+    ASSERT_EQ(result.get(), static_cast<ssize_t>(WORDCOUNT));
+
+    // Verify a wait returns the words which are left when the writer closes.
+    ASSERT_EQ(blocking->read(buf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(nonblocking->read(buf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->write(buf, 1), 1);
+    result = std::async([blocking]() { return blocking->wait(2, TIMEOUT * 10); });
+    ASSERT_EQ(result.wait_for(TIMEOUT), std::future_status::timeout);
+    writer->close();
+    ASSERT_EQ(result.get(), 1);
+    ASSERT_EQ(blocking->read(buf, WORDCOUNT), 1);
+    ASSERT_EQ(blocking->wait(1), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests that @c read() and @c peek() on a non-blocking @c Reader ignore their timeout, unlike @c wait().
+TEST_F(SharedDataStreamTest, test_nonblockingReadIgnoresTimeout) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::milliseconds TIMEOUT{500};
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    uint16_t buf[WORDCOUNT] = {1, 2, 3, 4};
+    Sds::Reader::Regions regions;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(reader->read(buf, WORDCOUNT, TIMEOUT), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(reader->peek(&regions, 1, TIMEOUT), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_LT(std::chrono::steady_clock::now() - start, TIMEOUT);
+}
+
 /// This tests an all-or-nothing, fast @c Writer streaming concurrently to a slow non-blocking @c Reader.
 TEST_F(SharedDataStreamTest, test_concurrencyAllOrNothingWriterNonblockingReader) {
     static const size_t WORDSIZE = 1;
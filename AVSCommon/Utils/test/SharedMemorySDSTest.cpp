@@ -0,0 +1,374 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedMemorySDSTest.cpp
+///
+/// Tests @c SharedMemorySDSTraits with a @c Writer and a @c Reader in different processes.  The two-process benchmark
+/// prints its results to stdout and records them as test properties; only correctness is asserted so that the test is
+/// stable on loaded build machines.
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+using namespace std::chrono;
+
+/// The size of a sample, which is the word size of the streams.
+static const size_t WORD_SIZE = sizeof(int16_t);
+
+/// The number of samples in a frame: 10 ms of 16 kHz audio.
+static const size_t FRAME_WORDS = 160;
+
+/// The number of frames buffered by the streams.
+static const size_t BUFFERED_FRAMES = 100;
+
+/// The maximum number of readers of the streams.
+static const size_t MAX_READERS = 2;
+
+/// The reader id used by the child process.
+static const size_t CHILD_READER_ID = 1;
+
+/// How long either process waits for the other before giving up.
+static const milliseconds TIMEOUT{5000};
+
+/// The number of frames written by the throughput benchmark: 60 seconds of audio.
+static const size_t THROUGHPUT_FRAMES = 6000;
+
+/// The number of frames written by the latency benchmark.
+static const size_t LATENCY_FRAMES = 500;
+
+/// The interval between frames written by the latency benchmark, so that the reader is waiting for each one.
+static const microseconds LATENCY_FRAME_INTERVAL{500};
+
+/// State shared between the processes of a test, besides the stream itself.
+struct SharedState {
+    /// Set by the child when it has created its @c Reader.
+    std::atomic<bool> readerReady;
+    /// The sum of the samples read by the child.
+    std::atomic<uint64_t> checksum;
+    /// The total latency of the frames read by the child, in nanoseconds.
+    std::atomic<uint64_t> totalLatencyNs;
+    /// The largest latency of a frame read by the child, in nanoseconds.
+    std::atomic<uint64_t> maxLatencyNs;
+};
+
+/**
+ * Produce the samples of a frame.
+ *
+ * @param frame The number of the frame.
+ * @param samples The samples to write to.
+ */
+static void produce(size_t frame, int16_t* samples) {
+    for (size_t i = 0; i < FRAME_WORDS; ++i) {
+        samples[i] = static_cast<int16_t>(frame + i);
+    }
+}
+
+/**
+ * Calculate a checksum of the samples of a frame.
+ *
+ * @param samples The samples of the frame.
+ * @return The checksum.
+ */
+static uint64_t checksum(const int16_t* samples) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < FRAME_WORDS; ++i) {
+        sum += static_cast<uint16_t>(samples[i]);
+    }
+    return sum;
+}
+
+/**
+ * Run a function in a child process.  The child exits without returning to the test framework.
+ *
+ * @param function The function to run, which returns whether the child succeeded.
+ * @return The process id of the child.
+ */
+template <typename Function>
+static pid_t runInChild(Function function) {
+    auto pid = fork();
+    if (0 == pid) {
+        _exit(function() ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    return pid;
+}
+
+/**
+ * Wait for a child process to exit.
+ *
+ * @param pid The process id of the child.
+ * @return Whether the child exited successfully.
+ */
+static bool waitForChild(pid_t pid) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid) {
+        return false;
+    }
+    return WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status);
+}
+
+/**
+ * Wait for the child process to create its @c Reader.
+ *
+ * @param state The state shared with the child.
+ * @return Whether the child created its @c Reader before @c TIMEOUT.
+ */
+static bool waitForReader(SharedState* state) {
+    auto deadline = steady_clock::now() + TIMEOUT;
+    while (!state->readerReady) {
+        if (steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+/**
+ * Read frames in a child process which attaches to a stream by name, as an unrelated process would.
+ *
+ * @param name The name of the stream's buffer.
+ * @param state The state shared with the parent.
+ * @param frames The number of frames to read.
+ * @param measureLatency Whether each frame starts with the @c steady_clock time at which it was written.
+ * @return Whether all frames were read.
+ */
+static bool readFrames(const std::string& name, SharedState* state, size_t frames, bool measureLatency) {
+    auto buffer = SharedMemoryBuffer::open(name);
+    if (!buffer) {
+        return false;
+    }
+    auto stream = SharedMemorySDS::open(buffer);
+    if (!stream) {
+        return false;
+    }
+    auto reader = stream->createReader(CHILD_READER_ID, SharedMemorySDS::Reader::Policy::BLOCKING);
+    if (!reader) {
+        return false;
+    }
+    state->readerReady = true;
+
+    std::vector<int16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < frames; ++i) {
+        if (reader->read(frame.data(), FRAME_WORDS, TIMEOUT) != static_cast<ssize_t>(FRAME_WORDS)) {
+            return false;
+        }
+        if (measureLatency) {
+            auto now = steady_clock::now().time_since_epoch().count();
+            decltype(now) written;
+            memcpy(&written, frame.data(), sizeof(written));
+            uint64_t latency = now - written;
+            state->totalLatencyNs += latency;
+            if (latency > state->maxLatencyNs) {
+                state->maxLatencyNs = latency;
+            }
+        } else {
+            state->checksum += checksum(frame.data());
+        }
+    }
+    return true;
+}
+
+/// Fixture which creates a named stream, and state shared with the child process of a test.
+class SharedMemorySDSTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_name = "/SharedMemorySDSTest." + std::to_string(getpid());
+        auto size = SharedMemorySDS::calculateBufferSize(FRAME_WORDS * BUFFERED_FRAMES, WORD_SIZE, MAX_READERS);
+        m_buffer = SharedMemoryBuffer::create(m_name, size);
+        ASSERT_NE(m_buffer, nullptr);
+        m_stream = SharedMemorySDS::create(m_buffer, WORD_SIZE, MAX_READERS, CHILD_READER_ID);
+        ASSERT_NE(m_stream, nullptr);
+
+        m_stateBuffer = std::make_shared<SharedMemoryBuffer>(sizeof(SharedState));
+        ASSERT_EQ(m_stateBuffer->size(), sizeof(SharedState));
+        m_state = new (m_stateBuffer->data()) SharedState;
+        m_state->readerReady = false;
+        m_state->checksum = 0;
+        m_state->totalLatencyNs = 0;
+        m_state->maxLatencyNs = 0;
+    }
+
+    /// The name of the stream's buffer.
+    std::string m_name;
+
+    /// The stream's buffer.
+    std::shared_ptr<SharedMemoryBuffer> m_buffer;
+
+    /// The stream.
+    std::unique_ptr<SharedMemorySDS> m_stream;
+
+    /// Anonymous shared memory holding @c m_state.
+    std::shared_ptr<SharedMemoryBuffer> m_stateBuffer;
+
+    /// State shared with the child process.
+    SharedState* m_state;
+};
+
+/// Verify that a second process can open a stream by name and read what the first process writes.
+TEST_F(SharedMemorySDSTest, test_openFromSecondProcess) {
+    const size_t frames = BUFFERED_FRAMES * 3;
+    auto name = m_name;
+    auto state = m_state;
+    auto child = runInChild([name, state, frames] { return readFrames(name, state, frames, false); });
+    ASSERT_GT(child, 0);
+    ASSERT_TRUE(waitForReader(m_state));
+
+    auto writer = m_stream->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    std::vector<int16_t> frame(FRAME_WORDS);
+    uint64_t expectedChecksum = 0;
+    for (size_t i = 0; i < frames; ++i) {
+        produce(i, frame.data());
+        expectedChecksum += checksum(frame.data());
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS, TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+    }
+
+    ASSERT_TRUE(waitForChild(child));
+    EXPECT_EQ(m_state->checksum, expectedChecksum);
+}
+
+/// Verify that a mutex held by a process which died can be locked again.
+TEST_F(SharedMemorySDSTest, test_mutexRecoveredAfterOwnerDied) {
+    auto mutexBuffer = std::make_shared<SharedMemoryBuffer>(sizeof(SharedMemoryMutex));
+    auto mutex = new (mutexBuffer->data()) SharedMemoryMutex;
+
+    auto child = runInChild([mutex] {
+        mutex->lock();
+        return true;
+    });
+    ASSERT_GT(child, 0);
+    ASSERT_TRUE(waitForChild(child));
+
+    EXPECT_TRUE(mutex->try_lock());
+    mutex->unlock();
+    EXPECT_TRUE(mutex->try_lock());
+    mutex->unlock();
+    mutex->~SharedMemoryMutex();
+}
+
+/// Verify that a reader left behind by a crashed process stalls a blocking writer until it is forcibly replaced.
+TEST_F(SharedMemorySDSTest, test_forceReplacementAfterReaderCrashed) {
+    auto name = m_name;
+    auto child = runInChild([name] {
+        auto stream = SharedMemorySDS::open(SharedMemoryBuffer::open(name));
+        if (!stream) {
+            return false;
+        }
+        // Leak the reader and exit without detaching, as a crash would.
+        stream->createReader(CHILD_READER_ID, SharedMemorySDS::Reader::Policy::BLOCKING).release();
+        stream.release();
+        return true;
+    });
+    ASSERT_GT(child, 0);
+    ASSERT_TRUE(waitForChild(child));
+
+    auto writer = m_stream->createWriter(SharedMemorySDS::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    std::vector<int16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < BUFFERED_FRAMES; ++i) {
+        produce(i, frame.data());
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+    }
+    EXPECT_EQ(writer->write(frame.data(), FRAME_WORDS), SharedMemorySDS::Writer::Error::WOULDBLOCK);
+
+    EXPECT_EQ(m_stream->createReader(CHILD_READER_ID, SharedMemorySDS::Reader::Policy::NONBLOCKING), nullptr);
+    auto reader = m_stream->createReader(CHILD_READER_ID, SharedMemorySDS::Reader::Policy::NONBLOCKING, true, true);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(writer->write(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+    EXPECT_EQ(reader->read(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+}
+
+/// Measure how many seconds of 16 kHz audio per second can be passed from one process to another.
+TEST_F(SharedMemorySDSTest, testSlow_twoProcessThroughput) {
+    auto name = m_name;
+    auto state = m_state;
+    auto child = runInChild([name, state] { return readFrames(name, state, THROUGHPUT_FRAMES, false); });
+    ASSERT_GT(child, 0);
+    ASSERT_TRUE(waitForReader(m_state));
+
+    auto writer = m_stream->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    std::vector<int16_t> frame(FRAME_WORDS);
+    uint64_t expectedChecksum = 0;
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < THROUGHPUT_FRAMES; ++i) {
+        produce(i, frame.data());
+        expectedChecksum += checksum(frame.data());
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS, TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+    }
+    ASSERT_TRUE(waitForChild(child));
+    auto elapsed = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+    EXPECT_EQ(m_state->checksum, expectedChecksum);
+    reportBenchmarkResult("audioSecondsPerSecond", THROUGHPUT_FRAMES / 100.0 / elapsed);
+    reportBenchmarkResult("megabytesPerSecond", THROUGHPUT_FRAMES * FRAME_WORDS * WORD_SIZE / elapsed / 1e6);
+}
+
+/// Measure the time from a frame being written in one process until a blocked reader in another process has read it.
+TEST_F(SharedMemorySDSTest, testSlow_twoProcessLatency) {
+    auto name = m_name;
+    auto state = m_state;
+    auto child = runInChild([name, state] { return readFrames(name, state, LATENCY_FRAMES, true); });
+    ASSERT_GT(child, 0);
+    ASSERT_TRUE(waitForReader(m_state));
+
+    auto writer = m_stream->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    std::vector<int16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < LATENCY_FRAMES; ++i) {
+        std::this_thread::sleep_for(LATENCY_FRAME_INTERVAL);
+        produce(i, frame.data());
+        auto now = steady_clock::now().time_since_epoch().count();
+        memcpy(frame.data(), &now, sizeof(now));
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS, TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+    }
+    ASSERT_TRUE(waitForChild(child));
+
+    reportBenchmarkResult("meanLatencyMicroseconds", m_state->totalLatencyNs / LATENCY_FRAMES / 1e3);
+    reportBenchmarkResult("maxLatencyMicroseconds", m_state->maxLatencyNs / 1e3);
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // __linux__
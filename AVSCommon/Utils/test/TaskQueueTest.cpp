@@ -0,0 +1,127 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/InlineTask.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Test that an empty task converts to false and a wrapped callable runs.
+TEST(InlineTaskTest, test_emptyAndInvoke) {
+    InlineTask empty;
+    EXPECT_FALSE(empty);
+
+    int calls = 0;
+    InlineTask task([&calls] { calls++; });
+    ASSERT_TRUE(task);
+    task();
+    task();
+    EXPECT_EQ(calls, 2);
+
+    task = nullptr;
+    EXPECT_FALSE(task);
+}
+
+/// Test that moving a task transfers the callable, for both inline and heap stored callables.
+TEST(InlineTaskTest, test_moveTransfersCallable) {
+    auto counter = std::make_shared<int>(0);
+    std::array<char, InlineTask::INLINE_SIZE * 2> padding{};
+
+    InlineTask small([counter] { (*counter)++; });
+    InlineTask large([counter, padding] { *counter += 1 + padding[0]; });
+
+    InlineTask movedSmall(std::move(small));
+    InlineTask movedLarge;
+    movedLarge = std::move(large);
+    EXPECT_FALSE(small);
+    EXPECT_FALSE(large);
+
+    movedSmall();
+    movedLarge();
+    EXPECT_EQ(*counter, 2);
+}
+
+/// Test that a task destroys its callable exactly once, including after being moved.
+TEST(InlineTaskTest, test_callableDestroyed) {
+    auto resource = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = resource;
+    {
+        InlineTask task([resource] {});
+        resource.reset();
+        InlineTask moved(std::move(task));
+        EXPECT_FALSE(weak.expired());
+    }
+    EXPECT_TRUE(weak.expired());
+}
+
+/// Test that tasks pushed to either end pop in the expected order.
+TEST(TaskQueueTest, test_pushAndPopOrder) {
+    TaskQueue queue;
+    std::vector<int> order;
+    EXPECT_TRUE(queue.empty());
+
+    queue.pushBack([&order] { order.push_back(2); });
+    queue.pushBack([&order] { order.push_back(3); });
+    queue.pushFront([&order] { order.push_back(1); });
+    queue.pushBack([&order] { order.push_back(4); });
+    EXPECT_EQ(queue.size(), 4U);
+
+    InlineTask task;
+    ASSERT_TRUE(queue.popBack(&task));
+    task();
+    while (queue.popFront(&task)) {
+        task();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.popBack(&task));
+    EXPECT_EQ(order, (std::vector<int>{4, 1, 2, 3}));
+}
+
+/// Test that clearing the queue, or destroying it, releases tasks without running them.
+TEST(TaskQueueTest, test_clearReleasesTasks) {
+    auto resource = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = resource;
+    bool ran = false;
+    {
+        TaskQueue queue(1);
+        queue.pushBack([resource, &ran] { ran = true; });
+        queue.clear();
+        EXPECT_TRUE(queue.empty());
+
+        queue.pushBack([resource, &ran] { ran = true; });
+        queue.pushBack([resource, &ran] { ran = true; });
+        resource.reset();
+        EXPECT_FALSE(weak.expired());
+    }
+    EXPECT_TRUE(weak.expired());
+    EXPECT_FALSE(ran);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
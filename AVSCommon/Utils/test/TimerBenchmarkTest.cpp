@@ -0,0 +1,170 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file TimerBenchmarkTest.cpp
+///
+/// Compares a set of periodic timers run the legacy way, with one sleeping thread per timer, against the same timers
+/// run as @c Timer instances on the shared @c TimerWheel. Thread counts and context switches per second are printed
+/// to stdout and recorded as test properties; only correctness is asserted so that the test is stable on loaded
+/// build machines.
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std::chrono;
+
+/// Number of periodic timers, roughly the number of @c Timer members active in an idle SDK client.
+static const size_t TIMER_COUNT = 18;
+
+/// The period of each timer.
+static const milliseconds PERIOD{100};
+
+/// The offset between the first expiries of consecutive timers, spreading them over most of a period.
+static const milliseconds STAGGER{5};
+
+/// The slack used for the wheel, which lets timers that expire within it share a wakeup.
+static const milliseconds SLACK{20};
+
+/// How long each variant is measured for.
+static const seconds MEASUREMENT_TIME{2};
+
+/**
+ * Read a numeric field such as "Threads:" from /proc/self/status.
+ *
+ * @param field The field name including the trailing colon.
+ * @return The value of the field, or 0 if it is unavailable.
+ */
+static uint64_t readProcStatus(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string name;
+    while (status >> name) {
+        if (name == field) {
+            uint64_t value = 0;
+            status >> value;
+            return value;
+        }
+        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+}
+
+/// The number of voluntary context switches (that is, blocking waits and wakeups) of all threads of this process.
+static uint64_t voluntaryContextSwitches() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<uint64_t>(usage.ru_nvcsw);
+}
+
+/// Test fixture.
+class TimerBenchmarkTest : public ::testing::Test {};
+
+/// Periodic timers on per-timer threads versus on the wheel; measures threads and wakeups per second.
+TEST_F(TimerBenchmarkTest, testSlow_threadsAndWakeups) {
+    // Must precede the first use of the default wheel for the slack to apply.
+    TimerWheel::setDefaultSlack(SLACK);
+    auto baseThreads = readProcStatus("Threads:");
+    auto measuredSeconds = duration_cast<duration<double>>(MEASUREMENT_TIME).count();
+
+    // Legacy: one thread per timer, each sleeping until its own next deadline.
+    {
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> calls{0};
+        std::vector<std::thread> threads;
+        auto start = steady_clock::now();
+        for (size_t i = 0; i < TIMER_COUNT; ++i) {
+            auto first = start + STAGGER * static_cast<milliseconds::rep>(i);
+            threads.emplace_back([first, &stop, &calls] {
+                for (auto next = first; !stop; next += PERIOD) {
+                    std::this_thread::sleep_until(next);
+                    calls++;
+                }
+            });
+        }
+        std::this_thread::sleep_for(PERIOD);
+        auto threadCount = static_cast<double>(readProcStatus("Threads:")) - baseThreads;
+        auto switches = voluntaryContextSwitches();
+        auto callsBefore = calls.load();
+        std::this_thread::sleep_for(MEASUREMENT_TIME);
+        auto switchesPerSecond = (voluntaryContextSwitches() - switches) / measuredSeconds;
+        auto callsPerSecond = (calls - callsBefore) / measuredSeconds;
+        stop = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        reportBenchmarkResult("THREAD_PER_TIMER", "additionalThreads", threadCount);
+        reportBenchmarkResult("THREAD_PER_TIMER", "contextSwitchesPerSecond", switchesPerSecond);
+        reportBenchmarkResult("THREAD_PER_TIMER", "callsPerSecond", callsPerSecond);
+        EXPECT_GT(callsPerSecond, 0);
+    }
+
+    // Wheel: the same timers as Timer instances, sharing the wheel's thread and the scheduler's workers.
+    {
+        auto wheel = TimerWheel::getDefault();
+        std::atomic<uint64_t> calls{0};
+        std::vector<std::unique_ptr<Timer>> timers;
+        baseThreads = readProcStatus("Threads:");
+        for (size_t i = 0; i < TIMER_COUNT; ++i) {
+            timers.emplace_back(new Timer);
+            timers.back()->start(
+                STAGGER * static_cast<milliseconds::rep>(i),
+                PERIOD,
+                Timer::PeriodType::ABSOLUTE,
+                Timer::FOREVER,
+                [&calls] { calls++; });
+        }
+        std::this_thread::sleep_for(PERIOD);
+        auto threadCount = static_cast<double>(readProcStatus("Threads:")) - baseThreads;
+        auto switches = voluntaryContextSwitches();
+        auto wakeups = wheel->getWakeupCount();
+        auto callsBefore = calls.load();
+        std::this_thread::sleep_for(MEASUREMENT_TIME);
+        auto switchesPerSecond = (voluntaryContextSwitches() - switches) / measuredSeconds;
+        auto wakeupsPerSecond = (wheel->getWakeupCount() - wakeups) / measuredSeconds;
+        auto callsPerSecond = (calls - callsBefore) / measuredSeconds;
+        timers.clear();
+        reportBenchmarkResult("TIMER_WHEEL", "slackMs", static_cast<double>(wheel->getSlack().count()));
+        reportBenchmarkResult("TIMER_WHEEL", "additionalThreads", threadCount);
+        reportBenchmarkResult("TIMER_WHEEL", "contextSwitchesPerSecond", switchesPerSecond);
+        reportBenchmarkResult("TIMER_WHEEL", "wheelWakeupsPerSecond", wakeupsPerSecond);
+        reportBenchmarkResult("TIMER_WHEEL", "callsPerSecond", callsPerSecond);
+        EXPECT_GT(callsPerSecond, 0);
+    }
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
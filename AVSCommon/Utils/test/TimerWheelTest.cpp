@@ -0,0 +1,140 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file TimerWheelTest.cpp
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std::chrono;
+
+/// Delay used for timers which should fire during a test.
+static const milliseconds SHORT_DELAY{20};
+
+/// A delay long enough for a timer to be placed above the first level of a 1ms wheel.
+static const milliseconds CASCADE_DELAY{150};
+
+/// Used to limit the amount of time tests will wait for a timer.  Only hit if a test is failing.
+static const seconds TIMEOUT{2};
+
+/// Test that a timer fires, and not before its deadline.
+TEST(TimerWheelTest, test_firesAfterDeadline) {
+    TimerWheel wheel;
+    std::promise<steady_clock::time_point> fired;
+    auto deadline = steady_clock::now() + SHORT_DELAY;
+
+    ASSERT_NE(wheel.schedule(deadline, [&fired] { fired.set_value(steady_clock::now()); }), TimerWheel::INVALID_ID);
+    auto future = fired.get_future();
+    ASSERT_EQ(future.wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_GE(future.get(), deadline);
+    EXPECT_EQ(wheel.getPendingCount(), 0U);
+}
+
+/// Test that a cancelled timer does not fire, and that only pending timers can be cancelled.
+TEST(TimerWheelTest, test_cancelledTimerDoesNotFire) {
+    TimerWheel wheel;
+    bool cancelledFired = false;
+    std::promise<void> fired;
+
+    auto cancelled = wheel.schedule(steady_clock::now() + SHORT_DELAY, [&cancelledFired] { cancelledFired = true; });
+    auto kept = wheel.schedule(steady_clock::now() + SHORT_DELAY * 2, [&fired] { fired.set_value(); });
+    EXPECT_EQ(wheel.getPendingCount(), 2U);
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+
+    ASSERT_EQ(fired.get_future().wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_FALSE(wheel.cancel(kept));
+    EXPECT_FALSE(cancelledFired);
+}
+
+/// Test that timers which expire in the same tick fire in the order they were scheduled.
+TEST(TimerWheelTest, test_sameTickFiresInScheduleOrder) {
+    TimerWheel wheel(SHORT_DELAY);
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+    auto deadline = steady_clock::now() + SHORT_DELAY;
+
+    for (int i = 0; i < 5; ++i) {
+        wheel.schedule(deadline, [&mutex, &order, &done, i] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(i);
+            if (5U == order.size()) {
+                done.set_value();
+            }
+        });
+    }
+    ASSERT_EQ(done.get_future().wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+/// Test that timers within one slack period share a single wakeup.
+TEST(TimerWheelTest, test_timersWithinSlackCoalesce) {
+    TimerWheel wheel(SHORT_DELAY * 5);
+    std::promise<void> done;
+    std::atomic<int> remaining{10};
+    auto start = steady_clock::now();
+
+    for (int i = 0; i < 10; ++i) {
+        wheel.schedule(start + milliseconds(i), [&remaining, &done] {
+            if (0 == --remaining) {
+                done.set_value();
+            }
+        });
+    }
+    ASSERT_EQ(done.get_future().wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_LE(wheel.getWakeupCount(), 2U);
+}
+
+/// Test that timers beyond the first level cascade down and fire, and far future timers stay pending.
+TEST(TimerWheelTest, test_longDelaysCascade) {
+    TimerWheel wheel;
+    std::promise<steady_clock::time_point> fired;
+    auto deadline = steady_clock::now() + CASCADE_DELAY;
+
+    wheel.schedule(deadline, [&fired] { fired.set_value(steady_clock::now()); });
+    auto farFuture = wheel.schedule(steady_clock::now() + hours(24 * 1000), [] {});
+
+    auto future = fired.get_future();
+    ASSERT_EQ(future.wait_for(TIMEOUT), std::future_status::ready);
+    EXPECT_GE(future.get(), deadline);
+    EXPECT_EQ(wheel.getPendingCount(), 1U);
+    EXPECT_TRUE(wheel.cancel(farFuture));
+}
+
+/// Test that an empty callback is rejected.
+TEST(TimerWheelTest, test_emptyCallbackRejected) {
+    TimerWheel wheel;
+    EXPECT_EQ(wheel.schedule(steady_clock::now(), nullptr), TimerWheel::INVALID_ID);
+    EXPECT_EQ(wheel.getPendingCount(), 0U);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,198 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/Strand.h"
+#include "AVSCommon/Utils/Threading/WorkStealingScheduler.h"
+#include "AVSCommon/Utils/WaitEvent.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Timeout used while waiting for synchronization events.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// Number of jobs used by the bulk tests.
+static const int JOB_COUNT = 10000;
+
+/// Number of threads used to submit jobs concurrently.
+static const int SUBMITTER_COUNT = 4;
+
+/// Test that an empty job is rejected.
+TEST(WorkStealingSchedulerTest, test_scheduleEmptyJobFails) {
+    WorkStealingScheduler scheduler(1);
+    EXPECT_FALSE(scheduler.schedule(WorkStealingScheduler::Job()));
+}
+
+/// Test that a scheduled job runs.
+TEST(WorkStealingSchedulerTest, test_scheduleRunsJob) {
+    WorkStealingScheduler scheduler(2);
+    WaitEvent waitEvent;
+    EXPECT_TRUE(scheduler.schedule([&waitEvent] { waitEvent.wakeUp(); }));
+    EXPECT_TRUE(waitEvent.wait(WAIT_TIMEOUT));
+    EXPECT_EQ(scheduler.getWorkerCount(), 2U);
+}
+
+/// Test that jobs scheduled concurrently from many threads, and from the workers themselves, all run exactly once.
+TEST(WorkStealingSchedulerTest, test_concurrentAndNestedJobsAllRun) {
+    WorkStealingScheduler scheduler(4);
+    std::atomic<int> counter{0};
+    std::promise<void> donePromise;
+    auto doneFuture = donePromise.get_future();
+
+    auto onJob = [&counter, &donePromise] {
+        if (++counter == JOB_COUNT * 2) {
+            donePromise.set_value();
+        }
+    };
+
+    std::vector<std::thread> submitters;
+    for (int i = 0; i < SUBMITTER_COUNT; ++i) {
+        submitters.emplace_back([&scheduler, &onJob] {
+            for (int j = 0; j < JOB_COUNT / SUBMITTER_COUNT; ++j) {
+                // Each external job schedules a nested job from the worker, exercising the local queues.
+                scheduler.schedule([&scheduler, &onJob] {
+                    onJob();
+                    scheduler.schedule(onJob);
+                });
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+
+    ASSERT_EQ(doneFuture.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(counter, JOB_COUNT * 2);
+}
+
+/// Test that a job blocked on another job does not deadlock a single worker scheduler.
+TEST(WorkStealingSchedulerTest, test_blockedWorkerIsCompensated) {
+    WorkStealingScheduler scheduler(1, 4, std::chrono::milliseconds(5));
+    std::promise<void> innerPromise;
+    auto innerFuture = innerPromise.get_future().share();
+    WaitEvent outerDone;
+
+    scheduler.schedule([&scheduler, &innerPromise, innerFuture, &outerDone] {
+        scheduler.schedule([&innerPromise] { innerPromise.set_value(); });
+        // Blocks the only core worker until the job above runs elsewhere.
+        innerFuture.wait();
+        outerDone.wakeUp();
+    });
+
+    EXPECT_TRUE(outerDone.wait(WAIT_TIMEOUT));
+
+    uint64_t executed = 0, stolen = 0, compensation = 0, live = 0;
+    scheduler.getStats(executed, stolen, compensation, live);
+    EXPECT_GE(compensation, 1U);
+}
+
+/**
+ * Wait until a scheduler has been destroyed, then give its workers time to return to their loops.
+ *
+ * @param weakScheduler The scheduler.
+ * @return Whether the scheduler was destroyed before @c WAIT_TIMEOUT.
+ */
+static bool waitForDestruction(const std::weak_ptr<WorkStealingScheduler>& weakScheduler) {
+    auto deadline = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    while (!weakScheduler.expired()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return true;
+}
+
+/// Test that a job may release the last reference to the scheduler running it.
+TEST(WorkStealingSchedulerTest, test_jobReleasesLastSchedulerReference) {
+    auto holder = std::make_shared<std::shared_ptr<WorkStealingScheduler>>(std::make_shared<WorkStealingScheduler>(2));
+    std::weak_ptr<WorkStealingScheduler> weakScheduler = *holder;
+
+    EXPECT_TRUE((*holder)->schedule([holder] { holder->reset(); }));
+    holder.reset();
+    EXPECT_TRUE(waitForDestruction(weakScheduler));
+}
+
+/// Test that a strand task may release the last reference to the strand, and through it to the scheduler.
+TEST(WorkStealingSchedulerTest, test_strandTaskReleasesLastSchedulerReference) {
+    auto scheduler = std::make_shared<WorkStealingScheduler>(2);
+    std::weak_ptr<WorkStealingScheduler> weakScheduler = scheduler;
+    auto holder = std::make_shared<std::shared_ptr<Strand>>(Strand::create(scheduler));
+    scheduler.reset();
+
+    // The scheduler is destroyed on its own worker when the drain job holding the strand is released.
+    EXPECT_TRUE((*holder)->push(false, [holder] { holder->reset(); }));
+    holder.reset();
+    EXPECT_TRUE(waitForDestruction(weakScheduler));
+}
+
+/// Test that a strand runs its tasks serially and in order even when they are queued from many threads.
+TEST(WorkStealingSchedulerTest, test_strandRunsTasksSerially) {
+    auto scheduler = std::make_shared<WorkStealingScheduler>(4);
+    auto strand = Strand::create(scheduler);
+    ASSERT_TRUE(strand);
+
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+    std::vector<int> order;
+    for (int i = 0; i < JOB_COUNT; ++i) {
+        strand->push(false, [&running, &overlapped, &order, i] {
+            if (++running != 1) {
+                overlapped = true;
+            }
+            order.push_back(i);
+            --running;
+        });
+    }
+    strand->waitForSubmittedTasks();
+
+    EXPECT_FALSE(overlapped);
+    ASSERT_EQ(order.size(), static_cast<size_t>(JOB_COUNT));
+    for (int i = 0; i < JOB_COUNT; ++i) {
+        ASSERT_EQ(order[i], i);
+    }
+}
+
+/// Test that a shutdown strand rejects tasks.
+TEST(WorkStealingSchedulerTest, test_strandRejectsTasksAfterShutdown) {
+    auto strand = Strand::create(std::make_shared<WorkStealingScheduler>(1));
+    ASSERT_TRUE(strand);
+    strand->shutdown();
+    EXPECT_TRUE(strand->isShutdown());
+    EXPECT_FALSE(strand->push(false, [] {}));
+}
+
+/// Test that creating a strand without a scheduler fails.
+TEST(WorkStealingSchedulerTest, test_strandCreateWithNullSchedulerFails) {
+    EXPECT_FALSE(Strand::create(nullptr));
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
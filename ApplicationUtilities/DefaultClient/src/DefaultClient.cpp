@@ -18,8 +18,10 @@
 #include <AVSCommon/AVS/ExceptionEncounteredSender.h>
 #include <AVSCommon/SDKInterfaces/InternetConnectionMonitorInterface.h>
 #include <AVSCommon/Utils/Bluetooth/BluetoothEventBus.h>
+#include <AVSCommon/Utils/Logger/ConsoleLogger.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Network/InternetConnectionMonitor.h>
+#include <AVSCommon/Utils/SDS/SDSBufferPool.h>
 #include <Audio/SystemSoundAudioFactory.h>
 
 #include <SystemSoundPlayer/SystemSoundPlayer.h>
@@ -400,6 +402,13 @@ bool DefaultClient::initialize(
 
     m_avsGatewayManager = avsGatewayManager;
 
+    auto consoleLogger = std::dynamic_pointer_cast<avsCommon::utils::logger::ConsoleLogger>(
+        avsCommon::utils::logger::ConsoleLogger::instance());
+    if (consoleLogger) {
+        consoleLogger->setMetricRecorder(metricRecorder);
+    }
+    avsCommon::utils::sds::SDSBufferPool::getDefault()->setMetricRecorder(metricRecorder);
+
     m_dialogUXStateAggregator = std::make_shared<avsCommon::avs::DialogUXStateAggregator>(metricRecorder);
 
     for (auto observer : alexaDialogStateObservers) {
@@ -412,7 +421,7 @@ bool DefaultClient::initialize(
      * writers to be created to handle the attachment.
      */
     auto attachmentManager = std::make_shared<avsCommon::avs::attachment::AttachmentManager>(
-        avsCommon::avs::attachment::AttachmentManager::AttachmentType::IN_PROCESS);
+        avsCommon::avs::attachment::AttachmentManager::AttachmentType::CHUNKED);
 
     /*
      * Creating the message router - This component actually maintains the
@@ -421,7 +430,8 @@ bool DefaultClient::initialize(
      * and the attachment manager, which helps
      * ACL write attachments received from AVS.
      */
-    m_messageRouter = std::make_shared<acl::MessageRouter>(authDelegate, attachmentManager, transportFactory);
+    m_messageRouter =
+        std::make_shared<acl::MessageRouter>(authDelegate, attachmentManager, transportFactory, "", metricRecorder);
 
     if (!internetConnectionMonitor) {
         ACSDK_CRITICAL(LX("initializeFailed").d("reason", "internetConnectionMonitor was nullptr"));
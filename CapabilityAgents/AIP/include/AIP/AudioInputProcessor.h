@@ -19,6 +19,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -302,6 +303,8 @@ private:
      * @param capabilitiesConfiguration The SpeechRecognizer capabilities configuration.
      * @param powerResourceManager Power Resource Manager.
      * @param metricRecorder The metric recorder.
+     * @param speculativeContextMaxAge How old the last context received may be for a Recognize event to be sent with
+     *     it rather than wait for the current context, or zero to always wait.
      *
      * @note This constructor is private so that users are forced to use the @c create() factory function.  The primary
      *     reason for this is to ensure that a @c std::shared_ptr to the instance exists, which is a requirement for
@@ -322,7 +325,38 @@ private:
         std::shared_ptr<settings::WakeWordsSetting> wakeWordsSetting,
         std::shared_ptr<avsCommon::avs::CapabilityConfiguration> capabilitiesConfiguration,
         std::shared_ptr<avsCommon::sdkInterfaces::PowerResourceManagerInterface> powerResourceManager,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        std::chrono::milliseconds speculativeContextMaxAge);
+
+    /**
+     * Receives the context requested when a Recognize event is sent with the last context received, and has the
+     * @c AudioInputProcessor check whether that context was stale.
+     */
+    class SpeculativeContextChecker : public avsCommon::sdkInterfaces::ContextRequesterInterface {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param audioInputProcessor The @c AudioInputProcessor which sent the Recognize event.
+         * @param speculativeContext The context the Recognize event was sent with.
+         */
+        SpeculativeContextChecker(
+            std::shared_ptr<AudioInputProcessor> audioInputProcessor,
+            const std::string& speculativeContext);
+
+        /// @name ContextRequesterInterface Functions
+        /// @{
+        void onContextAvailable(const std::string& jsonContext) override;
+        void onContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error) override;
+        /// @}
+
+    private:
+        /// The @c AudioInputProcessor which sent the Recognize event.
+        std::weak_ptr<AudioInputProcessor> m_audioInputProcessor;
+
+        /// The context the Recognize event was sent with.
+        const std::string m_speculativeContext;
+    };
 
     /// @name RequiresShutdown Functions
     /// @{
@@ -454,8 +488,25 @@ private:
      * but will defer sending it to @c executeOnFocusChanged().
      *
      * @param jsonContext The full system context to send with the event.
+     * @param isSpeculative Whether @c jsonContext is the last context received rather than the current context.
      */
-    void executeOnContextAvailable(const std::string jsonContext);
+    void executeOnContextAvailable(const std::string jsonContext, bool isSpeculative = false);
+
+    /**
+     * This function receives the current context once a Recognize event has been sent with the last context received,
+     * and records whether that context was stale.
+     *
+     * @param speculativeContext The context the Recognize event was sent with.
+     * @param jsonContext The current context.
+     */
+    void executeOnSpeculativeContextChecked(const std::string& speculativeContext, const std::string& jsonContext);
+
+    /**
+     * Get the last context received, if it is recent enough for a Recognize event to be sent with it.
+     *
+     * @return The last context received, or an empty string if there is none recent enough.
+     */
+    std::string getSpeculativeContext();
 
     /**
      * This function is called when a context request fails.  Context requests are initiated by @c executeRecognize()
@@ -705,6 +756,12 @@ private:
      * initiator should conform to the standard user initiated format.
      */
     std::unique_ptr<std::string> m_precedingExpectSpeechInitiator;
+
+    /// The last context received, which a Recognize event may be sent with while the current context is assembled.
+    std::string m_lastContext;
+
+    /// When @c m_lastContext was received.
+    std::chrono::steady_clock::time_point m_lastContextTime;
     /// @}
 
     /// Set of capability configurations that will get published using the Capabilities API
@@ -725,6 +782,12 @@ private:
     /// StopCapture received time
     std::chrono::steady_clock::time_point m_stopCaptureReceivedTime;
 
+    /**
+     * How old the last context received may be for a Recognize event to be sent with it rather than wait for the
+     * current context, or zero to always wait.
+     */
+    const std::chrono::milliseconds m_speculativeContextMaxAge;
+
     /**
      * @c Executor which queues up operations from asynchronous API calls.
      *
@@ -21,6 +21,7 @@
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/FocusState.h>
 #include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/JSON/JSONGenerator.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -32,6 +33,8 @@
 #include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/String/StringUtils.h>
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <AVSCommon/AVS/Attachment/AttachmentUtils.h>
 #include <Settings/SettingEventMetadata.h>
 #include <Settings/SettingEventSender.h>
@@ -46,6 +49,7 @@ namespace capabilityAgents {
 namespace aip {
 using namespace avsCommon::avs;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::logger;
 using namespace avsCommon::utils::metrics;
 using namespace avsCommon::sdkInterfaces;
@@ -87,6 +91,15 @@ static const std::string TAG("AudioInputProcessor");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The key in our config file to find the root of audio input processor configuration.
+static const std::string AUDIO_INPUT_PROCESSOR_CONFIGURATION_ROOT_KEY = "audioInputProcessorCapabilityAgent";
+
+/// The key in our config file for how old the last context may be for a Recognize event to be sent with it.
+static const std::string SPECULATIVE_CONTEXT_MAX_AGE_KEY = "speculativeContextMaxAge";
+
+/// By default, Recognize events always wait for the current context.
+static const std::chrono::milliseconds DEFAULT_SPECULATIVE_CONTEXT_MAX_AGE{0};
+
 /// The name of the @c FocusManager channel used by @c AudioInputProvider.
 static const std::string CHANNEL_NAME = FocusManagerInterface::DIALOG_CHANNEL_NAME;
 
@@ -199,6 +212,21 @@ static const std::string END_OF_SPEECH_OFFSET_RECEIVED = "END_OF_SPEECH_OFFSET";
 static const std::string END_OF_SPEECH_OFFSET_RECEIVED_ACTIVITY_NAME =
     METRIC_ACTIVITY_NAME_PREFIX_AIP + END_OF_SPEECH_OFFSET_RECEIVED;
 
+/// The key of the properties in a context.
+static const std::string CONTEXT_PROPERTIES_KEY = "properties";
+
+/// The keys which identify a property in a context.
+static const std::vector<std::string> CONTEXT_PROPERTY_IDENTIFIER_KEYS = {"namespace", "name", "instance"};
+
+/// The key of the value of a property in a context.
+static const std::string CONTEXT_PROPERTY_VALUE_KEY = "value";
+
+/// Speculative Context Activity Name for AIP metric source
+static const std::string SPECULATIVE_CONTEXT = "SPECULATIVE_CONTEXT";
+static const std::string SPECULATIVE_CONTEXT_ACTIVITY_NAME = METRIC_ACTIVITY_NAME_PREFIX_AIP + SPECULATIVE_CONTEXT;
+/// Counts the Recognize events sent with a context which differed from the current context.
+static const std::string SPECULATIVE_CONTEXT_STALE = "SPECULATIVE_CONTEXT_STALE";
+
 /// The duration metric for short time out
 static const std::string STOP_CAPTURE_TO_END_OF_SPEECH_METRIC_NAME = "STOP_CAPTURE_TO_END_OF_SPEECH";
 static const std::string STOP_CAPTURE_TO_END_OF_SPEECH_ACTIVITY_NAME =
@@ -262,6 +290,47 @@ static void submitMetric(
     recordMetric(metricRecorder, metricEvent);
 }
 
+/**
+ * Get the value of each property of a context, leaving out when it was sampled, so that contexts assembled at
+ * different times can be compared.
+ *
+ * @param jsonContext The context.
+ * @return The serialized value of each property, by namespace, name and instance.
+ */
+static std::map<std::string, std::string> getPropertyValues(const std::string& jsonContext) {
+    std::map<std::string, std::string> values;
+    rapidjson::Document document;
+    if (!json::jsonUtils::parseJSON(jsonContext, &document) || !document.IsObject()) {
+        return values;
+    }
+    auto properties = document.FindMember(CONTEXT_PROPERTIES_KEY);
+    if (document.MemberEnd() == properties || !properties->value.IsArray()) {
+        return values;
+    }
+    for (const auto& property : properties->value.GetArray()) {
+        if (!property.IsObject()) {
+            continue;
+        }
+        std::string identifier;
+        for (const auto& key : CONTEXT_PROPERTY_IDENTIFIER_KEYS) {
+            auto it = property.FindMember(key);
+            if (property.MemberEnd() != it && it->value.IsString()) {
+                identifier += it->value.GetString();
+            }
+            identifier += '/';
+        }
+        auto value = property.FindMember(CONTEXT_PROPERTY_VALUE_KEY);
+        if (property.MemberEnd() == value) {
+            continue;
+        }
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        value->value.Accept(writer);
+        values[identifier] = buffer.GetString();
+    }
+    return values;
+}
+
 /**
  * Handles a Metric event by creating and recording it. Failure to create or record the event results
  * in an early return.
@@ -379,6 +448,12 @@ std::shared_ptr<AudioInputProcessor> AudioInputProcessor::create(
         return nullptr;
     }
 
+    auto speculativeContextMaxAge = DEFAULT_SPECULATIVE_CONTEXT_MAX_AGE;
+    auto configurationRoot = ConfigurationNode::getRoot()[AUDIO_INPUT_PROCESSOR_CONFIGURATION_ROOT_KEY];
+    // If key is present, then read and initilize the value from config or set to default.
+    configurationRoot.getDuration<std::chrono::milliseconds>(
+        SPECULATIVE_CONTEXT_MAX_AGE_KEY, &speculativeContextMaxAge, DEFAULT_SPECULATIVE_CONTEXT_MAX_AGE);
+
     auto aip = std::shared_ptr<AudioInputProcessor>(new AudioInputProcessor(
         directiveSequencer,
         messageSender,
@@ -394,7 +469,8 @@ std::shared_ptr<AudioInputProcessor> AudioInputProcessor::create(
         wakeWordsSetting,
         capabilitiesConfiguration,
         powerResourceManager,
-        std::move(metricRecorder)));
+        std::move(metricRecorder),
+        speculativeContextMaxAge));
 
     if (aip) {
         dialogUXStateAggregator->addObserver(aip);
@@ -582,7 +658,8 @@ AudioInputProcessor::AudioInputProcessor(
     std::shared_ptr<settings::WakeWordsSetting> wakeWordsSetting,
     std::shared_ptr<avsCommon::avs::CapabilityConfiguration> capabilitiesConfiguration,
     std::shared_ptr<PowerResourceManagerInterface> powerResourceManager,
-    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+    std::chrono::milliseconds speculativeContextMaxAge) :
         CapabilityAgent{NAMESPACE, exceptionEncounteredSender},
         RequiresShutdown{"AudioInputProcessor"},
         m_metricRecorder{metricRecorder},
@@ -606,10 +683,34 @@ AudioInputProcessor::AudioInputProcessor(
         m_wakeWordConfirmation{wakeWordConfirmation},
         m_speechConfirmation{speechConfirmation},
         m_wakeWordsSetting{wakeWordsSetting},
-        m_powerResourceManager{powerResourceManager} {
+        m_powerResourceManager{powerResourceManager},
+        m_speculativeContextMaxAge{speculativeContextMaxAge} {
     m_capabilityConfigurations.insert(capabilitiesConfiguration);
 }
 
+AudioInputProcessor::SpeculativeContextChecker::SpeculativeContextChecker(
+    std::shared_ptr<AudioInputProcessor> audioInputProcessor,
+    const std::string& speculativeContext) :
+        m_audioInputProcessor{audioInputProcessor},
+        m_speculativeContext{speculativeContext} {
+}
+
+void AudioInputProcessor::SpeculativeContextChecker::onContextAvailable(const std::string& jsonContext) {
+    auto audioInputProcessor = m_audioInputProcessor.lock();
+    if (!audioInputProcessor) {
+        return;
+    }
+    auto aip = audioInputProcessor.get();
+    auto speculativeContext = m_speculativeContext;
+    aip->m_executor.submit([aip, speculativeContext, jsonContext]() {
+        aip->executeOnSpeculativeContextChecked(speculativeContext, jsonContext);
+    });
+}
+
+void AudioInputProcessor::SpeculativeContextChecker::onContextFailure(const ContextRequestError error) {
+    ACSDK_WARN(LX("speculativeContextCheckFailed").d("error", error));
+}
+
 /**
  * Generate supported wake words json capability configuration for a given scope (default, language or locale).
  *
@@ -975,6 +1076,10 @@ bool AudioInputProcessor::executeRecognize(
         }
     }
 
+    // The Recognize event may be sent with the last context received rather than wait for the current one, unless the
+    // context of a Recognize event being barged in on is still pending, as that would send a second event.
+    auto speculativeContext = m_preparingToSend ? std::string() : getSpeculativeContext();
+
     // Code below this point changes the state of AIP.  Formally update state now, and don't error out without calling
     // executeResetState() after this point.
     m_shouldGenerateDialogRequestId = shouldGenerateDialogRequestId(m_state);
@@ -991,8 +1096,15 @@ bool AudioInputProcessor::executeRecognize(
     // Reset flag when we send a new recognize event.
     m_localStopCapturePerformed = false;
 
-    //  Start assembling the context; we'll service the callback after assembling our Recognize event.
-    m_contextManager->getContext(shared_from_this());
+    if (speculativeContext.empty()) {
+        //  Start assembling the context; we'll service the callback after assembling our Recognize event.
+        m_contextManager->getContext(shared_from_this());
+    } else {
+        // The Recognize event is sent with the last context received below, and the current context is only used to
+        // check whether that one was stale.
+        m_contextManager->getContext(
+            std::make_shared<SpeculativeContextChecker>(shared_from_this(), speculativeContext));
+    }
 
     // Stop the ExpectSpeech timer so we don't get a timeout.
     m_expectingSpeechTimer.stop();
@@ -1034,11 +1146,22 @@ bool AudioInputProcessor::executeRecognize(
         ACSDK_DEBUG(LX(__func__).d("WW_DURATION(ms)", duration.count()));
     }
 
+    if (!speculativeContext.empty()) {
+        // Stream the audio right away rather than wait for the providers to answer.
+        executeOnContextAvailable(speculativeContext, true);
+    }
+
     return true;
 }
 
-void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContext) {
-    ACSDK_DEBUG(LX("executeOnContextAvailable").sensitive("jsonContext", jsonContext));
+void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContext, bool isSpeculative) {
+    ACSDK_DEBUG(
+        LX("executeOnContextAvailable").d("isSpeculative", isSpeculative).sensitive("jsonContext", jsonContext));
+
+    if (!isSpeculative && m_speculativeContextMaxAge > milliseconds::zero()) {
+        m_lastContext = jsonContext;
+        m_lastContextTime = steady_clock::now();
+    }
 
     // Should already be RECOGNIZING if we get here.
     if (m_state != ObserverInterface::State::RECOGNIZING) {
@@ -1079,7 +1202,9 @@ void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContex
     // Assemble the MessageRequest.  It will be sent by executeOnFocusChanged when we acquire the channel.
     auto msgIdAndJsonEvent =
         buildJsonEventString("Recognize", m_directiveSequencer->getDialogRequestId(), m_recognizePayload, jsonContext);
-    m_recognizeRequest = std::make_shared<avsCommon::avs::MessageRequest>(msgIdAndJsonEvent.second);
+    // The user is waiting for the response, so it is sent ahead of any queued background events.
+    m_recognizeRequest = std::make_shared<avsCommon::avs::MessageRequest>(
+        msgIdAndJsonEvent.second, "", avsCommon::avs::MessageRequest::Priority::HIGH);
 
     if (m_KWDMetadataReader) {
         m_recognizeRequest->addAttachmentReader(KWD_METADATA_FIELD_NAME, m_KWDMetadataReader);
@@ -1095,6 +1220,29 @@ void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContex
     }
 }
 
+void AudioInputProcessor::executeOnSpeculativeContextChecked(
+    const std::string& speculativeContext,
+    const std::string& jsonContext) {
+    m_lastContext = jsonContext;
+    m_lastContextTime = steady_clock::now();
+
+    bool isStale = getPropertyValues(speculativeContext) != getPropertyValues(jsonContext);
+    ACSDK_DEBUG(LX(__func__).d("isStale", isStale));
+    submitMetric(
+        m_metricRecorder,
+        SPECULATIVE_CONTEXT_ACTIVITY_NAME,
+        DataPointCounterBuilder{}.setName(SPECULATIVE_CONTEXT_STALE).increment(isStale ? 1 : 0).build(),
+        m_directiveSequencer->getDialogRequestId());
+}
+
+std::string AudioInputProcessor::getSpeculativeContext() {
+    if (m_speculativeContextMaxAge <= milliseconds::zero() || m_lastContext.empty() ||
+        steady_clock::now() - m_lastContextTime > m_speculativeContextMaxAge) {
+        return "";
+    }
+    return m_lastContext;
+}
+
 void AudioInputProcessor::executeOnContextFailure(const ContextRequestError error) {
     ACSDK_ERROR(LX("executeOnContextFailure").d("error", error));
     executeResetState();
@@ -1292,7 +1440,8 @@ bool AudioInputProcessor::executeExpectSpeechTimedOut() {
     }
     m_precedingExpectSpeechInitiator.reset();
     auto msgIdAndJsonEvent = buildJsonEventString("ExpectSpeechTimedOut");
-    auto request = std::make_shared<avsCommon::avs::MessageRequest>(msgIdAndJsonEvent.second);
+    auto request = std::make_shared<avsCommon::avs::MessageRequest>(
+        msgIdAndJsonEvent.second, "", avsCommon::avs::MessageRequest::Priority::HIGH);
     request->addObserver(shared_from_this());
     m_messageSender->sendMessage(request);
     setState(ObserverInterface::State::IDLE);
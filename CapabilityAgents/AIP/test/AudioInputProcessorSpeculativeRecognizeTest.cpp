@@ -0,0 +1,483 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AudioInputProcessorSpeculativeRecognizeTest.cpp
+///
+/// Measures the latency from a wake word to the first byte of audio read from the Recognize event, with a
+/// @c ContextManager whose only state provider takes @c PROVIDER_DELAY to answer.  The Recognize event either waits for
+/// the current context, or is sent with the last context received when it is recent enough.  Results are printed to
+/// stdout and recorded as test properties; the latency is only compared with @c PROVIDER_DELAY, so that the test is
+/// stable on loaded build machines.
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
+#include <AVSCommon/SDKInterfaces/MockDirectiveSequencer.h>
+#include <AVSCommon/SDKInterfaces/MockExceptionEncounteredSender.h>
+#include <AVSCommon/SDKInterfaces/MockFocusManager.h>
+#include <AVSCommon/SDKInterfaces/MockLocaleAssetsManager.h>
+#include <AVSCommon/SDKInterfaces/MockSystemSoundPlayer.h>
+#include <AVSCommon/SDKInterfaces/MockUserInactivityMonitor.h>
+#include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/DeviceInfo.h>
+#include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Metrics/MetricEvent.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
+#include <ContextManager/ContextManager.h>
+#include <Settings/MockSetting.h>
+
+#include "AIP/AudioInputProcessor.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::sdkInterfaces::test;
+using namespace avsCommon::utils::configuration;
+using namespace avsCommon::utils::metrics;
+using avsCommon::utils::reportBenchmarkResult;
+using namespace std::chrono;
+using namespace testing;
+
+/// How long the state provider takes to answer.
+static const milliseconds PROVIDER_DELAY{500};
+
+/// How long to wait for the Recognize event.
+static const milliseconds TIMEOUT{5000};
+
+/// The sample rate of the audio.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The number of samples written before each wake word.
+static const size_t SAMPLES_PER_TURN = SAMPLE_RATE_HZ;
+
+/// The number of samples of the wake word.
+static const size_t WAKEWORD_SAMPLES = SAMPLE_RATE_HZ / 4;
+
+/// The number of samples the audio buffer holds.
+static const size_t SDS_WORDS = 2 * SAMPLES_PER_TURN;
+
+/// The maximum number of readers of the audio buffer.
+static const size_t SDS_MAXREADERS = 3;
+
+/// The wake word.
+static const std::string KEYWORD = "ALEXA";
+
+/// The capability of the state provider.
+static const std::string PROVIDER_NAMESPACE = "SlowNamespace";
+
+/**
+ * Build a configuration for the @c AudioInputProcessor.
+ *
+ * @param speculativeContextMaxAge How old the last context may be for a Recognize event to be sent with it.
+ * @return The configuration.
+ */
+static std::string buildConfiguration(milliseconds speculativeContextMaxAge) {
+    return R"({"audioInputProcessorCapabilityAgent":{"speculativeContextMaxAge":)" +
+           std::to_string(speculativeContextMaxAge.count()) + "}}";
+}
+
+/**
+ * Build the state of the provider.
+ *
+ * @param value The value of the state.
+ * @return The serialized value of the state.
+ */
+static std::string buildStateValue(int value) {
+    return R"({"slowValue":)" + std::to_string(value) + "}";
+}
+
+/// A provider which answers @c provideState on its own thread after @c PROVIDER_DELAY.
+class SlowStateProvider : public StateProviderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param contextManager The context manager, which must outlive the provider.
+     */
+    SlowStateProvider(ContextManagerInterface* contextManager) : m_contextManager{contextManager}, m_value{0} {
+    }
+
+    /// Destructor.
+    ~SlowStateProvider() {
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void provideState(const CapabilityTag& stateProviderName, const ContextRequestToken stateRequestToken) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        int value = m_value;
+        m_threads.emplace_back([this, stateProviderName, stateRequestToken, value]() {
+            std::this_thread::sleep_for(PROVIDER_DELAY);
+            m_contextManager->provideStateResponse(
+                stateProviderName, CapabilityState{buildStateValue(value)}, stateRequestToken);
+        });
+    }
+
+    bool canStateBeRetrieved() override {
+        return true;
+    }
+
+    /**
+     * Change the state, which is provided to the context requests made after this call.
+     *
+     * @param value The new value of the state.
+     */
+    void setValue(int value) {
+        m_value = value;
+    }
+
+private:
+    /// The context manager.
+    ContextManagerInterface* m_contextManager;
+
+    /// The value of the state.
+    std::atomic<int> m_value;
+
+    /// Serializes access to @c m_threads.
+    std::mutex m_mutex;
+
+    /// The threads answering @c provideState.
+    std::vector<std::thread> m_threads;
+};
+
+/// A message sender which reads the first byte of audio of each Recognize event as soon as it is sent.
+class AudioReadingMessageSender : public MessageSenderInterface {
+public:
+    void sendMessage(std::shared_ptr<MessageRequest> request) override {
+        for (int i = 0; i < request->attachmentReadersCount(); ++i) {
+            auto namedReader = request->getAttachmentReader(i);
+            if (!namedReader || "audio" != namedReader->name) {
+                continue;
+            }
+            int16_t sample;
+            auto readStatus = attachment::AttachmentReader::ReadStatus::OK;
+            if (namedReader->reader->read(&sample, sizeof(sample), &readStatus) > 0) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_firstAudioByteTime = steady_clock::now();
+                m_json = request->getJsonContent();
+                m_wakeTrigger.notify_all();
+            }
+        }
+    }
+
+    /**
+     * Wait for the first byte of audio of a Recognize event sent since @c reset().
+     *
+     * @param[out] json The JSON of the Recognize event.
+     * @return When the first byte of audio was read, or the time point epoch on timeout.
+     */
+    steady_clock::time_point waitForFirstAudioByte(std::string* json) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_wakeTrigger.wait_for(
+                lock, TIMEOUT, [this] { return steady_clock::time_point() != m_firstAudioByteTime; })) {
+            return steady_clock::time_point();
+        }
+        *json = m_json;
+        return m_firstAudioByteTime;
+    }
+
+    /// Forget the last Recognize event.
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_firstAudioByteTime = steady_clock::time_point();
+        m_json.clear();
+    }
+
+private:
+    /// Serializes access to the members.
+    std::mutex m_mutex;
+
+    /// Notified when the first byte of audio is read.
+    std::condition_variable m_wakeTrigger;
+
+    /// When the first byte of audio of the last Recognize event was read.
+    steady_clock::time_point m_firstAudioByteTime;
+
+    /// The JSON of the last Recognize event.
+    std::string m_json;
+};
+
+/// A metric recorder which counts the Recognize events sent with a stale speculative context.
+class SpeculativeContextMetricRecorder : public MetricRecorderInterface {
+public:
+    SpeculativeContextMetricRecorder() : m_countOfChecks{0}, m_countOfStale{0} {
+    }
+
+    void recordMetric(std::shared_ptr<MetricEvent> metricEvent) override {
+        if ("AIP-SPECULATIVE_CONTEXT" != metricEvent->getActivityName()) {
+            return;
+        }
+        auto dataPoint = metricEvent->getDataPoint("SPECULATIVE_CONTEXT_STALE", DataType::COUNTER);
+        if (dataPoint.hasValue()) {
+            ++m_countOfChecks;
+            m_countOfStale += std::stoi(dataPoint.value().getValue());
+        }
+    }
+
+    /// The number of speculative contexts checked.
+    std::atomic<int> m_countOfChecks;
+
+    /// The number of speculative contexts which were stale.
+    std::atomic<int> m_countOfStale;
+};
+
+/// Fixture which runs the @c AudioInputProcessor against a real @c ContextManager, and reports results.
+class AudioInputProcessorSpeculativeRecognizeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_deviceInfo = avsCommon::utils::DeviceInfo::create(
+            "clientId", "productId", "1234", "manufacturer", "my device", "friendlyName", "deviceType");
+        ASSERT_NE(m_deviceInfo, nullptr);
+        m_contextManager = contextManager::ContextManager::create(*m_deviceInfo);
+        ASSERT_NE(m_contextManager, nullptr);
+        m_capability = avsCommon::utils::memory::make_unique<CapabilityTag>(
+            PROVIDER_NAMESPACE, "state", m_deviceInfo->getDefaultEndpointId());
+        m_stateProvider = std::make_shared<SlowStateProvider>(m_contextManager.get());
+        m_contextManager->addStateProvider(*m_capability, m_stateProvider);
+
+        m_directiveSequencer = std::make_shared<NiceMock<MockDirectiveSequencer>>();
+        m_messageSender = std::make_shared<AudioReadingMessageSender>();
+        m_metricRecorder = std::make_shared<SpeculativeContextMetricRecorder>();
+        m_focusManager = std::make_shared<NiceMock<MockFocusManager>>();
+        ON_CALL(*m_focusManager, acquireChannel(_, A<std::shared_ptr<FocusManagerInterface::Activity>>()))
+            .WillByDefault(InvokeWithoutArgs([this] {
+                m_audioInputProcessor->onFocusChanged(FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+                return true;
+            }));
+
+        size_t bufferSize = AudioInputStream::calculateBufferSize(SDS_WORDS, sizeof(int16_t), SDS_MAXREADERS);
+        auto stream = AudioInputStream::create(
+            std::make_shared<AudioInputStream::Buffer>(bufferSize), sizeof(int16_t), SDS_MAXREADERS);
+        ASSERT_NE(stream, nullptr);
+        m_writer = stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+        ASSERT_NE(m_writer, nullptr);
+        avsCommon::utils::AudioFormat format = {avsCommon::utils::AudioFormat::Encoding::LPCM,
+                                                avsCommon::utils::AudioFormat::Endianness::LITTLE,
+                                                SAMPLE_RATE_HZ,
+                                                sizeof(int16_t) * CHAR_BIT,
+                                                1,
+                                                false,
+                                                avsCommon::utils::AudioFormat::Layout::NON_INTERLEAVED};
+        m_audioProvider = avsCommon::utils::memory::make_unique<AudioProvider>(
+            std::move(stream), format, ASRProfile::NEAR_FIELD, true, true, true);
+    }
+
+    void TearDown() override {
+        if (m_audioInputProcessor) {
+            m_audioInputProcessor->resetState().wait();
+            m_audioInputProcessor->shutdown();
+        }
+        m_directiveSequencer->shutdown();
+        m_contextManager->removeStateProvider(*m_capability);
+        m_stateProvider.reset();
+        ConfigurationNode::uninitialize();
+    }
+
+    /**
+     * Create the @c AudioInputProcessor with a configuration.
+     *
+     * @param speculativeContextMaxAge How old the last context may be for a Recognize event to be sent with it.
+     */
+    void createAudioInputProcessor(milliseconds speculativeContextMaxAge) {
+        std::vector<std::shared_ptr<std::istream>> jsonStreams;
+        jsonStreams.push_back(std::make_shared<std::stringstream>(buildConfiguration(speculativeContextMaxAge)));
+        ASSERT_TRUE(ConfigurationNode::initialize(jsonStreams));
+
+        auto assetsManager = std::make_shared<NiceMock<MockLocaleAssetsManager>>();
+        ON_CALL(*assetsManager, getDefaultSupportedWakeWords())
+            .WillByDefault(Return(LocaleAssetsManagerInterface::WakeWordsSets{{KEYWORD}}));
+        m_audioInputProcessor = AudioInputProcessor::create(
+            m_directiveSequencer,
+            m_messageSender,
+            m_contextManager,
+            m_focusManager,
+            std::make_shared<DialogUXStateAggregator>(),
+            std::make_shared<NiceMock<MockExceptionEncounteredSender>>(),
+            std::make_shared<NiceMock<MockUserInactivityMonitor>>(),
+            std::make_shared<NiceMock<MockSystemSoundPlayer>>(),
+            assetsManager,
+            std::make_shared<settings::test::MockSetting<settings::WakeWordConfirmationSettingType>>(
+                settings::getWakeWordConfirmationDefault()),
+            std::make_shared<settings::test::MockSetting<settings::SpeechConfirmationSettingType>>(
+                settings::getSpeechConfirmationDefault()),
+            std::make_shared<settings::test::MockSetting<settings::WakeWords>>(settings::WakeWords{KEYWORD}),
+            nullptr,
+            AudioProvider::null(),
+            nullptr,
+            m_metricRecorder);
+        ASSERT_NE(m_audioInputProcessor, nullptr);
+    }
+
+    /**
+     * Write audio ending with a wake word, recognize it, and wait for the first byte of audio to be read from the
+     * Recognize event.  The @c AudioInputProcessor is reset afterwards.
+     *
+     * @param[out] latency The time from the wake word to the first byte of audio.
+     * @param[out] json The JSON of the Recognize event.
+     */
+    void recognizeWakeWord(milliseconds* latency, std::string* json) {
+        std::vector<int16_t> samples(SAMPLES_PER_TURN, 1);
+        ASSERT_EQ(m_writer->write(samples.data(), samples.size()), static_cast<ssize_t>(samples.size()));
+        auto end = m_writer->tell();
+
+        m_messageSender->reset();
+        auto wakeWordTime = steady_clock::now();
+        ASSERT_TRUE(m_audioInputProcessor
+                        ->recognize(
+                            *m_audioProvider, Initiator::WAKEWORD, wakeWordTime, end - WAKEWORD_SAMPLES, end, KEYWORD)
+                        .get());
+        auto firstAudioByteTime = m_messageSender->waitForFirstAudioByte(json);
+        ASSERT_NE(firstAudioByteTime, steady_clock::time_point());
+        *latency = duration_cast<milliseconds>(firstAudioByteTime - wakeWordTime);
+        m_audioInputProcessor->resetState().wait();
+    }
+
+    /**
+     * Recognize a first wake word, which receives the context, change the state, then recognize a second wake word
+     * after a pause, and report the latency of the second one.
+     *
+     * @param variant The name of the variant.
+     * @param speculativeContextMaxAge How old the last context may be for a Recognize event to be sent with it.
+     * @param pause The time between the two wake words.
+     * @param[out] latency The latency of the second wake word.
+     * @param[out] json The JSON of the second Recognize event.
+     */
+    void run(
+        const std::string& variant,
+        milliseconds speculativeContextMaxAge,
+        milliseconds pause,
+        milliseconds* latency,
+        std::string* json) {
+        createAudioInputProcessor(speculativeContextMaxAge);
+        if (HasFatalFailure()) {
+            return;
+        }
+        m_stateProvider->setValue(1);
+        milliseconds firstLatency;
+        std::string firstJson;
+        recognizeWakeWord(&firstLatency, &firstJson);
+        if (HasFatalFailure()) {
+            return;
+        }
+        EXPECT_NE(firstJson.find(buildStateValue(1)), std::string::npos);
+
+        m_stateProvider->setValue(2);
+        std::this_thread::sleep_for(pause);
+        recognizeWakeWord(latency, json);
+        if (HasFatalFailure()) {
+            return;
+        }
+
+        reportBenchmarkResult(variant, "wakeWordToFirstAudioByteMilliseconds", latency->count());
+    }
+
+    /// The device info the context manager is created with.
+    std::shared_ptr<avsCommon::utils::DeviceInfo> m_deviceInfo;
+
+    /// The context manager.
+    std::shared_ptr<contextManager::ContextManager> m_contextManager;
+
+    /// The capability of the state provider.
+    std::unique_ptr<CapabilityTag> m_capability;
+
+    /// The state provider.
+    std::shared_ptr<SlowStateProvider> m_stateProvider;
+
+    /// The directive sequencer.
+    std::shared_ptr<NiceMock<MockDirectiveSequencer>> m_directiveSequencer;
+
+    /// The message sender.
+    std::shared_ptr<AudioReadingMessageSender> m_messageSender;
+
+    /// The metric recorder.
+    std::shared_ptr<SpeculativeContextMetricRecorder> m_metricRecorder;
+
+    /// The focus manager, which grants the dialog channel right away.
+    std::shared_ptr<NiceMock<MockFocusManager>> m_focusManager;
+
+    /// The writer of the audio.
+    std::unique_ptr<AudioInputStream::Writer> m_writer;
+
+    /// The provider of the audio.
+    std::unique_ptr<AudioProvider> m_audioProvider;
+
+    /// The @c AudioInputProcessor under test.
+    std::shared_ptr<AudioInputProcessor> m_audioInputProcessor;
+};
+
+/// Without a speculative context, the audio waits for the state provider.
+TEST_F(AudioInputProcessorSpeculativeRecognizeTest, testSlow_waitForCurrentContext) {
+    milliseconds latency;
+    std::string json;
+    run("CURRENT_CONTEXT", milliseconds::zero(), milliseconds::zero(), &latency, &json);
+    EXPECT_GE(latency, PROVIDER_DELAY);
+    EXPECT_NE(json.find(buildStateValue(2)), std::string::npos);
+    EXPECT_EQ(m_metricRecorder->m_countOfChecks, 0);
+}
+
+/// With a recent context, the audio is streamed right away with it, and the context is found stale afterwards.
+TEST_F(AudioInputProcessorSpeculativeRecognizeTest, testSlow_sendWithSpeculativeContext) {
+    milliseconds latency;
+    std::string json;
+    run("SPECULATIVE_CONTEXT", seconds(10), milliseconds::zero(), &latency, &json);
+    EXPECT_LT(latency, PROVIDER_DELAY);
+    EXPECT_NE(json.find(buildStateValue(1)), std::string::npos);
+
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    // Wait for the current context to be compared with the one the Recognize event was sent with.
+    auto start = steady_clock::now();
+    while (0 == m_metricRecorder->m_countOfChecks && steady_clock::now() - start < TIMEOUT) {
+        std::this_thread::sleep_for(milliseconds(10));
+    }
+    EXPECT_EQ(m_metricRecorder->m_countOfChecks, 1);
+    EXPECT_EQ(m_metricRecorder->m_countOfStale, 1);
+#endif
+}
+
+/// With a context older than the bound, the audio waits for the state provider.
+TEST_F(AudioInputProcessorSpeculativeRecognizeTest, testSlow_waitWhenLastContextIsTooOld) {
+    milliseconds latency;
+    std::string json;
+    run("TOO_OLD_CONTEXT", milliseconds(100), milliseconds(300), &latency, &json);
+    EXPECT_GE(latency, PROVIDER_DELAY);
+    EXPECT_NE(json.find(buildStateValue(2)), std::string::npos);
+    EXPECT_EQ(m_metricRecorder->m_countOfChecks, 0);
+}
+
+}  // namespace test
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
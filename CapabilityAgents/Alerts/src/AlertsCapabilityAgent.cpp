@@ -839,8 +839,8 @@ void AlertsCapabilityAgent::executeHandleDirectiveImmediately(std::shared_ptr<Di
     ACSDK_DEBUG1(LX("executeHandleDirectiveImmediately"));
     auto& directive = info->directive;
 
-    rapidjson::Document payload;
-    payload.Parse(directive->getPayload());
+    auto payloadDocument = directive->getPayloadDocument();
+    const rapidjson::Document& payload = *payloadDocument;
 
     if (payload.HasParseError()) {
         std::string errorMessage = "Unable to parse payload";
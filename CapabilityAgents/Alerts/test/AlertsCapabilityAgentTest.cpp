@@ -467,6 +467,8 @@ void AlertsCapabilityAgentTest::testStartAlertWithContentVolume(
  * Test local alert volume changes. Without alert sounding. Must send event.
  */
 TEST_F(AlertsCapabilityAgentTest, test_localAlertVolumeChangeNoAlert) {
+    auto future = m_mockMessageSender->getNextMessage();
+
     SpeakerInterface::SpeakerSettings speakerSettings;
     speakerSettings.volume = TEST_VOLUME_VALUE;
     speakerSettings.mute = false;
@@ -475,8 +477,6 @@ TEST_F(AlertsCapabilityAgentTest, test_localAlertVolumeChangeNoAlert) {
         ChannelVolumeInterface::Type::AVS_ALERTS_VOLUME,
         speakerSettings);
 
-    auto future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
@@ -487,15 +487,16 @@ TEST_F(AlertsCapabilityAgentTest, test_localAlertVolumeChangeNoAlert) {
  * Test local alert volume changes. With alert sounding. Must not send event, volume is treated as local.
  */
 TEST_F(AlertsCapabilityAgentTest, testTimer_localAlertVolumeChangeAlertPlaying) {
+    auto future = m_mockMessageSender->getNextMessage();
     m_alertsCA->onAlertStateChange("", "", AlertObserverInterface::State::STARTED, "");
 
     // We have to wait for the alert state to be processed before updating speaker settings.
-    auto future = m_mockMessageSender->getNextMessage();
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
     ASSERT_TRUE(content.find("\"name\":\"AlertStarted\"") != std::string::npos);
 
+    future = m_mockMessageSender->getNextMessage();
     SpeakerInterface::SpeakerSettings speakerSettings;
     speakerSettings.volume = TEST_VOLUME_VALUE;
     m_alertsCA->onSpeakerSettingsChanged(
@@ -503,9 +504,7 @@ TEST_F(AlertsCapabilityAgentTest, testTimer_localAlertVolumeChangeAlertPlaying)
         ChannelVolumeInterface::Type::AVS_ALERTS_VOLUME,
         speakerSettings);
 
-    ASSERT_EQ(
-        m_mockMessageSender->getNextMessage().wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)),
-        std::future_status::timeout);
+    ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::timeout);
 }
 
 /**
@@ -523,12 +522,11 @@ TEST_F(AlertsCapabilityAgentTest, test_avsAlertVolumeChangeNoAlert) {
         *(m_speakerManager.get()), setVolume(ChannelVolumeInterface::Type::AVS_ALERTS_VOLUME, TEST_VOLUME_VALUE, _))
         .Times(1);
 
+    auto future = m_mockMessageSender->getNextMessage();
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)
         ->preHandleDirective(directive, std::move(m_mockDirectiveHandlerResult));
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)->handleDirective(MESSAGE_ID);
 
-    auto future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
@@ -550,19 +548,18 @@ TEST_F(AlertsCapabilityAgentTest, test_avsAlertVolumeChangeAlertPlaying) {
         *(m_speakerManager.get()), setVolume(ChannelVolumeInterface::Type::AVS_ALERTS_VOLUME, TEST_VOLUME_VALUE, _))
         .Times(1);
 
-    m_alertsCA->onAlertStateChange("", "", AlertObserverInterface::State::STARTED, "");
     auto future = m_mockMessageSender->getNextMessage();
+    m_alertsCA->onAlertStateChange("", "", AlertObserverInterface::State::STARTED, "");
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
     ASSERT_TRUE(content.find("\"name\":\"AlertStarted\"") != std::string::npos);
 
+    future = m_mockMessageSender->getNextMessage();
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)
         ->preHandleDirective(directive, std::move(m_mockDirectiveHandlerResult));
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)->handleDirective(MESSAGE_ID);
 
-    future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     content = future.get()->getJsonContent();
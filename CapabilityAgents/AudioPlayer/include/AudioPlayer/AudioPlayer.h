@@ -271,13 +271,13 @@ private:
     /// @}
 
     /**
-     * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This function gets a @c Directive's payload as a @c rapidjson::Document, which is shared with other users of the
+     * @c Directive.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to get the payload of.
+     * @return The payload, or @c nullptr if it could not be parsed.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    std::shared_ptr<const rapidjson::Document> parseDirectivePayload(std::shared_ptr<DirectiveInfo> info);
 
     /**
      * This function pre-handles a @c PLAY directive.
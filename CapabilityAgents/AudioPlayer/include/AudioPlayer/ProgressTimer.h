@@ -17,11 +17,12 @@
 #define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AUDIOPLAYER_INCLUDE_AUDIOPLAYER_PROGRESSTIMER_H_
 
 #include <chrono>
-#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <thread>
+
+#include <AVSCommon/Utils/Threading/Strand.h>
+#include <AVSCommon/Utils/Timing/TimerWheel.h>
 
 namespace alexaClientSDK {
 namespace capabilityAgents {
@@ -30,6 +31,9 @@ namespace audioPlayer {
 /**
  * Provides callbacks when ProgressReportDelayElapsed and ProgressReportIntervalElapsed events
  * should be sent to AVS.
+ *
+ * A @c ProgressTimer owns no thread: progress requests and notifications run on a @c Strand of the shared
+ * scheduler, and the wait for progress to reach the next target is a timer on the process-wide @c TimerWheel.
  */
 class ProgressTimer {
 public:
@@ -170,7 +174,7 @@ private:
     friend std::ostream& operator<<(std::ostream& stream, ProgressTimer::State state);
 
     /**
-     * Set the current state.  Also notifies @c m_wake when the state changes.
+     * Set the current state.
      *
      * @param newState The state to transition to.
      * @return Whether or not the transition was allowed.
@@ -178,14 +182,28 @@ private:
     bool setState(State newState);
 
     /**
-     * Start the thread that runs @c main_loop().
+     * Start requesting progress and sending notifications.  @c m_callMutex must be held.
+     */
+    void startRunning();
+
+    /**
+     * Stop requesting progress, and wait for a progress request or notification in progress to complete.
+     * @c m_callMutex must be held.
      */
-    void startThread();
+    void stopRunning();
 
     /**
-     * Thread function that sends notifications when it is time to send progress reports.
+     * Queue a request for the current progress.  @c m_stateMutex must be held.
      */
-    void mainLoop();
+    void requestProgressLocked();
+
+    /**
+     * Send notifications for the progress received, then either request progress again or wait for progress to
+     * reach the next target.
+     *
+     * @param generation The value of @c m_generation when the progress was requested.
+     */
+    void onProgressReceived(uint64_t generation);
 
     /**
      * Step the target offset at which the next notification should be sent.
@@ -198,7 +216,8 @@ private:
     /// Mutex serializing calls to public methods.
     std::mutex m_callMutex;
 
-    /// Mutex serializing access to @c m_state, @c m_progress and @c m_gotProgress.
+    /// Mutex serializing access to @c m_state, @c m_progress, @c m_awaitingProgress, @c m_wheelId and
+    /// @c m_generation.
     std::mutex m_stateMutex;
 
     /// The current state of the ProgressTimer.
@@ -219,17 +238,23 @@ private:
     /// The next offset at which to send a notification.
     std::chrono::milliseconds m_target;
 
-    /// Has progress been reported since last requested.
-    bool m_gotProgress;
+    /// Whether progress has been requested and not reported yet.
+    bool m_awaitingProgress;
 
     /// The last reported progress value.
     std::chrono::milliseconds m_progress;
 
-    /// Condition variable used to wake @c mainLoop() when there is a state change.
-    std::condition_variable m_wake;
+    /// Incremented whenever the timer stops or starts running, invalidating steps queued before.
+    uint64_t m_generation;
+
+    /// The wheel timer waiting for progress to reach @c m_target.
+    avsCommon::utils::timing::TimerWheel::Id m_wheelId;
+
+    /// The wheel used to wait for progress to reach @c m_target.
+    const std::shared_ptr<avsCommon::utils::timing::TimerWheel> m_wheel;
 
-    /// The thread upon which @c mainLoop() runs.
-    std::thread m_thread;
+    /// The strand progress requests and notifications run on.
+    const std::shared_ptr<avsCommon::utils::threading::Strand> m_strand;
 };
 
 }  // namespace audioPlayer
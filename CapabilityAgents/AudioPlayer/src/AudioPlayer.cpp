@@ -103,6 +103,10 @@ static const NamespaceAndName STATE{NAMESPACE, "PlaybackState"};
 /// Prefix for content ID prefix in the url property of the directive payload.
 static const std::string CID_PREFIX{"cid:"};
 
+/// The name of the event sent each progress report interval.  Each one reports the current offset, so one which is
+/// still queued when the next is sent for the same track is out of date.
+static const std::string PROGRESS_REPORT_INTERVAL_ELAPSED{"ProgressReportIntervalElapsed"};
+
 /// The token key used in @c AudioPlayer events.
 static const char TOKEN_KEY[] = "token";
 
@@ -587,7 +591,7 @@ void AudioPlayer::onProgressReportDelayElapsed() {
 
 void AudioPlayer::onProgressReportIntervalElapsed() {
     ACSDK_DEBUG9(LX(__func__));
-    m_executor.submit([this] { sendEventWithTokenAndOffset("ProgressReportIntervalElapsed", true); });
+    m_executor.submit([this] { sendEventWithTokenAndOffset(PROGRESS_REPORT_INTERVAL_ELAPSED, true); });
 }
 
 void AudioPlayer::onProgressReportIntervalUpdated() {
@@ -712,19 +716,19 @@ void AudioPlayer::doShutdown() {
     m_captionManager.reset();
 }
 
-bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
-        return true;
+std::shared_ptr<const rapidjson::Document> AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info) {
+    auto document = info->directive->getPayloadDocument();
+    if (!document->HasParseError()) {
+        return document;
     }
 
     ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+                    .d("reason", rapidjson::GetParseError_En(document->GetParseError()))
+                    .d("offset", document->GetErrorOffset())
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
-    return false;
+    return nullptr;
 }
 
 static audio::MixingBehavior getMixingBehavior(
@@ -763,10 +767,11 @@ static audio::MixingBehavior getMixingBehavior(
 void AudioPlayer::preHandlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("preHandlePlayDirective"));
     ACSDK_DEBUG9(LX("prePLAY").d("payload", info->directive->getPayload()));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payloadDocument = parseDirectivePayload(info);
+    if (!payloadDocument) {
         return;
     }
+    const rapidjson::Document& payload = *payloadDocument;
 
     std::shared_ptr<PlayDirectiveInfo> playItem = std::make_shared<PlayDirectiveInfo>(info->directive->getMessageId());
 
@@ -978,10 +983,11 @@ void AudioPlayer::handleStopDirective(std::shared_ptr<DirectiveInfo> info) {
 
 void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleClearQueue"));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payloadDocument = parseDirectivePayload(info);
+    if (!payloadDocument) {
         return;
     }
+    const rapidjson::Document& payload = *payloadDocument;
 
     ClearBehavior clearBehavior;
     if (!jsonUtils::retrieveValue(payload, "clearBehavior", &clearBehavior)) {
@@ -994,10 +1000,11 @@ void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info)
 
 void AudioPlayer::handleUpdateProgressReportIntervalDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleUpdateProgressReportIntervalDirective"));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payloadDocument = parseDirectivePayload(info);
+    if (!payloadDocument) {
         return;
     }
+    const rapidjson::Document& payload = *payloadDocument;
 
     int64_t milliseconds;
     if (!jsonUtils::retrieveValue(payload, "progressReportIntervalInMilliseconds", &milliseconds)) {
@@ -2024,6 +2031,10 @@ void AudioPlayer::sendEventWithTokenAndOffset(
 
     auto event = buildJsonEventString(eventName, "", buffer.GetString());
     auto request = std::make_shared<MessageRequest>(event.second);
+    if (PROGRESS_REPORT_INTERVAL_ELAPSED == eventName) {
+        // Keyed by track, so that the last report of a track is still sent when the next track starts.
+        request->setCoalescingKey(NAMESPACE + "." + eventName + "." + m_currentlyPlaying->audioItem.stream.token);
+    }
     m_messageSender->sendMessage(request);
 }
 
@@ -24,6 +24,7 @@ namespace alexaClientSDK {
 namespace capabilityAgents {
 namespace audioPlayer {
 
+using namespace avsCommon::utils::threading;
 using namespace avsCommon::utils::timing;
 
 /// String to identify log entries originating from this file.
@@ -41,8 +42,12 @@ ProgressTimer::ProgressTimer() :
         m_delay{ProgressTimer::getNoDelay()},
         m_interval{ProgressTimer::getNoInterval()},
         m_target{std::chrono::milliseconds::zero()},
-        m_gotProgress{false},
-        m_progress{std::chrono::milliseconds::zero()} {
+        m_awaitingProgress{false},
+        m_progress{std::chrono::milliseconds::zero()},
+        m_generation{0},
+        m_wheelId{TimerWheel::INVALID_ID},
+        m_wheel{TimerWheel::getDefault()},
+        m_strand{Strand::create()} {
 }
 
 /**
@@ -70,6 +75,7 @@ std::ostream& operator<<(std::ostream& stream, ProgressTimer::State state) {
 
 ProgressTimer::~ProgressTimer() {
     stop();
+    m_strand->shutdown();
 }
 
 void ProgressTimer::init(
@@ -130,7 +136,7 @@ void ProgressTimer::start() {
         }
     }
 
-    startThread();
+    startRunning();
 }
 
 void ProgressTimer::pause() {
@@ -143,9 +149,7 @@ void ProgressTimer::pause() {
         return;
     }
 
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
+    stopRunning();
 }
 
 void ProgressTimer::resume() {
@@ -158,7 +162,7 @@ void ProgressTimer::resume() {
         return;
     }
 
-    startThread();
+    startRunning();
 }
 
 void ProgressTimer::stop() {
@@ -179,9 +183,7 @@ void ProgressTimer::stop() {
         return;
     }
 
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
+    stopRunning();
 
     if (!setState(State::IDLE)) {
         ACSDK_ERROR(LX("stopFailed").d("reason", "setStateFailed"));
@@ -224,8 +226,11 @@ void ProgressTimer::onProgress(std::chrono::milliseconds progress) {
     std::lock_guard<std::mutex> stateLock(m_stateMutex);
 
     m_progress = progress;
-    m_gotProgress = true;
-    m_wake.notify_all();
+    if (State::RUNNING == m_state && m_awaitingProgress) {
+        m_awaitingProgress = false;
+        auto generation = m_generation;
+        m_strand->push(false, [this, generation] { onProgressReceived(generation); });
+    }
 }
 
 bool ProgressTimer::setState(State newState) {
@@ -252,7 +257,6 @@ bool ProgressTimer::setState(State newState) {
     if (allowed) {
         ACSDK_DEBUG9(LX(__func__).d("state", m_state).d("newState", newState));
         m_state = newState;
-        m_wake.notify_one();
     } else {
         ACSDK_ERROR(LX("setStateFailed").d("reason", "notAllowed").d("state", m_state).d("newState", newState));
     }
@@ -260,56 +264,86 @@ bool ProgressTimer::setState(State newState) {
     return allowed;
 }
 
-void ProgressTimer::startThread() {
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-    m_thread = std::thread(&ProgressTimer::mainLoop, this);
-}
-
-void ProgressTimer::mainLoop() {
-    ACSDK_DEBUG5(LX(__func__));
-
-    std::unique_lock<std::mutex> stateLock(m_stateMutex);
+void ProgressTimer::startRunning() {
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
 
     if (ProgressTimer::getNoDelay() == m_delay && ProgressTimer::getNoInterval() == m_interval) {
-        ACSDK_DEBUG5(LX("mainLoopExiting").d("reason", "noDelayOrInterval"));
+        ACSDK_DEBUG5(LX("startRunningIgnored").d("reason", "noDelayOrInterval"));
         return;
     }
 
-    while (State::RUNNING == m_state) {
-        m_gotProgress = false;
-        stateLock.unlock();
-        m_context->requestProgress();
-        stateLock.lock();
+    m_generation++;
+    requestProgressLocked();
+}
 
-        m_wake.wait(stateLock, [this] { return m_state != State::RUNNING || m_gotProgress; });
+void ProgressTimer::stopRunning() {
+    {
+        std::lock_guard<std::mutex> stateLock(m_stateMutex);
+        m_generation++;
+        m_awaitingProgress = false;
+        if (TimerWheel::INVALID_ID != m_wheelId) {
+            m_wheel->cancel(m_wheelId);
+            m_wheelId = TimerWheel::INVALID_ID;
+        }
+    }
 
-        if (m_state != State::RUNNING) {
-            break;
+    // Steps queued before the generation changed are ignored; wait for one that may be running.
+    m_strand->waitForSubmittedTasks();
+}
+
+void ProgressTimer::requestProgressLocked() {
+    m_awaitingProgress = true;
+    auto generation = m_generation;
+    m_strand->push(false, [this, generation] {
+        {
+            std::lock_guard<std::mutex> stateLock(m_stateMutex);
+            if (generation != m_generation || State::RUNNING != m_state) {
+                return;
+            }
         }
+        m_context->requestProgress();
+    });
+}
 
-        if (m_progress >= m_target) {
-            if (m_target == m_delay) {
-                m_context->onProgressReportDelayElapsed();
-                // If delay and interval coincide, send both notifications.
-                if (m_interval != ProgressTimer::getNoInterval() && (m_target.count() % m_interval.count()) == 0) {
-                    m_context->onProgressReportIntervalElapsed();
-                }
-            } else {
+void ProgressTimer::onProgressReceived(uint64_t generation) {
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+
+    if (generation != m_generation || State::RUNNING != m_state) {
+        return;
+    }
+
+    if (m_progress >= m_target) {
+        if (m_target == m_delay) {
+            m_context->onProgressReportDelayElapsed();
+            // If delay and interval coincide, send both notifications.
+            if (m_interval != ProgressTimer::getNoInterval() && (m_target.count() % m_interval.count()) == 0) {
                 m_context->onProgressReportIntervalElapsed();
             }
-            if (!updateTargetLocked()) {
-                ACSDK_DEBUG5(LX("mainLoopExiting").d("reason", "noTarget"));
-                return;
-            }
         } else {
-            std::chrono::milliseconds timeout = m_target - m_progress;
-            m_wake.wait_for(stateLock, timeout, [this] { return m_state != State::RUNNING; });
+            m_context->onProgressReportIntervalElapsed();
         }
+        if (!updateTargetLocked()) {
+            ACSDK_DEBUG5(LX("onProgressReceived").d("result", "noTarget"));
+            return;
+        }
+        requestProgressLocked();
+        return;
     }
 
-    ACSDK_DEBUG5(LX("mainLoopExiting").d("reason", "isStopping"));
+    // Check again once playback should have reached the target.
+    std::weak_ptr<Strand> weakStrand = m_strand;
+    m_wheelId = m_wheel->schedule(
+        std::chrono::steady_clock::now() + (m_target - m_progress), [weakStrand, this, generation] {
+            if (auto strand = weakStrand.lock()) {
+                strand->push(false, [this, generation] {
+                    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+                    if (generation == m_generation && State::RUNNING == m_state) {
+                        m_wheelId = TimerWheel::INVALID_ID;
+                        requestProgressLocked();
+                    }
+                });
+            }
+        });
 }
 
 bool ProgressTimer::updateTargetLocked() {
@@ -345,7 +379,7 @@ bool ProgressTimer::updateTargetLocked() {
     // Handle reporting progress after an initial delay, and without reporting periodic progress.
     if (ProgressTimer::getNoInterval() == m_interval) {
         // If progress has already reached the initial delay and there is no interval, there is
-        // no more progress to report and mainLoop() will exit.  Reset m_delay before returning
+        // no more progress to report and no more progress will be requested.  Reset m_delay before returning
         // so that a pesky call to resume() won't trigger more progress reports.
         if (m_target == m_delay) {
             m_delay = ProgressTimer::getNoDelay();
@@ -2733,6 +2733,12 @@ TEST_F(AudioPlayerTest, test_progressReportIntervalElapsedIntervalLessThanOffset
         .Times(AtLeast(1))
         .WillRepeatedly(Invoke([this](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
             std::lock_guard<std::mutex> lock(m_mutex);
+            // Only reports of the same track supersede each other.
+            if (request->getJsonContent().find(PROGRESS_REPORT_INTERVAL_ELAPSED_NAME) != std::string::npos) {
+                EXPECT_EQ(
+                    NAMESPACE_AUDIO_PLAYER + "." + PROGRESS_REPORT_INTERVAL_ELAPSED_NAME + "." + TOKEN_TEST,
+                    request->getCoalescingKey());
+            }
             verifyMessageMap(request, &m_expectedMessages);
             m_messageSentTrigger.notify_one();
         }));
@@ -17,6 +17,7 @@
 
 #include <AVSCommon/Utils/PromiseFuturePair.h>
 #include <AVSCommon/Utils/Timing/Stopwatch.h>
+#include <AVSCommon/Utils/Timing/TimerWheel.h>
 
 #include "AudioPlayer/ProgressTimer.h"
 
@@ -254,6 +255,37 @@ TEST_F(ProgressTimerTest, test_delayAndInterval) {
     std::this_thread::sleep_for(MILLIS_100);
 }
 
+// Verify that stop() cancels the wheel timer waiting for progress to reach the next target.
+TEST_F(ProgressTimerTest, test_stopCancelsPendingWheelTimer) {
+    auto wheel = TimerWheel::getDefault();
+    auto basePendingCount = wheel->getPendingCount();
+
+    PromiseFuturePair<void> progressRequested;
+    auto requestProgress = [this, &progressRequested] {
+        callOnProgress();
+        progressRequested.setValue();
+    };
+
+    // Progress is requested once, and the wait for the delay is cancelled before it elapses.
+    EXPECT_CALL(*(m_mockContext.get()), requestProgress()).Times(1).WillOnce(Invoke(requestProgress));
+    EXPECT_CALL(*(m_mockContext.get()), onProgressReportDelayElapsed()).Times(0);
+    EXPECT_CALL(*(m_mockContext.get()), onProgressReportIntervalElapsed()).Times(0);
+
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(FAIL_TIMEOUT);
+    m_timer.init(m_mockContext, delay, ProgressTimer::getNoInterval());
+
+    play();
+    ASSERT_TRUE(progressRequested.waitFor(FAIL_TIMEOUT));
+    auto deadline = std::chrono::steady_clock::now() + FAIL_TIMEOUT;
+    while (wheel->getPendingCount() == basePendingCount) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(MILLIS_10);
+    }
+
+    stop();
+    EXPECT_EQ(wheel->getPendingCount(), basePendingCount);
+}
+
 // Verify that when paused, a ProgressTimer will not generate notifications.
 TEST_F(ProgressTimerTest, test_pause) {
     auto requestProgress = [this] { callOnProgress(); };
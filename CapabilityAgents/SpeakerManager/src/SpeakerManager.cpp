@@ -275,6 +275,8 @@ void SpeakerManager::executeSendSpeakerSettingsChangedEvent(
 
     auto event = buildJsonEventString(eventName, "", buffer.GetString());
     auto request = std::make_shared<MessageRequest>(event.second);
+    // Each event reports the whole of the speaker settings, so one still queued is out of date.
+    request->setCoalescingKey(SPEAKER_CAPABILITY_INTERFACE_NAME + "." + eventName);
     m_messageSender->sendMessage(request);
 }
 
@@ -559,8 +559,9 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Document payload;
-    if (payload.Parse(speakInfo->directive->getPayload()).HasParseError()) {
+    auto payloadDocument = speakInfo->directive->getPayloadDocument();
+    const Document& payload = *payloadDocument;
+    if (payload.HasParseError()) {
         const std::string message("unableToParsePayload" + speakInfo->directive->getMessageId());
         ACSDK_ERROR(
             LX("executePreHandleFailed").d("reason", message).d("messageId", speakInfo->directive->getMessageId()));
@@ -633,7 +634,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
     } else {
         auto captionIterator = payload.FindMember(KEY_CAPTION);
         if (payload.MemberEnd() != captionIterator) {
-            rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
+            const rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
 
             auto captionFormat = captions::CaptionFormat::UNKNOWN;
             captionIterator = captionsPayload.FindMember(KEY_CAPTION_TYPE);
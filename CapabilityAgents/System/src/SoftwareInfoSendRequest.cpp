@@ -151,7 +151,7 @@ void SoftwareInfoSendRequest::send() {
         onSendCompleted(MessageRequestObserverInterface::Status::INTERNAL_ERROR);
         return;
     }
-    auto request = std::make_shared<MessageRequest>(jsonContent);
+    auto request = std::make_shared<MessageRequest>(jsonContent, "", MessageRequest::Priority::BACKGROUND);
     request->addObserver(shared_from_this());
     m_messageSender->sendMessage(request);
 }
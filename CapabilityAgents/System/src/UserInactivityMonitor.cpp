@@ -136,7 +136,8 @@ void UserInactivityMonitor::sendInactivityReport() {
     jsonUtils::convertToValue(inactivityPayload, &inactivityPayloadString);
 
     auto inactivityEvent = buildJsonEventString(INACTIVITY_EVENT_NAME, "", inactivityPayloadString);
-    m_messageSender->sendMessage(std::make_shared<MessageRequest>(inactivityEvent.second));
+    m_messageSender->sendMessage(
+        std::make_shared<MessageRequest>(inactivityEvent.second, "", MessageRequest::Priority::BACKGROUND));
 
     notifyObservers();
 }
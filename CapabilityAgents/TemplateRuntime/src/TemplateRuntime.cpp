@@ -331,12 +331,12 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
         ACSDK_DEBUG5(LX("handleRenderPlayerInfoDirectiveInExecutor"));
         m_isRenderTemplateLastReceived = false;
 
-        rapidjson::Document payload;
-        rapidjson::ParseResult result = payload.Parse(info->directive->getPayload());
-        if (!result) {
+        auto payloadDocument = info->directive->getPayloadDocument();
+        const rapidjson::Document& payload = *payloadDocument;
+        if (payload.HasParseError()) {
             ACSDK_ERROR(LX("handleRenderPlayerInfoDirectiveInExecutorParseFailed")
-                            .d("reason", rapidjson::GetParseError_En(result.Code()))
-                            .d("offset", result.Offset())
+                            .d("reason", rapidjson::GetParseError_En(payload.GetParseError()))
+                            .d("offset", payload.GetErrorOffset())
                             .d("messageId", info->directive->getMessageId()));
             sendExceptionEncounteredAndReportFailed(
                 info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
@@ -187,6 +187,8 @@ inline bool shouldRetryTransmission(MessageRequestObserverInterface::Status stat
         case MessageRequestObserverInterface::Status::CANCELED:
         case MessageRequestObserverInterface::Status::SERVER_OTHER_ERROR:
         case MessageRequestObserverInterface::Status::BAD_REQUEST:
+        case MessageRequestObserverInterface::Status::EXPIRED:
+        case MessageRequestObserverInterface::Status::SUPERSEDED:
             return false;
         case MessageRequestObserverInterface::Status::THROTTLED:
         case MessageRequestObserverInterface::Status::PENDING:
@@ -23,7 +23,9 @@
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <AVSCommon/AVS/AVSContext.h>
 #include <AVSCommon/AVS/CapabilityTag.h>
 #include <AVSCommon/AVS/StateRefreshPolicy.h>
 #include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
@@ -161,6 +163,18 @@ private:  // Private type declarations.
     /// Alias for endpoint id.
     using EndpointIdentifier = avsCommon::sdkInterfaces::endpoints::EndpointIdentifier;
 
+    /**
+     * The context of an endpoint, which is patched whenever the state of one of its capabilities changes, and the
+     * serialized snapshot of it which is shared by the context requests made until the next change.
+     */
+    struct EndpointContext {
+        /// The states included in the context of the endpoint.
+        avsCommon::avs::AVSContext context;
+
+        /// An immutable and serialized copy of @c context, or nullptr if @c context changed since it was taken.
+        std::shared_ptr<const avsCommon::avs::AVSContext> snapshot;
+    };
+
     /**
      * Structure used to save information about a request.
      */
@@ -169,8 +183,28 @@ private:  // Private type declarations.
         avsCommon::utils::timing::MultiTimer::Token timerToken;
         /// The context requester.
         std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> contextRequester;
+        /// The token of the fan-out which completes the request.
+        avsCommon::sdkInterfaces::ContextRequestToken fanOutToken;
+    };
+
+    /**
+     * Structure used to save information about a fan-out of @c provideState calls.  The requests for the context of an
+     * endpoint which arrive while a fan-out for it is in flight are attached to it, so that the providers are queried
+     * once for all of them.  A fan-out is identified by the token of the request which started it, which is the token
+     * the providers are given.
+     */
+    struct FanOut {
+        /// The endpoint whose providers are queried.
+        EndpointIdentifier endpointId;
+        /// The tokens of the requests completed by the fan-out, in the order they arrived.
+        std::vector<avsCommon::sdkInterfaces::ContextRequestToken> requestTokens;
     };
 
+    /// Alias for the requesters of the requests completed together, with the tokens of their requests.
+    using Requesters = std::vector<std::pair<
+        avsCommon::sdkInterfaces::ContextRequestToken,
+        std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface>>>;
+
 private:  // Private method declarations.
     /**
      * Constructor.
@@ -209,40 +243,79 @@ private:  // Private method declarations.
         const avsCommon::avs::CapabilityTag& capabilityIdentifier,
         const avsCommon::avs::CapabilityState& capabilityState);
 
+    /**
+     * Patch the context of an endpoint with the current state of one of its capabilities, following the rules which
+     * decide whether a state is included in the context.  @c m_endpointsStateMutex must be held.
+     *
+     * @param endpointId The endpoint of the capability.
+     * @param capabilityIdentifier The capability identifier.
+     */
+    void updateEndpointContextLocked(
+        const EndpointIdentifier& endpointId,
+        const avsCommon::avs::CapabilityTag& capabilityIdentifier);
+
     /**
      * This method returns a callback which should be invoked once the context is ready.
      * If the context is not ready, this method will return a no-op function.
      *
      * @note The callback method that is returned should only be called outside of a lock to prevent deadlock scenarios.
      *
-     * @note If the context is ready, the method also removes the request from the pending requests map.
+     * @note If the context is ready, the method also removes the fan-out and the requests attached to it from the
+     * pending requests maps.
      *
-     * @param requestToken The request token associated with the context request.
-     * @param endpointId The endpointId associated with the context request.
-     * @return A callback method to notify the context requester when the context is ready. An empty no-op function
+     * @note @c m_requestsMutex must be held, and @c m_endpointsStateMutex must not be.
+     *
+     * @param fanOutToken The token of the fan-out which completes the context requests.
+     * @return A callback method to notify the context requesters when the context is ready. An empty no-op function
      * if the context is not ready.
      */
     std::function<void()> getContextAvailableCallbackIfReadyLocked(
-        avsCommon::sdkInterfaces::ContextRequestToken requestToken,
-        const avsCommon::sdkInterfaces::endpoints::EndpointIdentifier& endpointId);
+        avsCommon::sdkInterfaces::ContextRequestToken fanOutToken);
 
     /**
-     * This method returns a callback which should be invoked once there is a context failure.
-     * If the contextRequester is invalid, this method returns a no-op function.
+     * This method returns a callback which should be invoked once there is a context failure, which fails every
+     * request attached to the fan-out.  If there is no such request, this method returns a no-op function.
      *
      * @note The callback method that is returned should only be called outside of a lock to prevent deadlock scenarios.
      *
-     * @note The method also cleans up the request from the pending requests map.
+     * @note The method also cleans up the fan-out and its requests from the pending requests maps.
      *
-     * @param requestToken The request token associated with the context request.
-     * @param error The @c ContextRequestError to be notified to the requester.
-     * @return A callback method to notify the context requester of a context fetch failure. An empty no-op function if
-     * the context requester is invalid.
+     * @param fanOutToken The token of the fan-out which failed.
+     * @param error The @c ContextRequestError to be notified to the requesters.
+     * @return A callback method to notify the context requesters of a context fetch failure. An empty no-op function if
+     * there is no requester.
      */
     std::function<void()> getContextFailureCallbackLocked(
-        avsCommon::sdkInterfaces::ContextRequestToken requestToken,
+        avsCommon::sdkInterfaces::ContextRequestToken fanOutToken,
         avsCommon::sdkInterfaces::ContextRequestError error);
 
+    /**
+     * This method returns a callback which should be invoked once a request timed out.  Only that request fails; the
+     * fan-out it is attached to carries on for the other requests attached to it, if any.
+     *
+     * @note The callback method that is returned should only be called outside of a lock to prevent deadlock scenarios.
+     *
+     * @param requestToken The token of the request which timed out.
+     * @return A callback method to notify the context requester of the timeout. An empty no-op function if the request
+     * is no longer pending.
+     */
+    std::function<void()> getContextTimeoutCallbackLocked(avsCommon::sdkInterfaces::ContextRequestToken requestToken);
+
+    /**
+     * Remove a fan-out and the requests attached to it from the pending requests maps, canceling their timeouts.
+     *
+     * @param fanOutToken The token of the fan-out.
+     * @return The requesters of the requests removed.
+     */
+    Requesters removeFanOutLocked(avsCommon::sdkInterfaces::ContextRequestToken fanOutToken);
+
+    /**
+     * Record a metric for each state a fan-out is still waiting for when a request fails.
+     *
+     * @param fanOutToken The token of the fan-out.
+     */
+    void recordPendingStatesMetricsLocked(avsCommon::sdkInterfaces::ContextRequestToken fanOutToken);
+
     /**
      * Generate a request token.
      *
@@ -258,6 +331,10 @@ private:  // Member variable declarations
     /// before accessing the map.
     std::unordered_map<EndpointIdentifier, CapabilitiesState> m_endpointsState;
 
+    /// Map of endpoints to their context, kept up to date with @c m_endpointsState. @c m_endpointsStateMutex must be
+    /// acquired before accessing the map.
+    std::unordered_map<EndpointIdentifier, EndpointContext> m_endpointsContext;
+
     /// Mutex used to guard the pending state requests. This is only needed because of @c setState.
     std::mutex m_requestsMutex;
 
@@ -267,12 +344,18 @@ private:  // Member variable declarations
     /// The request token counter.
     std::atomic<unsigned int> m_requestCounter;
 
-    /// Map of pending states per ongoing request.
+    /// Map of pending states per ongoing fan-out.
     std::unordered_map<unsigned int, std::unordered_set<avsCommon::avs::CapabilityTag>> m_pendingStateRequest;
 
     /// Map of requester per ongoing request and their respective tokens.
     std::unordered_map<avsCommon::sdkInterfaces::ContextRequestToken, RequestTracker> m_pendingRequests;
 
+    /// Map of ongoing fan-outs and their tokens.
+    std::unordered_map<avsCommon::sdkInterfaces::ContextRequestToken, FanOut> m_fanOuts;
+
+    /// Map of endpoints to the token of the fan-out in flight for them, which new requests are attached to.
+    std::unordered_map<EndpointIdentifier, avsCommon::sdkInterfaces::ContextRequestToken> m_endpointFanOuts;
+
     /// Mutex used to guard the observers.
     std::mutex m_observerMutex;
 
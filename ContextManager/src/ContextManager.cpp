@@ -15,7 +15,6 @@
 
 #include <algorithm>
 
-#include <AVSCommon/Utils/Error/FinallyGuard.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
 #include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
@@ -67,6 +66,8 @@ ContextManager::~ContextManager() {
     m_observers.clear();
     m_pendingRequests.clear();
     m_pendingStateRequest.clear();
+    m_fanOuts.clear();
+    m_endpointFanOuts.clear();
 }
 
 /**
@@ -99,6 +100,7 @@ void ContextManager::addStateProvider(
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState[capabilityIdentifier] = StateInfo(std::move(stateProvider), Optional<CapabilityState>());
+    updateEndpointContextLocked(endpointId, capabilityIdentifier);
 }
 
 void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIdentifier) {
@@ -107,6 +109,7 @@ void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIde
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState.erase(capabilityIdentifier);
+    updateEndpointContextLocked(endpointId, capabilityIdentifier);
 }
 
 SetStateResult ContextManager::setState(
@@ -117,7 +120,7 @@ SetStateResult ContextManager::setState(
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
     if (EMPTY_TOKEN == stateRequestToken) {
-        m_executor.submit([this, capabilityIdentifier, jsonState, refreshPolicy] {
+        m_executor.execute([this, capabilityIdentifier, jsonState, refreshPolicy] {
             updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy);
         });
         return SetStateResult::SUCCESS;
@@ -143,7 +146,7 @@ SetStateResult ContextManager::setState(
         return SetStateResult::STATE_PROVIDER_NOT_REGISTERED;
     }
 
-    m_executor.submit([this, capabilityIdentifier, jsonState, refreshPolicy, stateRequestToken] {
+    m_executor.execute([this, capabilityIdentifier, jsonState, refreshPolicy, stateRequestToken] {
         updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy);
         if (jsonState.empty() && (StateRefreshPolicy::ALWAYS == refreshPolicy)) {
             ACSDK_ERROR(LX("setStateFailed")
@@ -165,7 +168,7 @@ SetStateResult ContextManager::setState(
                 if (requestIt != m_pendingStateRequest.end()) {
                     requestIt->second.erase(capabilityIdentifier);
                 }
-                contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(stateRequestToken, "");
+                contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(stateRequestToken);
             }
             /// Callback method should be called outside the lock.
             contextAvailableCallback();
@@ -191,7 +194,7 @@ void ContextManager::reportStateChange(
     AlexaStateChangeCauseType cause) {
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
-    m_executor.submit([this, capabilityIdentifier, capabilityState, cause] {
+    m_executor.execute([this, capabilityIdentifier, capabilityState, cause] {
         updateCapabilityState(capabilityIdentifier, capabilityState);
         std::lock_guard<std::mutex> observerMutex{m_observerMutex};
         for (auto& observer : m_observers) {
@@ -206,7 +209,7 @@ void ContextManager::provideStateResponse(
     ContextRequestToken stateRequestToken) {
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
-    m_executor.submit([this, capabilityIdentifier, capabilityState, stateRequestToken] {
+    m_executor.execute([this, capabilityIdentifier, capabilityState, stateRequestToken] {
         std::function<void()> contextAvailableCallback = NoopCallback;
         {
             std::lock_guard<std::mutex> requestsLock{m_requestsMutex};
@@ -233,8 +236,7 @@ void ContextManager::provideStateResponse(
             if (requestIt != m_pendingStateRequest.end()) {
                 requestIt->second.erase(capabilityIdentifier);
             }
-            contextAvailableCallback =
-                getContextAvailableCallbackIfReadyLocked(stateRequestToken, capabilityIdentifier.endpointId);
+            contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(stateRequestToken);
         }
         /// Callback method should be called outside the lock.
         contextAvailableCallback();
@@ -248,7 +250,7 @@ void ContextManager::provideStateUnavailableResponse(
     bool isEndpointUnreachable) {
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
-    m_executor.submit([this, capabilityIdentifier, stateRequestToken, isEndpointUnreachable] {
+    m_executor.execute([this, capabilityIdentifier, stateRequestToken, isEndpointUnreachable] {
         std::function<void()> contextAvailableCallback = NoopCallback;
         std::function<void()> contextFailureCallback = NoopCallback;
         {
@@ -278,8 +280,7 @@ void ContextManager::provideStateUnavailableResponse(
                     if (requestIt != m_pendingStateRequest.end()) {
                         requestIt->second.erase(capabilityIdentifier);
                     }
-                    contextAvailableCallback =
-                        getContextAvailableCallbackIfReadyLocked(stateRequestToken, capabilityIdentifier.endpointId);
+                    contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(stateRequestToken);
 
                 } else {
                     contextFailureCallback =
@@ -318,65 +319,151 @@ ContextRequestToken ContextManager::getContext(
     const std::chrono::milliseconds& timeout) {
     ACSDK_DEBUG5(LX(__func__).sensitive("endpointId", endpointId));
     auto token = generateToken();
-    m_executor.submit([this, contextRequester, endpointId, token, timeout] {
+    // Capture a non-const copy so that the task is nothrow movable and is queued without allocating.
+    std::string capturedEndpointId = endpointId;
+    auto task = [this, contextRequester, capturedEndpointId, token, timeout] {
         auto timerToken = m_multiTimer->submitTask(timeout, [this, token] {
             // Cancel request after timeout.
-            m_executor.submit([this, token] {
+            m_executor.execute([this, token] {
                 std::function<void()> contextFailureCallback = NoopCallback;
                 {
                     std::lock_guard<std::mutex> lock{m_requestsMutex};
-                    contextFailureCallback =
-                        getContextFailureCallbackLocked(token, ContextRequestError::STATE_PROVIDER_TIMEDOUT);
+                    contextFailureCallback = getContextTimeoutCallbackLocked(token);
                 }
                 contextFailureCallback();
             });
         });
 
         std::lock_guard<std::mutex> requestsLock{m_requestsMutex};
-        auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
-        m_pendingRequests.emplace(token, RequestTracker{timerToken, contextRequester});
+        auto& requestEndpointId = capturedEndpointId.empty() ? m_defaultEndpointId : capturedEndpointId;
+        auto fanOutIt = m_endpointFanOuts.find(requestEndpointId);
+        if (fanOutIt != m_endpointFanOuts.end()) {
+            // The providers are already being queried for this endpoint, so complete this request with their answers.
+            ACSDK_DEBUG5(LX(__func__).d("token", token).d("attachedTo", fanOutIt->second));
+            m_pendingRequests.emplace(token, RequestTracker{timerToken, contextRequester, fanOutIt->second});
+            m_fanOuts[fanOutIt->second].requestTokens.push_back(token);
+            return;
+        }
+        m_pendingRequests.emplace(token, RequestTracker{timerToken, contextRequester, token});
+        m_fanOuts[token] = FanOut{requestEndpointId, {token}};
 
-        std::function<void()> contextAvailableCallback = NoopCallback;
         {
             std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
             for (auto& capability : m_endpointsState[requestEndpointId]) {
-                if (capability.second.stateProvider &&
-                    (capability.second.legacyCapability ? capability.second.refreshPolicy != StateRefreshPolicy::NEVER
-                                                        : capability.second.stateProvider->canStateBeRetrieved())) {
-                    capability.second.stateProvider->provideState(capability.first, token);
+                auto& stateInfo = capability.second;
+                if (!stateInfo.stateProvider) {
+                    continue;
+                }
+                // The state last reported by a provider which reports every change is its current state, so only the
+                // providers which do not are queried.
+                bool shouldQuery = stateInfo.legacyCapability
+                                       ? stateInfo.refreshPolicy != StateRefreshPolicy::NEVER
+                                       : stateInfo.stateProvider->canStateBeRetrieved() &&
+                                             !(stateInfo.capabilityState.hasValue() &&
+                                               stateInfo.stateProvider->isStateProactivelyReported());
+                if (shouldQuery) {
+                    stateInfo.stateProvider->provideState(capability.first, token);
                     m_pendingStateRequest[token].emplace(capability.first);
                 }
             }
+        }
 
-            contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(token, requestEndpointId);
+        if (m_pendingStateRequest.find(token) != m_pendingStateRequest.end()) {
+            m_endpointFanOuts[requestEndpointId] = token;
         }
+        auto contextAvailableCallback = getContextAvailableCallbackIfReadyLocked(token);
         /// Callback method should be called outside the lock.
         contextAvailableCallback();
-    });
+    };
+    static_assert(threading::InlineTask::fitsInline<decltype(task)>(), "getContext task should not allocate");
+    m_executor.execute(std::move(task));
 
     return token;
 }
 
 std::function<void()> ContextManager::getContextFailureCallbackLocked(
-    unsigned int requestToken,
+    ContextRequestToken fanOutToken,
     ContextRequestError error) {
-    ACSDK_DEBUG5(LX(__func__).d("token", requestToken));
-    // Make sure the request gets cleared in the end of this function no matter the outcome.
-    error::FinallyGuard clearRequestGuard{[this, requestToken] {
-        auto requestIt = m_pendingRequests.find(requestToken);
-        if (requestIt != m_pendingRequests.end()) {
-            m_multiTimer->cancelTask(requestIt->second.timerToken);
-            m_pendingRequests.erase(requestIt);
+    ACSDK_DEBUG5(LX(__func__).d("token", fanOutToken));
+    auto fanOutIt = m_fanOuts.find(fanOutToken);
+    if (fanOutIt != m_fanOuts.end()) {
+        for (size_t i = 0; i < fanOutIt->second.requestTokens.size(); ++i) {
+            recordPendingStatesMetricsLocked(fanOutToken);
+        }
+    }
+    auto requesters = removeFanOutLocked(fanOutToken);
+    if (requesters.empty()) {
+        ACSDK_DEBUG0(LX(__func__).d("result", "nullRequester").d("token", fanOutToken));
+        return NoopCallback;
+    }
+
+    return [requesters, error]() {
+        for (auto& requester : requesters) {
+            requester.second->onContextFailure(error, requester.first);
         }
-        m_pendingStateRequest.erase(requestToken);
-    }};
+    };
+}
 
-    auto& request = m_pendingRequests[requestToken];
-    if (!request.contextRequester) {
-        ACSDK_DEBUG0(LX(__func__).d("result", "nullRequester").d("token", requestToken));
+std::function<void()> ContextManager::getContextTimeoutCallbackLocked(ContextRequestToken requestToken) {
+    ACSDK_DEBUG5(LX(__func__).d("token", requestToken));
+    auto requestIt = m_pendingRequests.find(requestToken);
+    if (requestIt == m_pendingRequests.end()) {
+        ACSDK_DEBUG0(LX(__func__).d("result", "requestNotPending").d("token", requestToken));
+        return NoopCallback;
+    }
+    auto contextRequester = requestIt->second.contextRequester;
+    auto fanOutToken = requestIt->second.fanOutToken;
+    m_pendingRequests.erase(requestIt);
+    recordPendingStatesMetricsLocked(fanOutToken);
+
+    // The fan-out carries on as long as other requests are attached to it.
+    auto fanOutIt = m_fanOuts.find(fanOutToken);
+    if (fanOutIt != m_fanOuts.end()) {
+        auto& requestTokens = fanOutIt->second.requestTokens;
+        requestTokens.erase(std::remove(requestTokens.begin(), requestTokens.end(), requestToken), requestTokens.end());
+        if (requestTokens.empty()) {
+            removeFanOutLocked(fanOutToken);
+        }
+    }
+    if (!contextRequester) {
         return NoopCallback;
     }
-    for (auto& pendingState : m_pendingStateRequest[requestToken]) {
+
+    return [contextRequester, requestToken]() {
+        contextRequester->onContextFailure(ContextRequestError::STATE_PROVIDER_TIMEDOUT, requestToken);
+    };
+}
+
+ContextManager::Requesters ContextManager::removeFanOutLocked(ContextRequestToken fanOutToken) {
+    Requesters requesters;
+    auto fanOutIt = m_fanOuts.find(fanOutToken);
+    if (fanOutIt != m_fanOuts.end()) {
+        for (auto requestToken : fanOutIt->second.requestTokens) {
+            auto requestIt = m_pendingRequests.find(requestToken);
+            if (requestIt != m_pendingRequests.end()) {
+                m_multiTimer->cancelTask(requestIt->second.timerToken);
+                if (requestIt->second.contextRequester) {
+                    requesters.emplace_back(requestToken, requestIt->second.contextRequester);
+                }
+                m_pendingRequests.erase(requestIt);
+            }
+        }
+        auto endpointIt = m_endpointFanOuts.find(fanOutIt->second.endpointId);
+        if (endpointIt != m_endpointFanOuts.end() && endpointIt->second == fanOutToken) {
+            m_endpointFanOuts.erase(endpointIt);
+        }
+        m_fanOuts.erase(fanOutIt);
+    }
+    m_pendingStateRequest.erase(fanOutToken);
+    return requesters;
+}
+
+void ContextManager::recordPendingStatesMetricsLocked(ContextRequestToken fanOutToken) {
+    auto pendingStatesIt = m_pendingStateRequest.find(fanOutToken);
+    if (pendingStatesIt == m_pendingStateRequest.end()) {
+        return;
+    }
+    for (auto& pendingState : pendingStatesIt->second) {
         auto metricName = STATE_PROVIDER_TIMEOUT_METRIC_PREFIX + pendingState.nameSpace;
         recordMetric(
             m_metricRecorder,
@@ -385,66 +472,80 @@ std::function<void()> ContextManager::getContextFailureCallbackLocked(
                 .addDataPoint(DataPointCounterBuilder{}.setName(metricName).increment(1).build())
                 .build());
     }
-    auto contextRequester = request.contextRequester;
-
-    return [contextRequester, error, requestToken]() {
-        if (contextRequester) {
-            contextRequester->onContextFailure(error, requestToken);
-        }
-    };
 }
 
-std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
-    unsigned int requestToken,
-    const EndpointIdentifier& endpointId) {
-    auto& pendingStates = m_pendingStateRequest[requestToken];
-    if (!pendingStates.empty()) {
-        ACSDK_DEBUG5(LX(__func__).d("result", "stateNotAvailableYet").d("pendingStates", pendingStates.size()));
+std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(ContextRequestToken fanOutToken) {
+    auto pendingStatesIt = m_pendingStateRequest.find(fanOutToken);
+    if (pendingStatesIt != m_pendingStateRequest.end() && !pendingStatesIt->second.empty()) {
+        ACSDK_DEBUG5(
+            LX(__func__).d("result", "stateNotAvailableYet").d("pendingStates", pendingStatesIt->second.size()));
         return NoopCallback;
     }
 
-    ACSDK_DEBUG5(LX(__func__).sensitive("endpointId", endpointId).d("token", requestToken));
-    // Make sure the request gets cleared in the end of this function no matter the outcome.
-    error::FinallyGuard clearRequestGuard{[this, requestToken] {
-        auto requestIt = m_pendingRequests.find(requestToken);
-        if (requestIt != m_pendingRequests.end()) {
-            m_multiTimer->cancelTask(requestIt->second.timerToken);
-            m_pendingRequests.erase(requestIt);
-        }
-        m_pendingStateRequest.erase(requestToken);
-    }};
-
-    auto& request = m_pendingRequests[requestToken];
-    if (!request.contextRequester) {
+    auto fanOutIt = m_fanOuts.find(fanOutToken);
+    if (fanOutIt == m_fanOuts.end()) {
+        ACSDK_ERROR(LX("getContextAvailableCallbackIfReadyLockedFailed")
+                        .d("reason", "fanOutNotPending")
+                        .d("token", fanOutToken));
+        m_pendingStateRequest.erase(fanOutToken);
+        return NoopCallback;
+    }
+    auto endpointId = fanOutIt->second.endpointId;
+    ACSDK_DEBUG5(LX(__func__)
+                     .sensitive("endpointId", endpointId)
+                     .d("token", fanOutToken)
+                     .d("requests", fanOutIt->second.requestTokens.size()));
+    auto requesters = removeFanOutLocked(fanOutToken);
+    if (requesters.empty()) {
         ACSDK_ERROR(
-            LX("getContextAvailableCallbackIfReadyLockedFailed").d("reason", "nullRequester").d("token", requestToken));
+            LX("getContextAvailableCallbackIfReadyLockedFailed").d("reason", "nullRequester").d("token", fanOutToken));
         return NoopCallback;
     }
 
-    AVSContext context;
-    auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
-    for (auto& capability : m_endpointsState[requestEndpointId]) {
-        if (capability.second.legacyCapability ||
-            (capability.second.stateProvider && capability.second.stateProvider->canStateBeRetrieved())) {
-            // Ignore if the state is not available for legacy SOMETIMES refresh policy.
-            if (capability.second.refreshPolicy == StateRefreshPolicy::SOMETIMES &&
-                !capability.second.capabilityState.hasValue()) {
-                ACSDK_DEBUG5(LX(__func__).d("skipping state for capabilityIdentifier", capability.first));
-            } else {
-                ACSDK_DEBUG5(LX(__func__).sensitive("addState", capability.first));
-                context.addState(capability.first, capability.second.capabilityState.value());
-            }
+    std::shared_ptr<const AVSContext> context;
+    {
+        std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
+        auto& endpointContext = m_endpointsContext[endpointId];
+        if (!endpointContext.snapshot) {
+            // Serialize the context once for all the requests made until one of its states changes.
+            auto snapshot = std::make_shared<AVSContext>(endpointContext.context);
+            snapshot->cacheJson();
+            endpointContext.snapshot = std::move(snapshot);
         }
+        context = endpointContext.snapshot;
     }
-    auto contextRequester = request.contextRequester;
 
-    return [contextRequester, context, endpointId, requestToken]() {
-        if (contextRequester) {
-            contextRequester->onContextAvailable(endpointId, context, requestToken);
+    return [requesters, context, endpointId]() {
+        for (auto& requester : requesters) {
+            requester.second->onContextAvailable(endpointId, *context, requester.first);
         }
     };
 }
 
+void ContextManager::updateEndpointContextLocked(
+    const EndpointIdentifier& endpointId,
+    const CapabilityTag& capabilityIdentifier) {
+    auto& endpointContext = m_endpointsContext[endpointId];
+    endpointContext.snapshot.reset();
+    endpointContext.context.removeState(capabilityIdentifier);
+
+    auto& capabilitiesState = m_endpointsState[endpointId];
+    auto capabilityIt = capabilitiesState.find(capabilityIdentifier);
+    if (capabilityIt == capabilitiesState.end()) {
+        return;
+    }
+    auto& stateInfo = capabilityIt->second;
+    if (stateInfo.legacyCapability || (stateInfo.stateProvider && stateInfo.stateProvider->canStateBeRetrieved())) {
+        // Ignore if the state is not available for legacy SOMETIMES refresh policy.
+        if (stateInfo.refreshPolicy == StateRefreshPolicy::SOMETIMES && !stateInfo.capabilityState.hasValue()) {
+            ACSDK_DEBUG5(LX(__func__).d("skipping state for capabilityIdentifier", capabilityIdentifier));
+        } else {
+            ACSDK_DEBUG5(LX(__func__).sensitive("addState", capabilityIdentifier));
+            endpointContext.context.addState(capabilityIdentifier, stateInfo.capabilityState.value());
+        }
+    }
+}
+
 void ContextManager::updateCapabilityState(
     const avsCommon::avs::CapabilityTag& capabilityIdentifier,
     const avsCommon::avs::CapabilityState& capabilityState) {
@@ -453,6 +554,7 @@ void ContextManager::updateCapabilityState(
     auto& capabilitiesState = m_endpointsState[endpointId];
     auto& stateProvider = capabilitiesState[capabilityIdentifier].stateProvider;
     capabilitiesState[capabilityIdentifier] = StateInfo(stateProvider, capabilityState);
+    updateEndpointContextLocked(endpointId, capabilityIdentifier);
 }
 
 void ContextManager::updateCapabilityState(
@@ -464,6 +566,7 @@ void ContextManager::updateCapabilityState(
     auto& capabilityInfo = m_endpointsState[endpointId];
     auto& stateProvider = capabilityInfo[capabilityIdentifier].stateProvider;
     capabilityInfo[capabilityIdentifier] = StateInfo(stateProvider, jsonState, refreshPolicy);
+    updateEndpointContextLocked(endpointId, capabilityIdentifier);
 }
 
 ContextManager::StateInfo::StateInfo(
@@ -0,0 +1,251 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file ContextManagerBenchmarkTest.cpp
+///
+/// Measures the latency of @c ContextManager::getContext, from the request to the serialized context reaching the
+/// requester, with 30 state providers.  The providers either all answer @c provideState, or mostly report every change
+/// of their state so that the context is served from the state last reported.  One provider reports a change every
+/// @c REQUESTS_PER_CHANGE requests, so the cached context is patched and serialized again.  Results are printed to
+/// stdout and recorded as test properties; only correctness is asserted so that the test is stable on loaded build
+/// machines.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Common/BenchmarkReport.h>
+
+#include "ContextManager/ContextManager.h"
+
+namespace alexaClientSDK {
+namespace contextManager {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace std::chrono;
+using avsCommon::utils::reportBenchmarkResult;
+
+/// The number of state providers.
+static const int PROVIDERS = 30;
+
+/// The number of context requests made by each variant.
+static const int REQUESTS = 1000;
+
+/// The number of context requests between two state changes.
+static const int REQUESTS_PER_CHANGE = 10;
+
+/// The endpoint of the providers.
+static const std::string ENDPOINT_ID = "EndpointId";
+
+/// How long to wait for a context.
+static const milliseconds TIMEOUT{2000};
+
+/**
+ * Get the CPU time used by this process so far.
+ *
+ * @return The user and system CPU time.
+ */
+static microseconds cpuTime() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/**
+ * Build the state of a provider.
+ *
+ * @param value The value of the state.
+ * @return The state.
+ */
+static CapabilityState buildState(int value) {
+    return CapabilityState{R"({"value":)" + std::to_string(value) + R"(,"unit":"PERCENT"})"};
+}
+
+/// A provider which answers @c provideState immediately, or which reports every change of its state.
+class BenchmarkStateProvider : public StateProviderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param contextManager The context manager, which must outlive the provider.
+     * @param isProactivelyReported Whether the provider reports every change of its state.
+     */
+    BenchmarkStateProvider(ContextManagerInterface* contextManager, bool isProactivelyReported) :
+            m_contextManager{contextManager},
+            m_isProactivelyReported{isProactivelyReported},
+            m_value{0} {
+    }
+
+    void provideState(const CapabilityTag& stateProviderName, const ContextRequestToken stateRequestToken) override {
+        m_contextManager->provideStateResponse(stateProviderName, buildState(m_value), stateRequestToken);
+    }
+
+    bool isStateProactivelyReported() override {
+        return m_isProactivelyReported;
+    }
+
+    /**
+     * Change the state, and report it.
+     *
+     * @param capability The capability of the provider.
+     * @param value The new value of the state.
+     */
+    void changeState(const CapabilityTag& capability, int value) {
+        m_value = value;
+        m_contextManager->reportStateChange(capability, buildState(value), AlexaStateChangeCauseType::APP_INTERACTION);
+    }
+
+private:
+    /// The context manager.
+    ContextManagerInterface* m_contextManager;
+
+    /// Whether the provider reports every change of its state.
+    const bool m_isProactivelyReported;
+
+    /// The value of the state.
+    std::atomic<int> m_value;
+};
+
+/// A requester which receives the serialized context, as the requesters sending events do.
+class BenchmarkContextRequester : public ContextRequesterInterface {
+public:
+    /**
+     * Prepare for the next context.
+     *
+     * @return The future of the next context, or an empty string if the request fails.
+     */
+    std::future<std::string> expectContext() {
+        m_contextPromise = std::promise<std::string>();
+        return m_contextPromise.get_future();
+    }
+
+    void onContextAvailable(const std::string& jsonContext) override {
+        m_contextPromise.set_value(jsonContext);
+    }
+
+    void onContextFailure(const ContextRequestError error) override {
+        m_contextPromise.set_value("");
+    }
+
+private:
+    /// The promise of the next context.
+    std::promise<std::string> m_contextPromise;
+};
+
+/**
+ * Count the occurrences of a string in a context.
+ *
+ * @param context The context.
+ * @param needle The string to count.
+ * @return The number of occurrences.
+ */
+static int count(const std::string& context, const std::string& needle) {
+    int occurrences = 0;
+    for (auto position = context.find(needle); position != std::string::npos;
+         position = context.find(needle, position + needle.size())) {
+        ++occurrences;
+    }
+    return occurrences;
+}
+
+/// Fixture which creates a @c ContextManager.
+class ContextManagerBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto deviceInfo = avsCommon::utils::DeviceInfo::create(
+            "clientId", "productId", "1234", "manufacturer", "my device", "friendlyName", "deviceType");
+        ASSERT_NE(deviceInfo, nullptr);
+        m_contextManager = ContextManager::create(*deviceInfo);
+        ASSERT_NE(m_contextManager, nullptr);
+    }
+
+    /**
+     * Request the context repeatedly, changing the state of a provider every @c REQUESTS_PER_CHANGE requests, and
+     * report the latency of the requests.
+     *
+     * @param variant The name of the variant.
+     * @param proactiveProviders The number of providers which report every change of their state.
+     */
+    void run(const std::string& variant, int proactiveProviders) {
+        std::vector<CapabilityTag> capabilities;
+        std::vector<std::shared_ptr<BenchmarkStateProvider>> providers;
+        for (int i = 0; i < PROVIDERS; ++i) {
+            capabilities.emplace_back("Namespace" + std::to_string(i), "property", ENDPOINT_ID);
+            auto isProactive = i < proactiveProviders;
+            providers.push_back(std::make_shared<BenchmarkStateProvider>(m_contextManager.get(), isProactive));
+            m_contextManager->addStateProvider(capabilities.back(), providers.back());
+            providers.back()->changeState(capabilities.back(), -1);
+        }
+
+        auto requester = std::make_shared<BenchmarkContextRequester>();
+        nanoseconds latency{0};
+        auto start = cpuTime();
+        for (int i = 0; i < REQUESTS; ++i) {
+            int changed = (i / REQUESTS_PER_CHANGE) % PROVIDERS;
+            if (0 == i % REQUESTS_PER_CHANGE) {
+                providers[changed]->changeState(capabilities[changed], i);
+            }
+            auto contextFuture = requester->expectContext();
+            auto requestTime = steady_clock::now();
+            m_contextManager->getContext(requester, ENDPOINT_ID, TIMEOUT);
+            ASSERT_EQ(contextFuture.wait_for(TIMEOUT), std::future_status::ready);
+            latency += steady_clock::now() - requestTime;
+
+            auto context = contextFuture.get();
+            ASSERT_EQ(count(context, R"("namespace")"), PROVIDERS);
+            ASSERT_EQ(count(context, R"("value":)" + std::to_string(i - i % REQUESTS_PER_CHANGE) + ","), 1);
+        }
+        auto cpu = cpuTime() - start;
+
+        for (auto& capability : capabilities) {
+            m_contextManager->removeStateProvider(capability);
+        }
+        reportBenchmarkResult(
+            variant, "microsecondsPerRequest", duration_cast<nanoseconds>(latency).count() / 1000.0 / REQUESTS);
+        reportBenchmarkResult(variant, "cpuMicrosecondsPerRequest", static_cast<double>(cpu.count()) / REQUESTS);
+    }
+
+    /// The context manager.
+    std::shared_ptr<ContextManager> m_contextManager;
+};
+
+/// Every provider is queried for each request.
+TEST_F(ContextManagerBenchmarkTest, testSlow_onDemandProviders) {
+    run("ON_DEMAND", 0);
+}
+
+/// Three providers are queried for each request, and the states of the others are served from the cached context.
+TEST_F(ContextManagerBenchmarkTest, testSlow_mostlyProactiveProviders) {
+    run("MOSTLY_PROACTIVE", PROVIDERS - 3);
+}
+
+/// No provider is queried, and the context is served from the cached context.
+TEST_F(ContextManagerBenchmarkTest, testSlow_proactiveProviders) {
+    run("PROACTIVE", PROVIDERS);
+}
+
+}  // namespace test
+}  // namespace contextManager
+}  // namespace alexaClientSDK
@@ -13,6 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -49,6 +53,14 @@ public:
         void(const avs::CapabilityTag& stateProviderName, const ContextRequestToken stateRequestToken));
 };
 
+/// Mock state provider which reports every change of its state.
+class MockProactiveStateProvider : public MockStateProvider {
+public:
+    bool isStateProactivelyReported() override {
+        return true;
+    }
+};
+
 /// Mock legacy state provider.
 struct MockLegacyStateProvider : public StateProviderInterface {
     MOCK_METHOD2(
@@ -532,6 +544,150 @@ TEST_F(ContextManagerTest, test_getContextInParallelShouldSucceed) {
     EXPECT_EQ(statesForEndpoint2.find(capabilityForEndpoint1), statesForEndpoint2.end());
 }
 
+/// Test that a provider which reports every change is not queried once it has reported its state.
+TEST_F(ContextManagerTest, test_getContextShouldNotQueryProactivelyReportedProvider) {
+    auto provider = std::make_shared<StrictMock<MockProactiveStateProvider>>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    m_contextManager->setStateProvider(capability, provider);
+    const std::chrono::milliseconds timeout{100};
+
+    for (auto& state : {CapabilityState{R"({"state":1})"}, CapabilityState{R"({"state":2})"}}) {
+        m_contextManager->reportStateChange(capability, state, AlexaStateChangeCauseType::APP_INTERACTION);
+
+        auto requester = std::make_shared<MockContextRequester>();
+        std::promise<AVSContext::States> contextStatesPromise;
+        EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+            .WillOnce(WithArg<1>(Invoke([&contextStatesPromise](const AVSContext& context) {
+                contextStatesPromise.set_value(context.getStates());
+            })));
+        m_contextManager->getContext(requester, capability.endpointId);
+
+        // The context has the state last reported, including after the context was served once.
+        auto statesFuture = contextStatesPromise.get_future();
+        ASSERT_EQ(statesFuture.wait_for(timeout), std::future_status::ready);
+        EXPECT_EQ(statesFuture.get()[capability].valuePayload, state.valuePayload);
+    }
+}
+
+/// Test that a provider which reports every change is queried until it has reported its state.
+TEST_F(ContextManagerTest, test_getContextShouldQueryProactivelyReportedProviderWithoutState) {
+    auto provider = std::make_shared<MockProactiveStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    CapabilityState state{R"({"state":"target"})"};
+    m_contextManager->setStateProvider(capability, provider);
+
+    utils::WaitEvent provideStateEvent;
+    EXPECT_CALL(*provider, provideState(_, _)).WillOnce((InvokeWithoutArgs([&provideStateEvent] {
+        provideStateEvent.wakeUp();
+    })));
+
+    auto requester = std::make_shared<MockContextRequester>();
+    std::promise<AVSContext::States> contextStatesPromise;
+    EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+        .WillOnce(WithArg<1>(Invoke([&contextStatesPromise](const AVSContext& context) {
+            contextStatesPromise.set_value(context.getStates());
+        })));
+    auto requestToken = m_contextManager->getContext(requester, capability.endpointId);
+
+    const std::chrono::milliseconds timeout{100};
+    ASSERT_TRUE(provideStateEvent.wait(timeout));
+    m_contextManager->provideStateResponse(capability, state, requestToken);
+
+    auto statesFuture = contextStatesPromise.get_future();
+    ASSERT_EQ(statesFuture.wait_for(timeout), std::future_status::ready);
+    EXPECT_EQ(statesFuture.get()[capability].valuePayload, state.valuePayload);
+}
+
+/// Test that concurrent requests for the context of an endpoint query each of its providers once.
+TEST_F(ContextManagerTest, test_concurrentGetContextShouldQueryProvidersOnce) {
+    const int requestCount = 50;
+    auto provider1 = std::make_shared<MockStateProvider>();
+    auto capability1 = CapabilityTag("Namespace1", "Name", "EndpointId");
+    CapabilityState state1{R"({"state":1})"};
+    m_contextManager->setStateProvider(capability1, provider1);
+    auto provider2 = std::make_shared<MockStateProvider>();
+    auto capability2 = CapabilityTag("Namespace2", "Name", "EndpointId");
+    CapabilityState state2{R"({"state":2})"};
+    m_contextManager->setStateProvider(capability2, provider2);
+
+    std::promise<ContextRequestToken> provideStateTokenPromise;
+    EXPECT_CALL(*provider1, provideState(capability1, _))
+        .WillOnce(WithArg<1>(Invoke([&provideStateTokenPromise](ContextRequestToken token) {
+            provideStateTokenPromise.set_value(token);
+        })));
+    EXPECT_CALL(*provider2, provideState(capability2, _)).Times(1);
+
+    auto requester = std::make_shared<MockContextRequester>();
+    std::atomic<int> contextCount{0};
+    utils::WaitEvent allContextsEvent;
+    EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+        .Times(requestCount)
+        .WillRepeatedly(WithArg<1>(Invoke([&](const AVSContext& context) {
+            EXPECT_EQ(context.getStates()[capability1].valuePayload, state1.valuePayload);
+            EXPECT_EQ(context.getStates()[capability2].valuePayload, state2.valuePayload);
+            if (requestCount == ++contextCount) {
+                allContextsEvent.wakeUp();
+            }
+        })));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < requestCount; ++i) {
+        threads.emplace_back([this, requester] { m_contextManager->getContext(requester, "EndpointId"); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const std::chrono::milliseconds timeout{500};
+    auto provideStateTokenFuture = provideStateTokenPromise.get_future();
+    ASSERT_EQ(provideStateTokenFuture.wait_for(timeout), std::future_status::ready);
+    auto provideStateToken = provideStateTokenFuture.get();
+    m_contextManager->provideStateResponse(capability1, state1, provideStateToken);
+    m_contextManager->provideStateResponse(capability2, state2, provideStateToken);
+
+    EXPECT_TRUE(allContextsEvent.wait(timeout));
+}
+
+/// Test that a request attached to the query of another request keeps its own timeout.
+TEST_F(ContextManagerTest, test_coalescedRequestsShouldKeepTheirOwnTimeouts) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability = CapabilityTag("Namespace", "Name", "EndpointId");
+    CapabilityState state{R"({"state":"target"})"};
+    m_contextManager->setStateProvider(capability, provider);
+
+    utils::WaitEvent provideStateEvent;
+    EXPECT_CALL(*provider, provideState(_, _)).WillOnce((InvokeWithoutArgs([&provideStateEvent] {
+        provideStateEvent.wakeUp();
+    })));
+
+    // The first request times out before the provider answers.
+    const std::chrono::milliseconds shortTimeout{50};
+    auto shortRequester = std::make_shared<MockContextRequester>();
+    auto shortToken = m_contextManager->getContext(shortRequester, capability.endpointId, shortTimeout);
+    utils::WaitEvent timeoutEvent;
+    EXPECT_CALL(*shortRequester, onContextFailure(ContextRequestError::STATE_PROVIDER_TIMEDOUT, shortToken))
+        .WillOnce(InvokeWithoutArgs([&timeoutEvent] { timeoutEvent.wakeUp(); }));
+    EXPECT_CALL(*shortRequester, onContextAvailable(_, _, _)).Times(0);
+
+    // The second request is completed by the answer to the query made for the first one.
+    const std::chrono::milliseconds longTimeout{2000};
+    auto longRequester = std::make_shared<MockContextRequester>();
+    auto longToken = m_contextManager->getContext(longRequester, capability.endpointId, longTimeout);
+    std::promise<AVSContext::States> contextStatesPromise;
+    EXPECT_CALL(*longRequester, onContextAvailable(_, _, longToken))
+        .WillOnce(WithArg<1>(Invoke([&contextStatesPromise](const AVSContext& context) {
+            contextStatesPromise.set_value(context.getStates());
+        })));
+
+    ASSERT_TRUE(provideStateEvent.wait(longTimeout));
+    ASSERT_TRUE(timeoutEvent.wait(longTimeout));
+    m_contextManager->provideStateResponse(capability, state, shortToken);
+
+    auto statesFuture = contextStatesPromise.get_future();
+    ASSERT_EQ(statesFuture.wait_for(longTimeout), std::future_status::ready);
+    EXPECT_EQ(statesFuture.get()[capability].valuePayload, state.valuePayload);
+}
+
 }  // namespace test
 }  // namespace contextManager
 }  // namespace alexaClientSDK
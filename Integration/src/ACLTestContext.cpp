@@ -130,7 +130,7 @@ ACLTestContext::ACLTestContext(const std::string& filePath, const std::string& o
     auto postConnectFactory = acl::PostConnectSequencerFactory::create(providers);
     auto http2ConnectionFactory = std::make_shared<LibcurlHTTP2ConnectionFactory>();
     auto transportFactory = std::make_shared<acl::HTTP2TransportFactory>(http2ConnectionFactory, postConnectFactory);
-    m_attachmentManager = std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+    m_attachmentManager = std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::CHUNKED);
     m_messageRouter =
         std::make_shared<MessageRouter>(getAuthDelegate(), m_attachmentManager, transportFactory, DEFAULT_AVS_GATEWAY);
     m_connectionStatusObserver = std::make_shared<ConnectionStatusObserver>();
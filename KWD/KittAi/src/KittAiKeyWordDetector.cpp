@@ -194,18 +194,28 @@ bool KittAiKeyWordDetector::isAudioFormatCompatibleWithKittAi(avsCommon::utils::
 
 void KittAiKeyWordDetector::detectionLoop() {
     notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-    int16_t audioDataToPush[m_maxSamplesPerPush];
     ssize_t wordsRead;
     while (!m_isShuttingDown) {
         bool didErrorOccur;
-        wordsRead = readFromStream(
-            m_streamReader, m_stream, audioDataToPush, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &didErrorOccur);
+        const void* audioDataToPush = nullptr;
+        wordsRead = peekFromStream(
+            m_streamReader, m_stream, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &audioDataToPush, &didErrorOccur);
         if (didErrorOccur) {
             break;
         } else if (wordsRead > 0) {
             // Words were successfully read.
             notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-            int detectionResult = m_kittAiEngine->RunDetection(audioDataToPush, wordsRead);
+            int detectionResult =
+                m_kittAiEngine->RunDetection(static_cast<const int16_t*>(audioDataToPush), static_cast<int>(wordsRead));
+
+            // Release the samples, which also reports if they were overwritten while the engine was using them.
+            wordsRead = consumeFromStream(m_streamReader, m_stream, wordsRead, &didErrorOccur);
+            if (didErrorOccur) {
+                break;
+            } else if (wordsRead < 0) {
+                continue;
+            }
+
             if (detectionResult > 0) {
                 // > 0 indicates a keyword was found
                 if (m_detectionResultsToKeyWords.find(detectionResult) == m_detectionResultsToKeyWords.end()) {
@@ -308,18 +308,44 @@ bool SensoryKeywordDetector::setUpRuntimeSettings(SnsrSession* session) {
 void SensoryKeywordDetector::detectionLoop() {
     m_beginIndexOfStreamReader = m_streamReader->tell();
     notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-    std::vector<int16_t> audioDataToPush(m_maxSamplesPerPush);
     ssize_t wordsRead;
     SnsrRC result;
     while (!m_isShuttingDown) {
         bool didErrorOccur = false;
-        wordsRead = readFromStream(
-            m_streamReader,
-            m_stream,
-            audioDataToPush.data(),
-            audioDataToPush.size(),
-            TIMEOUT_FOR_READ_CALLS,
-            &didErrorOccur);
+        const void* audioDataToPush = nullptr;
+        wordsRead = peekFromStream(
+            m_streamReader, m_stream, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &audioDataToPush, &didErrorOccur);
+        if (wordsRead > 0) {
+            // Words were successfully read.
+            snsrSetStream(
+                m_session,
+                SNSR_SOURCE_AUDIO_PCM,
+                snsrStreamFromMemory(
+                    const_cast<void*>(audioDataToPush), wordsRead * sizeof(int16_t), SNSR_ST_MODE_READ));
+            result = snsrRun(m_session);
+            switch (result) {
+                case SNSR_RC_STREAM_END:
+                    // Reached end of buffer without any keyword detections
+                    break;
+                case SNSR_RC_OK:
+                    break;
+                default:
+                    // A different return from the callback function that indicates some sort of error
+                    ACSDK_ERROR(LX("detectionLoopFailed")
+                                    .d("reason", "unexpectedReturn")
+                                    .d("error", getSensoryDetails(m_session, result)));
+
+                    notifyKeyWordDetectorStateObservers(
+                        KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ERROR);
+                    didErrorOccur = true;
+                    break;
+            }
+            if (didErrorOccur) {
+                break;
+            }
+            // Release the samples, which also reports if they were overwritten while the engine was using them.
+            wordsRead = consumeFromStream(m_streamReader, m_stream, wordsRead, &didErrorOccur);
+        }
         if (didErrorOccur) {
             /*
              * Note that this does not include the overrun condition, which the base class handles by instructing the
@@ -351,34 +377,6 @@ void SensoryKeywordDetector::detectionLoop() {
             }
 
             m_session = newSession;
-        } else if (wordsRead > 0) {
-            // Words were successfully read.
-            snsrSetStream(
-                m_session,
-                SNSR_SOURCE_AUDIO_PCM,
-                snsrStreamFromMemory(
-                    audioDataToPush.data(), wordsRead * sizeof(*audioDataToPush.data()), SNSR_ST_MODE_READ));
-            result = snsrRun(m_session);
-            switch (result) {
-                case SNSR_RC_STREAM_END:
-                    // Reached end of buffer without any keyword detections
-                    break;
-                case SNSR_RC_OK:
-                    break;
-                default:
-                    // A different return from the callback function that indicates some sort of error
-                    ACSDK_ERROR(LX("detectionLoopFailed")
-                                    .d("reason", "unexpectedReturn")
-                                    .d("error", getSensoryDetails(m_session, result)));
-
-                    notifyKeyWordDetectorStateObservers(
-                        KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ERROR);
-                    didErrorOccur = true;
-                    break;
-            }
-            if (didErrorOccur) {
-                break;
-            }
         }
         // Reset return code for next round
         snsrClearRC(m_session);
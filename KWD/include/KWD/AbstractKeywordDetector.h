@@ -121,6 +121,44 @@ protected:
         std::chrono::milliseconds timeout,
         bool* errorOccurred);
 
+    /**
+     * Waits for data in the specified stream and provides direct access to it in the stream's buffer, with the same
+     * error checking and observer notifications as @c readFromStream().  The data stays in the stream until it is
+     * released with @c consumeFromStream().
+     *
+     * @param reader The stream reader. This should be a blocking reader.
+     * @param stream The stream.
+     * @param nWords The maximum number of words to return.
+     * @param timeout The amount of time to wait for data to become available.
+     * @param[out] data Set to the start of the words, which are contiguous in memory.
+     * @param[out] errorOccurred Lets caller know if there were any errors that occurred with the peek call.
+     * @return The number of words available at @c data.
+     */
+    ssize_t peekFromStream(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        size_t nWords,
+        std::chrono::milliseconds timeout,
+        const void** data,
+        bool* errorOccurred);
+
+    /**
+     * Releases data returned by @c peekFromStream(), with the same error checking and observer notifications as
+     * @c readFromStream().
+     *
+     * @param reader The stream reader.
+     * @param stream The stream.
+     * @param nWords The number of words to release.  This must not be more than @c peekFromStream() returned.
+     * @param[out] errorOccurred Lets caller know if there were any errors that occurred with the consume call.
+     * @return @c nWords if the words were released, or a negative @c AudioInputStream::Reader::Error code.  In the
+     *     case of @c OVERRUN, the words were overwritten while in use and the reader has been moved to the writer.
+     */
+    ssize_t consumeFromStream(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        size_t nWords,
+        bool* errorOccurred);
+
     /**
      * Checks to see if the @c audioFormat matches the platform endianness.
      *
@@ -130,6 +168,21 @@ protected:
     static bool isByteswappingRequired(avsCommon::utils::AudioFormat audioFormat);
 
 private:
+    /**
+     * Does the error checking and observer notifications for the result of a stream access.
+     *
+     * @param reader The stream reader.
+     * @param stream The stream.
+     * @param result The number of words accessed, or zero if the stream has closed, or a negative
+     *     @c AudioInputStream::Reader::Error code.
+     * @param[out] errorOccurred Lets caller know if the result was an error the caller can't recover from.
+     */
+    void checkStreamResult(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        ssize_t result,
+        bool* errorOccurred);
+
     /**
      * The observers to notify on key word detections. This should be locked with m_keyWordObserversMutex prior to
      * usage.
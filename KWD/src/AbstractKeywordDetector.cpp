@@ -94,20 +94,62 @@ ssize_t AbstractKeywordDetector::readFromStream(
     size_t nWords,
     std::chrono::milliseconds timeout,
     bool* errorOccurred) {
+    ssize_t wordsRead = reader->read(buf, nWords, timeout);
+    checkStreamResult(reader, stream, wordsRead, errorOccurred);
+    return wordsRead;
+}
+
+ssize_t AbstractKeywordDetector::peekFromStream(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    size_t nWords,
+    std::chrono::milliseconds timeout,
+    const void** data,
+    bool* errorOccurred) {
+    AudioInputStream::Reader::Regions regions;
+    ssize_t wordsRead = reader->peek(&regions, 1, timeout);
+    if (wordsRead > 0) {
+        // Only return the first region, which is contiguous; any data after the wrap is returned by the next peek.
+        if (static_cast<size_t>(wordsRead) > regions.nWords[0]) {
+            wordsRead = regions.nWords[0];
+        }
+        if (static_cast<size_t>(wordsRead) > nWords) {
+            wordsRead = nWords;
+        }
+        *data = regions.data[0];
+    }
+    checkStreamResult(reader, stream, wordsRead, errorOccurred);
+    return wordsRead;
+}
+
+ssize_t AbstractKeywordDetector::consumeFromStream(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    size_t nWords,
+    bool* errorOccurred) {
+    ssize_t wordsConsumed = reader->consume(nWords);
+    checkStreamResult(reader, stream, wordsConsumed, errorOccurred);
+    return wordsConsumed;
+}
+
+void AbstractKeywordDetector::checkStreamResult(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    ssize_t result,
+    bool* errorOccurred) {
     if (errorOccurred) {
         *errorOccurred = false;
     }
-    ssize_t wordsRead = reader->read(buf, nWords, timeout);
     // Stream has been closed
-    if (wordsRead == 0) {
+    if (result == 0) {
         ACSDK_DEBUG(LX("readFromStream").d("event", "streamClosed"));
         notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::STREAM_CLOSED);
         if (errorOccurred) {
             *errorOccurred = true;
         }
         // This represents some sort of error with the read() call
-    } else if (wordsRead < 0) {
-        switch (wordsRead) {
+    } else if (result < 0) {
+        switch (result) {
             case AudioInputStream::Reader::Error::OVERRUN:
                 ACSDK_ERROR(LX("readFromStreamFailed")
                                 .d("reason", "streamOverrun")
@@ -125,7 +167,7 @@ ssize_t AbstractKeywordDetector::readFromStream(
                 ACSDK_ERROR(LX("readFromStreamFailed")
                                 .d("reason", "unexpectedError")
                                 // Leave as ssize_t to avoid messiness of casting to enum.
-                                .d("error", wordsRead));
+                                .d("error", result));
 
                 notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ERROR);
                 if (errorOccurred) {
@@ -134,7 +176,6 @@ ssize_t AbstractKeywordDetector::readFromStream(
                 break;
         }
     }
-    return wordsRead;
 }
 
 bool AbstractKeywordDetector::isByteswappingRequired(avsCommon::utils::AudioFormat audioFormat) {
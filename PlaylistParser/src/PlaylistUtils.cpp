@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <sstream>
 
+#include <AVSCommon/AVS/Attachment/ChunkedAttachment.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserObserverInterface.h>
@@ -91,7 +92,7 @@ bool readFromContentFetcher(
         return false;
     }
 
-    auto stream = std::make_shared<InProcessAttachment>(PROCESS_ATTACHMENT_ID);
+    auto stream = std::make_shared<ChunkedAttachment>(PROCESS_ATTACHMENT_ID);
     std::shared_ptr<AttachmentWriter> streamWriter = stream->createWriter(WriterPolicy::BLOCKING);
 
     if (!contentFetcher->getBody(streamWriter)) {
@@ -15,6 +15,7 @@
 
 #include "PlaylistParser/UrlContentToAttachmentConverter.h"
 
+#include <AVSCommon/AVS/Attachment/ChunkedAttachment.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -255,7 +256,7 @@ bool UrlContentToAttachmentConverter::download(
     const std::vector<std::string>& headers,
     ByteVector* content,
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> contentFetcher) {
-    auto stream = std::make_shared<InProcessAttachment>("download:" + url);
+    auto stream = std::make_shared<ChunkedAttachment>("download:" + url);
     std::shared_ptr<AttachmentWriter> streamWriter = stream->createWriter(WriterPolicy::BLOCKING);
     if (!download(url, headers, streamWriter, contentFetcher)) {
         ACSDK_ERROR(LX("downloadFailed").d("reason", "downloadToStreamFailed"));
@@ -152,6 +152,8 @@ std::shared_future<bool> SettingEventSender::sendEvent(const std::string& jsonEv
                 case MessageRequestObserverInterface::Status::PROTOCOL_ERROR:
                 case MessageRequestObserverInterface::Status::REFUSED:
                 case MessageRequestObserverInterface::Status::INVALID_AUTH:
+                case MessageRequestObserverInterface::Status::EXPIRED:
+                case MessageRequestObserverInterface::Status::SUPERSEDED:
                     retPromise.set_value(false);
                     return retPromise.get_future();
             }
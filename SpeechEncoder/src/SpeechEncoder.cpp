@@ -15,9 +15,11 @@
 
 #include <iostream>
 #include <climits>
+#include <cstring>
 #include <fstream>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/SDS/SDSBufferPool.h>
 
 #include "SpeechEncoder/SpeechEncoder.h"
 
@@ -88,7 +90,12 @@ bool SpeechEncoder::startEncoding(
     // Setup Writer for the destination stream
     size_t size = AudioInputStream::calculateBufferSize(
         m_encoder->getOutputFrameSize() * MAX_OUTPUT_PACKETS, wordSize, MAX_READERS);
+#ifdef CUSTOM_SDS_TRAITS_CLASS
     auto buffer = std::make_shared<AudioInputStream::Buffer>(size);
+#else
+    // Drawn from the pool, so that the encoded stream of each interaction reuses the buffer of an earlier one.
+    auto buffer = sds::SDSBufferPool::getDefault()->acquire(size);
+#endif
     m_encodedStream = AudioInputStream::create(buffer, wordSize, MAX_READERS);
     if (!m_encodedStream) {
         ACSDK_ERROR(LX("startEncodingFailed").d("reason", "AudioInputStream creation failed"));
@@ -133,31 +140,68 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
 
     reader->seek(begin, reference);
 
-    size_t currentRead = 0;
     std::vector<uint8_t> readBuf(m_maxFrameSize * wordSize);
     std::vector<uint8_t> writeBuf(m_encoder->getOutputFrameSize());
 
     m_encoder->start();
     std::shared_ptr<AudioInputStream::Writer> writer =
         m_encodedStream->createWriter(AudioInputStream::Writer::Policy::BLOCKING);
+    size_t outputWordSize = writer->getWordSize();
+    size_t outputFrameWords = (m_encoder->getOutputFrameSize() + outputWordSize - 1) / outputWordSize;
     do {
         // May block here
-        auto readResult = reader->read(
-            readBuf.data() + (currentRead * wordSize),
-            m_maxFrameSize - currentRead,
-            std::chrono::milliseconds(READ_TIMEOUT_MS));
+        AudioInputStream::Reader::Regions inputRegions;
+        auto readResult = reader->peek(
+            &inputRegions, readsFull ? m_maxFrameSize : 1, std::chrono::milliseconds(READ_TIMEOUT_MS));
         if (readResult > 0) {
-            currentRead += readResult;
+            size_t currentRead = static_cast<size_t>(readResult) < m_maxFrameSize ? readResult : m_maxFrameSize;
             if (readsFull && (currentRead < m_maxFrameSize)) {
+                // The reader is closing before a full frame is available, so the partial frame is discarded.
+                reader->consume(currentRead);
                 continue;
             }
-            auto processResult = m_encoder->processSamples(readBuf.data(), currentRead, writeBuf.data());
-            if (processResult < 0) {
+
+            // Encode the samples where they are in the input stream, unless they wrap around the end of its buffer.
+            void* samples = const_cast<void*>(inputRegions.data[0]);
+            if (inputRegions.nWords[0] < currentRead) {
+                memcpy(readBuf.data(), inputRegions.data[0], inputRegions.nWords[0] * wordSize);
+                memcpy(
+                    readBuf.data() + inputRegions.nWords[0] * wordSize,
+                    inputRegions.data[1],
+                    (currentRead - inputRegions.nWords[0]) * wordSize);
+                samples = readBuf.data();
+            }
+
+            // Encode into the output stream if there is room for a whole frame before the end of its buffer.
+            AudioInputStream::Writer::Regions outputRegions;
+            uint8_t* output = writeBuf.data();
+            bool encodesInPlace = false;
+            if (writer->reserve(&outputRegions, outputFrameWords, WRITE_TIMEOUT_MS) > 0 &&
+                outputRegions.nWords[0] >= outputFrameWords) {
+                output = static_cast<uint8_t*>(outputRegions.data[0]);
+                encodesInPlace = true;
+            }
+
+            auto processResult = m_encoder->processSamples(samples, currentRead, output);
+            auto consumeResult = reader->consume(currentRead);
+            if (consumeResult < 0) {
+                ACSDK_ERROR(LX("encodeLoopFailed").d("reason", "readerError").d("error", consumeResult));
+                done = true;
+            } else if (processResult < 0) {
                 ACSDK_ERROR(LX("encodeLoopFailed").d("reason", "processSamplesFailed").d("error", processResult));
                 done = true;
+            } else if (encodesInPlace) {
+                ssize_t totalWordsToSend = processResult / outputWordSize;
+                if (totalWordsToSend > 0) {
+                    auto commitResult = writer->commit(totalWordsToSend);
+                    if (commitResult <= 0) {
+                        ACSDK_DEBUG7(LX("encodeLoopEnded").d("reason", "commitFailed").d("error", commitResult));
+                        done = true;
+                    }
+                }
             } else {
                 ssize_t writeResult = AudioInputStream::Writer::Error::INVALID;
-                ssize_t totalWordsToSend = processResult / wordSize;
+                ssize_t totalWordsToSend = processResult / outputWordSize;
                 ssize_t wordsSent = 0;
                 unsigned int writeBufIndex = 0;
 
@@ -169,7 +213,7 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
                     if (writeResult > 0) {
                         // Some words were sent, update the counters.
                         wordsSent += writeResult;
-                        writeBufIndex += writeResult * wordSize;
+                        writeBufIndex += writeResult * outputWordSize;
 
                         if (wordsSent == totalWordsToSend) {
                             // We are done sending everything.
@@ -211,7 +255,6 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
                     }
                 }
             }
-            currentRead = 0;
         } else {
             switch (readResult) {
                 case AudioInputStream::Reader::Error::OVERRUN:
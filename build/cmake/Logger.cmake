@@ -17,3 +17,48 @@ if (ACSDK_EMIT_SENSITIVE_LOGS)
         message(FATAL_ERROR "FATAL_ERROR: ACSDK_EMIT_SENSITIVE_LOGS=ON in non-DEBUG build.")
     endif()
 endif()
+
+#
+# To remove logs below a minimum severity level at compile time, include the following option on the cmake command
+# line:
+#     -DACSDK_MIN_LOG_LEVEL=<level>
+# where <level> is one of DEBUG9, DEBUG8, ... DEBUG0, INFO, WARN, ERROR, CRITICAL or NONE.
+#
+# To use a different minimum severity level for some modules (the values of ACSDK_LOG_MODULE), include:
+#     -DACSDK_MIN_LOG_LEVEL_MODULES="<module>=<level>;<module>=<level>"
+#
+
+set(ACSDK_MIN_LOG_LEVEL "" CACHE STRING "Lowest severity level of logs compiled in.")
+set(ACSDK_MIN_LOG_LEVEL_MODULES "" CACHE STRING "Lowest severity level of logs compiled in for specific modules.")
+
+# The levels, in the order of the logger::Level enumeration.
+set(ACSDK_LOG_LEVELS
+    DEBUG9 DEBUG8 DEBUG7 DEBUG6 DEBUG5 DEBUG4 DEBUG3 DEBUG2 DEBUG1 DEBUG0
+    INFO WARN ERROR CRITICAL NONE)
+
+if (ACSDK_MIN_LOG_LEVEL)
+    list(FIND ACSDK_LOG_LEVELS "${ACSDK_MIN_LOG_LEVEL}" levelIndex)
+    if (levelIndex LESS 0)
+        message(FATAL_ERROR "FATAL_ERROR: Unknown ACSDK_MIN_LOG_LEVEL ${ACSDK_MIN_LOG_LEVEL}.")
+    endif()
+    message("Logs below ${ACSDK_MIN_LOG_LEVEL} are compiled out.")
+    add_definitions(-DACSDK_MIN_LOG_LEVEL=${ACSDK_MIN_LOG_LEVEL})
+endif()
+
+if (ACSDK_MIN_LOG_LEVEL_MODULES)
+    # Logger.h looks modules up in a string of the form ",<module>=<level number>,<module>=<level number>,".
+    set(minLogLevelOverrides ",")
+    foreach(override ${ACSDK_MIN_LOG_LEVEL_MODULES})
+        if (NOT override MATCHES "^([A-Za-z0-9_]+)=([A-Z0-9]+)$")
+            message(FATAL_ERROR "FATAL_ERROR: Invalid ACSDK_MIN_LOG_LEVEL_MODULES entry ${override}.")
+        endif()
+        set(module ${CMAKE_MATCH_1})
+        list(FIND ACSDK_LOG_LEVELS "${CMAKE_MATCH_2}" levelIndex)
+        if (levelIndex LESS 0)
+            message(FATAL_ERROR "FATAL_ERROR: Unknown level in ACSDK_MIN_LOG_LEVEL_MODULES entry ${override}.")
+        endif()
+        message("Logs of module ${module} below ${CMAKE_MATCH_2} are compiled out.")
+        set(minLogLevelOverrides "${minLogLevelOverrides}${module}=${levelIndex},")
+    endforeach()
+    add_definitions("-DACSDK_MIN_LOG_LEVEL_OVERRIDES=\"${minLogLevelOverrides}\"")
+endif()
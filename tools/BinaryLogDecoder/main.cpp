@@ -0,0 +1,45 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file main.cpp
+///
+/// Prints the entries of files written by @c BinaryFileLogger in the text format of @c ConsoleLogger.
+///
+/// Usage: BinaryLogDecoder <file>...
+///
+/// Files are decoded in the order given, so pass rotated files oldest first, e.g. "sdk.bin.2 sdk.bin.1 sdk.bin".
+
+#include <cstdlib>
+#include <iostream>
+
+#include <AVSCommon/Utils/Logger/BinaryLogDecoder.h>
+
+using namespace alexaClientSDK::avsCommon::utils::logger;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+    int result = EXIT_SUCCESS;
+    for (int i = 1; i < argc; ++i) {
+        if (!BinaryLogDecoder::decodeFile(argv[i], std::cout)) {
+            std::cerr << argv[i] << ": not a binary log, or truncated" << std::endl;
+            result = EXIT_FAILURE;
+        }
+    }
+    std::cout.flush();
+    return result;
+}
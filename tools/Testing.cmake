@@ -21,6 +21,10 @@ macro(discover_unit_tests includes libraries)
             list(GET extra_macro_args 0 inputs)
         endif()
         file(GLOB_RECURSE tests RELATIVE "${CMAKE_CURRENT_SOURCE_DIR}" "${CMAKE_CURRENT_SOURCE_DIR}/*Test.cpp")
+        # Tests whose dependencies are missing are listed, relative to the test directory, in SKIPPED_UNIT_TESTS.
+        if (SKIPPED_UNIT_TESTS)
+            list(REMOVE_ITEM tests ${SKIPPED_UNIT_TESTS})
+        endif()
         foreach(testsourcefile IN LISTS tests)
             get_filename_component(testname ${testsourcefile} NAME_WE)
             add_executable(${testname} ${testsourcefile})